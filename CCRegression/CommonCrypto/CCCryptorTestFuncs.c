@@ -343,6 +343,141 @@ CCMultiCryptTestCase(char *keyStr, char *ivStr, CCAlgorithm alg, CCOptions optio
 
 
 
+#define BATCH_COPIES 4
+#define BATCH_MAXLEN 4096
+
+/*
+ * Checks each message of a batch against CCCrypt() of that message alone:
+ * the same output, or the same dataOutMoved where CCCrypt() fails too.
+ * Sets *firstError to the status the batch should have returned.
+ */
+static int
+ccBatchMatchesCCCrypt(CCOperation op, CCAlgorithm alg, CCOptions options, byteBuffer key, const void * const *ivs,
+                      const void * const *dataIn, const size_t *dataInLength, char dataOut[][BATCH_MAXLEN],
+                      const size_t *dataOutAvailable, const size_t *dataOutMoved, CCCryptorStatus *firstError)
+{
+    char expected[BATCH_MAXLEN];
+    CCCryptorStatus retval;
+    size_t moved;
+    
+    *firstError = kCCSuccess;
+    for(int i = 0; i < BATCH_COPIES; i++) {
+        retval = CCCrypt(op, alg, options, key->bytes, key->len, (ivs) ? ivs[i]: NULL,
+                         dataIn[i], dataInLength[i], expected, dataOutAvailable[i], &moved);
+        if(*firstError == kCCSuccess) *firstError = retval;
+        if(dataOutMoved[i] != moved || (retval == kCCSuccess && memcmp(dataOut[i], expected, moved))) {
+            diag("FAIL Batch %s Output %d\n", (op == kCCEncrypt) ? "Encrypt": "Decrypt", i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int
+CCBatchCryptTestCase(char *keyStr, char *ivStr, CCAlgorithm alg, CCOptions options, char *cipherText, char *plainText)
+{
+    byteBuffer key, iv;
+    byteBuffer pt, ct;
+    
+	CCCryptorStatus retval, expected;
+    char plainDataIn[BATCH_COPIES][BATCH_MAXLEN];
+    char cipherDataOut[BATCH_COPIES][BATCH_MAXLEN];
+    char plainDataOut[BATCH_COPIES][BATCH_MAXLEN];
+    uint8_t otherIV[kCCBlockSizeAES128];
+    const void *ivs[BATCH_COPIES], *dataIn[BATCH_COPIES];
+    void *dataOut[BATCH_COPIES];
+    size_t dataInLength[BATCH_COPIES], dataOutAvailable[BATCH_COPIES], dataOutMoved[BATCH_COPIES];
+    int result = 0;
+    
+    key = hexStringToBytes(keyStr);
+    pt = ccConditionalTextBuffer(plainText);
+    ct = ccConditionalTextBuffer(cipherText);
+    iv = ccConditionalTextBuffer(ivStr);
+    
+    for(size_t i = 0; i < sizeof(otherIV); i++) otherIV[i] = ((i < iv->len) ? iv->bytes[i]: 0) ^ 0xa5;
+    
+    /*
+     * The vector itself, the vector under another IV, the plaintext twice
+     * over with no IV (all zeroes), and an empty message.
+     */
+    const size_t plainLength[BATCH_COPIES] = { pt->len, pt->len, 2 * pt->len, 0 };
+    ivs[0] = iv->bytes;
+    ivs[1] = otherIV;
+    ivs[2] = NULL;
+    ivs[3] = iv->bytes;
+    memcpy(dataInLength, plainLength, sizeof(dataInLength));
+    for(int i = 0; i < BATCH_COPIES; i++) {
+        memcpy(plainDataIn[i], pt->bytes, pt->len);
+        memcpy(plainDataIn[i] + pt->len, pt->bytes, pt->len);
+        dataIn[i] = plainDataIn[i];
+        dataOut[i] = cipherDataOut[i]; dataOutAvailable[i] = BATCH_MAXLEN;
+    }
+    retval = CCCryptBatch(kCCEncrypt, alg, options, key->bytes, key->len, BATCH_COPIES, ivs, dataIn, dataInLength, dataOut, dataOutAvailable, dataOutMoved);
+    if(retval != kCCSuccess) {
+    	diag("Batch Encrypt Failed\n");
+        result = 1;
+        goto out;
+    }
+    if(ct->bytes && (dataOutMoved[0] != ct->len || memcmp(cipherDataOut[0], ct->bytes, ct->len))) {
+        diag("FAIL Batch Encrypt Output does not match the vector\n");
+        result = 1;
+        goto out;
+    }
+    if((result = ccBatchMatchesCCCrypt(kCCEncrypt, alg, options, key, ivs, dataIn, dataInLength, cipherDataOut, dataOutAvailable, dataOutMoved, &expected)) != 0) goto out;
+    
+    for(int i = 0; i < BATCH_COPIES; i++) {
+        dataIn[i] = cipherDataOut[i]; dataInLength[i] = dataOutMoved[i];
+        dataOut[i] = plainDataOut[i];
+    }
+    retval = CCCryptBatch(kCCDecrypt, alg, options, key->bytes, key->len, BATCH_COPIES, ivs, dataIn, dataInLength, dataOut, dataOutAvailable, dataOutMoved);
+    if(retval != kCCSuccess) {
+    	diag("Batch Decrypt Failed\n");
+        result = 1;
+        goto out;
+    }
+    if((result = ccBatchMatchesCCCrypt(kCCDecrypt, alg, options, key, ivs, dataIn, dataInLength, plainDataOut, dataOutAvailable, dataOutMoved, &expected)) != 0) goto out;
+    for(int i = 0; i < BATCH_COPIES; i++) {
+        if(dataOutMoved[i] != plainLength[i] || memcmp(plainDataOut[i], plainDataIn[i], plainLength[i])) {
+            diag("FAIL Batch Decrypt Output %d\n", i);
+            result = 1;
+            goto out;
+        }
+    }
+    
+    /* No IV array at all is the same as every IV NULL */
+    for(int i = 0; i < BATCH_COPIES; i++) {
+        dataIn[i] = plainDataIn[i];
+        dataOut[i] = cipherDataOut[i];
+    }
+    memcpy(dataInLength, plainLength, sizeof(dataInLength));
+    retval = CCCryptBatch(kCCEncrypt, alg, options, key->bytes, key->len, BATCH_COPIES, NULL, dataIn, dataInLength, dataOut, dataOutAvailable, dataOutMoved);
+    if(retval != kCCSuccess) {
+    	diag("Batch Encrypt with no IVs Failed\n");
+        result = 1;
+        goto out;
+    }
+    if((result = ccBatchMatchesCCCrypt(kCCEncrypt, alg, options, key, NULL, dataIn, dataInLength, cipherDataOut, dataOutAvailable, dataOutMoved, &expected)) != 0) goto out;
+    
+    /* One short output fails only that message, and reports the size it needs */
+    CCCrypt(kCCEncrypt, alg, options, key->bytes, key->len, NULL, dataIn[2], dataInLength[2], NULL, 0, &dataOutAvailable[2]);
+    dataOutAvailable[2]--;
+    memset(dataOutMoved, 0, sizeof(dataOutMoved));
+    retval = CCCryptBatch(kCCEncrypt, alg, options, key->bytes, key->len, BATCH_COPIES, ivs, dataIn, dataInLength, dataOut, dataOutAvailable, dataOutMoved);
+    if((result = ccBatchMatchesCCCrypt(kCCEncrypt, alg, options, key, ivs, dataIn, dataInLength, cipherDataOut, dataOutAvailable, dataOutMoved, &expected)) != 0) goto out;
+    if(retval != expected || retval != kCCBufferTooSmall || dataOutMoved[2] != dataOutAvailable[2] + 1) {
+        diag("FAIL Batch with a short output returned %d\n", retval);
+        result = 1;
+        goto out;
+    }
+    
+out:
+    free(pt);
+    free(ct);
+    free(key);
+    free(iv);
+	return result;
+}
+
 int
 CCModeTestCase(char *keyStr, char *ivStr, CCMode mode, CCAlgorithm alg, CCPadding padding, char *cipherText, char *plainText)
 #ifdef CRYPTORWITHMODE
@@ -53,6 +53,10 @@ CCCryptTestCase(char *keyStr, char *ivStr, CCAlgorithm alg, CCOptions options, c
 int
 CCMultiCryptTestCase(char *keyStr, char *ivStr, CCAlgorithm alg, CCOptions options, char *cipherText, char *plainText);
 
+/* This is a Test Case "doer" using CCCryptBatch over variants of the message, checked against CCCrypt */
+int
+CCBatchCryptTestCase(char *keyStr, char *ivStr, CCAlgorithm alg, CCOptions options, char *cipherText, char *plainText);
+
 /* This is a Test Case "doer" using CCCryptWithMode */
 int
 CCModeTestCase(char *keyStr, char *ivStr, CCMode mode, CCAlgorithm alg, CCPadding padding, char *cipherText, char *plainText);
@@ -21,7 +21,7 @@
 entryPoint(CommonCryptoReset,"CommonCrypto Reset Testing")
 #else
 
-static int kTestTestCount = 35;
+static int kTestTestCount = 42;
 
 static CCCryptorStatus CommonCryptoReset_mode(CCMode mode, CCCryptorStatus rv, CCOptions options)
 {
@@ -119,6 +119,44 @@ static int CommonCryptoReset_before_10_13(void)
     return kCCSuccess;
 }
 
+static int CommonCryptoReset_clone(void)
+{
+    CCCryptorRef tmpl, cref, cref2;
+    CCCryptorStatus retval;
+    size_t moved;
+    uint8_t key[16] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+    uint8_t plain[16] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+    uint8_t iv[16] = { 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00 };
+    uint8_t cipher1[32], cipher2[32], cipher3[16];
+    
+    retval = CCCryptorCreateWithMode(kCCEncrypt, kCCModeCBC, kCCAlgorithmAES128, ccNoPadding, iv, key, 16, NULL, 0, 0, 0, &tmpl);
+    ok(retval == kCCSuccess, "template cryptor created");
+    retval = CCCryptorUpdate(tmpl, plain, 16, cipher1, 16, &moved);
+    retval |= CCCryptorUpdate(tmpl, plain, 16, cipher1 + 16, 16, &moved);
+    ok(retval == kCCSuccess, "template encrypts");
+    retval = CCCryptorReset(tmpl, NULL);
+    ok(retval == kCCSuccess, "template reset");
+    
+    /* A clone given the same IV reproduces the template's output */
+    retval = CCCryptorClone(tmpl, &cref);
+    ok(retval == kCCSuccess, "cryptor cloned");
+    retval = CCCryptorReset(cref, iv);
+    retval |= CCCryptorUpdate(cref, plain, 16, cipher2, 16, &moved);
+    ok(retval == kCCSuccess && memcmp(cipher1, cipher2, 16) == 0, "clone crypt should match the template");
+    
+    /* A clone taken mid-stream carries the chaining state with it */
+    retval = CCCryptorClone(cref, &cref2);
+    retval |= CCCryptorUpdate(cref, plain, 16, cipher2 + 16, 16, &moved);
+    retval |= CCCryptorUpdate(cref2, plain, 16, cipher3, 16, &moved);
+    ok(retval == kCCSuccess && memcmp(cipher1 + 16, cipher2 + 16, 16) == 0 && memcmp(cipher1 + 16, cipher3, 16) == 0,
+       "clone continues the chain");
+    
+    CCCryptorRelease(cref2);
+    CCCryptorRelease(cref);
+    CCCryptorRelease(tmpl);
+    return kCCSuccess;
+}
+
 //to test behavior for macOS prior to 10.13, add "-Wl,-sdk_version,10.12" to Other Linker Flags
 int CommonCryptoReset(int __unused argc, char *const * __unused argv)
 {
@@ -132,6 +170,9 @@ int CommonCryptoReset(int __unused argc, char *const * __unused argv)
         ok(rc == kCCSuccess, "CCCryptorReset() for CTR");
     }
     rc = CommonCryptoReset_before_10_13(); ok(rc == kCCSuccess, "CCCryptorReset() before macos 10.13");
+    if(ProgramLinkedOnOrAfter_macOS1013_iOS11()){
+        rc = CommonCryptoReset_clone(); ok(rc == kCCSuccess, "CCCryptorClone()");
+    }
     return kCCSuccess;
     
 }
@@ -37,7 +37,7 @@ entryPoint(CommonCryptoSymCBC,"CommonCrypto Symmetric CBC Testing")
 #else
 
 
-static int kTestTestCount = 31;
+static int kTestTestCount = 33;
 
 int CommonCryptoSymCBC(int __unused argc, char *const * __unused argv) {
 	char *keyStr;
@@ -66,6 +66,9 @@ int CommonCryptoSymCBC(int __unused argc, char *const * __unused argv) {
     accum |= retval;
     retval = CCMultiCryptTestCase(keyStr, iv, alg, options, cipherText, plainText);
     ok(retval == 0, "CBC with Padding 1 byte Multiple Updates");
+    accum |= retval;
+    retval = CCBatchCryptTestCase(keyStr, iv, alg, options, cipherText, plainText);
+    ok(retval == 0, "CBC with Padding 1 byte Batch");
     accum |= retval;
 
 	// 15
@@ -221,6 +224,9 @@ int CommonCryptoSymCBC(int __unused argc, char *const * __unused argv) {
     retval = CCMultiCryptTestCase(keyStr, iv, alg, options, cipherText, plainText);
     ok(retval == 0, "CBC-blowfish vector 1");
     accum |= retval;
+    retval = CCBatchCryptTestCase(keyStr, iv, alg, options, cipherText, plainText);
+    ok(retval == 0, "CBC-blowfish vector 1 Batch");
+    accum |= retval;
 
     
     return accum != 0;
@@ -37,7 +37,7 @@ entryPoint(CommonCryptoSymECB,"CommonCrypto Symmetric ECB Testing")
 #else
 
 
-static int kTestTestCount = 4;
+static int kTestTestCount = 7;
 
 int CommonCryptoSymECB(int __unused argc, char *const * __unused argv) {
 	char *keyStr;
@@ -77,6 +77,20 @@ int CommonCryptoSymECB(int __unused argc, char *const * __unused argv) {
     retval = CCMultiCryptTestCase(keyStr, iv, alg, options, cipherText, plainText);
     ok(retval == 0, "ECB 32 byte Multiple Updates NULL IV");
     accum |= retval;
+    retval = CCBatchCryptTestCase(keyStr, iv, alg, options, cipherText, plainText);
+    ok(retval == 0, "ECB 32 byte Batch NULL IV");
+    accum |= retval;
+    retval = CCBatchCryptTestCase(keyStr, iv, alg, options | kCCOptionPKCS7Padding, NULL, plainText);
+    ok(retval == 0, "ECB with Padding 32 byte Batch NULL IV");
+    accum |= retval;
+
+    // RC4 takes no IV either (RFC 6229, 40-bit key)
+    keyStr     = "0102030405";
+    plainText  = "00000000000000000000000000000000";
+    cipherText = "b2396305f03dc027ccc3524a0a1118a8";
+    retval = CCBatchCryptTestCase(keyStr, iv, kCCAlgorithmRC4, 0, cipherText, plainText);
+    ok(retval == 0, "RC4 16 byte Batch");
+    accum |= retval;
 
     return accum != 0;
 }
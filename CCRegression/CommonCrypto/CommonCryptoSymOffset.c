@@ -27,6 +27,9 @@
  */
 
 #include <stdio.h>
+#if !defined(_WIN32)
+#include <sys/uio.h>
+#endif
 #include <CommonCrypto/CommonCryptor.h>
 #include <CommonCrypto/CommonCryptorSPI.h>
 #include "testbyteBuffer.h"
@@ -43,7 +46,170 @@ entryPoint(CommonCryptoSymOffset,"CommonCrypto Symmetric Unaligned Testing")
 #define ALITTLEONTHESIDE 5
 
 
-static int kTestTestCount = ALITTLEONTHESIDE * 3;
+#define UPDATEV_TESTS 9
+
+static int kTestTestCount = ALITTLEONTHESIDE * 3 + UPDATEV_TESTS;
+
+#if !defined(_WIN32)
+/*
+ * An Update of "first" bytes followed by two UpdateV calls, each over four
+ * elements (zero lengths included), then Final.  Compared step by step with
+ * the same input fed through CCCryptorUpdate.
+ */
+typedef struct {
+    const char      *label;
+    CCOperation     op;
+    CCPadding       padding;
+    size_t          first;
+    size_t          v1[4];
+    size_t          v2[4];
+} updateVCase;
+
+static const updateVCase updateVCases[] = {
+    { "UpdateV starts on buffered bytes", kCCEncrypt, ccPKCS7Padding, 5, { 11, 0, 40, 9 }, { 0, 0, 0, 0 } },
+    { "UpdateV holds an unaligned tail", kCCEncrypt, ccNoPadding, 0, { 7, 0, 13, 5 }, { 3, 4, 0, 0 } },
+    { "UpdateV PKCS7 decrypt reserve", kCCDecrypt, ccPKCS7Padding, 10, { 1, 0, 3, 0 }, { 18, 0, 9, 7 } },
+    { "UpdateV CTS encrypt reserve", kCCEncrypt, ccCBCCTS3, 20, { 9, 0, 1, 0 }, { 5, 0, 14, 2 } },
+    { "UpdateV CTS decrypt reserve", kCCDecrypt, ccCBCCTS3, 20, { 9, 0, 1, 0 }, { 5, 0, 14, 2 } },
+};
+
+static size_t
+sumPieces(const size_t *pieces)
+{
+    return pieces[0] + pieces[1] + pieces[2] + pieces[3];
+}
+
+static CCCryptorStatus
+createCBC(CCOperation op, CCPadding padding, byteBuffer key, CCCryptorRef *cryptor)
+{
+    return CCCryptorCreateWithMode(op, kCCModeCBC, kCCAlgorithmAES, padding, NULL, key->bytes, key->len, NULL, 0, 0, 0, cryptor);
+}
+
+/* Lays pieces over buf as iovecs; returns the bytes covered */
+static size_t
+fillIOV(struct iovec *iov, const size_t *pieces, uint8_t *buf)
+{
+    size_t off = 0;
+    for(int i = 0; i < 4; i++) {
+        iov[i].iov_base = buf + off;
+        iov[i].iov_len = pieces[i];
+        off += pieces[i];
+    }
+    return off;
+}
+
+static int
+doUpdateVCase(const updateVCase *tc, byteBuffer key, uint8_t *plain)
+{
+    uint8_t input[128], expected[256], got[256];
+    size_t total = tc->first + sumPieces(tc->v1) + sumPieces(tc->v2);
+    size_t in1 = tc->first, in2 = in1 + sumPieces(tc->v1);
+    size_t eMoved[4], gMoved[4], eLen = 0, gLen = 0, moved;
+    size_t outPieces[4] = { 3, 0, 29, 0 };
+    struct iovec in[4], out[4];
+    CCCryptorRef cryptor;
+    CCCryptorStatus retval;
+    
+    /* Decrypt cases need a well formed ciphertext of exactly total bytes */
+    if(tc->op == kCCDecrypt) {
+        size_t plainLen = (tc->padding == ccPKCS7Padding) ? total - kCCBlockSizeAES128: total;
+        retval = createCBC(kCCEncrypt, tc->padding, key, &cryptor);
+        retval |= CCCryptorUpdate(cryptor, plain, plainLen, input, sizeof(input), &moved);
+        retval |= CCCryptorFinal(cryptor, input + moved, sizeof(input) - moved, &moved);
+        CCCryptorRelease(cryptor);
+        if(retval) return 1;
+    } else {
+        memcpy(input, plain, total);
+    }
+    
+    retval = createCBC(tc->op, tc->padding, key, &cryptor);
+    retval |= CCCryptorUpdate(cryptor, input, in1, expected, sizeof(expected), &eMoved[0]); eLen += eMoved[0];
+    retval |= CCCryptorUpdate(cryptor, input + in1, in2 - in1, expected + eLen, sizeof(expected) - eLen, &eMoved[1]); eLen += eMoved[1];
+    retval |= CCCryptorUpdate(cryptor, input + in2, total - in2, expected + eLen, sizeof(expected) - eLen, &eMoved[2]); eLen += eMoved[2];
+    retval |= CCCryptorFinal(cryptor, expected + eLen, sizeof(expected) - eLen, &eMoved[3]); eLen += eMoved[3];
+    CCCryptorRelease(cryptor);
+    
+    retval |= createCBC(tc->op, tc->padding, key, &cryptor);
+    retval |= CCCryptorUpdate(cryptor, input, in1, got, sizeof(got), &gMoved[0]); gLen += gMoved[0];
+    fillIOV(in, tc->v1, input + in1);
+    outPieces[3] = sizeof(got) - gLen - 32;
+    fillIOV(out, outPieces, got + gLen);
+    retval |= CCCryptorUpdateV(cryptor, in, 4, out, 4, &gMoved[1]); gLen += gMoved[1];
+    fillIOV(in, tc->v2, input + in2);
+    outPieces[3] = sizeof(got) - gLen - 32;
+    fillIOV(out, outPieces, got + gLen);
+    retval |= CCCryptorUpdateV(cryptor, in, 4, out, 4, &gMoved[2]); gLen += gMoved[2];
+    retval |= CCCryptorFinal(cryptor, got + gLen, sizeof(got) - gLen, &gMoved[3]); gLen += gMoved[3];
+    CCCryptorRelease(cryptor);
+    
+    ok(retval == kCCSuccess && memcmp(eMoved, gMoved, sizeof(eMoved)) == 0 &&
+       eLen == gLen && memcmp(expected, got, eLen) == 0, tc->label);
+    return retval != kCCSuccess;
+}
+
+/* A short output chain is refused up front and leaves the cryptor untouched */
+static int
+doUpdateVTooSmall(byteBuffer key, uint8_t *plain)
+{
+    uint8_t expected[128], got[128];
+    size_t eMoved, gMoved, needed;
+    size_t inPieces[4] = { 13, 0, 30, 17 };
+    size_t outPieces[4] = { 40, 0, 23, 0 };
+    struct iovec in[4], out[4];
+    CCCryptorRef cryptor;
+    CCCryptorStatus retval, tooSmall;
+    
+    retval = createCBC(kCCEncrypt, ccPKCS7Padding, key, &cryptor);
+    retval |= CCCryptorUpdate(cryptor, plain, 5, expected, sizeof(expected), &eMoved);
+    retval |= CCCryptorUpdate(cryptor, plain + 5, 60, expected, sizeof(expected), &eMoved);
+    CCCryptorRelease(cryptor);
+    
+    retval |= createCBC(kCCEncrypt, ccPKCS7Padding, key, &cryptor);
+    retval |= CCCryptorUpdate(cryptor, plain, 5, got, sizeof(got), &gMoved);
+    needed = CCCryptorGetOutputLength(cryptor, 60, false);
+    fillIOV(in, inPieces, plain + 5);
+    fillIOV(out, outPieces, got);
+    tooSmall = CCCryptorUpdateV(cryptor, in, 4, out, 4, &gMoved);
+    ok(tooSmall == kCCBufferTooSmall && gMoved == needed && needed == 64, "UpdateV reports the output size it needs");
+    
+    outPieces[3] = 1;
+    fillIOV(out, outPieces, got);
+    retval |= CCCryptorUpdateV(cryptor, in, 4, out, 4, &gMoved);
+    CCCryptorRelease(cryptor);
+    ok(retval == kCCSuccess && gMoved == eMoved && memcmp(expected, got, eMoved) == 0, "UpdateV retry after kCCBufferTooSmall");
+    return retval != kCCSuccess;
+}
+#endif
+
+/* The same data through CCCryptorUpdateV, fragmented off block boundaries */
+static int
+doUpdateV(byteBuffer key, uint8_t *iLikeBigBuffs, uint8_t *andICannotLie, uint8_t *iLikeEmRoundandBig)
+{
+#if defined(_WIN32)
+    test_skip("no struct iovec on this platform", UPDATEV_TESTS, 0);
+    return 0;
+#else
+    CCCryptorRef cryptor;
+    CCCryptorStatus retval;
+    size_t moved, moved2;
+    struct iovec in[5] = {
+        { iLikeBigBuffs, 7 }, { iLikeBigBuffs+7, 16 }, { iLikeBigBuffs+23, 33 }, { iLikeBigBuffs+56, 1 },
+        { iLikeBigBuffs+57, ILIKEEMDISBIG-16-57 } };
+    struct iovec out[3] = {
+        { iLikeEmRoundandBig, 5 }, { iLikeEmRoundandBig+5, 100 }, { iLikeEmRoundandBig+105, ILIKEEMDISBIG-105 } };
+    retval = CCCrypt(kCCEncrypt, kCCAlgorithmAES128, 0, key->bytes, key->len, NULL, iLikeBigBuffs, ILIKEEMDISBIG-16, andICannotLie, ILIKEEMDISBIG, &moved);
+    retval |= CCCryptorCreate(kCCEncrypt, kCCAlgorithmAES128, 0, key->bytes, key->len, NULL, &cryptor);
+    retval |= CCCryptorUpdateV(cryptor, in, 5, out, 3, &moved2);
+    ok(retval == 0 && moved2 == moved, "UpdateV worked");
+    ok(memcmp(andICannotLie, iLikeEmRoundandBig, moved) == 0, "UpdateV matches CCCrypt");
+    CCCryptorRelease(cryptor);
+    
+    for(size_t i = 0; i < sizeof(updateVCases) / sizeof(updateVCases[0]); i++)
+        retval |= doUpdateVCase(&updateVCases[i], key, iLikeBigBuffs);
+    retval |= doUpdateVTooSmall(key, iLikeBigBuffs);
+    return retval != 0;
+#endif
+}
 
 
 int CommonCryptoSymOffset(int __unused argc, char *const * __unused argv) {
@@ -70,6 +236,8 @@ int CommonCryptoSymOffset(int __unused argc, char *const * __unused argv) {
         ok(retval == 0, "Encrypt/Decrypt Cycle");
         accum += retval;
     }
+    
+    accum += doUpdateV(key, iLikeBigBuffs, andICannotLie, iLikeEmRoundandBig);
     free(key);
     return accum != 0;
 }
@@ -8,6 +8,7 @@
 
 #include <stdio.h>
 #include <CommonCrypto/CommonCryptor.h>
+#include <CommonCrypto/CommonCryptorSPI.h>
 #include "testbyteBuffer.h"
 #include "testmore.h"
 #include "capabilities.h"
@@ -17,7 +18,75 @@ entryPoint(CommonCryptoWithData,"CommonCrypto With Data Testing")
 #else
 #define AES_KEYST_SIZE    (kCCContextSizeAES128 + 8)
 
-static int kTestTestCount = 1;
+static int kTestTestCount = 12;
+
+/*
+ * ECB and CBC cryptors key the direction they were not created for on
+ * first use through CCCryptor{En,De}cryptDataBlock.
+ */
+static void
+lazyDirectionTests(byteBuffer key, byteBuffer pt, byteBuffer ct)
+{
+    CCCryptorStatus retval;
+    CCCryptorRef cryptor, clone;
+    byteBuffer iv = hexStringToBytes("000102030405060708090a0b0c0d0e0f");
+    byteBuffer cbc = hexStringToBytes("7649abac8119b246cee98e9b12e9197d");
+    unsigned char out[16], chained[16];
+    size_t moved = 0;
+    
+    retval = CCCryptorCreateWithMode(kCCEncrypt, kCCModeECB, kCCAlgorithmAES, ccNoPadding, NULL, key->bytes, key->len, NULL, 0, 0, 0, &cryptor);
+    retval |= CCCryptorDecryptDataBlock(cryptor, NULL, ct->bytes, ct->len, out);
+    ok(retval == kCCSuccess && memcmp(out, pt->bytes, 16) == 0, "ECB encryptor decrypts a block");
+    
+    /* The clone gets its own copy of the opposite direction */
+    retval = CCCryptorClone(cryptor, &clone);
+    CCCryptorRelease(cryptor);
+    memset(out, 0, sizeof(out));
+    retval |= CCCryptorDecryptDataBlock(clone, NULL, ct->bytes, ct->len, out);
+    retval |= CCCryptorUpdate(clone, pt->bytes, pt->len, chained, sizeof(chained), &moved);
+    ok(retval == kCCSuccess && memcmp(out, pt->bytes, 16) == 0 && memcmp(chained, ct->bytes, 16) == 0,
+       "Clone taken after the opposite direction was keyed");
+    CCCryptorRelease(clone);
+    
+    retval = CCCryptorCreateWithMode(kCCDecrypt, kCCModeECB, kCCAlgorithmAES, ccNoPadding, NULL, key->bytes, key->len, NULL, 0, 0, 0, &cryptor);
+    retval |= CCCryptorEncryptDataBlock(cryptor, NULL, pt->bytes, pt->len, out);
+    ok(retval == kCCSuccess && memcmp(out, ct->bytes, 16) == 0, "ECB decryptor encrypts a block");
+    CCCryptorRelease(cryptor);
+    
+    /* The opposite direction starts from the IV the cryptor was created with */
+    retval = CCCryptorCreateWithMode(kCCEncrypt, kCCModeCBC, kCCAlgorithmAES, ccNoPadding, iv->bytes, key->bytes, key->len, NULL, 0, 0, 0, &cryptor);
+    retval |= CCCryptorUpdate(cryptor, pt->bytes, pt->len, chained, sizeof(chained), &moved);
+    retval |= CCCryptorDecryptDataBlock(cryptor, NULL, cbc->bytes, cbc->len, out);
+    ok(retval == kCCSuccess && memcmp(chained, cbc->bytes, 16) == 0 && memcmp(out, pt->bytes, 16) == 0,
+       "CBC encryptor decrypts a block");
+    CCCryptorRelease(cryptor);
+    
+    retval = CCCryptorCreateWithMode(kCCDecrypt, kCCModeCBC, kCCAlgorithmAES, ccNoPadding, iv->bytes, key->bytes, key->len, NULL, 0, 0, 0, &cryptor);
+    retval |= CCCryptorEncryptDataBlock(cryptor, NULL, pt->bytes, pt->len, out);
+    retval |= CCCryptorUpdate(cryptor, cbc->bytes, cbc->len, chained, sizeof(chained), &moved);
+    ok(retval == kCCSuccess && memcmp(out, cbc->bytes, 16) == 0 && memcmp(chained, pt->bytes, 16) == 0,
+       "CBC decryptor encrypts a block");
+    CCCryptorRelease(cryptor);
+    
+    /* In caller memory the opposite direction is still allocated, and released with the cryptor */
+    size_t arenaSize = CCCryptorGetContextSize(kCCEncrypt, kCCModeECB, kCCAlgorithmAES);
+    unsigned char *arena = malloc(arenaSize);
+    retval = CCCryptorCreateFromDataWithMode(kCCEncrypt, kCCModeECB, kCCAlgorithmAES, ccNoPadding, NULL, key->bytes, key->len, NULL, 0, 0, 0,
+                                             arena, arenaSize, &cryptor, NULL);
+    retval |= CCCryptorDecryptDataBlock(cryptor, NULL, ct->bytes, ct->len, out);
+    ok(retval == kCCSuccess && memcmp(out, pt->bytes, 16) == 0, "In-place encryptor decrypts a block");
+    CCCryptorRelease(cryptor);
+    
+    retval = CCCryptorCreateFromDataWithMode(kCCEncrypt, kCCModeECB, kCCAlgorithmAES, ccNoPadding, NULL, key->bytes, key->len, NULL, 0, 0, 0,
+                                             arena, arenaSize, &cryptor, NULL);
+    retval |= CCCryptorUpdate(cryptor, pt->bytes, pt->len, out, sizeof(out), &moved);
+    ok(retval == kCCSuccess && memcmp(out, ct->bytes, 16) == 0, "Caller memory is reusable after release");
+    CCCryptorRelease(cryptor);
+    
+    free(arena);
+    free(cbc);
+    free(iv);
+}
 
 int CommonCryptoWithData(int __unused argc, char *const * __unused argv)
 {
@@ -35,6 +104,35 @@ int CommonCryptoWithData(int __unused argc, char *const * __unused argv)
 
     CCCryptorRelease(cryptor);
     ok(retval == kCCSuccess, "Cryptor was created");
+
+    /* Memory sized by CCCryptorGetContextSize holds the whole cryptor */
+    size_t arenaSize = CCCryptorGetContextSize(kCCEncrypt, kCCModeECB, kCCAlgorithmAES128);
+    unsigned char *arena = malloc(arenaSize + 1);
+    size_t used = 0;
+    ok(arenaSize != 0, "Context size is known");
+    retval = CCCryptorCreateFromData(kCCEncrypt, kCCAlgorithmAES128,
+                                     kCCOptionECBMode, key->bytes, key->len, NULL,
+                                     arena + 1, arenaSize, &cryptor, &used);
+    ok(retval == kCCSuccess && (unsigned char *) cryptor > arena && (unsigned char *) cryptor < arena + 1 + used && used <= arenaSize,
+       "Cryptor was built in caller memory");
+
+    byteBuffer pt = hexStringToBytes("6bc1bee22e409f96e93d7e117393172a");
+    byteBuffer ct = hexStringToBytes("3ad77bb40d7a3660a89ecaf32466ef97");
+    unsigned char out[16];
+    size_t moved = 0;
+    retval = CCCryptorUpdate(cryptor, pt->bytes, pt->len, out, sizeof(out), &moved);
+    ok(retval == kCCSuccess && moved == 16 && memcmp(out, ct->bytes, 16) == 0, "In-place cryptor encrypts");
+    CCCryptorRelease(cryptor);
+
+    retval = CCCryptorCreateFromData(kCCEncrypt, kCCAlgorithmAES128,
+                                     kCCOptionECBMode, key->bytes, key->len, NULL,
+                                     arena, 2, &cryptor, &used);
+    ok(retval == kCCBufferTooSmall, "Tiny buffer is refused");
+    free(arena);
+
+    lazyDirectionTests(key, pt, ct);
+    free(pt);
+    free(ct);
     free(key);
     return 0;
 }
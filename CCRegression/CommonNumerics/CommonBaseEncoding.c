@@ -13,8 +13,12 @@ entryPoint(CommonBaseEncoding,"Base XX Encoding")
 #else
 
 #include <CommonNumerics/CommonBaseXX.h>
+#include <CommonNumerics/CommonCRC.h>
+#if !defined(_WIN32)
+#include <sys/uio.h>
+#endif
 
-static int kTestTestCount = 416;
+static int kTestTestCount = 476;
 
 #define BUFSIZE 1024
 
@@ -152,6 +156,197 @@ doOneShotStyle(CNEncodings encodingStrat, char *input, char *expected)
     return 0;    
 }
 
+
+static int
+doLineOptions(CNEncodings encodingStrat, size_t lineWidth, char *input, char *expected)
+{
+    CNStatus retval;
+    CNEncoderRef coder;
+    char outBuf[BUFSIZE], secondBuf[BUFSIZE];
+    size_t outLen, outAvailable, pos, chunk;
+    
+    retval = CNEncoderCreateWithOptions(encodingStrat, kCNEncode, 0, lineWidth, &coder);
+    ok(retval == kCNSuccess, "got a line breaking encoder");
+    
+    // Feed odd sized pieces so groups straddle both calls and lines.
+    for(outLen = pos = 0; pos < strlen(input); pos += chunk) {
+        chunk = strlen(input) - pos < 7 ? strlen(input) - pos : 7;
+        outAvailable = BUFSIZE - outLen;
+        retval = CNEncoderUpdate(coder, &input[pos], chunk, &outBuf[outLen], &outAvailable);
+        if(retval) break;
+        outLen += outAvailable;
+    }
+    ok(retval == kCNSuccess, "encoded");
+    outAvailable = BUFSIZE - outLen;
+    retval = CNEncoderFinal(coder, &outBuf[outLen], &outAvailable);
+    ok(retval == kCNSuccess, "finalized");
+    outLen += outAvailable;
+    ok(outLen == strlen(expected) && strncmp(expected, outBuf, outLen) == 0, "output matches");
+    CNEncoderRelease(&coder);
+    
+    retval = CNEncoderCreateWithOptions(encodingStrat, kCNDecode, kCNDecodeIgnoreWhitespace, 0, &coder);
+    ok(retval == kCNSuccess, "got a whitespace skipping decoder");
+    
+    for(outLen = pos = 0; pos < strlen(expected); pos += chunk) {
+        chunk = strlen(expected) - pos < 5 ? strlen(expected) - pos : 5;
+        outAvailable = BUFSIZE - outLen;
+        retval = CNEncoderUpdate(coder, &expected[pos], chunk, &secondBuf[outLen], &outAvailable);
+        if(retval) break;
+        outLen += outAvailable;
+    }
+    ok(retval == kCNSuccess, "decoded");
+    outAvailable = BUFSIZE - outLen;
+    retval = CNEncoderFinal(coder, &secondBuf[outLen], &outAvailable);
+    outLen += outAvailable;
+    ok(retval == kCNSuccess && outLen == strlen(input) && strncmp(input, secondBuf, outLen) == 0, "output matches");
+    CNEncoderRelease(&coder);
+    
+    ok(CNEncoderCreateWithOptions(encodingStrat, kCNEncode, kCNDecodeIgnoreWhitespace, 0, &coder) == kCNParamError, "whitespace option is decode only");
+    ok(CNEncoderCreateWithOptions(encodingStrat, kCNDecode, 0, lineWidth, &coder) == kCNParamError, "line width is encode only");
+    
+    return 0;
+}
+
+static int
+doArmor(size_t lineWidth, char *input, char *expected)
+{
+    CNStatus retval;
+    CNEncoderRef coder;
+    char outBuf[BUFSIZE];
+    size_t outLen, outAvailable, pos, chunk;
+    
+    retval = CNEncoderCreateWithOptions(kCNEncodingBase64, kCNEncode, kCNEncodeArmorChecksum, lineWidth, &coder);
+    ok(retval == kCNSuccess, "got an armor encoder");
+    
+    for(outLen = pos = 0; pos < strlen(input); pos += chunk) {
+        chunk = strlen(input) - pos < 7 ? strlen(input) - pos : 7;
+        outAvailable = BUFSIZE - outLen;
+        retval = CNEncoderUpdate(coder, &input[pos], chunk, &outBuf[outLen], &outAvailable);
+        if(retval) break;
+        outLen += outAvailable;
+    }
+    ok(retval == kCNSuccess, "encoded");
+    outAvailable = BUFSIZE - outLen;
+    retval = CNEncoderFinal(coder, &outBuf[outLen], &outAvailable);
+    outLen += outAvailable;
+    ok(retval == kCNSuccess && outLen == strlen(expected) && strncmp(expected, outBuf, outLen) == 0, "output matches");
+    CNEncoderRelease(&coder);
+    
+    ok(CNEncoderCreateWithOptions(kCNEncodingBase32, kCNEncode, kCNEncodeArmorChecksum, lineWidth, &coder) == kCNParamError &&
+       CNEncoderCreateWithOptions(kCNEncodingBase64, kCNEncode, kCNEncodeArmorChecksum, 0, &coder) == kCNParamError, "armor is line broken Base64 only");
+    
+    return 0;
+}
+
+static int
+doArmorLarge(void)
+{
+    // Larger than one checksum slice; the body must match the plain line
+    // encoder and the checksum CNCRC over the whole input.
+    size_t len = 100000, bodyLen, armorLen, crcLen = 5;
+    uint8_t *buf = malloc(len), crcBytes[3];
+    char *body, *armor, crcChars[5];
+    uint64_t crc = 0;
+    CNEncoderRef coder;
+    int good = 1;
+    
+    for(size_t i=0; i<len; i++) buf[i] = (uint8_t) (i * 7 + (i >> 9));
+    
+    CNEncoderCreateWithOptions(kCNEncodingBase64, kCNEncode, 0, 64, &coder);
+    bodyLen = CNEncoderGetOutputLength(coder, len);
+    body = malloc(bodyLen);
+    good &= CNEncoderUpdate(coder, buf, len, body, &bodyLen) == kCNSuccess;
+    size_t tail = CNEncoderGetOutputLength(coder, 0);
+    good &= CNEncoderFinal(coder, body + bodyLen, &tail) == kCNSuccess;
+    bodyLen += tail;
+    CNEncoderRelease(&coder);
+    
+    CNEncoderCreateWithOptions(kCNEncodingBase64, kCNEncode, kCNEncodeArmorChecksum, 64, &coder);
+    armorLen = CNEncoderGetOutputLength(coder, len);
+    armor = malloc(armorLen);
+    good &= CNEncoderUpdate(coder, buf, len, armor, &armorLen) == kCNSuccess;
+    tail = CNEncoderGetOutputLength(coder, 0);
+    good &= CNEncoderFinal(coder, armor + armorLen, &tail) == kCNSuccess;
+    armorLen += tail;
+    CNEncoderRelease(&coder);
+    
+    CNCRC(kCN_CRC_24_OPENPGP, buf, len, &crc);
+    crcBytes[0] = (uint8_t) (crc >> 16);
+    crcBytes[1] = (uint8_t) (crc >> 8);
+    crcBytes[2] = (uint8_t) crc;
+    CNEncode(kCNEncodingBase64, kCNEncode, crcBytes, 3, crcChars, &crcLen);
+    
+    ok(good && armorLen == bodyLen + 6 && memcmp(armor, body, bodyLen) == 0 &&
+       armor[bodyLen] == '=' && memcmp(armor + bodyLen + 1, crcChars, 4) == 0 && armor[bodyLen + 5] == '\n',
+       "armor is the line encoded body plus its CRC-24");
+    free(buf);
+    free(body);
+    free(armor);
+    return 0;
+}
+
+#define UPDATEV_TESTS 7
+
+static int
+doUpdateV(CNEncodings encodingStrat, char *input, char *expected)
+{
+#if defined(_WIN32)
+    test_skip("no struct iovec on this platform", UPDATEV_TESTS, 0);
+    return 0;
+#else
+    static const size_t pieces[] = { 1, 0, 5, 2, 11 };
+    struct iovec iov[64];
+    CNStatus retval;
+    CNEncoderRef coder;
+    char outBuf[BUFSIZE], secondBuf[BUFSIZE];
+    size_t outLen, outAvailable, pos;
+    int iovcnt;
+    
+    // Uneven pieces, including empty ones, cut across block boundaries.
+    for(iovcnt = 0, pos = 0; pos < strlen(input) && iovcnt < 63; iovcnt++) {
+        size_t len = pieces[iovcnt % 5];
+        if(len > strlen(input) - pos) len = strlen(input) - pos;
+        iov[iovcnt].iov_base = &input[pos];
+        iov[iovcnt].iov_len = len;
+        pos += len;
+    }
+    iov[iovcnt].iov_base = &input[pos];
+    iov[iovcnt++].iov_len = strlen(input) - pos;
+    
+    retval = CNEncoderCreate(encodingStrat, kCNEncode, &coder);
+    ok(retval == kCNSuccess, "got an encoder");
+    outLen = BUFSIZE;
+    retval = CNEncoderUpdateV(coder, iov, iovcnt, outBuf, &outLen);
+    ok(retval == kCNSuccess, "encoded");
+    outAvailable = BUFSIZE - outLen;
+    retval = CNEncoderFinal(coder, &outBuf[outLen], &outAvailable);
+    ok(retval == kCNSuccess, "finalized");
+    outLen += outAvailable;
+    ok(outLen == strlen(expected) && strncmp(expected, outBuf, outLen) == 0, "output matches");
+    CNEncoderRelease(&coder);
+    
+    pos = 0;
+    for(int i = 0; i < iovcnt; i++) {
+        iov[i].iov_base = &outBuf[pos];
+        iov[i].iov_len = pieces[i % 5] < outLen - pos ? pieces[i % 5] : outLen - pos;
+        pos += iov[i].iov_len;
+        if(i == iovcnt - 1) iov[i].iov_len += outLen - pos;
+    }
+    
+    retval = CNEncoderCreate(encodingStrat, kCNDecode, &coder);
+    ok(retval == kCNSuccess, "got a decoder");
+    outLen = BUFSIZE;
+    retval = CNEncoderUpdateV(coder, iov, iovcnt, secondBuf, &outLen);
+    ok(retval == kCNSuccess, "decoded");
+    outAvailable = BUFSIZE - outLen;
+    retval = CNEncoderFinal(coder, &secondBuf[outLen], &outAvailable);
+    outLen += outAvailable;
+    ok(retval == kCNSuccess && outLen == strlen(input) && strncmp(input, secondBuf, outLen) == 0, "output matches");
+    CNEncoderRelease(&coder);
+    
+    return 0;
+#endif
+}
     
 
 int CommonBaseEncoding(int __unused argc, char *const * __unused argv) {
@@ -250,8 +445,62 @@ int CommonBaseEncoding(int __unused argc, char *const * __unused argv) {
                        "Man is distinguished, not only by his reason, but by this singular passion from other animals, which is a lust of the mind, that by a perseverance of delight in the continued and indefatigable generation of knowledge, exceeds the short vehemence of any carnal pleasure.",
                        "");
 
+    // Long enough to go through the vector kernels and their scalar tails.
+    accum |= doOneShotStyle(kCNEncodingBase64,
+                       "Man is distinguished, not only by his reason, but by this singular passion from other animals, which is a lust of the mind, that by a perseverance of delight in the continued and indefatigable generation of knowledge, exceeds the short vehemence of any carnal pleasure.",
+                       "TWFuIGlzIGRpc3Rpbmd1aXNoZWQsIG5vdCBvbmx5IGJ5IGhpcyByZWFzb24sIGJ1dCBieSB0aGlz"
+                       "IHNpbmd1bGFyIHBhc3Npb24gZnJvbSBvdGhlciBhbmltYWxzLCB3aGljaCBpcyBhIGx1c3Qgb2Yg"
+                       "dGhlIG1pbmQsIHRoYXQgYnkgYSBwZXJzZXZlcmFuY2Ugb2YgZGVsaWdodCBpbiB0aGUgY29udGlu"
+                       "dWVkIGFuZCBpbmRlZmF0aWdhYmxlIGdlbmVyYXRpb24gb2Yga25vd2xlZGdlLCBleGNlZWRzIHRo"
+                       "ZSBzaG9ydCB2ZWhlbWVuY2Ugb2YgYW55IGNhcm5hbCBwbGVhc3VyZS4=");
+
+    if(verbose) diag("Base32/Base16 Long - One-Shot\n");
+    accum |= doOneShotStyle(kCNEncodingBase32,
+                       "Man is distinguished, not only by his reason, but by this singular passion from other animals, which is a lust of the mind, that by a perseverance of delight in the continued and indefatigable generation of knowledge, exceeds the short vehemence of any carnal pleasure.",
+                       "JVQW4IDJOMQGI2LTORUW4Z3VNFZWQZLEFQQG433UEBXW43DZEBRHSIDINFZSA4TFMFZW63RMEBRH"
+                       "K5BAMJ4SA5DINFZSA43JNZTXK3DBOIQHAYLTONUW63RAMZZG63JAN52GQZLSEBQW42LNMFWHGLBA"
+                       "O5UGSY3IEBUXGIDBEBWHK43UEBXWMIDUNBSSA3LJNZSCYIDUNBQXIIDCPEQGCIDQMVZHGZLWMVZG"
+                       "C3TDMUQG6ZRAMRSWY2LHNB2CA2LOEB2GQZJAMNXW45DJNZ2WKZBAMFXGIIDJNZSGKZTBORUWOYLC"
+                       "NRSSAZ3FNZSXEYLUNFXW4IDPMYQGW3TPO5WGKZDHMUWCAZLYMNSWKZDTEB2GQZJAONUG64TUEB3G"
+                       "K2DFNVSW4Y3FEBXWMIDBNZ4SAY3BOJXGC3BAOBWGKYLTOVZGKLQ=");
+    accum |= doOneShotStyle(kCNEncodingBase16,
+                       "Man is distinguished, not only by his reason, but by this singular passion from other animals, which is a lust of the mind, that by a perseverance of delight in the continued and indefatigable generation of knowledge, exceeds the short vehemence of any carnal pleasure.",
+                       "4D616E2069732064697374696E677569736865642C206E6F74206F6E6C792062792068697320"
+                       "726561736F6E2C2062757420627920746869732073696E67756C61722070617373696F6E2066"
+                       "726F6D206F7468657220616E696D616C732C2077686963682069732061206C757374206F6620"
+                       "746865206D696E642C20746861742062792061207065727365766572616E6365206F66206465"
+                       "6C6967687420696E2074686520636F6E74696E75656420616E6420696E646566617469676162"
+                       "6C652067656E65726174696F6E206F66206B6E6F776C656467652C2065786365656473207468"
+                       "652073686F727420766568656D656E6365206F6620616E79206361726E616C20706C65617375"
+                       "72652E");
     
-    
+
+    if(verbose) diag("Line breaks and whitespace\n");
+    accum |= doLineOptions(kCNEncodingBase64, 76,
+                       "Man is distinguished, not only by his reason, but by this singular passion from other animals, which is a lust of the mind, that by a perseverance of delight in the continued and indefatigable generation of knowledge, exceeds the short vehemence of any carnal pleasure.",
+                      "TWFuIGlzIGRpc3Rpbmd1aXNoZWQsIG5vdCBvbmx5IGJ5IGhpcyByZWFzb24sIGJ1dCBieSB0aGlz\n"
+                      "IHNpbmd1bGFyIHBhc3Npb24gZnJvbSBvdGhlciBhbmltYWxzLCB3aGljaCBpcyBhIGx1c3Qgb2Yg\n"
+                      "dGhlIG1pbmQsIHRoYXQgYnkgYSBwZXJzZXZlcmFuY2Ugb2YgZGVsaWdodCBpbiB0aGUgY29udGlu\n"
+                      "dWVkIGFuZCBpbmRlZmF0aWdhYmxlIGdlbmVyYXRpb24gb2Yga25vd2xlZGdlLCBleGNlZWRzIHRo\n"
+                      "ZSBzaG9ydCB2ZWhlbWVuY2Ugb2YgYW55IGNhcm5hbCBwbGVhc3VyZS4=\n");
+    if(verbose) diag("Scatter-gather\n");
+    accum |= doUpdateV(kCNEncodingBase64, "foobar", "Zm9vYmFy");
+    accum |= doUpdateV(kCNEncodingBase32, "Man is distinguished, not only by his reason",
+                       "JVQW4IDJOMQGI2LTORUW4Z3VNFZWQZLEFQQG433UEBXW43DZEBRHSIDINFZSA4TFMFZW63Q=");
+    accum |= doUpdateV(kCNEncodingBase16, "fooba", "666F6F6261");
+    accum |= doLineOptions(kCNEncodingBase32, 7, "foobar", "MZXW6YT\nBOI====\n==\n");
+    if(verbose) diag("Armor\n");
+    accum |= doArmor(64, "", "=twTO\n");
+    accum |= doArmor(64,
+                     "Man is distinguished, not only by his reason, but by this singular passion from other animals, which is a lust of the mind, that by a perseverance of delight in the continued and indefatigable generation of knowledge, exceeds the short vehemence of any carnal pleasure.",
+                     "TWFuIGlzIGRpc3Rpbmd1aXNoZWQsIG5vdCBvbmx5IGJ5IGhpcyByZWFzb24sIGJ1\n"
+                     "dCBieSB0aGlzIHNpbmd1bGFyIHBhc3Npb24gZnJvbSBvdGhlciBhbmltYWxzLCB3\n"
+                     "aGljaCBpcyBhIGx1c3Qgb2YgdGhlIG1pbmQsIHRoYXQgYnkgYSBwZXJzZXZlcmFu\n"
+                     "Y2Ugb2YgZGVsaWdodCBpbiB0aGUgY29udGludWVkIGFuZCBpbmRlZmF0aWdhYmxl\n"
+                     "IGdlbmVyYXRpb24gb2Yga25vd2xlZGdlLCBleGNlZWRzIHRoZSBzaG9ydCB2ZWhl\n"
+                     "bWVuY2Ugb2YgYW55IGNhcm5hbCBwbGVhc3VyZS4=\n"
+                     "=JQUQ\n");
+    accum |= doArmorLarge();
     
     if(verbose) diag("Custom\n");
     accum |= doCustomEncoder("Custom64", 64, "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789+/", '*',
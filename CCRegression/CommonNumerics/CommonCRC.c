@@ -30,7 +30,7 @@ entryPoint(CommonCRCTest,"CRC")
 #else
 #include <CommonNumerics/CommonCRC.h>
 
-static const int kTestTestCount = 40;
+static const int kTestTestCount = 97;
 
 static int
 doCRC(CNcrc alg, char *data, uint64_t expected)
@@ -64,21 +64,214 @@ static void test_CNCRC_consistency()
     CNCRCRelease(crcref);
 }
 
+static void test_CNCRC_chunked(CNcrc alg)
+{
+    uint8_t buf[1031];
+    CNCRCRef crcref;
+    uint64_t crc = 0, crc2 = 1;
+    size_t pos, chunk;
+    
+    for(size_t i=0; i<sizeof(buf); i++) buf[i] = (uint8_t) (i * 7 + (i >> 3));
+    
+    CNCRC(alg, buf, sizeof(buf), &crc2);
+    CNCRCInit(alg, &crcref);
+    for(pos=0, chunk=1; pos<sizeof(buf); pos+=chunk, chunk=(chunk % 13) + 1) {
+        if(chunk > sizeof(buf) - pos) chunk = sizeof(buf) - pos;
+        CNCRCUpdate(crcref, &buf[pos], chunk);
+    }
+    CNCRCFinal(crcref, &crc);
+    CNCRCRelease(crcref);
+    ok(crc == crc2, "CNCRC and chunked incremental match");
+}
+static void test_CNCRC_storage(CNcrc alg)
+{
+    const char *str = "The quick brown fox jumps over the lazy dog";
+    CNCRCContext storage;
+    CNCRCRef crcref = NULL;
+    uint64_t crc = 0, crc2 = 1;
+    
+    CNCRC(alg, str, strlen(str), &crc2);
+    ok(CNCRCInitWithStorage(alg, &storage, &crcref) == kCNSuccess && crcref != NULL &&
+       CNCRCUpdate(crcref, str, 9) == kCNSuccess && CNCRCUpdate(crcref, str + 9, strlen(str) - 9) == kCNSuccess &&
+       CNCRCFinal(crcref, &crc) == kCNSuccess && crc == crc2, "CNCRCInitWithStorage matches CNCRC");
+    CNCRCRelease(crcref);
+}
+
+static void test_CNCRC_combine(CNcrc alg)
+{
+    uint8_t buf[700];
+    uint64_t whole, crcA, crcB, combined;
+    size_t splits[] = { 0, 1, 5, 64, 333, 699, 700 };
+    int matched = 1;
+    
+    for(size_t i=0; i<sizeof(buf); i++) buf[i] = (uint8_t) (i * 13 + 5);
+    CNCRC(alg, buf, sizeof(buf), &whole);
+    for(size_t i=0; i<sizeof(splits)/sizeof(splits[0]); i++) {
+        size_t lenA = splits[i];
+        CNCRC(alg, buf, lenA, &crcA);
+        CNCRC(alg, &buf[lenA], sizeof(buf) - lenA, &crcB);
+        if(CNCRCCombine(alg, crcA, crcB, sizeof(buf) - lenA, &combined) != kCNSuccess) matched = 0;
+        if(combined != whole) matched = 0;
+    }
+    ok(matched, "CNCRCCombine matches CNCRC over the whole buffer");
+}
+static void test_CNCRC_parallel(CNcrc alg)
+{
+    size_t len = 3 * 1024 * 1024 + 77;
+    uint8_t *buf = malloc(len);
+    uint64_t crc = 0, crc2 = 1;
+    
+    for(size_t i=0; i<len; i++) buf[i] = (uint8_t) (i ^ (i >> 11));
+    CNCRC(alg, buf, len, &crc);
+    CNCRCParallel(alg, buf, len, 4, &crc2);
+    ok(crc == crc2, "CNCRCParallel matches CNCRC");
+    free(buf);
+}
+
+static void test_CNCRC_batch(CNcrc alg)
+{
+    static const size_t lens[] = { 4096, 64, 0, 7, 4096, 200, 1, 129, 4096, 4096, 4096, 4096, 33 };
+    const size_t n = sizeof(lens) / sizeof(lens[0]);
+    const void *bufs[sizeof(lens) / sizeof(lens[0])];
+    uint64_t results[sizeof(lens) / sizeof(lens[0])];
+    uint8_t *buf = malloc(8192);
+    int matched = 1;
+    
+    for(size_t i=0; i<8192; i++) buf[i] = (uint8_t) (i * 13 + (i >> 7));
+    for(size_t i=0; i<n; i++) bufs[i] = buf + i * 97;
+    matched = (CNCRCBatch(alg, bufs, lens, n, results) == kCNSuccess);
+    for(size_t i=0; i<n; i++) {
+        uint64_t crc = 0;
+        CNCRC(alg, bufs[i], lens[i], &crc);
+        if(crc != results[i]) matched = 0;
+    }
+    ok(matched, "CNCRCBatch matches CNCRC for each buffer");
+    free(buf);
+}
+
+static void test_CNCRC_custom(size_t width, uint64_t poly, uint64_t init, uint64_t xorout, int reflect, uint64_t check)
+{
+    CNCRCRef crcref = NULL;
+    uint64_t crc = 0;
+    
+    if(CNCRCCreateCustom(width, poly, init, xorout, reflect, &crcref) != kCNSuccess) {
+        ok(0, "CNCRCCreateCustom failed");
+        return;
+    }
+    CNCRCUpdate(crcref, "1234", 4);
+    CNCRCUpdate(crcref, "56789", 5);
+    CNCRCFinal(crcref, &crc);
+    CNCRCRelease(crcref);
+    ok(crc == check, "Custom CRC check value");
+}
 
 int CommonCRCTest(int __unused argc, char *const * __unused argv)
 {
 	plan_tests(kTestTestCount);
     test_CNCRC_consistency();
+    test_CNCRC_chunked(kCN_CRC_8);
+    test_CNCRC_chunked(kCN_CRC_8_ROHC);
+    test_CNCRC_chunked(kCN_CRC_16);
+    test_CNCRC_chunked(kCN_CRC_16_XMODEM);
+    test_CNCRC_chunked(kCN_CRC_32);
+    test_CNCRC_chunked(kCN_CRC_24_OPENPGP);
+    test_CNCRC_chunked(kCN_CRC_32_MPEG_2);
+    test_CNCRC_chunked(kCN_CRC_32_CASTAGNOLI);
+    test_CNCRC_chunked(kCN_CRC_64_ECMA_182);
+    test_CNCRC_chunked(kCN_CRC_32_Adler);
+    test_CNCRC_chunked(kCN_CRC_16_Fletcher);
+    test_CNCRC_chunked(kCN_CRC_32_Fletcher);
+    test_CNCRC_parallel(kCN_CRC_16);
+    test_CNCRC_parallel(kCN_CRC_32);
+    test_CNCRC_parallel(kCN_CRC_32_CASTAGNOLI);
+    test_CNCRC_parallel(kCN_CRC_32_Adler);
+    test_CNCRC_storage(kCN_CRC_32);
+    test_CNCRC_storage(kCN_CRC_32_CASTAGNOLI);
+    test_CNCRC_storage(kCN_CRC_32_Adler);
+    test_CNCRC_batch(kCN_CRC_8);
+    test_CNCRC_batch(kCN_CRC_16_A);
+    test_CNCRC_batch(kCN_CRC_32);
+    test_CNCRC_batch(kCN_CRC_32_MPEG_2);
+    test_CNCRC_batch(kCN_CRC_32_CASTAGNOLI);
+    test_CNCRC_batch(kCN_CRC_64_ECMA_182);
+    test_CNCRC_batch(kCN_CRC_32_Adler);
+    test_CNCRC_combine(kCN_CRC_8);
+    test_CNCRC_combine(kCN_CRC_16);
+    test_CNCRC_combine(kCN_CRC_16_A);
+    test_CNCRC_combine(kCN_CRC_16_XMODEM);
+    test_CNCRC_combine(kCN_CRC_24_OPENPGP);
+    test_CNCRC_combine(kCN_CRC_32);
+    test_CNCRC_combine(kCN_CRC_32_CASTAGNOLI);
+    test_CNCRC_combine(kCN_CRC_64_ECMA_182);
+    {
+        uint64_t combined;
+        ok(CNCRCCombine(kCN_CRC_32_Adler, 1, 1, 1, &combined) == kCNParamError, "Adler-32 is not a polynomial CRC");
+    }
     
     doCRC(kCN_CRC_32_Adler, "Mark Adler", 0x13070394);
     doCRC(kCN_CRC_32_Adler, "resume", 0x09150292);
     doCRC(kCN_CRC_32_Adler, "foofoofoofoo", 0x20D00511);
+    {
+        // All 0xff bytes are the worst case for the deferred modulo.
+        size_t len = 1024 * 1024;
+        uint8_t *buf = malloc(len);
+        uint64_t result = 0;
+        memset(buf, 0xff, len);
+        CNCRC(kCN_CRC_32_Adler, buf, len, &result);
+        ok(result == 0x8E88EF11, "Adler-32 over 1MiB of 0xff");
+        free(buf);
+    }
+    doCRC(kCN_CRC_16_Fletcher, "abcde", 0xC8F0);
+    doCRC(kCN_CRC_16_Fletcher, "abcdef", 0x2057);
+    doCRC(kCN_CRC_16_Fletcher, "abcdefgh", 0x0627);
+    doCRC(kCN_CRC_32_Fletcher, "abcde", 0xF04FC729);
+    doCRC(kCN_CRC_32_Fletcher, "abcdef", 0x56502D2A);
+    doCRC(kCN_CRC_32_Fletcher, "abcdefgh", 0xEBE19591);
+    {
+        // Odd length, and near-maximal words between deferred reductions.
+        size_t len = 1024 * 1024 + 1;
+        uint8_t *buf = malloc(len);
+        uint64_t result = 0;
+        memset(buf, 0xfe, len);
+        CNCRC(kCN_CRC_32_Fletcher, buf, len, &result);
+        ok(result == 0xD4D1F8F5, "Fletcher-32 over 1MiB + 1 of 0xfe");
+        free(buf);
+    }
+    test_CNCRC_custom(5, 0x05, 0x1F, 0x1F, 1, 0x19); // CRC-5/USB
+    test_CNCRC_custom(15, 0x4599, 0, 0, 0, 0x059E); // CRC-15/CAN
+    test_CNCRC_custom(24, 0x864CFB, 0xB704CE, 0, 0, 0x21CF02); // CRC-24/OPENPGP
+    test_CNCRC_custom(32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, 1, 0xCBF43926);
+    test_CNCRC_custom(32, 0xF4ACFB13, 0xFFFFFFFF, 0xFFFFFFFF, 1, 0x1697D06A); // CRC-32/AUTOSAR
+    test_CNCRC_custom(64, 0x42F0E1EBA9EA3693, ~0ULL, ~0ULL, 1, 0x995DC9BBDF1939FAULL); // CRC-64/XZ
+    test_CNCRC_custom(64, 0xAD93D23594C93659, ~0ULL, ~0ULL, 1, 0xAE8B14860A799888ULL); // CRC-64/NVME
+    {
+        size_t len = 5000;
+        uint8_t *buf = malloc(len);
+        CNCRCRef crcref = NULL;
+        uint64_t crc = 0, crc2 = 1;
+        
+        for(size_t i=0; i<len; i++) buf[i] = (uint8_t) (i * 11 + (i >> 5));
+        CNCRC(kCN_CRC_32_MPEG_2, buf, len, &crc);
+        CNCRCCreateCustom(32, 0x04C11DB7, 0xFFFFFFFF, 0, 0, &crcref);
+        CNCRCUpdate(crcref, buf, len);
+        CNCRCFinal(crcref, &crc2);
+        CNCRCRelease(crcref);
+        ok(crc == crc2, "Custom CRC matches the built-in model");
+        free(buf);
+    }
+    {
+        CNCRCRef crcref = NULL;
+        ok(CNCRCCreateCustom(16, 0x18005, 0, 0, 0, &crcref) == kCNParamError, "Polynomial wider than the CRC");
+    }
     doCRC(kCN_CRC_32, "123456789", 0xCBF43926); // CRC32 IEEE 802.3
     doCRC(kCN_CRC_32, "foofoofoofoo", 0xd18e130c);
+    doCRC(kCN_CRC_32, "The quick brown fox jumps over the lazy dog", 0x414FA339);
     doCRC(kCN_CRC_16_CCITT_FALSE, "123456789", 0x29B1);
     doCRC(kCN_CRC_16_CCITT_FALSE, "foofoofoofoo", 0x074F);
     doCRC(kCN_CRC_16_XMODEM, "123456789", 0x0C73);
+    doCRC(kCN_CRC_24_OPENPGP, "123456789", 0x21CF02);
     doCRC(kCN_CRC_32_CASTAGNOLI, "123456789", 0xE3069283);
+    doCRC(kCN_CRC_32_CASTAGNOLI, "The quick brown fox jumps over the lazy dog", 0x22620404);
     doCRC(kCN_CRC_64_ECMA_182, "123456789", 0x62EC59E3F1A4F00AULL);
     ok(CNCRCWeakTest(kCN_CRC_8) == kCNSuccess, "Self Test");
     ok(CNCRCWeakTest(kCN_CRC_8_ICODE) == kCNSuccess, "Self Test");
@@ -97,6 +290,7 @@ int CommonCRCTest(int __unused argc, char *const * __unused argv)
     ok(CNCRCWeakTest(kCN_CRC_16_A) == kCNSuccess, "Self Test");
     ok(CNCRCWeakTest(kCN_CRC_16_B) == kCNSuccess, "Self Test");
     ok(CNCRCWeakTest(kCN_CRC_16_Fletcher) == kCNSuccess, "Self Test");
+    ok(CNCRCWeakTest(kCN_CRC_24_OPENPGP) == kCNSuccess, "Self Test");
     ok(CNCRCWeakTest(kCN_CRC_32_Adler) == kCNSuccess, "Self Test");
     ok(CNCRCWeakTest(kCN_CRC_32) == kCNSuccess, "Self Test");
     ok(CNCRCWeakTest(kCN_CRC_32_CASTAGNOLI) == kCNSuccess, "Self Test");
@@ -104,6 +298,7 @@ int CommonCRCTest(int __unused argc, char *const * __unused argv)
     ok(CNCRCWeakTest(kCN_CRC_32_MPEG_2) == kCNSuccess, "Self Test");
     ok(CNCRCWeakTest(kCN_CRC_32_POSIX) == kCNSuccess, "Self Test");
     ok(CNCRCWeakTest(kCN_CRC_32_XFER) == kCNSuccess, "Self Test");
+    ok(CNCRCWeakTest(kCN_CRC_32_Fletcher) == kCNSuccess, "Self Test");
     ok(CNCRCWeakTest(kCN_CRC_64_ECMA_182) == kCNSuccess, "Self Test");
 #if 0
     diag("Dumping 4 CRC tables - if all is well");
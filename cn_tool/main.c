@@ -32,12 +32,24 @@
 #include <assert.h>
 #include <libgen.h>
 #include <ctype.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 #include <AssertMacros.h>
 #include <CommonNumerics/CommonCRC.h>
 #include <CommonNumerics/CommonBaseXX.h>
 
 #define CN_NAME "cn"
 #define ENCODE_DEFAULT_WIDTH 64
+#define CRC_MMAP_MIN (1 << 20)  // files at least this large are mapped rather than read
+#define BENCH_DEFAULT_MIN   64
+#define BENCH_DEFAULT_MAX   (64 << 20)
+#define BENCH_DEFAULT_MS    50
+#define BENCH_COLD_SPAN     (256 << 20) // cold runs cycle through this much input
 
 #define PRINT(...)  if (context->verbose) { fprintf(context->out_file, __VA_ARGS__); }
 
@@ -67,6 +79,7 @@ static cnItem crcMap[] = {
     CN_ITEM(kCN_CRC_16_A),
     CN_ITEM(kCN_CRC_16_B),
     CN_ITEM(kCN_CRC_16_Fletcher),
+    CN_ITEM(kCN_CRC_24_OPENPGP),
     CN_ITEM(kCN_CRC_32_Adler),
     CN_ITEM(kCN_CRC_32),
     CN_ITEM(kCN_CRC_32_CASTAGNOLI),
@@ -74,6 +87,7 @@ static cnItem crcMap[] = {
     CN_ITEM(kCN_CRC_32_MPEG_2),
     CN_ITEM(kCN_CRC_32_POSIX),
     CN_ITEM(kCN_CRC_32_XFER),
+    CN_ITEM(kCN_CRC_32_Fletcher),
     CN_ITEM(kCN_CRC_64_ECMA_182)
 };
 
@@ -88,7 +102,8 @@ static cnItem basexxMap[] = {
 enum {
     cmdOpCRC = 1,
     cmdOpEncode,
-    cmdOpDecode
+    cmdOpDecode,
+    cmdOpBench
 };
 typedef uint32_t cmdOp; //operation
 
@@ -116,6 +131,14 @@ typedef struct _cnContext
     bool        dumpTable;
     int         pageSize;
     int         width;
+    int         jobs;
+    size_t      chunkSize;
+    const char  *indexFile;
+    uint64_t    rangeStart;
+    uint64_t    rangeLength;    // 0 for through the end of the file
+    size_t      benchMin;
+    size_t      benchMax;
+    int         benchMillis;
     uint64_t    totalBytes;
     bool        verbose;
 } cnContext, *cnContextPtr;
@@ -124,7 +147,7 @@ static cnCmd cmdMap[] =
 {
     {   .name = "crc",
         .op = cmdOpCRC,
-        .options = "a:ds:Th?v",
+        .options = "a:c:di:j:r:s:Th?v",
         .description = "Generate a checksum CRC",
         .usage =    "[file ...]\n",
         .algDefault = kCN_CRC_64_ECMA_182,
@@ -142,6 +165,12 @@ static cnCmd cmdMap[] =
         .description = "Decode using BaseXX representation",
         .usage = "[file ...]\n",
         .algDefault = kCNEncodingBase64,
+    },
+    {   .name = "bench",
+        .op = cmdOpBench,
+        .options = "m:M:t:h?v",
+        .description = "Report CRC and BaseXX throughput as JSON",
+        .usage = "\n",
     }
 };
 
@@ -190,12 +219,15 @@ static uint32_t getalg(cnContextPtr context, const char * name)
             return 0;
     }
     
+    // Names may prefix one another (kCN_CRC_16, kCN_CRC_16_Fletcher), so
+    // the longest one that matches wins.
     uint32_t alg = 0;
+    size_t best = 0;
     for (int x = 0; x < num; x++) {
         size_t nlen = strlen(algMap[x].name);
-        if (strncasecmp(algMap[x].name, name, nlen) == 0) {
+        if (nlen > best && strncasecmp(algMap[x].name, name, nlen) == 0) {
             alg = algMap[x].alg;
-            break;
+            best = nlen;
         }
     }
     
@@ -246,12 +278,33 @@ static void usage(cnContextPtr context)
                 case 'a':
                     fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-a <num|string>", "Operate with a specific Algorithm");
                     break;
+                case 'c':
+                    fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-c <size>", "Write a JSON index of per chunk CRCs (--chunk)");
+                    break;
                 case 'd':
                     fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-d", "Display CRC in decimal");
                     break;
                 case 'h':
                     fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-h, -?", "Show help");
                     break;
+                case 'i':
+                    fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-i <index>", "Verify a file against an index (--verify-index)");
+                    break;
+                case 'j':
+                    fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-j <num>", "Process files on <num> threads (0 for one per CPU)");
+                    break;
+                case 'm':
+                    fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-m <size>", "Smallest buffer size (default 64)");
+                    break;
+                case 'M':
+                    fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-M <size>", "Largest buffer size (default 64M)");
+                    break;
+                case 'r':
+                    fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-r <off>[:<len>]", "Verify only chunks in this byte range (--range)");
+                    break;
+                case 't':
+                    fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-t <ms>", "Time spent on each measurement");
+                    break;
                 case 's':
                     fprintf(stderr, "  %-"USAGE_SPACE"s%-s\n", "-s <string>", "Operate on a specified string");
                     break;
@@ -316,6 +369,36 @@ static uint32_t parseAlg(cnContextPtr context, const char * str)
     return alg;
 }
 
+static size_t parseSize(const char * str)
+{
+    char * end = NULL;
+    size_t size = strtoul(str, &end, 0);
+    
+    switch (end ? *end : '\0') {
+        case 'k': case 'K': size <<= 10; break;
+        case 'm': case 'M': size <<= 20; break;
+        case 'g': case 'G': size <<= 30; break;
+        default: break;
+    }
+    return size;
+}
+
+static bool parseRange(cnContextPtr context, const char * str)
+{
+    const char * colon = strchr(str, ':');
+    
+    context->rangeStart = parseSize(str);
+    context->rangeLength = colon ? parseSize(colon + 1) : 0;
+    return !colon || context->rangeLength != 0;
+}
+
+static const struct option longOptions[] = {
+    { "chunk",          required_argument,  NULL,   'c' },
+    { "verify-index",   required_argument,  NULL,   'i' },
+    { "range",          required_argument,  NULL,   'r' },
+    { NULL,             0,                  NULL,   0 }
+};
+
 static bool parseArgs(int argc, const char * argv[], cnContextPtr context)
 {
     bool result = false;
@@ -345,14 +428,40 @@ static bool parseArgs(int argc, const char * argv[], cnContextPtr context)
     
     context->out_file = fdopen(STDOUT_FILENO, "a");
     
-    while ((ch = getopt(argc, (char**)argv,context->cmd->options)) != -1) {
+    while ((ch = getopt_long(argc, (char**)argv, context->cmd->options, longOptions, NULL)) != -1) {
+        // Long options map to letters that not every command takes.
+        require_quiet(strchr(context->cmd->options, ch) != NULL, done);
         switch (ch) {
             case 'a':
                 context->alg = parseAlg(context, optarg);
                 break;
+            case 'c':
+                context->chunkSize = parseSize(optarg);
+                require_quiet(context->chunkSize != 0, done);
+                break;
+            case 'i':
+                context->indexFile = optarg;
+                break;
+            case 'r':
+                require_quiet(parseRange(context, optarg), done);
+                break;
             case 'd':
                 context->showDecimal = true;
                 break;
+            case 'm':
+                context->benchMin = parseSize(optarg);
+                break;
+            case 'M':
+                context->benchMax = parseSize(optarg);
+                break;
+            case 't':
+                context->benchMillis = atoi(optarg);
+                break;
+            case 'j':
+                context->jobs = atoi(optarg);
+                if (context->jobs < 1)
+                    context->jobs = (int) sysconf(_SC_NPROCESSORS_ONLN);
+                break;
             case 'T':
                 context->dumpTable = true;
                 context->string = "";
@@ -371,6 +480,16 @@ static bool parseArgs(int argc, const char * argv[], cnContextPtr context)
         }
     }
     
+    if (context->cmd->op == cmdOpBench) {
+        if (!context->benchMin)
+            context->benchMin = BENCH_DEFAULT_MIN;
+        if (!context->benchMax)
+            context->benchMax = BENCH_DEFAULT_MAX;
+        if (context->benchMillis <= 0)
+            context->benchMillis = BENCH_DEFAULT_MS;
+        require_quiet(context->benchMin <= context->benchMax, done);
+    }
+    
     envInt = getEnvInt("CN_READ_SIZE");
     context->pageSize = envInt ? envInt : getpagesize();
     
@@ -380,6 +499,13 @@ static bool parseArgs(int argc, const char * argv[], cnContextPtr context)
     argc -= optind;
     argv += optind;
     
+    // An index describes a single file, and chunks are read by offset.
+    require_quiet(!(context->chunkSize && context->indexFile), done);
+    require_quiet(!context->chunkSize || argc <= 1, done);
+    require_quiet(!context->indexFile || argc == 1, done);
+    require_quiet(context->indexFile || (!context->rangeStart && !context->rangeLength), done);
+    require_quiet(!context->string || (!context->chunkSize && !context->indexFile), done);
+    
     if (argc > 0) {
         context->filesCount = argc;
         context->files = calloc(1u,argc*sizeof(char*)+1);
@@ -411,10 +537,67 @@ static void pcrc(cnContextPtr context, uint64_t crc)
     fprintf(context->out_file, "\n");
 }
 
-static CNStatus crcOp(cnContextPtr context)
+/*
+ * CRC an open file.  Large regular files are mapped and handed to the CRC in
+ * one call; anything else (pipes, small files, or a failed mmap) is read in
+ * pageSize pieces.
+ */
+static CNStatus crcFd(cnContextPtr context, int fd, uint64_t *crc, uint64_t *totalBytes)
 {
     CNStatus status = kCNSuccess;
     CNCRCRef crcRef = NULL;
+    uint8_t *buf = NULL;
+    struct stat sb;
+    bool mapped = false;
+    
+    *totalBytes = 0;
+    status = CNCRCInit(context->alg, &crcRef);
+    require_noerr(status, done);
+    
+    if (fstat(fd, &sb) == 0 && S_ISREG(sb.st_mode) && sb.st_size >= CRC_MMAP_MIN) {
+        void *map = mmap(NULL, (size_t) sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            madvise(map, (size_t) sb.st_size, MADV_SEQUENTIAL);
+            status = CNCRCUpdate(crcRef, map, (size_t) sb.st_size);
+            munmap(map, (size_t) sb.st_size);
+            require_noerr(status, done);
+            
+            *totalBytes = (uint64_t) sb.st_size;
+            mapped = true;
+        }
+    }
+    
+    if (!mapped) {
+        ssize_t nr;
+        
+        buf = malloc(context->pageSize);
+        require_action(buf != NULL, done, status = kCNMemoryFailure);
+        
+        while ((nr = read(fd, buf, context->pageSize)) > 0) {
+            status = CNCRCUpdate(crcRef, buf, nr);
+            require_noerr(status, done);
+            
+            *totalBytes += nr;
+        }
+        require_action(nr == 0, done, status = kCNFailure);
+    }
+    
+    status = CNCRCFinal(crcRef, crc);
+    require_noerr(status, done);
+
+done:
+    if (buf) {
+        free(buf);
+    }
+    if (crcRef) {
+        CNCRCRelease(crcRef);
+    }
+    return status;
+}
+
+static CNStatus crcOp(cnContextPtr context)
+{
+    CNStatus status = kCNSuccess;
     uint64_t crc = 0;
     
     if(context->dumpTable) {
@@ -428,82 +611,330 @@ static CNStatus crcOp(cnContextPtr context)
         
         context->totalBytes = sLen;
     } else {
-        status = CNCRCInit(context->alg, &crcRef);
-        require_noerr(status, done);
-        
-        char buf[context->pageSize];
-        size_t nr;
-        
-        while ((nr = read(context->fd, buf, sizeof(buf))) > 0) {
-            status = CNCRCUpdate(crcRef, buf, nr);
-            require_noerr(status, done);
-            
-            context->totalBytes += nr;
-        }
-        
-        status = CNCRCFinal(crcRef, &crc);
+        status = crcFd(context, context->fd, &crc, &context->totalBytes);
         require_noerr(status, done);
     }
     
     pcrc(context, crc);
 
 done:
-    if (crcRef) {
-        CNCRCRelease(crcRef);
-    }
     return status;
 }
 
-static void pbase(cnContextPtr context, CNEncodingDirection direction, uint8_t * buf, size_t buf_len)
-{
-    switch(direction) {
-        case kCNEncode:
-            {
-                size_t pos = 0, size;
-                while(buf_len) {
-                    size = buf_len > (size_t) context->width ? context->width : buf_len;
-                    fwrite(&buf[pos], size, 1, context->out_file);
-                    fprintf(context->out_file, "\n");
-                    buf_len -= size;
-                    pos += size;
-                }
-            }
+/*
+ * crc -j: a pool of workers takes files from a shared index while the main
+ * thread prints the results in command line order as they complete.
+ */
+
+typedef struct _cnCRCJob
+{
+    const char  *file;
+    uint64_t    crc;
+    uint64_t    totalBytes;
+    CNStatus    status;
+    bool        openFailed;
+    bool        done;
+} cnCRCJob;
+
+typedef struct _cnCRCPool
+{
+    cnContextPtr    context;
+    cnCRCJob        *jobs;
+    uint32_t        count;
+    uint32_t        next;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+} cnCRCPool;
+
+static void *crcWorker(void *arg)
+{
+    cnCRCPool *pool = arg;
+    
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        uint32_t i = pool->next < pool->count ? pool->next++ : pool->count;
+        pthread_mutex_unlock(&pool->lock);
+        if (i == pool->count)
             break;
         
-        case kCNDecode:
-            fwrite(buf, buf_len, 1, context->out_file);
-            fflush(context->out_file);
-            break;
-        default:
+        cnCRCJob *job = &pool->jobs[i];
+        int fd = open(job->file, O_RDONLY, 0);
+        if (fd < 0) {
+            job->openFailed = true;
+        } else {
+            job->status = crcFd(pool->context, fd, &job->crc, &job->totalBytes);
+            close(fd);
+        }
+        
+        pthread_mutex_lock(&pool->lock);
+        job->done = true;
+        pthread_cond_broadcast(&pool->cond);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return NULL;
+}
+
+static int crcFilesParallel(cnContextPtr context)
+{
+    int rc = kCNSuccess;
+    cnCRCPool pool = { .context = context, .count = context->filesCount };
+    uint32_t nthreads = (uint32_t) context->jobs < context->filesCount ? (uint32_t) context->jobs : context->filesCount;
+    pthread_t *threads = calloc(nthreads, sizeof(pthread_t));
+    uint32_t started = 0;
+    
+    pool.jobs = calloc(pool.count, sizeof(cnCRCJob));
+    require_action(threads != NULL && pool.jobs != NULL, done, rc = kCNMemoryFailure);
+    for (uint32_t i = 0; i < pool.count; i++) {
+        pool.jobs[i].file = context->files[i];
+    }
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.cond, NULL);
+    
+    for (started = 0; started < nthreads; started++) {
+        if (pthread_create(&threads[started], NULL, crcWorker, &pool) != 0)
             break;
     }
+    if (started == 0) {
+        // No threads; do the work here.
+        crcWorker(&pool);
+    }
+    
+    for (uint32_t i = 0; i < pool.count; i++) {
+        cnCRCJob *job = &pool.jobs[i];
+        
+        pthread_mutex_lock(&pool.lock);
+        while (!job->done) {
+            pthread_cond_wait(&pool.cond, &pool.lock);
+        }
+        pthread_mutex_unlock(&pool.lock);
+        
+        if (job->openFailed) {
+            fprintf(stderr, "failed to open %s\n", job->file);
+            rc = kCNFailure;
+        } else if (job->status != kCNSuccess) {
+            rc = kCNFailure;
+        } else {
+            context->file = job->file;
+            context->totalBytes = job->totalBytes;
+            pcrc(context, job->crc);
+        }
+    }
+    
+    for (uint32_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_cond_destroy(&pool.cond);
+    pthread_mutex_destroy(&pool.lock);
+    
+done:
+    free(pool.jobs);
+    free(threads);
+    return rc;
+}
+
+/*
+ * crc -c: one CRC per chunkSize bytes, written as a JSON index with one
+ * chunk per line.  The whole file CRC is combined from the chunk CRCs, so
+ * it costs no second pass (null for checksums that don't combine).
+ *
+ * crc -i: reread the chunks of an index, optionally only those overlapping
+ * -r <offset>[:<length>], and report the ones that no longer match.
+ */
+
+typedef struct _cnCRCChunk
+{
+    uint64_t    offset;
+    uint64_t    length;
+    uint64_t    crc;
+} cnCRCChunk;
+
+static const char * crcName(uint32_t alg)
+{
+    for (size_t x = 0; x < sizeof(crcMap)/sizeof(cnItem); x++) {
+        if (crcMap[x].alg == alg)
+            return crcMap[x].name;
+    }
+    return "unknown";
 }
 
-static void _getBlockReadSize(cnContextPtr context, size_t * readSize, size_t * encodeSize)
+// Fill buf from the current position, stopping short only at end of file.
+static ssize_t readFull(int fd, uint8_t *buf, size_t len)
 {
-    size_t encode, in, out;
+    size_t got = 0;
+    ssize_t nr = 0;
     
-    CNEncoderBlocksize(context->alg, &in, &out);
+    while (got < len && (nr = read(fd, buf + got, len - got)) > 0) {
+        got += nr;
+    }
+    return nr < 0 ? -1 : (ssize_t) got;
+}
 
-    encode = (context->pageSize / in) * out;
-    encode = encode - (encode % context->width);
-    *readSize = (encode / out) * in;
-    *encodeSize = encode;
+static ssize_t preadFull(int fd, uint8_t *buf, size_t len, uint64_t offset)
+{
+    size_t got = 0;
+    ssize_t nr = 0;
+    
+    while (got < len && (nr = pread(fd, buf + got, len - got, (off_t) (offset + got))) > 0) {
+        got += nr;
+    }
+    return nr < 0 ? -1 : (ssize_t) got;
 }
 
-static void _sanitizeBuf(uint8_t * buf, size_t bufLen, uint8_t * outBuf, size_t * outLen)
+static CNStatus crcIndexOp(cnContextPtr context)
 {
-    uint8_t * cur = outBuf;
-    size_t len = bufLen;
-    for (size_t i = 0; i < bufLen; i++) {
-        if (buf[i] != '\n') {
-            *cur = buf[i];
-            cur++;
-        } else {
-            len--;
+    CNStatus status = kCNSuccess;
+    uint8_t *buf = NULL;
+    uint64_t offset = 0, crc = 0, whole = 0;
+    bool combined = true;
+    ssize_t nr;
+    
+    buf = malloc(context->chunkSize);
+    require_action(buf != NULL, done, status = kCNMemoryFailure);
+    
+    fprintf(context->out_file, "{\n  \"algorithm\": \"%s\",\n  \"alg\": %u,\n  \"chunk\": %zu,\n  \"chunks\": [",
+            crcName(context->alg), context->alg, context->chunkSize);
+    
+    while ((nr = readFull(context->fd, buf, context->chunkSize)) > 0) {
+        status = CNCRC(context->alg, buf, nr, &crc);
+        require_noerr(status, done);
+        
+        if (offset == 0) {
+            whole = crc;
+        } else if (combined && CNCRCCombine(context->alg, whole, crc, nr, &whole) != kCNSuccess) {
+            combined = false;
+        }
+        fprintf(context->out_file, "%s\n    { \"offset\": %llu, \"length\": %zd, \"crc\": \"%llx\" }",
+                offset ? "," : "", offset, nr, crc);
+        offset += nr;
+    }
+    require_action(nr == 0, done, status = kCNFailure);
+    
+    if (offset == 0) {
+        // Empty input: the whole file CRC is that of no data.
+        status = CNCRC(context->alg, buf, 0, &whole);
+        require_noerr(status, done);
+    }
+    fprintf(context->out_file, "\n  ],\n  \"size\": %llu,\n", offset);
+    if (combined) {
+        fprintf(context->out_file, "  \"crc\": \"%llx\"\n}\n", whole);
+    } else {
+        fprintf(context->out_file, "  \"crc\": null\n}\n");
+    }
+    
+done:
+    free(buf);
+    return status;
+}
+
+/*
+ * Reads back the line oriented JSON that crcIndexOp writes; this is not a
+ * general JSON parser.
+ */
+static CNStatus readIndex(const char *path, uint32_t *alg, uint64_t *size, cnCRCChunk **chunks, size_t *count)
+{
+    CNStatus status = kCNSuccess;
+    FILE *f = fopen(path, "r");
+    char line[256];
+    size_t capacity = 0;
+    unsigned long long offset, length, crc, total;
+    unsigned int id;
+    bool haveSize = false;
+    
+    *alg = 0;
+    *size = 0;
+    *chunks = NULL;
+    *count = 0;
+    require_action(f != NULL, done, status = kCNFailure);
+    
+    while (fgets(line, sizeof(line), f) != NULL) {
+        if (sscanf(line, " \"alg\": %u", &id) == 1) {
+            *alg = id;
+        } else if (sscanf(line, " \"size\": %llu", &total) == 1) {
+            *size = total;
+            haveSize = true;
+        } else if (sscanf(line, " { \"offset\": %llu, \"length\": %llu, \"crc\": \"%llx\" }", &offset, &length, &crc) == 3) {
+            if (*count == capacity) {
+                cnCRCChunk *grown = realloc(*chunks, (capacity ? 2 * capacity : 64) * sizeof(cnCRCChunk));
+                require_action(grown != NULL, done, status = kCNMemoryFailure);
+                capacity = capacity ? 2 * capacity : 64;
+                *chunks = grown;
+            }
+            (*chunks)[(*count)++] = (cnCRCChunk) { .offset = offset, .length = length, .crc = crc };
+        }
+    }
+    require_action(*alg != 0 && haveSize, done, status = kCNDecodeError);
+    
+done:
+    if (f) {
+        fclose(f);
+    }
+    if (status != kCNSuccess) {
+        free(*chunks);
+        *chunks = NULL;
+        *count = 0;
+    }
+    return status;
+}
+
+static CNStatus crcVerifyOp(cnContextPtr context)
+{
+    CNStatus status;
+    cnCRCChunk *chunks = NULL;
+    size_t count = 0, checked = 0, bad = 0, maxLength = 0;
+    uint8_t *buf = NULL;
+    uint32_t alg;
+    uint64_t size;
+    struct stat sb;
+    bool resized = false;
+    uint64_t rangeEnd = context->rangeLength ? context->rangeStart + context->rangeLength : UINT64_MAX;
+    
+    status = readIndex(context->indexFile, &alg, &size, &chunks, &count);
+    if (status != kCNSuccess) {
+        fprintf(stderr, "failed to read index %s\n", context->indexFile);
+        goto done;
+    }
+    require_action(fstat(context->fd, &sb) == 0, done, status = kCNFailure);
+    
+    // Chunks only cover the bytes that were indexed; bytes appended or cut
+    // off since then show up in the length alone.
+    if (S_ISREG(sb.st_mode) && (uint64_t) sb.st_size != size) {
+        fprintf(context->out_file, "size %llu %llu %s\n", (unsigned long long) sb.st_size, size, context->file);
+        resized = true;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (chunks[i].length > maxLength)
+            maxLength = chunks[i].length;
+    }
+    buf = malloc(maxLength ? maxLength : 1);
+    require_action(buf != NULL, done, status = kCNMemoryFailure);
+    
+    for (size_t i = 0; i < count; i++) {
+        cnCRCChunk *chunk = &chunks[i];
+        uint64_t crc = 0;
+        ssize_t nr;
+        
+        if (chunk->offset >= rangeEnd || chunk->offset + chunk->length <= context->rangeStart)
+            continue;
+        
+        nr = preadFull(context->fd, buf, chunk->length, chunk->offset);
+        require_action(nr >= 0, done, status = kCNFailure);
+        status = CNCRC(alg, buf, nr, &crc);
+        require_noerr(status, done);
+        
+        checked++;
+        if ((uint64_t) nr != chunk->length || crc != chunk->crc) {
+            fprintf(context->out_file, "mismatch %llu %llu %s\n", chunk->offset, chunk->length, context->file);
+            bad++;
         }
     }
-    *outLen = len;
+    PRINT("%zu of %zu chunks checked, %zu mismatched\n", checked, count, bad);
+    if (bad || resized)
+        status = kCNFailure;
+    
+done:
+    free(buf);
+    free(chunks);
+    return status;
 }
 
 static CNStatus basexxOp(cnContextPtr context)
@@ -511,81 +942,58 @@ static CNStatus basexxOp(cnContextPtr context)
     CNStatus status = kCNSuccess;
     CNEncoderRef encoder = NULL;
     uint8_t * encodeBuf = NULL;
-    uint8_t * sanitizedBuf = NULL;
-    size_t encodedSize = 0;
+    size_t encodeLen = 0, encodedSize = 0, in, out;
     CNEncodingDirection direction = context->cmd->op == cmdOpEncode ? kCNEncode : kCNDecode;
-        
+    
+    // The encoder breaks lines itself and the decoder skips them, so buffers
+    // go straight from read() to the encoder and from there to the output.
+    status = CNEncoderCreateWithOptions(context->alg, direction,
+                                        direction == kCNDecode ? kCNDecodeIgnoreWhitespace : 0,
+                                        direction == kCNEncode ? (size_t) context->width : 0,
+                                        &encoder);
+    require_noerr_action(status, done, status = kCNDecodeError);
+    
+    status = CNEncoderBlocksizeFromRef(encoder, &in, &out);
+    require_noerr(status, done);
+    
     if (context->string) {
         size_t sLen = strlen(context->string);
-        encodedSize = CNEncoderGetOutputLengthFromEncoding(context->alg, direction, sLen);
         
-        encodeBuf = calloc(1u, encodedSize);
+        encodeLen = CNEncoderGetOutputLength(encoder, sLen);
+        encodeBuf = calloc(1u, encodeLen);
         require(encodeBuf != NULL, done);
         
-        CNEncode(context->alg, direction, context->string, sLen, encodeBuf, &encodedSize);
+        encodedSize = encodeLen;
+        status = CNEncoderUpdate(encoder, context->string, sLen, encodeBuf, &encodedSize);
         require_noerr_action(status, done, status = kCNDecodeError);
-        
-        pbase(context, direction, encodeBuf, encodedSize);
+        fwrite(encodeBuf, encodedSize, 1, context->out_file);
         
         context->totalBytes = sLen;
     } else {
         uint8_t readBuf[context->pageSize];
-        size_t bytesRead;
-        size_t pos;
-        size_t encodeLen = 0;
-
-        status = CNEncoderCreate(context->alg, direction, &encoder);
-        require_noerr_action(status, done, status = kCNDecodeError);
-        
-        size_t readBufSize = context->pageSize, expectedSize = 0;
-        if (direction == kCNEncode) {
-            _getBlockReadSize(context, &readBufSize, &expectedSize); // align reads to context->width
-            assert(readBufSize <= (size_t) context->pageSize);
-        }
+        ssize_t bytesRead;
         
-        encodeLen = CNEncoderGetOutputLength(encoder, readBufSize);
+        // Leave room for a partial block held over from the previous read.
+        encodeLen = CNEncoderGetOutputLength(encoder, context->pageSize + (direction == kCNEncode ? in : out));
         encodeBuf = calloc(1u, encodeLen);
         require(encodeBuf != NULL, done);
         
-        while ((bytesRead = read(context->fd, readBuf, readBufSize)) > 0) {
+        while ((bytesRead = read(context->fd, readBuf, context->pageSize)) > 0) {
             encodedSize = encodeLen;
-            
-            if (direction == kCNDecode) {
-                if (!sanitizedBuf) {
-                    sanitizedBuf = calloc(1u, context->pageSize);
-                }
-                size_t sanitizedSize = 0;
-                _sanitizeBuf(readBuf, bytesRead, sanitizedBuf, &sanitizedSize);
-                status = CNEncoderUpdate(encoder, sanitizedBuf, sanitizedSize, encodeBuf, &encodedSize);
-                expectedSize = encodedSize; 
-            } else {
-                status = CNEncoderUpdate(encoder, readBuf, bytesRead, encodeBuf, &encodedSize);
-            }
+            status = CNEncoderUpdate(encoder, readBuf, bytesRead, encodeBuf, &encodedSize);
             require_noerr_action(status, done, status = kCNDecodeError);
-            
-            // during encode only print if we got the full expected encode size (we might need to add padding)
-            // during decode print all decoded bytes
-            if (encodedSize == expectedSize) {
-                pbase(context, direction, encodeBuf, encodedSize);
-            }
+            fwrite(encodeBuf, encodedSize, 1, context->out_file);
             
             context->totalBytes += bytesRead;
         }
-        
-        pos = encodedSize;
-        encodedSize = encodeLen - pos;
-        
-        status = CNEncoderFinal(encoder, &encodeBuf[pos], &encodedSize);
-        require_noerr_action(status, done, status = kCNDecodeError);
-        
-        // If we had to add padding or didn't print the full buffer from above do so now
-        if (direction == kCNEncode && (encodedSize || pos < expectedSize)) {
-            size_t left = pos < expectedSize ?  pos + encodedSize : encodedSize;
-            // if pos < expectedSize start from 0 else just print the padding from pos
-            pbase(context, direction, &encodeBuf[pos < expectedSize ? 0 : pos], left);
-        }
     }
     
+    encodedSize = encodeLen;
+    status = CNEncoderFinal(encoder, encodeBuf, &encodedSize);
+    require_noerr_action(status, done, status = kCNDecodeError);
+    fwrite(encodeBuf, encodedSize, 1, context->out_file);
+    fflush(context->out_file);
+    
     PRINT("\n%llu", context->totalBytes);
     if (context->file)
         PRINT(" %s", context->file);
@@ -598,10 +1006,160 @@ done:
     if (encodeBuf) {
         free(encodeBuf);
     }
-    if (sanitizedBuf) {
-        free(sanitizedBuf);
+    
+    return status;
+}
+
+/*
+ * bench: time every CRC in crcMap and every encoder in basexxMap, both
+ * directions, at sizes from benchMin to benchMax (stepping by 4x).  Hot runs
+ * repeat the same buffer; cold runs walk through BENCH_COLD_SPAN bytes of
+ * copies so each call starts from memory.  Rates are in raw (base256)
+ * bytes so encode and decode figures are comparable.
+ */
+
+typedef CNStatus (*benchFn)(uint32_t alg, const void *in, size_t inLen, void *out, size_t outLen);
+
+static CNStatus benchCRC(uint32_t alg, const void *in, size_t inLen, void __unused *out, size_t __unused outLen)
+{
+    uint64_t crc;
+    return CNCRC(alg, in, inLen, &crc);
+}
+
+static CNStatus benchEncode(uint32_t alg, const void *in, size_t inLen, void *out, size_t outLen)
+{
+    return CNEncode(alg, kCNEncode, in, inLen, out, &outLen);
+}
+
+static CNStatus benchDecode(uint32_t alg, const void *in, size_t inLen, void *out, size_t outLen)
+{
+    return CNEncode(alg, kCNDecode, in, inLen, out, &outLen);
+}
+
+static double benchNow(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint64_t benchCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Time fn over inLen byte inputs taken in turn from slots consecutive copies
+ * at pool; one slot is the hot cache case.
+ */
+static CNStatus benchOne(cnContextPtr context, const char *kind, const cnItem *item, benchFn fn,
+                         const uint8_t *pool, size_t slots, size_t inLen, size_t rawLen,
+                         uint8_t *out, size_t outLen, bool *first)
+{
+    CNStatus status;
+    uint64_t calls = 0, cycles;
+    double start, elapsed, limit = context->benchMillis / 1000.0;
+    
+    status = fn(item->alg, pool, inLen, out, outLen);
+    require_noerr(status, done);
+    
+    start = benchNow();
+    cycles = benchCycles();
+    do {
+        fn(item->alg, &pool[(calls % slots) * inLen], inLen, out, outLen);
+        calls++;
+    } while ((elapsed = benchNow() - start) < limit);
+    cycles = benchCycles() - cycles;
+    
+    fprintf(context->out_file, "%s\n    { \"kind\": \"%s\", \"alg\": \"%s\", \"id\": %u, \"bytes\": %zu, "
+            "\"cache\": \"%s\", \"mb_per_s\": %.1f, ", *first ? "" : ",", kind, item->name, item->alg, rawLen,
+            slots > 1 ? "cold" : "hot", (double) calls * rawLen / elapsed / 1e6);
+    if (cycles) {
+        fprintf(context->out_file, "\"cycles_per_byte\": %.3f, ", (double) cycles / ((double) calls * rawLen));
+    } else {
+        fprintf(context->out_file, "\"cycles_per_byte\": null, ");
     }
+    fprintf(context->out_file, "\"calls_per_s\": %.0f }", calls / elapsed);
+    fflush(context->out_file);
+    *first = false;
     
+done:
+    return status;
+}
+
+static inline size_t benchSlots(size_t inLen)
+{
+    return BENCH_COLD_SPAN / inLen > 2 ? BENCH_COLD_SPAN / inLen : 2;
+}
+
+static CNStatus benchOp(cnContextPtr context)
+{
+    CNStatus status = kCNSuccess;
+    size_t outLen = 2 * context->benchMax + 16, poolLen, encodedLen;  // Base16 doubles its input
+    uint8_t *pool = NULL, *encoded = NULL, *out = NULL;
+    bool first = true;
+    
+    // Cold runs read the whole pool; the first slot doubles as the hot input.
+    poolLen = benchSlots(context->benchMin) * context->benchMin;
+    if (poolLen < benchSlots(outLen) * outLen)
+        poolLen = benchSlots(outLen) * outLen;
+    pool = malloc(poolLen);
+    encoded = malloc(outLen);
+    out = malloc(outLen);
+    require_action(pool != NULL && encoded != NULL && out != NULL, done, status = kCNMemoryFailure);
+    srandom(1);
+    for (size_t i = 0; i < poolLen; i++) {
+        pool[i] = (uint8_t) random();
+    }
+    
+    fprintf(context->out_file, "{\n  \"min_bytes\": %zu,\n  \"max_bytes\": %zu,\n  \"ms_per_result\": %d,\n  \"results\": [",
+            context->benchMin, context->benchMax, context->benchMillis);
+    
+    for (size_t a = 0; a < sizeof(crcMap)/sizeof(cnItem); a++) {
+        for (size_t size = context->benchMin; size <= context->benchMax; size *= 4) {
+            status = benchOne(context, "crc", &crcMap[a], benchCRC, pool, 1, size, size, out, outLen, &first);
+            require_noerr(status, done);
+            status = benchOne(context, "crc", &crcMap[a], benchCRC, pool, benchSlots(size), size, size, out, outLen, &first);
+            require_noerr(status, done);
+        }
+    }
+    
+    for (size_t a = 0; a < sizeof(basexxMap)/sizeof(cnItem); a++) {
+        for (size_t size = context->benchMin; size <= context->benchMax; size *= 4) {
+            status = benchOne(context, "encode", &basexxMap[a], benchEncode, pool, 1, size, size, out, outLen, &first);
+            require_noerr(status, done);
+            status = benchOne(context, "encode", &basexxMap[a], benchEncode, pool, benchSlots(size), size, size, out, outLen, &first);
+            require_noerr(status, done);
+        }
+    }
+    
+    // Decoding needs valid input, so these fill the pool with encoded copies.
+    for (size_t a = 0; a < sizeof(basexxMap)/sizeof(cnItem); a++) {
+        for (size_t size = context->benchMin; size <= context->benchMax; size *= 4) {
+            encodedLen = outLen;
+            memcpy(encoded, pool, size);
+            status = CNEncode(basexxMap[a].alg, kCNEncode, encoded, size, out, &encodedLen);
+            require_noerr(status, done);
+            for (size_t i = 0; i < benchSlots(encodedLen); i++) {
+                memcpy(&pool[i * encodedLen], out, encodedLen);
+            }
+            status = benchOne(context, "decode", &basexxMap[a], benchDecode, pool, 1, encodedLen, size, out, outLen, &first);
+            require_noerr(status, done);
+            status = benchOne(context, "decode", &basexxMap[a], benchDecode, pool, benchSlots(encodedLen), encodedLen, size, out, outLen, &first);
+            require_noerr(status, done);
+        }
+    }
+    
+    fprintf(context->out_file, "\n  ]\n}\n");
+
+done:
+    free(pool);
+    free(encoded);
+    free(out);
     return status;
 }
 
@@ -631,18 +1189,26 @@ int main(int argc, const char * argv[])
 
     switch (context->cmd->op) {
         case cmdOpCRC:
-            op = crcOp;
+            op = context->indexFile ? crcVerifyOp : context->chunkSize ? crcIndexOp : crcOp;
             break;
         case cmdOpEncode:
         case cmdOpDecode:
             op = basexxOp;
             break;
+        case cmdOpBench:
+            op = benchOp;
+            break;
         default:
             break;
     }
     
     require_action(op != NULL, done, rc = kCNParamError);
 
+    if (op == crcOp && context->jobs > 1 && context->filesCount > 1 && !context->string) {
+        rc = crcFilesParallel(context);
+        goto done;
+    }
+
     const char ** pos = context->files;
     do {
         context->totalBytes = 0;
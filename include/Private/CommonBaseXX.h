@@ -69,6 +69,26 @@ enum {
 };
 typedef uint32_t CNEncodingDirection;
 
+/*!
+ @enum       CNEncoderOptions
+ @abstract   Options for CNEncoderCreateWithOptions().
+
+ @constant   kCNDecodeIgnoreWhitespace   When decoding, skip CR, LF, tab and space
+                                         characters in the input, as found in PEM
+                                         and MIME bodies.
+ @constant   kCNEncodeArmorChecksum      When Base64 encoding with a line width,
+                                         compute the OpenPGP CRC-24 of the input in
+                                         the same pass and have CNEncoderFinal()
+                                         append the "=XXXX" checksum line of an
+                                         ASCII armored message (RFC 4880).
+ */
+
+enum {
+    kCNDecodeIgnoreWhitespace   = 0x0001,
+    kCNEncodeArmorChecksum      = 0x0002,
+};
+typedef uint32_t CNEncoderOptions;
+
 /*!
     @typedef    CNEncoderRef
     @abstract   Opaque reference to a CNEncoder object.
@@ -114,6 +134,31 @@ CNEncoderCreate(CNEncodings encoding,
                          CNEncoderRef *encoderRef)  /* RETURNED */
 API_AVAILABLE(macos(10.9), ios(5.0));
 
+/*!
+    @function   CNEncoderCreateWithOptions
+    @abstract   Create a base encoder context with line handling options.
+    @param      encoding    selects one of the base encodings above.
+    @param      direction   Designate the direction (encode or decode) for this
+                            CNEncoderRef.
+    @param      options     kCNDecodeIgnoreWhitespace (decode only),
+                            kCNEncodeArmorChecksum (kCNEncodingBase64 encode with a
+                            non-zero lineWidth only) or 0.
+    @param      lineWidth   When encoding, the number of characters after which a
+                            newline is emitted; CNEncoderFinal() ends a partial last
+                            line with a newline as well.  Zero for unbroken output.
+                            Must be zero when decoding.
+    @param      encoderRef  A (required) pointer to the returned CNEncoderRef.
+    @result     kCNSuccess or one of kCNParamError, kCNMemoryFailure.
+ */
+
+CNStatus
+CNEncoderCreateWithOptions(CNEncodings encoding,
+                           CNEncodingDirection direction,
+                           CNEncoderOptions options,
+                           size_t lineWidth,
+                           CNEncoderRef *encoderRef)  /* RETURNED */
+API_AVAILABLE(macos(10.14), ios(12.0));
+
 /*!
     @function   CCEncoderCreateCustom
     @abstract   Create a custom base encoder context.
@@ -209,6 +254,38 @@ CNEncoderUpdate(CNEncoderRef coderRef, const void *in, const size_t inLen, void
 API_AVAILABLE(macos(10.9), ios(6.0));
 
 
+/*!
+    @function   CNEncoderUpdateV
+    @abstract   Scatter-gather form of CNEncoderUpdate().  The elements of the
+                iovec array are processed in order as one contiguous input;
+                whole blocks are processed straight from the caller's memory
+                and only a block split across elements is copied.
+
+	@param      coderRef  A CNEncoderRef obtained through CNEncoderCreate()
+                            or CNEncoderCreateCustom().
+
+	@param      iov         The input buffers.
+
+	@param		iovcnt		The number of elements in iov.
+
+	@param		out			The destination of the processed data.
+
+	@param		outLen		On input the space available at out, on output the
+                            length of the processed data.
+
+    @result     kCNSuccess or one of kCNParamError, kCNBufferTooSmall.
+*/
+
+#if !defined(_WIN32)
+struct iovec;
+
+CNStatus
+CNEncoderUpdateV(CNEncoderRef coderRef, const struct iovec *iov, int iovcnt, void *out,
+         size_t *outLen)
+API_AVAILABLE(macos(10.14), ios(12.0));
+#endif
+
+
 /*!
  @function   CNEncoderFinal
  @abstract   Complete coding for all available inputs, padding where necessary.
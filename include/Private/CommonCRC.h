@@ -32,6 +32,14 @@
 
 typedef struct _CNCRCRef_t *CNCRCRef;
 
+/*!
+ @typedef    CNCRCContext
+ @abstract   Caller-allocated storage for a CNCRCRef, see CNCRCInitWithStorage().
+ */
+typedef struct CNCRCContext_t {
+    uint64_t opaque[6];
+} CNCRCContext;
+
 enum {
     kCN_CRC_8 = 10,
     kCN_CRC_8_ICODE = 11,
@@ -50,6 +58,7 @@ enum {
     kCN_CRC_16_A = 29,
     kCN_CRC_16_B = 30,
     kCN_CRC_16_Fletcher = 31,
+    kCN_CRC_24_OPENPGP = 35,
     kCN_CRC_32_Adler = 40,
     kCN_CRC_32 = 41,
     kCN_CRC_32_CASTAGNOLI = 42,
@@ -57,6 +66,7 @@ enum {
     kCN_CRC_32_MPEG_2 = 44,
     kCN_CRC_32_POSIX = 45,
     kCN_CRC_32_XFER = 46,
+    kCN_CRC_32_Fletcher = 47,
     kCN_CRC_64_ECMA_182 = 60,
 };
 typedef uint32_t CNcrc;
@@ -77,6 +87,48 @@ CNStatus
 CNCRC(CNcrc algorithm, const void *in, size_t len, uint64_t *result)
 API_AVAILABLE(macos(10.9), ios(6.0));
 
+/*!
+ @function   CNCRCParallel
+ @abstract   One-shot CRC function that spreads large inputs over several threads.
+
+ @param      algorithm  Designates the CRC algorithm to use.
+ @param      in         The data to be checksummed.
+ @param      len        The length of the data to be checksummed.
+ @param      nthreads   The maximum number of threads to use, or 0 for one per CPU.
+ @param      result     The resulting checksum.
+
+ @discussion The result is identical to CNCRC().  Inputs too small to be worth
+             splitting, and checksums that cannot be combined, are computed on
+             the calling thread.
+
+ @result     Possible error returns are kCNParamError, kCNMemoryFailure and kCNUnimplemented.
+ */
+
+CNStatus
+CNCRCParallel(CNcrc algorithm, const void *in, size_t len, size_t nthreads, uint64_t *result)
+API_AVAILABLE(macos(10.14), ios(12.0));
+
+/*!
+ @function   CNCRCBatch
+ @abstract   One-shot CRC function over several independent buffers.
+
+ @param      algorithm  Designates the CRC algorithm to use.
+ @param      bufs       The n buffers to be checksummed.
+ @param      lens       The length of each buffer.
+ @param      n          The number of buffers.
+ @param      results    Receives the n checksums, in the order of bufs.
+
+ @discussion Each result is identical to CNCRC() on that buffer.  Buffers are
+             processed several at a time so that many small records are
+             checksummed faster than with one call each.
+
+ @result     Possible error returns are kCNParamError and kCNUnimplemented.
+ */
+
+CNStatus
+CNCRCBatch(CNcrc algorithm, const void *const *bufs, const size_t *lens, size_t n, uint64_t *results)
+API_AVAILABLE(macos(10.14), ios(12.0));
+
 /*!
  @function   CNCRCInit
  @abstract   Initialize a CNCRCRef.
@@ -91,6 +143,52 @@ CNStatus
 CNCRCInit(CNcrc algorithm, CNCRCRef *crcRef)
 API_AVAILABLE(macos(10.9), ios(6.0));
 
+/*!
+ @function   CNCRCInitWithStorage
+ @abstract   Initialize a CNCRCRef in caller-supplied memory.
+
+ @param      algorithm  Designates the CRC algorithm to use.
+ @param      storage    Memory for the CRC state, typically on the stack.  It must
+                        outlive the returned reference.
+ @param      crcRef     The resulting CNCRCRef, which points into storage.
+
+ @discussion No memory is allocated.  The reference is used with CNCRCUpdate()
+             and CNCRCFinal() like one from CNCRCInit(); CNCRCRelease() may be
+             called on it but is not required.
+
+ @result     Possible error returns are kCNParamError and kCNUnimplemented.
+ */
+
+CNStatus
+CNCRCInitWithStorage(CNcrc algorithm, CNCRCContext *storage, CNCRCRef *crcRef)
+API_AVAILABLE(macos(10.14), ios(12.0));
+
+/*!
+ @function   CNCRCCreateCustom
+ @abstract   Initialize a CNCRCRef for a CRC model not covered by CNcrc.
+
+ @param      width            The width of the CRC in bits, 1 to 64.
+ @param      poly             The generator polynomial, normal (unreflected) form,
+                              without the leading x^width term.
+ @param      init             The initial register value, unreflected.
+ @param      xorout           The value XORed into the final register.
+ @param      reflect_reverse  Nonzero if input bytes are reflected and the
+                              result is reversed (refin = refout = true).
+ @param      crcRef           The resulting CNCRCRef.
+
+ @discussion The parameters follow the usual catalogue conventions, e.g. CRC-64/XZ
+             is (64, 0x42F0E1EBA9EA3693, ~0, ~0, 1).  Tables are built the first
+             time a model is used and kept for the life of the process, so
+             creating the same model again is cheap.  Use CNCRCUpdate(),
+             CNCRCFinal() and CNCRCRelease() with the returned reference.
+
+ @result     Possible error returns are kCNParamError and kCNMemoryFailure.
+ */
+
+CNStatus
+CNCRCCreateCustom(size_t width, uint64_t poly, uint64_t init, uint64_t xorout, int reflect_reverse, CNCRCRef *crcRef)
+API_AVAILABLE(macos(10.14), ios(12.0));
+
 /*!
  @function   CNCRCRelease
  @abstract   Release a CNCRCRef.
@@ -133,6 +231,26 @@ CNStatus
 CNCRCFinal(CNCRCRef crcRef, uint64_t *result)
 API_AVAILABLE(macos(10.9), ios(6.0));
 
+/*!
+ @function   CNCRCCombine
+ @abstract   Compute the CRC of two concatenated buffers from the CRCs of each.
+
+ @param      algorithm  Designates the CRC algorithm to use.
+ @param      crcA       The checksum of the first buffer.
+ @param      crcB       The checksum of the second buffer.
+ @param      lenB       The length of the second buffer.
+ @param      result     The checksum of the first buffer followed by the second.
+
+ @discussion The data is not needed; the cost grows with log(lenB).  Only
+             polynomial CRC models can be combined.
+
+ @result     Possible error returns are kCNParamError and kCNUnimplemented.
+ */
+
+CNStatus
+CNCRCCombine(CNcrc algorithm, uint64_t crcA, uint64_t crcB, size_t lenB, uint64_t *result)
+API_AVAILABLE(macos(10.14), ios(12.0));
+
 /*!
  @function   CNCRCWeakTest
  @abstract   Perform a "weak" test of a checksum.
@@ -119,6 +119,114 @@ CCCryptorStatus CCCryptorCreateFromDataWithMode(
 	size_t			*dataUsed)		/* optional, RETURNED */
 API_AVAILABLE(macos(10.7), ios(5.0));
 
+/*!
+    @function   CCCryptorGetContextSize
+    @abstract   Size of caller-supplied memory that holds an entire cryptor.
+
+    @param      op          kCCEncrypt, kCCDecrypt or kCCBoth.
+    @param      mode        The cipher mode.
+    @param      alg         The algorithm.
+
+    @result     The number of bytes which, passed to CCCryptorCreateFromData()
+                or CCCryptorCreateFromDataWithMode(), lets the cryptor and the
+                mode context for its direction be built in that memory. This
+                includes slack for aligning the memory to a cache line. Returns
+                0 if the combination is not supported.
+
+    @discussion Smaller memory is still accepted by the FromData calls, in which
+                case the cryptor itself is allocated as by CCCryptorCreate().
+                The memory may come from an arena or pool owned by the caller;
+                CCCryptorRelease() clears it but does not free it.
+
+                An ECB, CBC or XTS cryptor created for one direction keys the
+                other on its first use through CCCryptorEncryptDataBlock() or
+                CCCryptorDecryptDataBlock(). That context is allocated even for
+                a cryptor in caller memory, and is freed by CCCryptorRelease().
+*/
+size_t CCCryptorGetContextSize(CCOperation op, CCMode mode, CCAlgorithm alg)
+API_AVAILABLE(macos(10.14), ios(12.0));
+
+/*!
+    @function   CCCryptorClone
+    @abstract   Create an independent copy of a cryptor, including its
+                expanded key schedule and current IV and buffered state.
+
+    @param      src         The CCCryptorRef to copy.
+    @param      dst         A (required) pointer to the returned CCCryptorRef,
+                            to be released with CCCryptorRelease().
+
+    @result     kCCParamError or kCCMemoryFailure on failure.
+
+    @discussion Key setup is done once, in a "template" cryptor that is kept
+                around and never used for data. Each message then gets a
+                clone of the template, followed by CCCryptorReset() for a
+                new IV. This skips key expansion, which is costly for
+                Blowfish in particular.
+*/
+CCCryptorStatus CCCryptorClone(CCCryptorRef src, CCCryptorRef *dst)
+API_AVAILABLE(macos(10.14), ios(12.0));
+
+/*!
+    @function   CCCryptorUpdateV
+    @abstract   Scatter-gather form of CCCryptorUpdate().
+
+    @param      cryptorRef  A CCCryptorRef created via CCCryptorCreate() or
+                            CCCryptorCreateFromData().
+    @param      in          The input buffers, processed in order as one
+                            contiguous input.
+    @param      inCnt       The number of elements in in.
+    @param      out         The output buffers, filled in order as one
+                            contiguous output.
+    @param      outCnt      The number of elements in out.
+    @param      dataOutMoved On successful return, the number of bytes written
+                            across the output buffers. On kCCBufferTooSmall,
+                            the total output space required.
+
+    @result     kCCSuccess or one of kCCParamError, kCCBufferTooSmall.
+
+    @discussion Produces exactly what CCCryptorUpdate() would for the
+                concatenated input. Whole blocks are processed straight from
+                the input elements into the output elements; only a block
+                split across elements on either side is copied.
+*/
+#if !defined(_WIN32)
+struct iovec;
+
+CCCryptorStatus CCCryptorUpdateV(CCCryptorRef cryptorRef, const struct iovec *in, int inCnt,
+    const struct iovec *out, int outCnt, size_t *dataOutMoved)
+API_AVAILABLE(macos(10.14), ios(12.0));
+#endif
+
+/*!
+    @function   CCCryptBatch
+    @abstract   CCCrypt() over many independent messages under one key.
+
+    @param      op, alg, options, key, keyLength
+                            As for CCCrypt().
+    @param      count       The number of messages.
+    @param      ivs         Optional; if present, ivs[i] is the (optional)
+                            initialization vector for message i.
+    @param      dataIn      dataIn[i] is the input of message i, dataInLength[i]
+                            bytes long.
+    @param      dataInLength The lengths of the inputs.
+    @param      dataOut     dataOut[i] receives the output of message i, with
+                            dataOutAvailable[i] bytes of space.
+    @param      dataOutAvailable The space available at each output.
+    @param      dataOutMoved Optional; dataOutMoved[i] is set as CCCrypt() would
+                            set it for message i.
+
+    @result     kCCSuccess if every message succeeded, otherwise the error of
+                the first message that failed. Every message is attempted.
+
+    @discussion The key is expanded once and no memory is allocated per message,
+                which dominates the cost of CCCrypt() for short messages.
+*/
+CCCryptorStatus CCCryptBatch(CCOperation op, CCAlgorithm alg, CCOptions options,
+    const void *key, size_t keyLength, size_t count, const void * const *ivs,
+    const void * const *dataIn, const size_t *dataInLength, void * const *dataOut,
+    const size_t *dataOutAvailable, size_t *dataOutMoved)
+API_AVAILABLE(macos(10.14), ios(12.0));
+
 
 /*
 	Assuming we can use existing CCCryptorCreateFromData for all modes serviced by these:
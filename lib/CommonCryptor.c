@@ -36,6 +36,9 @@
 #include "CommonCryptorPriv.h"
 
 #include "CCCryptorReset_internal.h"
+#if !defined(_WIN32)
+#include <sys/uio.h>
+#endif
 
 #ifdef DEBUG
 #include <stdio.h>
@@ -112,22 +115,22 @@ static inline CCCryptorStatus ccSetupCryptor(CCCryptor *ref, CCAlgorithm cipher,
     
     ref->mode = mode;
     CCOperation op = direction;
-    if(ref->mode == kCCModeXTS || ref->mode == kCCModeECB || ref->mode == kCCModeCBC) op = kCCBoth;
+    ref->symMode[kCCEncrypt].ecb = NULL;
+    ref->symMode[kCCDecrypt].ecb = NULL;
     ref->ctx[kCCEncrypt].data = NULL;
     ref->ctx[kCCDecrypt].data = NULL;
     
     // printf("Cryptor setup - cipher %d mode %d direction %d padding %d\n", cipher, mode, direction, padding);
+    // Contexts are placed later by ccLayoutCryptor once the total size is known.
+    // ECB, CBC and XTS cryptors for one direction get the other one lazily - see ccLazyContext.
     switch(op) {
         case kCCEncrypt:
         case kCCDecrypt:
             if((retval = setCryptorCipherMode(ref, cipher, mode, op)) != kCCSuccess) return retval;
-            if((ref->ctx[op].data = CC_XMALLOC(ref->modeDesc->mode_get_ctx_size(ref->symMode[op]))) == NULL) return kCCMemoryFailure;
             break;
         case kCCBoth:
             if((retval = setCryptorCipherMode(ref, cipher, mode, kCCEncrypt)) != kCCSuccess) return retval;
-            if((ref->ctx[kCCEncrypt].data = CC_XMALLOC(ref->modeDesc->mode_get_ctx_size(ref->symMode[kCCEncrypt]))) == NULL) return kCCMemoryFailure;
             if((retval = setCryptorCipherMode(ref, cipher, mode, kCCDecrypt)) != kCCSuccess) return retval;
-            if((ref->ctx[kCCDecrypt].data = CC_XMALLOC(ref->modeDesc->mode_get_ctx_size(ref->symMode[kCCDecrypt]))) == NULL) return kCCMemoryFailure;
             break;
     }
     
@@ -158,6 +161,9 @@ static inline CCCryptorStatus ccSetupCryptor(CCCryptor *ref, CCAlgorithm cipher,
     ref->op = direction;
     ref->bufferPos = 0;
     ref->bytesProcessed = 0;
+    ref->lazySetup = NULL;
+    ref->lazyKeyLength = 0;
+    ref->lazyTweak = false;
     return kCCSuccess;
 }
 
@@ -191,6 +197,20 @@ static int check_algorithm_keysize(CCAlgorithm alg, size_t keysize)
 
 }
 
+static size_t ccMaxKeySize(CCAlgorithm alg)
+{
+    switch (alg) {
+        case kCCAlgorithmAES: return kCCKeySizeAES256;
+        case kCCAlgorithmDES: return kCCKeySizeDES;
+        case kCCAlgorithm3DES: return kCCKeySize3DES;
+        case kCCAlgorithmCAST: return kCCKeySizeMaxCAST;
+        case kCCAlgorithmRC4: return kCCKeySizeMaxRC4;
+        case kCCAlgorithmRC2: return kCCKeySizeMaxRC2;
+        case kCCAlgorithmBlowfish: return kCCKeySizeMaxBlowfish;
+        default: return 0;
+    }
+}
+
 static inline CCCryptorStatus ccInitCryptor(CCCryptor *ref, const void *key, unsigned long key_len, const void *tweak_key, const void *iv)
 {
     if( check_algorithm_keysize(ref->cipher, key_len) <0 )
@@ -204,12 +224,7 @@ static inline CCCryptorStatus ccInitCryptor(CCCryptor *ref, const void *key, uns
         iv = defaultIV;
     }
      
-    CCOperation op = ref->op;
-    
-    // This will create both sides of the context/mode pairs for now.
-    if(ref->mode == kCCModeXTS || ref->mode == kCCModeECB || ref->mode == kCCModeCBC) op = kCCBoth;
-    
-    switch(op) {
+    switch(ref->op) {
         case kCCEncrypt:
         case kCCDecrypt:
             ref->modeDesc->mode_setup(ref->symMode[ref->op], iv, key, key_len, tweak_key, 0, 0, ref->ctx[ref->op]);
@@ -219,29 +234,78 @@ static inline CCCryptorStatus ccInitCryptor(CCCryptor *ref, const void *key, uns
             ref->modeDesc->mode_setup(ref->symMode[kCCDecrypt], iv, key, key_len, tweak_key, 0, 0, ref->ctx[kCCDecrypt]);
             break;
     }
+    
+    // Keep what the other direction needs to be keyed the same way later.
+    if(ref->lazySetup) {
+        CC_XMEMCPY(ref->lazySetup, iv, blocksize);
+        CC_XMEMCPY(ref->lazySetup + blocksize, key, key_len);
+        if(ref->lazyTweak) CC_XMEMCPY(ref->lazySetup + blocksize + key_len, tweak_key, key_len);
+    }
     return kCCSuccess;    
 }
 
+/*
+ * ECB, CBC and XTS cryptors can be driven in the opposite direction through
+ * CCCryptor{En,De}cryptDataBlock. Rather than keying both directions for
+ * every cryptor, the one that wasn't asked for is set up on first use.
+ */
+static inline bool ccHasLazyDirection(CCCryptor *ref) {
+    return (ref->op == kCCEncrypt || ref->op == kCCDecrypt) &&
+        (ref->mode == kCCModeXTS || ref->mode == kCCModeECB || ref->mode == kCCModeCBC);
+}
+
+static inline size_t ccLazySetupSize(CCCryptor *ref) {
+    if(!ref->lazyKeyLength) return 0;
+    return ccGetCipherBlockSize(ref) + ref->lazyKeyLength * (ref->lazyTweak ? 2 : 1);
+}
+
+static CCCryptorStatus ccLazyContext(CCCryptor *ref, CCOperation direction) {
+    CCCryptorStatus retval;
+    
+    if(ref->ctx[direction].data) return kCCSuccess;
+    if(!ref->lazySetup) return kCCParamError;
+    if((retval = setCryptorCipherMode(ref, ref->cipher, ref->mode, direction)) != kCCSuccess) return retval;
+    if((ref->ctx[direction].data = CC_XMALLOC(ref->modeDesc->mode_get_ctx_size(ref->symMode[direction]))) == NULL) {
+        ref->symMode[direction].ecb = NULL;
+        return kCCMemoryFailure;
+    }
+    ref->lazyAllocated = true;
+    
+    const uint8_t *iv = ref->lazySetup;
+    const uint8_t *key = iv + ccGetCipherBlockSize(ref);
+    ref->modeDesc->mode_setup(ref->symMode[direction], iv, key, ref->lazyKeyLength,
+                              ref->lazyTweak ? key + ref->lazyKeyLength : NULL, 0, 0, ref->ctx[direction]);
+    return kCCSuccess;
+}
+
 static inline CCCryptorStatus ccDoEnCrypt(CCCryptor *ref, const void *dataIn, size_t dataInLength, void *dataOut) {
+    CCCryptorStatus retval;
     if(!ref->modeDesc->mode_encrypt) return kCCParamError;
+    if((retval = ccLazyContext(ref, kCCEncrypt)) != kCCSuccess) return retval;
     ref->modeDesc->mode_encrypt(ref->symMode[kCCEncrypt], dataIn, dataOut, dataInLength, ref->ctx[kCCEncrypt]);
     return kCCSuccess;
 }
 
 static inline CCCryptorStatus ccDoDeCrypt(CCCryptor *ref, const void *dataIn, size_t dataInLength, void *dataOut) {
+    CCCryptorStatus retval;
     if(!ref->modeDesc->mode_decrypt) return kCCParamError;
+    if((retval = ccLazyContext(ref, kCCDecrypt)) != kCCSuccess) return retval;
     ref->modeDesc->mode_decrypt(ref->symMode[kCCDecrypt], dataIn, dataOut, dataInLength, ref->ctx[kCCDecrypt]);
     return kCCSuccess;
 }
 
 static inline CCCryptorStatus ccDoEnCryptTweaked(CCCryptor *ref, const void *dataIn, size_t dataInLength, void *dataOut, const void *tweak) {
+    CCCryptorStatus retval;
     if(!ref->modeDesc->mode_encrypt_tweaked) return kCCParamError;
+    if((retval = ccLazyContext(ref, kCCEncrypt)) != kCCSuccess) return retval;
     ref->modeDesc->mode_encrypt_tweaked(ref->symMode[kCCEncrypt], dataIn, dataInLength, dataOut, tweak, ref->ctx[kCCEncrypt]);
     return kCCSuccess;
 }
 
 static inline CCCryptorStatus ccDoDeCryptTweaked(CCCryptor *ref, const void *dataIn, size_t dataInLength, void *dataOut, const void *tweak) {
+    CCCryptorStatus retval;
     if(!ref->modeDesc->mode_decrypt_tweaked) return kCCParamError;
+    if((retval = ccLazyContext(ref, kCCDecrypt)) != kCCSuccess) return retval;
     ref->modeDesc->mode_decrypt_tweaked(ref->symMode[kCCDecrypt], dataIn, dataInLength, dataOut, tweak, ref->ctx[kCCDecrypt]);
     return kCCSuccess;
 }
@@ -261,31 +325,90 @@ static inline CCCryptorStatus ccSetIV(CCCryptor *ref, const void *iv, size_t ivL
 }
 
 static inline void ccClearCryptor(CCCryptor *ref) {
-    CC_XZEROMEM(ref->buffptr, sizeof(ref->buffptr));
-    CCOperation op = ref->op;
+    void *block = ref->block;
+    size_t blockSize = ref->blockSize;
+    bool allocated = ref->allocated;
     
-    // This will clear both sides of the context/mode pairs for now.
-    if(ref->mode == kCCModeXTS || ref->mode == kCCModeECB || ref->mode == kCCModeCBC) op = kCCBoth;
-    switch(op) {
-        case kCCEncrypt:
-        case kCCDecrypt:
-            CC_XZEROMEM(ref->ctx[ref->op].data, ref->modeDesc->mode_get_ctx_size(ref->symMode[ref->op]));
-            CC_XFREE(ref->ctx[ref->op].data, ref->modeDesc->mode_get_ctx_size(ref->symMode[ref->op]));
-            break;
-        case kCCBoth:
-            for(int i = 0; i<2; i++) {
-                CC_XZEROMEM(ref->ctx[i].data, ref->modeDesc->mode_get_ctx_size(ref->symMode[i]));
-                CC_XFREE(ref->ctx[i].data, ref->modeDesc->mode_get_ctx_size(ref->symMode[i]));
-            }
-            break;
+    if(ref->lazyAllocated) {
+        CCOperation lazy = (ref->op == kCCEncrypt) ? kCCDecrypt : kCCEncrypt;
+        size_t ctxSize = ref->modeDesc->mode_get_ctx_size(ref->symMode[lazy]);
+        CC_XZEROMEM(ref->ctx[lazy].data, ctxSize);
+        CC_XFREE(ref->ctx[lazy].data, ctxSize);
     }
-    cc_clear(CCCRYPTOR_SIZE, ref);
+    
+    // The struct, its mode contexts and the retained key live in the one block.
+    CC_XZEROMEM(block, blockSize);
+    if(allocated) CC_XFREE(block, blockSize);
 }
 
 static inline void returnLengthIfPossible(size_t length, size_t *returnPtr) {
     if(returnPtr) *returnPtr = length;
 }
 
+#define CC_ALIGN_UP(X) (((X) + CC_CRYPTOR_ALIGN - 1) & ~((size_t) CC_CRYPTOR_ALIGN - 1))
+
+/*
+ * Bytes needed for the cryptor struct followed by each mode context set up
+ * by ccSetupCryptor, each starting on a CC_CRYPTOR_ALIGN boundary, and then
+ * any retained key material.
+ */
+static inline size_t ccLayoutSize(CCCryptor *ref) {
+    size_t needed = CC_ALIGN_UP(CCCRYPTOR_SIZE);
+    for(int i = 0; i < CC_DIRECTIONS; i++)
+        if(ref->symMode[i].ecb) needed += CC_ALIGN_UP(ref->modeDesc->mode_get_ctx_size(ref->symMode[i]));
+    return needed + ccLazySetupSize(ref);
+}
+
+/*
+ * Copy a set up (but not yet initialised) prototype into mem and point its
+ * contexts at the space behind it. Returns NULL if memLength is too small;
+ * either way the number of bytes needed from mem is returned via used.
+ */
+static inline CCCryptor *
+ccLayoutCryptor(CCCryptor *proto, void *mem, size_t memLength, size_t *used) {
+    uintptr_t start = CC_ALIGN_UP((uintptr_t) mem);
+    size_t needed = (size_t) (start - (uintptr_t) mem) + ccLayoutSize(proto);
+    returnLengthIfPossible(needed, used);
+    if(needed > memLength) return NULL;
+    
+    CCCryptor *ref = (CCCryptor *) start;
+    CC_XMEMCPY(ref, proto, CCCRYPTOR_SIZE);
+    uint8_t *p = (uint8_t *) start + CC_ALIGN_UP(CCCRYPTOR_SIZE);
+    for(int i = 0; i < CC_DIRECTIONS; i++) {
+        if(!ref->symMode[i].ecb) continue;
+        ref->ctx[i].data = p;
+        p += CC_ALIGN_UP(ref->modeDesc->mode_get_ctx_size(ref->symMode[i]));
+    }
+    ref->lazySetup = ref->lazyKeyLength ? p : NULL;
+    ref->lazyAllocated = false;
+    ref->block = mem;
+    ref->blockSize = needed;
+    ref->allocated = false;
+    return ref;
+}
+
+static inline CCCryptor *
+ccAllocCryptor(CCCryptor *proto) {
+    size_t allocSize = CC_CRYPTOR_ALIGN - 1 + ccLayoutSize(proto);
+    void *block;
+    
+    if((block = CC_XMALLOC(allocSize)) == NULL) return NULL;
+    CCCryptor *ref = ccLayoutCryptor(proto, block, allocSize, NULL);
+    ref->allocated = true;
+    return ref;
+}
+
+/*
+ * Copy the keyed mode contexts and any retained key of src into dst, which
+ * must have been laid out from src.
+ */
+static inline void ccCopyCryptorState(CCCryptor *dst, CCCryptor *src) {
+    for(int i = 0; i < CC_DIRECTIONS; i++)
+        if(src->symMode[i].ecb)
+            CC_XMEMCPY(dst->ctx[i].data, src->ctx[i].data, src->modeDesc->mode_get_ctx_size(src->symMode[i]));
+    if(src->lazySetup) CC_XMEMCPY(dst->lazySetup, src->lazySetup, ccLazySetupSize(src));
+}
+
 static inline CCCryptorStatus ccEncryptPad(CCCryptor *cryptor, void *buf, size_t *moved) {
     if(cryptor->padptr->encrypt_pad(cryptor->ctx[cryptor->op], cryptor->modeDesc, cryptor->symMode[cryptor->op], cryptor->buffptr, cryptor->bufferPos, buf, moved)) return kCCAlignmentError;
     return kCCSuccess;
@@ -324,6 +447,20 @@ static inline int ccAddBuff(CCCryptor *cryptor, const void *dataIn, size_t dataI
 }
 
 
+/*
+ * Translate the CCOptions of the original (pre mode) interfaces into a mode
+ * and padding - old calls only supported ECB and CBC, and we treat RC4 as a
+ * "mode" in that it's the only streaming cipher currently supported.
+ */
+static inline void ccModeFromOptions(CCAlgorithm alg, CCOptions options, CCMode *mode, CCPadding *padding) {
+    if(alg == kCCAlgorithmRC4) *mode = kCCModeRC4;
+    else if(options & kCCOptionECBMode) *mode = kCCModeECB;
+    else *mode = kCCModeCBC;
+    
+    /* Only PKCS7 padding was available */
+    *padding = (options & kCCOptionPKCS7Padding) ? ccPKCS7Padding : ccNoPadding;
+}
+
 CCCryptorStatus CCCryptorCreateFromData(
     CCOperation op,             /* kCCEncrypt, etc. */
     CCAlgorithm alg,            /* kCCAlgorithmDES, etc. */
@@ -337,11 +474,11 @@ CCCryptorStatus CCCryptorCreateFromData(
     size_t *dataUsed)			/* optional, RETURNED */
 
 {
-    CCCryptor *cryptor = ccCreateCompatCryptorFromData(data, dataLength, dataUsed);
-    if(!cryptor) return kCCBufferTooSmall;
-    CCCryptorStatus err = CCCryptorCreate(op, alg, options, key,  keyLength, iv, &cryptor->compat);
-    if(err == kCCSuccess) *cryptorRef = cryptor;    
-    return err;
+    CCMode mode;
+    CCPadding padding;
+    
+    ccModeFromOptions(alg, options, &mode, &padding);
+    return CCCryptorCreateFromDataWithMode(op, mode, alg, padding, iv, key, keyLength, NULL, 0, 0, 0, data, dataLength, cryptorRef, dataUsed);
 }
 
 CCCryptorStatus CCCryptorCreate(
@@ -361,17 +498,7 @@ CCCryptorStatus CCCryptorCreate(
 	CCModeOptions 	modeOptions;
     
     CC_DEBUG_LOG("Entering\n");
-	/* Determine mode from options - old call only supported ECB and CBC 
-       we treat RC4 as a "mode" in that it's the only streaming cipher
-       currently supported 
-    */
-    if(alg == kCCAlgorithmRC4) mode = kCCModeRC4;
-    else if(options & kCCOptionECBMode) mode = kCCModeECB;
-	else mode = kCCModeCBC;
-    
-	/* Determine padding from options - only PKCS7 was available */
-    padding = ccNoPadding;
-	if(options & kCCOptionPKCS7Padding) padding = ccPKCS7Padding;
+    ccModeFromOptions(alg, options, &mode, &padding);
    
 	/* No tweak was ever used */
    	tweak = NULL;
@@ -386,50 +513,32 @@ CCCryptorStatus CCCryptorCreate(
 	return CCCryptorCreateWithMode(op, mode, alg, padding, iv, key, keyLength, tweak, tweakLength, numRounds, modeOptions, cryptorRef);
 }
 
-/* This version mallocs the CCCryptorRef */
+#define KEYALIGNMENT (sizeof(int)-1)
 
-CCCryptorStatus CCCryptorCreateFromDataWithMode(
-    CCOperation 	op,				/* kCCEncrypt, kCCEncrypt, kCCBoth (default for BlockMode) */
+/*
+ * Common creation path. The cryptor and its mode contexts are laid out in a
+ * single block: caller-supplied memory when data is non-NULL, otherwise one
+ * CC_XMALLOC sized for this mode and algorithm.
+ */
+static CCCryptorStatus ccCreateCryptor(
+    CCOperation 	op,
     CCMode			mode,
     CCAlgorithm		alg,
-    CCPadding		padding,		
-    const void 		*iv,			/* optional initialization vector */
-    const void 		*key,			/* raw key material */
-    size_t 			keyLength,	
-    const void 		*tweak,			/* raw tweak material */
-    size_t 			tweakLength,	
-    int				numRounds,
+    CCPadding		padding,
+    const void 		*iv,
+    const void 		*key,
+    size_t 			keyLength,
+    const void 		*tweak,
     CCModeOptions 	options,
-    const void		*data,			/* caller-supplied memory */
-    size_t			dataLength,		/* length of data in bytes */
-    CCCryptorRef	*cryptorRef,	/* RETURNED */
-    size_t			*dataUsed)		/* optional, RETURNED */
-{
-    CCCryptor *cryptor = ccCreateCompatCryptorFromData(data, dataLength, dataUsed);
-    if(!cryptor) return kCCBufferTooSmall;
-    CCCryptorStatus err = CCCryptorCreateWithMode(op, mode, alg, padding, iv, key,  keyLength, tweak, tweakLength, numRounds, options, &cryptor->compat);
-    if(err == kCCSuccess) *cryptorRef = cryptor;    
-    return err;
-}
-
-#define KEYALIGNMENT (sizeof(int)-1)
-CCCryptorStatus CCCryptorCreateWithMode(
-	CCOperation 	op,				/* kCCEncrypt, kCCEncrypt, kCCBoth (default for BlockMode) */
-	CCMode			mode,
-	CCAlgorithm		alg,
-	CCPadding		padding,		
-	const void 		*iv,			/* optional initialization vector */
-	const void 		*key,			/* raw key material */
-	size_t 			keyLength,	
-	const void 		*tweak,			/* raw tweak material */
-	size_t 			 __unused tweakLength,	
-	int				 __unused numRounds,		/* 0 == default */
-	CCModeOptions 	options,
-	CCCryptorRef	*cryptorRef)	/* RETURNED */
+    const void		*data,
+    size_t			dataLength,
+    CCCryptorRef	*cryptorRef,
+    size_t			*dataUsed)
 {
 	CCCryptorStatus retval = kCCSuccess;
+    CCCryptor proto;
 	CCCryptor *cryptor = NULL;
-    uint8_t *alignedKey = NULL;
+    uint32_t alignedKey[kCCKeySizeMaxRC4 / sizeof(uint32_t)];
 
     CC_DEBUG_LOG("Entering Op: %d Mode: %d Cipher: %d Padding: %d\n", op, mode, alg, padding);
 
@@ -454,26 +563,36 @@ CCCryptorStatus CCCryptorCreateWithMode(
     
     /*
      * Some implementations are sensitive to keys not being 4 byte aligned.
-     * We'll move the key into an aligned buffer for the call to setup
-     * the key schedule.
+     * We'll move the key into an aligned stack buffer for the call to setup
+     * the key schedule.  No algorithm takes a key longer than RC4's.
      */
     
     if((intptr_t) key & KEYALIGNMENT) {
-        if((alignedKey = CC_XMALLOC(keyLength)) == NULL) {
-            return kCCMemoryFailure;
-        }
+        if(keyLength > sizeof(alignedKey)) return kCCKeySizeError;
         CC_XMEMCPY(alignedKey, key, keyLength);
         key = alignedKey;
     }
     
-    if((cryptor = (CCCryptor *)CC_XMALLOC(DEFAULT_CRYPTOR_MALLOC)) == NULL) {
-        retval = kCCMemoryFailure;
+    proto.compat = NULL;
+    if((retval = ccSetupCryptor(&proto, alg, mode, op, padding)) != kCCSuccess) {
         goto out;
     }
-	
-    cryptor->compat = NULL;
+    if(ccHasLazyDirection(&proto)) {
+        if(check_algorithm_keysize(alg, keyLength) < 0) {
+            retval = kCCKeySizeError;
+            goto out;
+        }
+        proto.lazyKeyLength = keyLength;
+        proto.lazyTweak = (proto.mode == kCCModeXTS && tweak != NULL);
+    }
     
-    if((retval = ccSetupCryptor(cryptor, alg, mode, op, padding)) != kCCSuccess) {
+    if(data) {
+        if((cryptor = ccLayoutCryptor(&proto, (void *) data, dataLength, dataUsed)) == NULL) {
+            retval = kCCBufferTooSmall;
+            goto out;
+        }
+    } else if((cryptor = ccAllocCryptor(&proto)) == NULL) {
+        retval = kCCMemoryFailure;
         goto out;
     }
     
@@ -491,23 +610,87 @@ out:
     // Things to destroy if setup failed
     if(retval) {
         *cryptorRef = NULL;
-        if(cryptor) {
-            ccClearCryptor(cryptor);
-            CC_XFREE(cryptor, DEFAULT_CRYPTOR_MALLOC);
-        }
-    } else {
-        // printf("Blocksize = %d mode = %d pad = %d\n", ccGetBlockSize(cryptor), cryptor->mode, padding);
+        if(cryptor) ccClearCryptor(cryptor);
     }
     
     // Things to destroy all the time
-    if(alignedKey) {
-        CC_XZEROMEM(alignedKey, keyLength);
-        CC_XFREE(alignedKey, keyLength);
-    }
+    if(key == alignedKey) CC_XZEROMEM(alignedKey, keyLength);
     
     return retval;
 }
 
+/* This version uses the caller's memory for the CCCryptorRef */
+
+CCCryptorStatus CCCryptorCreateFromDataWithMode(
+    CCOperation 	op,				/* kCCEncrypt, kCCEncrypt, kCCBoth (default for BlockMode) */
+    CCMode			mode,
+    CCAlgorithm		alg,
+    CCPadding		padding,		
+    const void 		*iv,			/* optional initialization vector */
+    const void 		*key,			/* raw key material */
+    size_t 			keyLength,	
+    const void 		*tweak,			/* raw tweak material */
+    size_t 			__unused tweakLength,	
+    int				__unused numRounds,
+    CCModeOptions 	options,
+    const void		*data,			/* caller-supplied memory */
+    size_t			dataLength,		/* length of data in bytes */
+    CCCryptorRef	*cryptorRef,	/* RETURNED */
+    size_t			*dataUsed)		/* optional, RETURNED */
+{
+    if(data == NULL) return kCCParamError;
+    CCCryptorStatus err = ccCreateCryptor(op, mode, alg, padding, iv, key, keyLength, tweak, options, data, dataLength, cryptorRef, dataUsed);
+    if(err != kCCBufferTooSmall) return err;
+    
+    /*
+     * Too small for the whole cryptor (CCCryptorGetContextSize() reports what
+     * is needed). Existing callers size this memory by kCCContextSize*, so
+     * keep honouring them with a pointer to a malloced cryptor.
+     */
+    CCCryptor *cryptor = ccCreateCompatCryptorFromData(data, dataLength, dataUsed);
+    if(!cryptor) return kCCBufferTooSmall;
+    err = ccCreateCryptor(op, mode, alg, padding, iv, key, keyLength, tweak, options, NULL, 0, &cryptor->compat, NULL);
+    if(err == kCCSuccess) *cryptorRef = cryptor;    
+    return err;
+}
+
+/* This version mallocs the CCCryptorRef */
+
+CCCryptorStatus CCCryptorCreateWithMode(
+	CCOperation 	op,				/* kCCEncrypt, kCCEncrypt, kCCBoth (default for BlockMode) */
+	CCMode			mode,
+	CCAlgorithm		alg,
+	CCPadding		padding,		
+	const void 		*iv,			/* optional initialization vector */
+	const void 		*key,			/* raw key material */
+	size_t 			keyLength,	
+	const void 		*tweak,			/* raw tweak material */
+	size_t 			 __unused tweakLength,	
+	int				 __unused numRounds,		/* 0 == default */
+	CCModeOptions 	options,
+	CCCryptorRef	*cryptorRef)	/* RETURNED */
+{
+    return ccCreateCryptor(op, mode, alg, padding, iv, key, keyLength, tweak, options, NULL, 0, cryptorRef, NULL);
+}
+
+size_t CCCryptorGetContextSize(
+    CCOperation op,
+    CCMode mode,
+    CCAlgorithm alg)
+{
+    CCCryptor proto;
+    
+    if(alg == kCCAlgorithmAES128NoHardware || alg == kCCAlgorithmAES128WithHardware)
+        alg = kCCAlgorithmAES128;
+    if(ccSetupCryptor(&proto, alg, mode, op, ccNoPadding) != kCCSuccess) return 0;
+    if(ccHasLazyDirection(&proto)) {
+        proto.lazyKeyLength = ccMaxKeySize(alg);
+        proto.lazyTweak = (proto.mode == kCCModeXTS);
+    }
+    // Worst case, the caller's memory needs aligning to a cache line first.
+    return CC_CRYPTOR_ALIGN - 1 + ccLayoutSize(&proto);
+}
+
 
 CCCryptorStatus CCCryptorRelease(
 	CCCryptorRef cryptorRef)
@@ -515,13 +698,39 @@ CCCryptorStatus CCCryptorRelease(
     CCCryptor *cryptor = getRealCryptor(cryptorRef, 0);
     
     CC_DEBUG_LOG("Entering\n");
-    if(cryptor) {
-        ccClearCryptor(cryptor);
-        CC_XFREE(cryptor, DEFAULT_CRYPTOR_MALLOC);
-    }
+    if(cryptor) ccClearCryptor(cryptor);
 	return kCCSuccess;
 }
 
+CCCryptorStatus CCCryptorClone(
+    CCCryptorRef src,
+    CCCryptorRef *dst)
+{
+    CCCryptor *cryptor = getRealCryptor(src, 1);
+    CCCryptor *clone;
+    
+    CC_DEBUG_LOG("Entering\n");
+    if(!cryptor || !dst) return kCCParamError;
+    
+    /*
+     * ccAllocCryptor carries over the struct with its contexts re-pointed
+     * into the new block; the mode contexts hold no pointers of their own,
+     * so the key schedules, IV and chaining state copy byte for byte. A
+     * lazily keyed direction that is already in use moves into the block.
+     */
+    if((clone = ccAllocCryptor(cryptor)) == NULL) return kCCMemoryFailure;
+    ccCopyCryptorState(clone, cryptor);
+#ifdef DEBUG
+    if(CCRandomGenerateBytes(&clone->cryptorID, sizeof(clone->cryptorID)) != kCCSuccess) {
+        ccClearCryptor(clone);
+        return kCCRNGFailure;
+    }
+#endif
+    
+    *dst = clone;
+    return kCCSuccess;
+}
+
 #define FULLBLOCKSIZE(X,BLOCKSIZE) (((X)/(BLOCKSIZE))*BLOCKSIZE)
 #define FULLBLOCKREMAINDER(X,BLOCKSIZE) ((X)%(BLOCKSIZE))
 
@@ -694,6 +903,139 @@ CCCryptorStatus CCCryptorUpdate(
     return retval;
 }
 
+#if !defined(_WIN32)
+/*
+ * Position within an iovec chain for CCCryptorUpdateV.  The input cursor
+ * starts on the cryptor's own buffered bytes before moving on to the chain.
+ */
+typedef struct {
+    const struct iovec *iov;
+    int             cnt;
+    int             next;
+    uint8_t         *p;
+    size_t          left;
+} ccIOCursor;
+
+static inline void ccCursorAdvance(ccIOCursor *c, size_t n) {
+    c->p += n;
+    c->left -= n;
+    while(c->left == 0 && c->next < c->cnt) {
+        c->p = c->iov[c->next].iov_base;
+        c->left = c->iov[c->next].iov_len;
+        c->next++;
+    }
+}
+
+static inline void ccCursorGather(ccIOCursor *c, uint8_t *dst, size_t n) {
+    while(n) {
+        size_t len = (c->left < n) ? c->left: n;
+        CC_XMEMCPY(dst, c->p, len);
+        ccCursorAdvance(c, len);
+        dst += len; n -= len;
+    }
+}
+
+static inline void ccCursorScatter(ccIOCursor *c, const uint8_t *src, size_t n) {
+    while(n) {
+        size_t len = (c->left < n) ? c->left: n;
+        CC_XMEMCPY(c->p, src, len);
+        ccCursorAdvance(c, len);
+        src += len; n -= len;
+    }
+}
+
+static inline CCCryptorStatus ccDoCrypt(CCCryptor *cryptor, const void *dataIn, size_t dataInLength, void *dataOut) {
+    if(cryptor->op == kCCEncrypt) return ccDoEnCrypt(cryptor, dataIn, dataInLength, dataOut);
+    return ccDoDeCrypt(cryptor, dataIn, dataInLength, dataOut);
+}
+
+CCCryptorStatus CCCryptorUpdateV(
+    CCCryptorRef cryptorRef,
+    const struct iovec *in,
+    int inCnt,
+    const struct iovec *out,
+    int outCnt,
+    size_t *dataOutMoved)
+{
+    CC_DEBUG_LOG("Entering\n");
+    CCCryptorStatus retval = kCCSuccess;
+    CCCryptor *cryptor = getRealCryptor(cryptorRef, 1);
+    size_t inTotal = 0, outTotal = 0;
+    
+    if(dataOutMoved) *dataOutMoved = 0;
+    if(!cryptor || inCnt < 0 || outCnt < 0 || (inCnt && !in) || (outCnt && !out)) return kCCParamError;
+    for(int i = 0; i < inCnt; i++) {
+        if(!in[i].iov_base && in[i].iov_len) return kCCParamError;
+        inTotal += in[i].iov_len;
+    }
+    for(int i = 0; i < outCnt; i++) {
+        if(!out[i].iov_base && out[i].iov_len) return kCCParamError;
+        outTotal += out[i].iov_len;
+    }
+    if(0 == inTotal) return kCCSuccess;
+    
+    size_t needed = ccGetOutputLength(cryptor, inTotal, false);
+    if(needed > outTotal) {
+        if(dataOutMoved) *dataOutMoved = needed;
+        return kCCBufferTooSmall;
+    }
+    
+    /* Split between what is processed now and what stays buffered, as in ccBlockUpdate */
+    size_t blocksize = 1, dataCountToHold = 0;
+    size_t dataCount = cryptor->bufferPos + inTotal;
+    if(!ccIsStreaming(cryptor)) {
+        size_t reserve = ccGetReserve(cryptor);
+        blocksize = ccGetCipherBlockSize(cryptor);
+        if(dataCount <= reserve) {
+            dataCountToHold = dataCount;
+        } else if(FULLBLOCKREMAINDER(dataCount, blocksize)) {
+            dataCountToHold = ((reserve) ? reserve: blocksize) - blocksize + FULLBLOCKREMAINDER(dataCount, blocksize);
+        } else {
+            dataCountToHold = reserve;
+        }
+    }
+    size_t dataCountToProcess = dataCount - dataCountToHold;
+    
+    ccIOCursor src = { in, inCnt, 0, cryptor->buffptr, cryptor->bufferPos };
+    ccIOCursor dst = { out, outCnt, 0, NULL, 0 };
+    uint8_t blockIn[sizeof(cryptor->buffptr)], blockOut[sizeof(cryptor->buffptr)];
+    ccCursorAdvance(&src, 0);
+    ccCursorAdvance(&dst, 0);
+    
+    /*
+     * Whole blocks go straight from one element to another; only a block
+     * split across elements on either side passes through blockIn/blockOut.
+     */
+    for(size_t remaining = dataCountToProcess; remaining; ) {
+        size_t n = (src.left < dst.left) ? src.left: dst.left;
+        if(n > remaining) n = remaining;
+        n = FULLBLOCKSIZE(n, blocksize);
+        if(n) {
+            if((retval = ccDoCrypt(cryptor, src.p, n, dst.p)) != kCCSuccess) break;
+            ccCursorAdvance(&src, n);
+            ccCursorAdvance(&dst, n);
+        } else {
+            n = blocksize;
+            ccCursorGather(&src, blockIn, n);
+            if((retval = ccDoCrypt(cryptor, blockIn, n, blockOut)) != kCCSuccess) break;
+            ccCursorScatter(&dst, blockOut, n);
+        }
+        remaining -= n;
+    }
+    CC_XZEROMEM(blockOut, sizeof(blockOut));
+    if(retval != kCCSuccess) return retval;
+    
+    /* The unprocessed tail becomes the new buffered data */
+    ccCursorGather(&src, blockIn, dataCountToHold);
+    CC_XMEMCPY(cryptor->buffptr, blockIn, dataCountToHold);
+    CC_XZEROMEM(blockIn, sizeof(blockIn));
+    cryptor->bufferPos = dataCountToHold;
+    cryptor->bytesProcessed += dataCountToProcess;
+    if(dataOutMoved) *dataOutMoved = dataCountToProcess;
+    return kCCSuccess;
+}
+#endif /* !_WIN32 */
+
 
 
 CCCryptorStatus CCCryptorFinal(
@@ -837,6 +1179,31 @@ CCCryptorGetIV(CCCryptorRef cryptorRef, void *iv)
     return ccGetIV(cryptor, iv, &blocksize);
 }
 
+/* One message through a freshly keyed cryptor: the body of CCCrypt() */
+static CCCryptorStatus ccCryptOneShot(
+    CCCryptorRef cryptor,
+	const void *dataIn,
+	size_t dataInLength,
+	void *dataOut,
+	size_t dataOutAvailable,
+	size_t *dataOutMoved)
+{
+	CCCryptorStatus retval;
+	size_t updateLen, finalLen;
+
+    size_t needed = CCCryptorGetOutputLength(cryptor, dataInLength, true);
+    if(dataOutMoved != NULL) *dataOutMoved = needed;
+    if(needed > dataOutAvailable) return kCCBufferTooSmall;
+    
+	if(kCCSuccess != (retval = CCCryptorUpdate(cryptor, dataIn, dataInLength, dataOut, dataOutAvailable, &updateLen))) {
+        return retval;
+    }
+    dataOut += updateLen; dataOutAvailable -= updateLen;
+    retval = CCCryptorFinal(cryptor, dataOut, dataOutAvailable, &finalLen);
+    if(dataOutMoved != NULL) *dataOutMoved = updateLen + finalLen;
+    return retval;
+}
+
 /* 
  * One-shot is mostly service provider independent, except for the
  * dataOutLength check.
@@ -857,25 +1224,71 @@ CCCryptorStatus CCCrypt(
     CC_DEBUG_LOG("Entering\n");
 	CCCryptorRef cryptor = NULL;
 	CCCryptorStatus retval;
-	size_t updateLen, finalLen;
             
 	if(kCCSuccess != (retval = CCCryptorCreate(op, alg, options, key, keyLength, iv, &cryptor))) return retval;
-    size_t needed = CCCryptorGetOutputLength(cryptor, dataInLength, true);
-    if(dataOutMoved != NULL) *dataOutMoved = needed;
-    if(needed > dataOutAvailable) {
-        retval = kCCBufferTooSmall;
-        goto out;
+    retval = ccCryptOneShot(cryptor, dataIn, dataInLength, dataOut, dataOutAvailable, dataOutMoved);
+	CCCryptorRelease(cryptor);
+	return retval;
+}
+
+CCCryptorStatus CCCryptBatch(
+	CCOperation op,
+	CCAlgorithm alg,
+	CCOptions options,
+	const void *key,
+	size_t keyLength,
+	size_t count,
+	const void * const *ivs,
+	const void * const *dataIn,
+	const size_t *dataInLength,
+	void * const *dataOut,
+	const size_t *dataOutAvailable,
+	size_t *dataOutMoved)
+{
+    CC_DEBUG_LOG("Entering\n");
+	CCCryptorRef tmpl;
+	CCCryptorStatus retval, status = kCCSuccess;
+    CCMode mode;
+    CCPadding padding;
+    
+    if(0 == count) return kCCSuccess;
+    if(!dataIn || !dataInLength || !dataOut || !dataOutAvailable) return kCCParamError;
+    
+    ccModeFromOptions(alg, options, &mode, &padding);
+    size_t memSize = CCCryptorGetContextSize(op, mode, alg);
+    if(0 == memSize) return kCCParamError;
+    
+    /*
+     * The key is expanded once into a template.  Each message then runs on a
+     * working cryptor whose contexts are copied back from the template, so
+     * nothing is allocated or re-keyed per message.
+     */
+    uint8_t tmplMem[memSize], workMem[memSize];
+    if((retval = ccCreateCryptor(op, mode, alg, padding, NULL, key, keyLength, NULL, 0, tmplMem, memSize, &tmpl, NULL)) != kCCSuccess) {
+        return retval;
     }
+    CCCryptor *work = ccLayoutCryptor(tmpl, workMem, memSize, NULL);
     
-	if(kCCSuccess != (retval = CCCryptorUpdate(cryptor, dataIn, dataInLength, dataOut, dataOutAvailable, &updateLen))) {
-        goto out;
+    for(size_t i = 0; i < count; i++) {
+        const void *iv = (ivs) ? ivs[i]: NULL;
+        size_t moved = 0;
+        
+        ccCopyCryptorState(work, tmpl);
+        work->bufferPos = work->bytesProcessed = 0;
+#ifdef DEBUG
+        work->active = ACTIVE;
+#endif
+        retval = kCCSuccess;
+        if(iv && work->mode == kCCModeCBC) retval = ccSetIV(work, iv, ccGetCipherBlockSize(work));
+        if(retval == kCCSuccess)
+            retval = ccCryptOneShot(work, dataIn[i], dataInLength[i], dataOut[i], dataOutAvailable[i], &moved);
+        if(dataOutMoved) dataOutMoved[i] = moved;
+        if(status == kCCSuccess) status = retval;
     }
-    dataOut += updateLen; dataOutAvailable -= updateLen;
-    retval = CCCryptorFinal(cryptor, dataOut, dataOutAvailable, &finalLen);
-    if(dataOutMoved != NULL) *dataOutMoved = updateLen + finalLen;
-out:
-	CCCryptorRelease(cryptor);
-	return retval;
+    
+    ccClearCryptor(work);
+    ccClearCryptor(tmpl);
+	return status;
 }
 
 CCCryptorStatus CCCryptorEncryptDataBlock(
@@ -45,7 +45,7 @@ extern "C" {
     
     /* Byte-Size Constants */
 #define CCMAXBUFFERSIZE 128             /* RC2/RC5 Max blocksize */
-#define DEFAULT_CRYPTOR_MALLOC 4096
+#define CC_CRYPTOR_ALIGN 64             /* cache line; cryptor and mode contexts start on one */
 #define CC_STREAMKEYSCHED  2048
 #define CC_MODEKEYSCHED  2048
 #define CC_MAXBLOCKSIZE  128
@@ -72,6 +72,15 @@ typedef struct _CCCryptor {
     const cc2CCModeDescriptor *modeDesc;
     modeCtx         ctx[CC_DIRECTIONS];
     const cc2CCPaddingDescriptor *padptr;
+
+    void            *block;    /* single allocation holding this struct and ctx[] */
+    size_t          blockSize;
+    bool            allocated; /* block came from CC_XMALLOC rather than the caller */
+
+    uint8_t         *lazySetup;      /* iv, key and tweak for keying the other direction on first use */
+    size_t          lazyKeyLength;
+    bool            lazyTweak;
+    bool            lazyAllocated;   /* the other direction's ctx came from CC_XMALLOC */
     
 } CCCryptor;
     
@@ -103,7 +103,8 @@ static void init_globals_crc(void *g){
     globals->crcSelectionTab[kCN_CRC_16_VERIFONE].descriptor = &crc16_verifone;
     globals->crcSelectionTab[kCN_CRC_16_A].descriptor = &crc16_a;
     globals->crcSelectionTab[kCN_CRC_16_B].descriptor = &crc16_b;
-    globals->crcSelectionTab[kCN_CRC_16_Fletcher].descriptor = NULL;
+    globals->crcSelectionTab[kCN_CRC_16_Fletcher].descriptor = &fletcher16;
+    globals->crcSelectionTab[kCN_CRC_24_OPENPGP].descriptor = &crc24_openpgp;
     globals->crcSelectionTab[kCN_CRC_32_Adler].descriptor = &adler32;
     globals->crcSelectionTab[kCN_CRC_32].descriptor = &crc32;
     globals->crcSelectionTab[kCN_CRC_32_CASTAGNOLI].descriptor = &crc32_castagnoli;
@@ -111,6 +112,7 @@ static void init_globals_crc(void *g){
     globals->crcSelectionTab[kCN_CRC_32_MPEG_2].descriptor = &crc32_mpeg_2;
     globals->crcSelectionTab[kCN_CRC_32_POSIX].descriptor = &crc32_posix;
     globals->crcSelectionTab[kCN_CRC_32_XFER].descriptor = &crc32_xfer;
+    globals->crcSelectionTab[kCN_CRC_32_Fletcher].descriptor = &fletcher32;
     globals->crcSelectionTab[kCN_CRC_64_ECMA_182].descriptor = &crc64_ecma_182;
 }
 
@@ -23,10 +23,12 @@
 
 #include "basexx.h"
 #include <CommonNumerics/CommonBaseXX.h>
+#include <CommonNumerics/CommonCRC.h>
 #include "ccMemory.h"
 #include "CommonBufferingPriv.h"
 #include "ccGlobals.h"
 #include "cc_macros_priv.h"
+#include "crc.h"
 
 const static encoderConstants encoderValue[] = {
     { 16, 4, 1, 2, 0x0f }, // Base16
@@ -39,6 +41,11 @@ typedef struct _CNEncoder {
     CNEncodingDirection direction;
     CNBufferRef base256buffer;
     CNBufferRef baseXXbuffer;
+    CNEncoderOptions options;
+    size_t lineWidth;   // encode: characters per output line, 0 for none
+    size_t column;      // encode: characters written on the current line
+    CNCRCRef crc;       // encode: armor checksum state, NULL unless requested
+    CNCRCContext crcStorage;
 } CNEncoder;
 
 /*
@@ -152,6 +159,349 @@ static inline size_t encodeLen(void *ctx, size_t len)
 }
 
 
+/*
+ * Group codecs.  Every encoding has a natural group where both sides are
+ * byte aligned: 3 bytes <-> 4 characters for Base64, 5 <-> 8 for Base32 and
+ * 1 <-> 2 for Base16 (the inputBlocksize and outputBlocksize of its
+ * encoderConstants).  Whole groups are converted with a single load and
+ * shift sequence; only a trailing partial group goes through the general
+ * bit-by-bit loops in enCode/deCode.
+ */
+
+static inline int
+isStandardBase64(CNEncoder *coderRef)
+{
+    return coderRef->coderFrame->encoderRef->encoding == kCNEncodingBase64;
+}
+
+/*
+ * OR one decoded character into dest at character position i.  This is the
+ * original deCode step; note that characters outside the alphabet decode
+ * to 0x80 and their bits land in the output rather than being rejected.
+ */
+
+static inline void
+decodeBits(uint8_t srcByte, size_t i, int sourceBits, uint8_t *dest)
+{
+    int dBit = (i*sourceBits) % 8; // destination position of Leftmost Bit of source byte
+    int shiftl = (8-sourceBits) - dBit; // amount needed to shift left to get bits positioned
+    size_t dPos = (i*sourceBits) / 8; // destination byte of leftmost bit of source byte
+    
+    if(shiftl >= 0) {
+        dest[dPos] |= srcByte << shiftl;
+    } else if(shiftl < 0) {
+        int shiftr = shiftl * (-1);
+        dest[dPos] |= srcByte >> shiftr;
+        dest[dPos+1] |= srcByte << (8-shiftr);
+    } 
+}
+
+/*
+ * Characters are looked up through reverseMap with padding reading as 0.
+ * The values of a group are ORed together as they are gathered; if any of
+ * them is outside the alphabet the group is redone with decodeBits so the
+ * result matches the bitwise decoder exactly.
+ */
+
+#define DECODE_VALUE(c) (((c) == pad) ? 0 : map[(c)])
+
+static void
+decodeGroupBits(CNEncoder *coderRef, const uint8_t *src, uint8_t *dest)
+{
+    const uint8_t pad = coderRef->coderFrame->encoderRef->padding;
+    
+    CC_XZEROMEM(dest, inputBlocksize(coderRef));
+    for(uint32_t k=0; k<outputBlocksize(coderRef); k++)
+        if(src[k] != pad) decodeBits(decodeFromBase(coderRef, src[k]), k, baselog(coderRef), dest);
+}
+
+static void
+encodeGroups64(const char *charMap, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+    for(size_t g=0; g<groups; g++, src += 3, dest += 4) {
+        uint32_t n = ((uint32_t) src[0] << 16) | ((uint32_t) src[1] << 8) | src[2];
+        dest[0] = charMap[(n >> 18) & 0x3f];
+        dest[1] = charMap[(n >> 12) & 0x3f];
+        dest[2] = charMap[(n >> 6) & 0x3f];
+        dest[3] = charMap[n & 0x3f];
+    }
+}
+
+static void
+decodeGroups64(CNEncoder *coderRef, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+    const uint8_t *map = coderRef->coderFrame->reverseMap;
+    const uint8_t pad = coderRef->coderFrame->encoderRef->padding;
+    
+    for(size_t g=0; g<groups; g++, src += 4, dest += 3) {
+        uint32_t v0 = DECODE_VALUE(src[0]), v1 = DECODE_VALUE(src[1]);
+        uint32_t v2 = DECODE_VALUE(src[2]), v3 = DECODE_VALUE(src[3]);
+        if((v0 | v1 | v2 | v3) & ~0x3fU) {
+            decodeGroupBits(coderRef, src, dest);
+            continue;
+        }
+        uint32_t n = (v0 << 18) | (v1 << 12) | (v2 << 6) | v3;
+        dest[0] = (uint8_t) (n >> 16);
+        dest[1] = (uint8_t) (n >> 8);
+        dest[2] = (uint8_t) n;
+    }
+}
+
+/*
+ * Base32 groups are 40 bits: one byte plus a big endian 32 bit word.
+ */
+
+static void
+encodeGroups32(const char *charMap, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+    for(size_t g=0; g<groups; g++, src += 5, dest += 8) {
+        uint64_t n = ((uint64_t) src[0] << 32) | ((uint64_t) src[1] << 24) | ((uint64_t) src[2] << 16) |
+                     ((uint64_t) src[3] << 8) | src[4];
+        dest[0] = charMap[(n >> 35) & 0x1f];
+        dest[1] = charMap[(n >> 30) & 0x1f];
+        dest[2] = charMap[(n >> 25) & 0x1f];
+        dest[3] = charMap[(n >> 20) & 0x1f];
+        dest[4] = charMap[(n >> 15) & 0x1f];
+        dest[5] = charMap[(n >> 10) & 0x1f];
+        dest[6] = charMap[(n >> 5) & 0x1f];
+        dest[7] = charMap[n & 0x1f];
+    }
+}
+
+static void
+decodeGroups32(CNEncoder *coderRef, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+    const uint8_t *map = coderRef->coderFrame->reverseMap;
+    const uint8_t pad = coderRef->coderFrame->encoderRef->padding;
+    
+    for(size_t g=0; g<groups; g++, src += 8, dest += 5) {
+        uint64_t v0 = DECODE_VALUE(src[0]), v1 = DECODE_VALUE(src[1]);
+        uint64_t v2 = DECODE_VALUE(src[2]), v3 = DECODE_VALUE(src[3]);
+        uint64_t v4 = DECODE_VALUE(src[4]), v5 = DECODE_VALUE(src[5]);
+        uint64_t v6 = DECODE_VALUE(src[6]), v7 = DECODE_VALUE(src[7]);
+        if((v0 | v1 | v2 | v3 | v4 | v5 | v6 | v7) & ~0x1fULL) {
+            decodeGroupBits(coderRef, src, dest);
+            continue;
+        }
+        uint64_t n = (v0 << 35) | (v1 << 30) | (v2 << 25) | (v3 << 20) | (v4 << 15) | (v5 << 10) | (v6 << 5) | v7;
+        dest[0] = (uint8_t) (n >> 32);
+        dest[1] = (uint8_t) (n >> 24);
+        dest[2] = (uint8_t) (n >> 16);
+        dest[3] = (uint8_t) (n >> 8);
+        dest[4] = (uint8_t) n;
+    }
+}
+
+static void
+encodeGroups16(const char *charMap, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+    for(size_t g=0; g<groups; g++, src++, dest += 2) {
+        dest[0] = charMap[src[0] >> 4];
+        dest[1] = charMap[src[0] & 0x0f];
+    }
+}
+
+static void
+decodeGroups16(CNEncoder *coderRef, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+    const uint8_t *map = coderRef->coderFrame->reverseMap;
+    const uint8_t pad = coderRef->coderFrame->encoderRef->padding;
+    
+    for(size_t g=0; g<groups; g++, src += 2, dest++) {
+        uint32_t v0 = DECODE_VALUE(src[0]), v1 = DECODE_VALUE(src[1]);
+        if((v0 | v1) & ~0x0fU) {
+            decodeGroupBits(coderRef, src, dest);
+            continue;
+        }
+        dest[0] = (uint8_t) ((v0 << 4) | v1);
+    }
+}
+
+static void
+encode_groups_scalar(CNEncoder *coderRef, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+    const char *charMap = coderRef->coderFrame->encoderRef->charMap;
+    
+    switch(baselog(coderRef)) {
+        case 6: encodeGroups64(charMap, src, groups, dest); break;
+        case 5: encodeGroups32(charMap, src, groups, dest); break;
+        case 4: encodeGroups16(charMap, src, groups, dest); break;
+    }
+}
+
+static void
+decode_groups_scalar(CNEncoder *coderRef, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+    switch(baselog(coderRef)) {
+        case 6: decodeGroups64(coderRef, src, groups, dest); break;
+        case 5: decodeGroups32(coderRef, src, groups, dest); break;
+        case 4: decodeGroups16(coderRef, src, groups, dest); break;
+    }
+}
+
+#if CRC_X86_64
+#include <immintrin.h>
+
+/*
+ * pshufb reshuffle and lookup.  The encoder spreads each 3 byte group over a
+ * 32 bit lane, pulls the four 6 bit indices into separate bytes with two
+ * multiplies, and turns indices into ASCII by adding a per-range offset
+ * picked with pshufb.  The decoder validates characters with a pair of
+ * nibble lookups, subtracts the per-range offset, and packs the 6 bit values
+ * back together with pmaddubsw/pmaddwd.
+ */
+
+#define B64_ENC_SHUFFLE 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1
+#define B64_ENC_OFFSETS 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, \
+                        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0
+#define B64_DEC_LUT_LO  0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A
+#define B64_DEC_LUT_HI  0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+#define B64_DEC_ROLL    0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+#define B64_DEC_PACK    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+
+CRC_TARGET("ssse3")
+static size_t
+base64_encode_ssse3(const uint8_t *src, size_t srcLen, uint8_t *dest)
+{
+    const __m128i shuffle = _mm_set_epi8(B64_ENC_SHUFFLE);
+    const __m128i offsets = _mm_setr_epi8(B64_ENC_OFFSETS);
+    size_t i = 0;
+    
+    // Each load reads 16 bytes but only consumes 12.
+    for(; i + 16 <= srcLen; i += 12, dest += 16) {
+        __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (src + i)), shuffle);
+        __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+        __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+        __m128i idx = _mm_or_si128(t0, t1);
+        __m128i range = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+        range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), idx), _mm_set1_epi8(13)));
+        _mm_storeu_si128((__m128i *) dest, _mm_add_epi8(idx, _mm_shuffle_epi8(offsets, range)));
+    }
+    return i;
+}
+
+CRC_TARGET("avx2")
+static size_t
+base64_encode_avx2(const uint8_t *src, size_t srcLen, uint8_t *dest)
+{
+    const __m256i shuffle = _mm256_set_epi8(B64_ENC_SHUFFLE, B64_ENC_SHUFFLE);
+    const __m256i offsets = _mm256_setr_epi8(B64_ENC_OFFSETS, B64_ENC_OFFSETS);
+    size_t i = 0;
+    
+    // Two 16 byte loads 12 bytes apart fill one 24 byte block.
+    for(; i + 28 <= srcLen; i += 24, dest += 32) {
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (src + i))),
+                                             _mm_loadu_si128((const __m128i *) (src + i + 12)), 1);
+        in = _mm256_shuffle_epi8(in, shuffle);
+        __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+        __m256i idx = _mm256_or_si256(t0, t1);
+        __m256i range = _mm256_subs_epu8(idx, _mm256_set1_epi8(51));
+        range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), idx), _mm256_set1_epi8(13)));
+        _mm256_storeu_si256((__m256i *) dest, _mm256_add_epi8(idx, _mm256_shuffle_epi8(offsets, range)));
+    }
+    return i;
+}
+
+/*
+ * The decode kernels store a full vector for 12 (or 24) bytes of output, so
+ * they stop while enough whole groups remain behind them to overwrite the
+ * spare bytes.
+ */
+
+CRC_TARGET("ssse3")
+static size_t
+base64_decode_ssse3(CNEncoder *coderRef, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+    const __m128i lut_lo = _mm_setr_epi8(B64_DEC_LUT_LO);
+    const __m128i lut_hi = _mm_setr_epi8(B64_DEC_LUT_HI);
+    const __m128i roll = _mm_setr_epi8(B64_DEC_ROLL);
+    const __m128i pack = _mm_setr_epi8(B64_DEC_PACK);
+    const __m128i mask_2f = _mm_set1_epi8(0x2f);
+    size_t g = 0;
+    
+    for(; g + 4 + 2 <= groups; g += 4, src += 16, dest += 12) {
+        __m128i in = _mm_loadu_si128((const __m128i *) src);
+        __m128i hi = _mm_and_si128(_mm_srli_epi32(in, 4), mask_2f);
+        __m128i lo = _mm_shuffle_epi8(lut_lo, _mm_and_si128(in, mask_2f));
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, _mm_shuffle_epi8(lut_hi, hi)), _mm_setzero_si128())) != 0xffff) {
+            decode_groups_scalar(coderRef, src, 4, dest);
+            continue;
+        }
+        in = _mm_add_epi8(in, _mm_shuffle_epi8(roll, _mm_add_epi8(_mm_cmpeq_epi8(in, mask_2f), hi)));
+        in = _mm_madd_epi16(_mm_maddubs_epi16(in, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+        _mm_storeu_si128((__m128i *) dest, _mm_shuffle_epi8(in, pack));
+    }
+    return g;
+}
+
+CRC_TARGET("avx2")
+static size_t
+base64_decode_avx2(CNEncoder *coderRef, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+    const __m256i lut_lo = _mm256_setr_epi8(B64_DEC_LUT_LO, B64_DEC_LUT_LO);
+    const __m256i lut_hi = _mm256_setr_epi8(B64_DEC_LUT_HI, B64_DEC_LUT_HI);
+    const __m256i roll = _mm256_setr_epi8(B64_DEC_ROLL, B64_DEC_ROLL);
+    const __m256i pack = _mm256_setr_epi8(B64_DEC_PACK, B64_DEC_PACK);
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    const __m256i mask_2f = _mm256_set1_epi8(0x2f);
+    size_t g = 0;
+    
+    for(; g + 8 + 3 <= groups; g += 8, src += 32, dest += 24) {
+        __m256i in = _mm256_loadu_si256((const __m256i *) src);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask_2f);
+        __m256i lo = _mm256_shuffle_epi8(lut_lo, _mm256_and_si256(in, mask_2f));
+        if(!_mm256_testz_si256(lo, _mm256_shuffle_epi8(lut_hi, hi))) {
+            decode_groups_scalar(coderRef, src, 8, dest);
+            continue;
+        }
+        in = _mm256_add_epi8(in, _mm256_shuffle_epi8(roll, _mm256_add_epi8(_mm256_cmpeq_epi8(in, mask_2f), hi)));
+        in = _mm256_madd_epi16(_mm256_maddubs_epi16(in, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+        in = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(in, pack), lanes);
+        _mm256_storeu_si256((__m256i *) dest, in);
+    }
+    return g;
+}
+#endif /* CRC_X86_64 */
+
+/*
+ * Convert whole groups; the standard Base64 alphabet has vector kernels.
+ */
+
+static void
+encode_groups(CNEncoder *coderRef, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+#if CRC_X86_64
+    if(isStandardBase64(coderRef)) {
+        uint32_t features = crc_cpu_features();
+        size_t done = 0;
+        if(features & CRC_CPU_AVX2) done = base64_encode_avx2(src, groups * 3, dest) / 3;
+        else if(features & CRC_CPU_SSSE3) done = base64_encode_ssse3(src, groups * 3, dest) / 3;
+        src += done * 3;
+        dest += done * 4;
+        groups -= done;
+    }
+#endif
+    encode_groups_scalar(coderRef, src, groups, dest);
+}
+
+static void
+decode_groups(CNEncoder *coderRef, const uint8_t *src, size_t groups, uint8_t *dest)
+{
+#if CRC_X86_64
+    if(isStandardBase64(coderRef)) {
+        uint32_t features = crc_cpu_features();
+        size_t done = 0;
+        if(features & CRC_CPU_AVX2) done = base64_decode_avx2(coderRef, src, groups, dest);
+        else if(features & CRC_CPU_SSSE3) done = base64_decode_ssse3(coderRef, src, groups, dest);
+        src += done * 4;
+        dest += done * 3;
+        groups -= done;
+    }
+#endif
+    decode_groups_scalar(coderRef, src, groups, dest);
+}
+
 /*
  * This takes raw data from base XX (where XX is "base") and puts it into base256 form.
  */
@@ -162,7 +512,7 @@ deCode(void *ctx, const void *in, size_t srcLen, void *out, size_t *destLen)
     const uint8_t *src = in;
     uint8_t *dest = out;
     CNEncoder *coderRef = (CNEncoder *) ctx;
-    size_t i;
+    size_t i, groups;
     size_t dPos = 0;
     int sourceBits = baselog(coderRef);
     
@@ -172,22 +522,24 @@ deCode(void *ctx, const void *in, size_t srcLen, void *out, size_t *destLen)
         return 0;
     }
     
-    CC_XZEROMEM(dest, *destLen);
+    groups = srcLen / outputBlocksize(coderRef);
+    decode_groups(coderRef, src, groups, dest);
+    i = groups * outputBlocksize(coderRef);
+    
+    // dPos follows the last non-padding character, wherever it was decoded.
+    for(size_t j = i; j > 0; j--) {
+        if(src[j-1] != coderRef->coderFrame->encoderRef->padding) {
+            dPos = ((j-1) * sourceBits) / 8;
+            break;
+        }
+    }
+    
+    CC_XZEROMEM(dest + groups * inputBlocksize(coderRef), *destLen - groups * inputBlocksize(coderRef));
     
-    for(i=0; i<srcLen; i++) {
+    for(; i<srcLen; i++) {
         if(src[i] != coderRef->coderFrame->encoderRef->padding) {
-            uint8_t srcByte = decodeFromBase(coderRef, src[i]);
-            int dBit = (i*sourceBits) % 8; // destination position of Leftmost Bit of source byte
-            int shiftl = (8-sourceBits) - dBit; // amount needed to shift left to get bits positioned
-            dPos = (i*sourceBits) / 8; // destination byte of leftmost bit of source byte
-            
-            if(shiftl >= 0) {
-                dest[dPos] |= srcByte << shiftl;
-            } else if(shiftl < 0) {
-                int shiftr = shiftl * (-1);
-                dest[dPos] |= srcByte >> shiftr;
-                dest[dPos+1] |= srcByte << (8-shiftr);
-            } 
+            decodeBits(decodeFromBase(coderRef, src[i]), i, sourceBits, dest);
+            dPos = (i*sourceBits) / 8;
         }
     }
     *destLen = (dest[dPos+1]) ? dPos+2: dPos+1;
@@ -207,7 +559,7 @@ enCode(void *ctx, const void *in, size_t srcLen, void *out, size_t *destLen)
     size_t i;
     int destBits = baselog(coderRef);
     int baseShift = 8 - destBits;
-    size_t needed, dPos;    
+    size_t needed, dPos, groups;    
 
     if((needed = encodeLen(coderRef, srcLen)) == 0) {
         *destLen = 0;
@@ -222,31 +574,211 @@ enCode(void *ctx, const void *in, size_t srcLen, void *out, size_t *destLen)
     
     *destLen = needed;    
     
-    CC_XZEROMEM(dest, needed);
+    groups = srcLen / inputBlocksize(coderRef);
+    encode_groups(coderRef, src, groups, dest);
+    src += groups * inputBlocksize(coderRef);
+    srcLen -= groups * inputBlocksize(coderRef);
+    dest += groups * outputBlocksize(coderRef);
+    needed -= groups * outputBlocksize(coderRef);
     
-    dPos = 0;
-    for(i=0; i<srcLen; i++) {
-        int dBit = (i*8) % destBits;
-        dPos = (i*8) / destBits;
-        int shiftr = baseShift + dBit;
+    if(srcLen) {
+        // Partial final group.
+        CC_XZEROMEM(dest, needed);
+        
+        dPos = 0;
+        for(i=0; i<srcLen; i++) {
+            int dBit = (i*8) % destBits;
+            dPos = (i*8) / destBits;
+            int shiftr = baseShift + dBit;
 
-        dest[dPos] |= (src[i] >> shiftr) & basemask(coderRef);
-        if(shiftr > destBits) {
-            shiftr = shiftr - destBits;
-            dPos++;
             dest[dPos] |= (src[i] >> shiftr) & basemask(coderRef);
-        } 
-        dest[dPos+1] |= (src[i] << (destBits - shiftr)) & basemask(coderRef);
+            if(shiftr > destBits) {
+                shiftr = shiftr - destBits;
+                dPos++;
+                dest[dPos] |= (src[i] >> shiftr) & basemask(coderRef);
+            } 
+            dest[dPos+1] |= (src[i] << (destBits - shiftr)) & basemask(coderRef);
+        }
+        dPos+=2;
+        
+        for(i=0; i<dPos; i++) dest[i] = encodeToBase(coderRef, dest[i]);
+        
+        for(; dPos < needed; dPos++) dest[dPos] = coderRef->coderFrame->encoderRef->padding;
+    }
+    dest[needed] = 0;
+    return 0;
+}
+
+/*
+ * Line broken output.  A newline follows every lineWidth characters, and
+ * CNEncoderFinal terminates a partial last line, so every line of the
+ * output ends in '\n'.  Groups that fit on the current line are encoded in
+ * place; a group that straddles a line break goes through a small buffer.
+ */
+
+static inline size_t
+lineBreaks(CNEncoder *coderRef, size_t chars)
+{
+    return (coderRef->column + chars) / coderRef->lineWidth;
+}
+
+static size_t
+encodeLinesLen(void *ctx, size_t len)
+{
+    CNEncoder *coderRef = (CNEncoder *) ctx;
+    size_t chars = encodeLen(coderRef, len);
+    return chars + lineBreaks(coderRef, chars);
+}
+
+static int
+enCodeLines(void *ctx, const void *in, size_t srcLen, void *out, size_t *destLen)
+{
+    const uint8_t *src = in;
+    uint8_t *dest = out;
+    CNEncoder *coderRef = (CNEncoder *) ctx;
+    size_t inBlock = inputBlocksize(coderRef), outBlock = outputBlocksize(coderRef);
+    size_t needed = encodeLinesLen(coderRef, srcLen);
+    
+    if(*destLen < needed) {
+        *destLen = needed;
+        return -1;
     }
-    dPos+=2;
+    *destLen = needed;
     
-    for(i=0; i<dPos; i++) dest[i] = encodeToBase(coderRef, dest[i]);
+    while(srcLen) {
+        size_t groups = CC_XMIN((coderRef->lineWidth - coderRef->column) / outBlock, srcLen / inBlock);
+        
+        if(groups) {
+            size_t chars = groups * outBlock;
+            enCode(coderRef, src, groups * inBlock, dest, &chars);
+            src += groups * inBlock;
+            srcLen -= groups * inBlock;
+            dest += chars;
+            coderRef->column += chars;
+        } else {
+            uint8_t group[16];
+            size_t take = CC_XMIN(inBlock, srcLen), chars = sizeof(group) - 1;
+            enCode(coderRef, src, take, group, &chars);
+            src += take;
+            srcLen -= take;
+            for(size_t i=0; i<chars; i++) {
+                *dest++ = group[i];
+                if(++coderRef->column == coderRef->lineWidth) {
+                    *dest++ = '\n';
+                    coderRef->column = 0;
+                }
+            }
+        }
+        if(coderRef->column == coderRef->lineWidth) {
+            *dest++ = '\n';
+            coderRef->column = 0;
+        }
+    }
+    *dest = 0;
+    return 0;
+}
+
+/*
+ * kCNEncodeArmorChecksum runs the CRC-24 and the encoder over the same
+ * slice of input in turn, so each slice is still in cache for the second
+ * pass.  Slices are whole groups; only the flush at CNEncoderFinal can end
+ * in a partial one.
+ */
+
+#define ARMOR_SLICE (3 * 4096)
+
+static int
+enCodeArmor(void *ctx, const void *in, size_t srcLen, void *out, size_t *destLen)
+{
+    const uint8_t *src = in;
+    uint8_t *dest = out;
+    CNEncoder *coderRef = (CNEncoder *) ctx;
+    size_t needed = encodeLinesLen(coderRef, srcLen), used = 0;
     
-    for(; dPos < needed; dPos++) dest[dPos] = coderRef->coderFrame->encoderRef->padding;
-    dest[dPos] = 0;
+    if(*destLen < needed) {
+        *destLen = needed;
+        return -1;
+    }
+    
+    do {
+        size_t take = CC_XMIN(srcLen, ARMOR_SLICE), chars = needed + 1 - used;
+        CNCRCUpdate(coderRef->crc, src, take);
+        enCodeLines(coderRef, src, take, dest + used, &chars);
+        src += take;
+        srcLen -= take;
+        used += chars;
+    } while(srcLen);
+    *destLen = used;
     return 0;
 }
 
+/*
+ * The "=XXXX" line that follows the body of an OpenPGP armored message:
+ * the 24 bit checksum, big endian, as one Base64 group.
+ */
+
+static void
+armorChecksumLine(CNEncoder *coderRef, uint8_t *dest)
+{
+    uint64_t crc = 0;
+    uint8_t crcBytes[3];
+    size_t chars = 5;
+    
+    CNCRCFinal(coderRef->crc, &crc);
+    crcBytes[0] = (uint8_t) (crc >> 16);
+    crcBytes[1] = (uint8_t) (crc >> 8);
+    crcBytes[2] = (uint8_t) crc;
+    dest[0] = '=';
+    enCode(coderRef, crcBytes, sizeof(crcBytes), dest + 1, &chars);
+    dest[5] = '\n';
+    // Ready for the next message.
+    CNCRCInitWithStorage(kCN_CRC_24_OPENPGP, &coderRef->crcStorage, &coderRef->crc);
+}
+
+#define ARMOR_CHECKSUM_LINE 6
+
+static inline int
+isWhitespace(uint8_t c)
+{
+    return c == '\n' || c == '\r' || c == ' ' || c == '\t';
+}
+
+/*
+ * With kCNDecodeIgnoreWhitespace each run of non-whitespace characters is
+ * passed straight from the caller's buffer to the block decoder.  Whole
+ * blocks decode to an exact number of bytes, so once the output space has
+ * been checked for the complete input the per-run checks can't fail.
+ */
+
+static CNStatus
+deCodeSkippingWhitespace(CNEncoder *coderRef, const uint8_t *in, size_t inLen, uint8_t *out, size_t *outLen)
+{
+    CNStatus retval = kCNSuccess;
+    size_t outAvailable = *outLen, outUsed = 0;
+    
+    if(decodeLen(coderRef, coderRef->baseXXbuffer->bufferPos + inLen) > outAvailable) return kCNBufferTooSmall;
+    
+    while(inLen) {
+        size_t run, produced;
+        
+        while(inLen && isWhitespace(*in)) {
+            in++;
+            inLen--;
+        }
+        for(run = 0; run < inLen && !isWhitespace(in[run]); run++) ;
+        if(0 == run) break;
+        
+        produced = outAvailable - outUsed;
+        retval = CNBufferProcessData(coderRef->baseXXbuffer, coderRef, in, run, out + outUsed, &produced, deCode, decodeLen);
+        if(kCNSuccess != retval) break;
+        outUsed += produced;
+        in += run;
+        inLen -= run;
+    }
+    *outLen = outUsed;
+    return retval;
+}
+
 static CoderFrame
 getCodeFrame(CNEncodings encoding)
 {
@@ -281,6 +813,10 @@ CNStatus CNEncoderCreate(CNEncodings encoding,
 
     coderRef->direction = direction;
     coderRef->coderFrame = codeFrame;
+    coderRef->options = 0;
+    coderRef->lineWidth = 0;
+    coderRef->column = 0;
+    coderRef->crc = NULL;
     coderRef->base256buffer = NULL;
     coderRef->baseXXbuffer = NULL;
     coderRef->base256buffer = CNBufferCreate(inputBlocksize(coderRef));
@@ -296,6 +832,32 @@ CNStatus CNEncoderCreate(CNEncodings encoding,
 }
 
 
+CNStatus CNEncoderCreateWithOptions(CNEncodings encoding,
+                                    CNEncodingDirection direction,
+                                    CNEncoderOptions options,
+                                    size_t lineWidth,
+                                    CNEncoderRef *encoderRef)
+{
+    CNStatus retval;
+    
+    if(options & ~(kCNDecodeIgnoreWhitespace | kCNEncodeArmorChecksum)) return kCNParamError;
+    if((options & kCNDecodeIgnoreWhitespace) && direction != kCNDecode) return kCNParamError;
+    if((options & kCNEncodeArmorChecksum) && (direction != kCNEncode || encoding != kCNEncodingBase64 || !lineWidth))
+        return kCNParamError;
+    if(lineWidth && direction != kCNEncode) return kCNParamError;
+    
+    if((retval = CNEncoderCreate(encoding, direction, encoderRef)) != kCNSuccess) return retval;
+    (*encoderRef)->options = options;
+    (*encoderRef)->lineWidth = lineWidth;
+    if(options & kCNEncodeArmorChecksum) {
+        if((retval = CNCRCInitWithStorage(kCN_CRC_24_OPENPGP, &(*encoderRef)->crcStorage, &(*encoderRef)->crc)) != kCNSuccess) {
+            CNEncoderRelease(encoderRef);
+            return retval;
+        }
+    }
+    return kCNSuccess;
+}
+
 void setReverseMap(CoderFrame frame)
 {
     int i;
@@ -343,6 +905,10 @@ CNStatus CNEncoderCreateCustom(const void *name,
 
     coderRef->coderFrame = codeFrame;
     coderRef->direction = direction;
+    coderRef->options = 0;
+    coderRef->lineWidth = 0;
+    coderRef->column = 0;
+    coderRef->crc = NULL;
     coderRef->base256buffer = CNBufferCreate(inputBlocksize(coderRef));
     coderRef->baseXXbuffer = CNBufferCreate(outputBlocksize(coderRef));
     if(!coderRef->base256buffer || !coderRef->baseXXbuffer) goto errOut;
@@ -392,6 +958,9 @@ CNEncoderGetOutputLength(CNEncoderRef encoderRef, const size_t inLen)
 
     if(coderRef->direction == kCNEncode) {
         retval = encodeLen(coderRef, inLen + coderRef->base256buffer->bufferPos) + 1;
+        // Line breaks, including the one that may end the last line.
+        if(coderRef->lineWidth) retval += lineBreaks(coderRef, retval) + 1;
+        if(coderRef->crc) retval += ARMOR_CHECKSUM_LINE;
     } else if(coderRef->direction == kCNDecode) {
         retval = decodeLen(coderRef, inLen + coderRef->baseXXbuffer->bufferPos);
     }
@@ -445,9 +1014,17 @@ CNEncoderUpdate(CNEncoderRef coderRef, const void *in, const size_t inLen, void
 //    outputAvailable = outputLen = *outLen;
     
     if(encoderRef->direction == kCNEncode) {
-        retval = CNBufferProcessData(coderRef->base256buffer, coderRef, in, inLen, out, outLen, enCode, encodeLen);
+        if(encoderRef->crc)
+            retval = CNBufferProcessData(coderRef->base256buffer, coderRef, in, inLen, out, outLen, enCodeArmor, encodeLinesLen);
+        else if(encoderRef->lineWidth)
+            retval = CNBufferProcessData(coderRef->base256buffer, coderRef, in, inLen, out, outLen, enCodeLines, encodeLinesLen);
+        else
+            retval = CNBufferProcessData(coderRef->base256buffer, coderRef, in, inLen, out, outLen, enCode, encodeLen);
     } else if(encoderRef->direction == kCNDecode) {
-        retval = CNBufferProcessData(coderRef->baseXXbuffer, coderRef, in, inLen, out, outLen, deCode, decodeLen);
+        if(encoderRef->options & kCNDecodeIgnoreWhitespace)
+            retval = deCodeSkippingWhitespace(coderRef, in, inLen, out, outLen);
+        else
+            retval = CNBufferProcessData(coderRef->baseXXbuffer, coderRef, in, inLen, out, outLen, deCode, decodeLen);
     } else {
         retval = kCNParamError;
     }
@@ -456,6 +1033,54 @@ errOut:
     return retval;
 }
 
+#if !defined(_WIN32)
+CNStatus
+CNEncoderUpdateV(CNEncoderRef coderRef, const struct iovec *iov, int iovcnt, void *out, size_t *outLen)
+{
+    CNStatus retval = kCNParamError;
+    CNEncoder *encoderRef = coderRef;
+    
+    __Require_Quiet(NULL != coderRef, errOut);
+    __Require_Quiet(NULL != out, errOut);
+    __Require_Quiet(NULL != outLen, errOut);
+    
+    if(encoderRef->direction == kCNEncode) {
+        if(encoderRef->crc)
+            retval = CNBufferProcessDataV(coderRef->base256buffer, coderRef, iov, iovcnt, out, outLen, enCodeArmor, encodeLinesLen);
+        else if(encoderRef->lineWidth)
+            retval = CNBufferProcessDataV(coderRef->base256buffer, coderRef, iov, iovcnt, out, outLen, enCodeLines, encodeLinesLen);
+        else
+            retval = CNBufferProcessDataV(coderRef->base256buffer, coderRef, iov, iovcnt, out, outLen, enCode, encodeLen);
+    } else if(encoderRef->direction == kCNDecode) {
+        if(encoderRef->options & kCNDecodeIgnoreWhitespace) {
+            size_t total = 0, used = 0;
+            
+            __Require_Quiet(iovcnt >= 0 && (0 == iovcnt || NULL != iov), errOut);
+            for(int i=0; i<iovcnt; i++) {
+                __Require_Quiet(NULL != iov[i].iov_base || 0 == iov[i].iov_len, errOut);
+                total += iov[i].iov_len;
+            }
+            if(decodeLen(coderRef, coderRef->baseXXbuffer->bufferPos + total) > *outLen) return kCNBufferTooSmall;
+            
+            retval = kCNSuccess;
+            for(int i=0; i<iovcnt && kCNSuccess == retval; i++) {
+                size_t produced = *outLen - used;
+                retval = deCodeSkippingWhitespace(coderRef, iov[i].iov_base, iov[i].iov_len, (uint8_t *) out + used, &produced);
+                used += produced;
+            }
+            *outLen = used;
+        } else {
+            retval = CNBufferProcessDataV(coderRef->baseXXbuffer, coderRef, iov, iovcnt, out, outLen, deCode, decodeLen);
+        }
+    } else {
+        retval = kCNParamError;
+    }
+    
+errOut:
+    return retval;
+}
+#endif /* !_WIN32 */
+
 CNStatus
 CNEncoderFinal(CNEncoderRef coderRef, void *out, size_t *outLen)
 {
@@ -472,7 +1097,30 @@ CNEncoderFinal(CNEncoderRef coderRef, void *out, size_t *outLen)
             retval = kCNBufferTooSmall;
             goto errOut;
         }
-        retval = CNBufferFlushData(coderRef->base256buffer, coderRef, out, outLen, enCode, encodeLen);
+        if(encoderRef->lineWidth) {
+            size_t chars = encodeLinesLen(coderRef, coderRef->base256buffer->bufferPos);
+            // The partial last line, if any, gets its newline here.
+            int endLine = ((coderRef->column + encodeLen(coderRef, coderRef->base256buffer->bufferPos)) % coderRef->lineWidth) != 0;
+            size_t checksum = coderRef->crc ? ARMOR_CHECKSUM_LINE: 0;
+            if(chars + endLine + checksum + 1 > *outLen) {
+                retval = kCNBufferTooSmall;
+                goto errOut;
+            }
+            if(coderRef->crc)
+                retval = CNBufferFlushData(coderRef->base256buffer, coderRef, out, outLen, enCodeArmor, encodeLinesLen);
+            else
+                retval = CNBufferFlushData(coderRef->base256buffer, coderRef, out, outLen, enCodeLines, encodeLinesLen);
+            if(kCNSuccess == retval && endLine) {
+                ((uint8_t *)out)[(*outLen)++] = '\n';
+                coderRef->column = 0;
+            }
+            if(kCNSuccess == retval && checksum) {
+                armorChecksumLine(coderRef, (uint8_t *)out + *outLen);
+                *outLen += checksum;
+            }
+        } else {
+            retval = CNBufferFlushData(coderRef->base256buffer, coderRef, out, outLen, enCode, encodeLen);
+        }
         if(kCNSuccess == retval) {
             ((uint8_t *)out)[*outLen] = 0;
         }
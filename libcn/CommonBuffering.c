@@ -43,10 +43,17 @@ out:
 
 
 
-CNStatus
-CNBufferProcessData(CNBufferRef bufRef, 
-                    void *ctx, const void *in, const size_t inLen, void *out, size_t *outLen, 
-                    cnProcessFunction pFunc, cnSizeFunction sizeFunc)
+/*
+ * Feed one contiguous piece of input through the buffer: top up and process
+ * any carried over partial block, process the whole blocks straight from
+ * the input, and keep the remainder.  The caller has already checked that
+ * the output will fit.  *outLen is the number of bytes produced.
+ */
+
+static CNStatus
+bufferProcessData(CNBufferRef bufRef, 
+                  void *ctx, const void *in, const size_t inLen, void *out, size_t *outLen, 
+                  cnProcessFunction pFunc)
 {
     size_t  blocksize = bufRef->chunksize;
     const uint8_t *input = in;
@@ -55,7 +62,6 @@ CNBufferProcessData(CNBufferRef bufRef,
     
     outputAvailable = outputLen = *outLen;
     
-    if(sizeFunc(ctx, bufRef->bufferPos + inLen) > outputAvailable) return  kCNBufferTooSmall;
     *outLen = 0;
     if(bufRef->bufferPos > 0) {
         inputUsing = CC_XMIN(blocksize - bufRef->bufferPos, inputLen);
@@ -88,6 +94,49 @@ CNBufferProcessData(CNBufferRef bufRef,
     
 }
 
+CNStatus
+CNBufferProcessData(CNBufferRef bufRef, 
+                    void *ctx, const void *in, const size_t inLen, void *out, size_t *outLen, 
+                    cnProcessFunction pFunc, cnSizeFunction sizeFunc)
+{
+    if(sizeFunc(ctx, bufRef->bufferPos + inLen) > *outLen) return  kCNBufferTooSmall;
+    return bufferProcessData(bufRef, ctx, in, inLen, out, outLen, pFunc);
+}
+
+#if !defined(_WIN32)
+/*
+ * Scatter-gather form.  Output space is checked once for the whole chain;
+ * a block split across elements is stitched together in the buffer, so at
+ * most one block is ever copied per element boundary.
+ */
+
+CNStatus
+CNBufferProcessDataV(CNBufferRef bufRef, 
+                     void *ctx, const struct iovec *iov, int iovcnt, void *out, size_t *outLen, 
+                     cnProcessFunction pFunc, cnSizeFunction sizeFunc)
+{
+    CNStatus retval = kCNSuccess;
+    uint8_t *output = out;
+    size_t total = 0, outputAvailable = *outLen, used = 0;
+    
+    if(iovcnt < 0 || (iovcnt > 0 && NULL == iov)) return kCNParamError;
+    for(int i=0; i<iovcnt; i++) {
+        if(NULL == iov[i].iov_base && iov[i].iov_len) return kCNParamError;
+        total += iov[i].iov_len;
+    }
+    if(sizeFunc(ctx, bufRef->bufferPos + total) > outputAvailable) return  kCNBufferTooSmall;
+    
+    for(int i=0; i<iovcnt && kCNSuccess == retval; i++) {
+        size_t produced = outputAvailable - used;
+        if(0 == iov[i].iov_len) continue;
+        retval = bufferProcessData(bufRef, ctx, iov[i].iov_base, iov[i].iov_len, output + used, &produced, pFunc);
+        used += produced;
+    }
+    *outLen = used;
+    return retval;
+}
+#endif /* !_WIN32 */
+
 CNStatus
 CNBufferFlushData(CNBufferRef bufRef,
                   void *ctx, void *out, size_t *outLen,
@@ -26,6 +26,9 @@
 
 #include <CommonNumerics/CommonNumerics.h>
 #include <stdbool.h>
+#if !defined(_WIN32)
+#include <sys/uio.h>
+#endif
 
 typedef struct CNBuffer_t {
     size_t chunksize;
@@ -47,6 +50,13 @@ CNBufferProcessData(CNBufferRef bufRef,
                     void *ctx, const void *in, const size_t inLen, void *out, size_t *outLen, 
                     cnProcessFunction pFunc, cnSizeFunction sizeFunc);
 
+#if !defined(_WIN32)
+CNStatus
+CNBufferProcessDataV(CNBufferRef bufRef, 
+                     void *ctx, const struct iovec *iov, int iovcnt, void *out, size_t *outLen, 
+                     cnProcessFunction pFunc, cnSizeFunction sizeFunc);
+#endif
+
 CNStatus
 CNBufferFlushData(CNBufferRef bufRef,
                   void *ctx, void *out, size_t *outLen,
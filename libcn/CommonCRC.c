@@ -27,6 +27,9 @@
 #include "crc.h"
 #include "ccGlobals.h"
 #include <stdlib.h>
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
 
 static inline crcInfoPtr getDesc(CNcrc algorithm)
 {
@@ -34,12 +37,22 @@ static inline crcInfoPtr getDesc(CNcrc algorithm)
     return &globals->crcSelectionTab[algorithm];
 }
 
+static inline crcDescriptorPtr getModel(crcInfoPtr crc)
+{
+    if(crc->descriptor->defType == model) return crc->descriptor;
+    return crc->descriptor->def.funcs.model;
+}
+
 typedef struct crcRef_int {
     crcInfoPtr crc;
     uint64_t current;
     size_t length;
+    int allocated; // zero when the ref lives in caller storage
 } *crcRefptr;
 
+// CNCRCContext must stay large enough to hold a crcRef_int.
+typedef char crcContextSizeCheck[(sizeof(struct crcRef_int) <= sizeof(CNCRCContext)) ? 1: -1];
+
 static inline uint64_t
 try_generic_oneshot(crcInfoPtr crc, size_t len, const void *in)
 {
@@ -57,10 +70,7 @@ try_generic_setup(crcInfoPtr crc)
 static inline uint64_t
 try_generic_update(crcInfoPtr crc, size_t len, const void *in, uint64_t current)
 {
-    if(crc->descriptor->def.parms.reflect_reverse)
-        return crc_reverse_update(crc, (uint8_t *) in, len, current);
-    else
-        return crc_normal_update(crc, (uint8_t *) in, len, current);
+    return crc->update(crc, in, len, current);
 }
 
 static inline uint64_t
@@ -70,32 +80,232 @@ try_generic_final(crcInfoPtr crc, uint64_t current)
     else return crc_normal_final(crc, current);
 }
 
+static inline uint64_t
+crc_oneshot(crcInfoPtr crc, size_t len, const void *in)
+{
+    if(crc->descriptor->defType == model) return try_generic_oneshot(crc, len, in);
+    return crc->descriptor->def.funcs.oneshot(len, in);
+}
+
+static inline uint64_t
+crc_combine(crcDescriptorPtr descriptor, uint64_t crcA, uint64_t crcB, size_t lenB)
+{
+    // Undo the final XOR of A and swap its initial value for a zero register,
+    // then advance it over B's length; B already accounts for its own start.
+    uint64_t mask = descmaskfunc(descriptor);
+    int pad = descriptor->def.parms.pad;
+    uint64_t current = ((crcA << pad) ^ descriptor->def.parms.final_xor ^ descriptor->def.parms.initial_value) & mask;
+    return ((crc_shift(descriptor, current, lenB) ^ (crcB << pad)) & mask) >> pad;
+}
+
 CNStatus
 CNCRC(CNcrc algorithm, const void *in, size_t len, uint64_t *result)
 {
     crcInfoPtr crc = getDesc(algorithm);
     if(crc->descriptor == NULL) return kCNUnimplemented;
-    if(crc->descriptor->defType == model)
-        *result = try_generic_oneshot(crc, len, in);
-    else
-        *result = crc->descriptor->def.funcs.oneshot(len, in);
+    *result = crc_oneshot(crc, len, in);
     return kCNSuccess;
 }
 
+/*
+ * The input is cut into one contiguous segment per worker so each worker
+ * streams through its own memory, and only one combine per segment is needed
+ * to stitch the results back together.
+ */
+
+#define CRC_PARALLEL_MIN_SEGMENT (1024 * 1024)
+
+typedef struct crcParallelJob_t {
+    crcInfoPtr crc;
+    const uint8_t *in;
+    size_t len;
+    size_t segment;
+    size_t count;
+    uint64_t *results;
+} crcParallelJob;
+
+static void
+crc_parallel_segment(void *ctx, size_t i)
+{
+    crcParallelJob *job = ctx;
+    size_t start = i * job->segment;
+    size_t len = (i == job->count - 1) ? job->len - start: job->segment;
+    job->results[i] = crc_oneshot(job->crc, len, job->in + start);
+}
+
+CNStatus
+CNCRCParallel(CNcrc algorithm, const void *in, size_t len, size_t nthreads, uint64_t *result)
+{
+    crcInfoPtr crc = getDesc(algorithm);
+    crcDescriptorPtr descriptor;
+    crcParallelJob job;
+    
+    if(crc->descriptor == NULL) return kCNUnimplemented;
+    if(result == NULL || (in == NULL && len != 0)) return kCNParamError;
+    
+#if defined(_WIN32)
+    nthreads = 1;
+#else
+    if(nthreads == 0) {
+        long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = (ncpu > 0) ? (size_t) ncpu: 1;
+    }
+#endif
+    if(nthreads > len / CRC_PARALLEL_MIN_SEGMENT) nthreads = len / CRC_PARALLEL_MIN_SEGMENT;
+    if(nthreads < 2 || (descriptor = getModel(crc)) == NULL) {
+        *result = crc_oneshot(crc, len, in);
+        return kCNSuccess;
+    }
+    
+    job.crc = crc;
+    job.in = in;
+    job.len = len;
+    job.count = nthreads;
+    job.segment = len / nthreads;
+    if((job.results = malloc(nthreads * sizeof(uint64_t))) == NULL) return kCNMemoryFailure;
+    
+#if !defined(_WIN32)
+    dispatch_apply_f(nthreads, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), &job, crc_parallel_segment);
+#endif
+    
+    *result = job.results[0];
+    for(size_t i=1; i<nthreads; i++) {
+        size_t segLen = (i == nthreads - 1) ? len - i * job.segment: job.segment;
+        *result = crc_combine(descriptor, *result, job.results[i], segLen);
+    }
+    free(job.results);
+    return kCNSuccess;
+}
+
+/*
+ * Buffers are taken CRC_BATCH_LANES at a time and walked in lock step over
+ * their common length, so the independent table lookup (or crc32) chains
+ * overlap instead of each buffer waiting on its own latency.  Models that
+ * would fold the common length with PCLMULQDQ are already throughput bound
+ * and go straight to their update kernel.
+ */
+
+static void
+crc_batch_lanes(crcInfoPtr crc, const void *const *bufs, const size_t *lens, uint64_t *results)
+{
+    const uint8_t *p[CRC_BATCH_LANES];
+    size_t common = lens[0];
+    
+    for(int j=0; j<CRC_BATCH_LANES; j++) {
+        p[j] = bufs[j];
+        if(lens[j] < common) common = lens[j];
+    }
+    
+    if(crc->descriptor->defType == model) {
+        for(int j=0; j<CRC_BATCH_LANES; j++) results[j] = crc->descriptor->def.parms.initial_value;
+        if(crc->fold.enabled && common >= CRC_CLMUL_MIN) common = 0;
+        else crc->batch(crc, p, common, results);
+        for(int j=0; j<CRC_BATCH_LANES; j++)
+            results[j] = try_generic_final(crc, crc->update(crc, p[j] + common, lens[j] - common, results[j]));
+    } else {
+        const crcFuncs *funcs = &crc->descriptor->def.funcs;
+        for(int j=0; j<CRC_BATCH_LANES; j++) results[j] = funcs->setup();
+        funcs->batch(common, p, results);
+        for(int j=0; j<CRC_BATCH_LANES; j++)
+            results[j] = funcs->final(lens[j], funcs->update(lens[j] - common, p[j] + common, results[j]));
+    }
+}
+
+CNStatus
+CNCRCBatch(CNcrc algorithm, const void *const *bufs, const size_t *lens, size_t n, uint64_t *results)
+{
+    crcInfoPtr crc = getDesc(algorithm);
+    size_t i = 0;
+    
+    if(crc->descriptor == NULL) return kCNUnimplemented;
+    if(n == 0) return kCNSuccess;
+    if(bufs == NULL || lens == NULL || results == NULL) return kCNParamError;
+    for(i=0; i<n; i++) if(bufs[i] == NULL && lens[i] != 0) return kCNParamError;
+    
+    i = 0;
+    if(crc->descriptor->defType == model) (void) try_generic_setup(crc);
+    if(crc->descriptor->defType == model || crc->descriptor->def.funcs.batch != NULL) {
+        for(; i + CRC_BATCH_LANES <= n; i += CRC_BATCH_LANES)
+            crc_batch_lanes(crc, &bufs[i], &lens[i], &results[i]);
+    }
+    for(; i<n; i++) results[i] = crc_oneshot(crc, lens[i], bufs[i]);
+    return kCNSuccess;
+}
+
+static void
+crc_ref_init(crcRefptr ref, crcInfoPtr crc, int allocated)
+{
+    ref->crc = crc;
+    ref->length = 0;
+    ref->allocated = allocated;
+    if(crc->descriptor->defType == model) ref->current = try_generic_setup(crc);
+    else ref->current = crc->descriptor->def.funcs.setup();
+}
+
 CNStatus
 CNCRCInit(CNcrc algorithm, CNCRCRef *crcRef)
 {
-    crcRefptr retval = malloc(sizeof(struct crcRef_int));
-    if(retval == NULL) return kCNMemoryFailure;
-    retval->crc = getDesc(algorithm);
-    if(retval->crc->descriptor == NULL) {
+    crcInfoPtr crc = getDesc(algorithm);
+    crcRefptr retval;
+    
+    if(crc->descriptor == NULL) return kCNUnimplemented;
+    if((retval = malloc(sizeof(struct crcRef_int))) == NULL) return kCNMemoryFailure;
+    crc_ref_init(retval, crc, 1);
+    *crcRef = (CNCRCRef) retval;
+    return kCNSuccess;
+}
+
+CNStatus
+CNCRCInitWithStorage(CNcrc algorithm, CNCRCContext *storage, CNCRCRef *crcRef)
+{
+    crcInfoPtr crc = getDesc(algorithm);
+    
+    if(crc->descriptor == NULL) return kCNUnimplemented;
+    if(storage == NULL || crcRef == NULL) return kCNParamError;
+    crc_ref_init((crcRefptr) storage, crc, 0);
+    *crcRef = (CNCRCRef) storage;
+    return kCNSuccess;
+}
+
+/*
+ * Widths other than 8, 16, 32 and 64 bits run on the next wider table
+ * engine with the polynomial moved to the top of the register.  Normal order
+ * models then carry their value pad bits up and drop them in the final step;
+ * reflected models keep theirs in the low bits and need no adjustment.
+ */
+
+CNStatus
+CNCRCCreateCustom(size_t width, uint64_t poly, uint64_t init, uint64_t xorout, int reflect_reverse, CNCRCRef *crcRef)
+{
+    crcModelParms parms = { 0 };
+    uint64_t mask;
+    crcInfoPtr crc;
+    crcRefptr retval;
+    
+    if(crcRef == NULL || width == 0 || width > 64) return kCNParamError;
+    mask = (width == 64) ? MASK64: (1ULL << width) - 1;
+    if(poly == 0 || (poly & ~mask) || (init & ~mask) || (xorout & ~mask)) return kCNParamError;
+    
+    parms.width = (width <= 8) ? 1: (width <= 16) ? 2: (width <= 32) ? 4: 8;
+    int shift = parms.width * 8 - (int) width;
+    parms.poly = poly << shift;
+    if(reflect_reverse) {
+        parms.reflect_reverse = REFLECT_REVERSE;
+        parms.initial_value = reflect(init << shift, parms.width * 8);
+        parms.final_xor = xorout;
+    } else {
+        parms.reflect_reverse = NO_REFLECT_REVERSE;
+        parms.pad = shift;
+        parms.initial_value = init << shift;
+        parms.final_xor = xorout << shift;
+    }
+    
+    if((retval = malloc(sizeof(struct crcRef_int))) == NULL) return kCNMemoryFailure;
+    if((crc = crc_custom_info(&parms)) == NULL) {
         free(retval);
-        return kCNUnimplemented;
+        return kCNMemoryFailure;
     }
-    retval->current = 0;
-    retval->length = 0;
-    if(retval->crc->descriptor->defType == model) retval->current = try_generic_setup(retval->crc);
-    else retval->current = retval->crc->descriptor->def.funcs.setup();
+    crc_ref_init(retval, crc, 1);
     *crcRef = (CNCRCRef) retval;
     return kCNSuccess;
 }
@@ -105,7 +315,7 @@ CNStatus
 CNCRCRelease(CNCRCRef crcRef)
 {
     crcRefptr ref = (crcRefptr) crcRef;
-    free(ref);
+    if(ref != NULL && ref->allocated) free(ref);
     return kCNSuccess;
 }
 
@@ -130,6 +340,18 @@ CNCRCFinal(CNCRCRef crcRef, uint64_t *result)
     return kCNSuccess;
 }
 
+CNStatus
+CNCRCCombine(CNcrc algorithm, uint64_t crcA, uint64_t crcB, size_t lenB, uint64_t *result)
+{
+    crcInfoPtr crc = getDesc(algorithm);
+    crcDescriptorPtr descriptor;
+    
+    if(crc->descriptor == NULL) return kCNUnimplemented;
+    if((descriptor = getModel(crc)) == NULL || result == NULL) return kCNParamError;
+    *result = crc_combine(descriptor, crcA, crcB, lenB);
+    return kCNSuccess;
+}
+
 CNStatus
 CNCRCDumpTable(CNcrc algorithm)
 {
@@ -146,10 +368,12 @@ CNStatus
 CNCRCWeakTest(CNcrc algorithm)
 {
     crcInfoPtr crc = getDesc(algorithm);    
-    if(!crc->descriptor || crc->descriptor->defType == functions) return kCNSuccess;
+    if(!crc->descriptor || !getModel(crc)) return kCNSuccess;
     
-    uint64_t result = try_generic_oneshot(crc, 9, "123456789");
-    if(result == crc->descriptor->def.parms.weak_check) return kCNSuccess;
+    uint64_t result;
+    if(crc->descriptor->defType == functions) result = crc->descriptor->def.funcs.oneshot(9, "123456789");
+    else result = try_generic_oneshot(crc, 9, "123456789");
+    if(result == getModel(crc)->def.parms.weak_check) return kCNSuccess;
     return kCNFailure;
 }
 
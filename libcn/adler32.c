@@ -23,22 +23,138 @@
 
 #include "crc.h"
 
-static const int adler_mod_value = 65521;
+#define ADLER_MOD 65521
+// Largest n such that 255 n (n+1) / 2 + (n+1) (ADLER_MOD-1) fits in 32 bits,
+// so the modulo only has to be taken once every ADLER_NMAX bytes.
+#define ADLER_NMAX 5552
+
+/*
+ * The running (a, b) pair is carried between updates in the low and high
+ * halves of the checksum, the same layout as the final value.
+ */
 
 static uint64_t
-adler32_setup() { return 0; }
+adler32_setup(void) { return 1; }
+
+static void
+byte_sums_scalar(const uint8_t *p, size_t len, uint32_t *sum1, uint32_t *sum2)
+{
+    uint32_t a = *sum1, b = *sum2;
+    
+    while(len--) {
+        a += *p++;
+        b += a;
+    }
+    *sum1 = a;
+    *sum2 = b;
+}
+
+#if CRC_X86_64
+#include <immintrin.h>
+
+/*
+ * For a block of n bytes x[0..n-1], a grows by sum(x[i]) and b by
+ * n * a + sum((n - i) * x[i]).  The kernels keep the byte sums, the weighted
+ * sums and the running total of a at each block start in vector lanes, and
+ * fold them into (a, b) at the end.
+ */
+
+#define SUMS_BLOCK 32
+
+CRC_TARGET("avx2")
+static void
+byte_sums_avx2(const uint8_t *p, size_t blocks, uint32_t *sum1, uint32_t *sum2)
+{
+    const __m256i taps = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                          16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i vs1 = zero, vs2 = zero, vps = zero;
+    
+    for(size_t i=0; i<blocks; i++) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i *) (p + i * SUMS_BLOCK));
+        vps = _mm256_add_epi32(vps, vs1);
+        vs1 = _mm256_add_epi32(vs1, _mm256_sad_epu8(bytes, zero));
+        vs2 = _mm256_add_epi32(vs2, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, taps), ones));
+    }
+    vs2 = _mm256_add_epi32(vs2, _mm256_slli_epi32(vps, 5));
+    
+    __m128i s1 = _mm_add_epi32(_mm256_castsi256_si128(vs1), _mm256_extracti128_si256(vs1, 1));
+    __m128i s2 = _mm_add_epi32(_mm256_castsi256_si128(vs2), _mm256_extracti128_si256(vs2, 1));
+    s1 = _mm_add_epi32(s1, _mm_shuffle_epi32(s1, _MM_SHUFFLE(1, 0, 3, 2)));
+    s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, _MM_SHUFFLE(1, 0, 3, 2)));
+    s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, _MM_SHUFFLE(2, 3, 0, 1)));
+    *sum2 += (uint32_t) (*sum1 * blocks * SUMS_BLOCK) + (uint32_t) _mm_cvtsi128_si32(s2);
+    *sum1 += (uint32_t) _mm_cvtsi128_si32(s1);
+}
+
+CRC_TARGET("ssse3")
+static void
+byte_sums_ssse3(const uint8_t *p, size_t blocks, uint32_t *sum1, uint32_t *sum2)
+{
+    const __m128i taps1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+    const __m128i taps2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i vs1 = zero, vs2 = zero, vps = zero;
+    
+    for(size_t i=0; i<blocks; i++) {
+        __m128i bytes1 = _mm_loadu_si128((const __m128i *) (p + i * SUMS_BLOCK));
+        __m128i bytes2 = _mm_loadu_si128((const __m128i *) (p + i * SUMS_BLOCK + 16));
+        vps = _mm_add_epi32(vps, vs1);
+        vs1 = _mm_add_epi32(vs1, _mm_sad_epu8(bytes1, zero));
+        vs1 = _mm_add_epi32(vs1, _mm_sad_epu8(bytes2, zero));
+        vs2 = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, taps1), ones));
+        vs2 = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_maddubs_epi16(bytes2, taps2), ones));
+    }
+    vs2 = _mm_add_epi32(vs2, _mm_slli_epi32(vps, 5));
+    
+    vs1 = _mm_add_epi32(vs1, _mm_shuffle_epi32(vs1, _MM_SHUFFLE(1, 0, 3, 2)));
+    vs2 = _mm_add_epi32(vs2, _mm_shuffle_epi32(vs2, _MM_SHUFFLE(1, 0, 3, 2)));
+    vs2 = _mm_add_epi32(vs2, _mm_shuffle_epi32(vs2, _MM_SHUFFLE(2, 3, 0, 1)));
+    *sum2 += (uint32_t) (*sum1 * blocks * SUMS_BLOCK) + (uint32_t) _mm_cvtsi128_si32(vs2);
+    *sum1 += (uint32_t) _mm_cvtsi128_si32(vs1);
+}
+
+#endif /* CRC_X86_64 */
+
+/*
+ * Unreduced running sums a += x[i], b += a over len bytes.  Fletcher-16
+ * shares these; callers bound len so neither sum can overflow.
+ */
+
+void
+crc_byte_sums(const uint8_t *p, size_t len, uint32_t *sum1, uint32_t *sum2)
+{
+#if CRC_X86_64
+    uint32_t features = crc_cpu_features();
+    
+    if(features & (CRC_CPU_AVX2 | CRC_CPU_SSSE3)) {
+        size_t blocks = len / SUMS_BLOCK;
+        if(features & CRC_CPU_AVX2) byte_sums_avx2(p, blocks, sum1, sum2);
+        else byte_sums_ssse3(p, blocks, sum1, sum2);
+        p += blocks * SUMS_BLOCK;
+        len -= blocks * SUMS_BLOCK;
+    }
+#endif
+    byte_sums_scalar(p, len, sum1, sum2);
+}
 
 static uint64_t
-adler32_implementation(size_t len, const void *in, uint64_t __unused crc)
+adler32_update(size_t len, const void *in, uint64_t crc)
 {
-    uint32_t a = 1, b = 0;
-    const uint8_t *bytes = in;
+    const uint8_t *p = in;
+    uint32_t a = crc & 0xffff, b = (crc >> 16) & 0xffff;
     
-    for (size_t i = 0; i < len; i++) {
-        a = (a + bytes[i]) % adler_mod_value;
-        b = (b + a) % adler_mod_value;
+    while(len) {
+        size_t n = (len < ADLER_NMAX) ? len : ADLER_NMAX;
+        crc_byte_sums(p, n, &a, &b);
+        p += n;
+        len -= n;
+        a %= ADLER_MOD;
+        b %= ADLER_MOD;
     }
-    return (b << 16) | a;
+    return ((uint64_t) b << 16) | a;
 }
 
 static uint64_t
@@ -48,7 +164,7 @@ adler32_final(size_t __unused length, uint64_t crc) { return crc; }
 static uint64_t
 adler32_oneshot(size_t len, const void *in)
 {
-    return adler32_implementation(len, in, 0);
+    return adler32_update(len, in, adler32_setup());
 }
 
 
@@ -57,7 +173,7 @@ const crcDescriptor adler32 = {
     .name = "adler-32",
     .defType = functions,
     .def.funcs.setup = adler32_setup,
-    .def.funcs.update = adler32_implementation,
+    .def.funcs.update = adler32_update,
     .def.funcs.final = adler32_final,
     .def.funcs.oneshot = adler32_oneshot
 };
@@ -33,6 +33,18 @@
 #include <stddef.h>
 #include "../lib/ccDispatch.h"
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define CRC_X86_64 1
+#else
+#define CRC_X86_64 0
+#endif
+
+#if defined(_MSC_VER)
+#define CRC_TARGET(features)
+#else
+#define CRC_TARGET(features) __attribute__((target(features)))
+#endif
+
 #define MASK08 0x00000000000000ffLL
 #define MASK16 0x000000000000ffffLL
 #define MASK32 0x00000000ffffffffLL
@@ -42,17 +54,39 @@
 
 #define WEAK_CHECK_INPUT "123456789"
 
+// Model tables are generated for slicing-by-8: CRC_SLICES consecutive 256 entry
+// tables where slice k holds the CRC of byte i followed by k zero bytes.
+#define CRC_SLICES 8
+#define CRC_SLICE(n) ((n) * 256)
+
 // Utility Functions
 
 uint8_t reflect_byte(uint8_t b);
 uint64_t reflect(uint64_t w, size_t bits);
 uint64_t reverse_poly(uint64_t poly, size_t width);
 
+// CPU capabilities used to select hardware checksum paths at runtime.
+
+#define CRC_CPU_SSE42   0x00000001
+#define CRC_CPU_PCLMUL  0x00000002
+#define CRC_CPU_SSSE3   0x00000004
+#define CRC_CPU_AVX2    0x00000008
+
+uint32_t crc_cpu_features(void);
+
+void crc_byte_sums(const uint8_t *p, size_t len, uint32_t *sum1, uint32_t *sum2);
+
 typedef uint64_t (*cccrc_setup_p)(void);
 typedef uint64_t (*cccrc_update_p)(size_t len, const void *in, uint64_t crc);
 typedef uint64_t (*cccrc_final_p)(size_t length, uint64_t crc);
 typedef uint64_t (*cccrc_oneshot_p)(size_t len, const void *in);
 
+// Multi-buffer kernels advance CRC_BATCH_LANES independent running values
+// over the same number of bytes so their dependency chains overlap.
+#define CRC_BATCH_LANES 4
+
+typedef void (*cccrc_batch_p)(size_t len, const uint8_t *const *in, uint64_t *crc);
+
 #define NO_REFLECT_REVERSE 0
 #define REFLECT_IN 1
 #define REVERSE_OUT 2
@@ -60,12 +94,14 @@ typedef uint64_t (*cccrc_oneshot_p)(size_t len, const void *in);
 
 typedef struct crcModelParms_t {
     int width; // width in bytes
+    int pad; // low register bits below a narrower normal order CRC
     int reflect_reverse;
     uint64_t mask;
     uint64_t poly;
     uint64_t initial_value;
     uint64_t final_xor;
     uint64_t weak_check;
+    const void *table; // read-only slicing tables, NULL to generate at first use
 } crcModelParms;
 
 typedef struct crcFuncs_t {
@@ -73,6 +109,8 @@ typedef struct crcFuncs_t {
     cccrc_update_p update;
     cccrc_final_p final;
     cccrc_oneshot_p oneshot;
+    cccrc_batch_p batch; // optional multi-buffer update
+    const struct crcDescriptor_t *model; // the model implemented, if any
 } crcFuncs;
 
 enum crcType_t {
@@ -92,21 +130,56 @@ typedef struct crcDescriptor_t {
 
 typedef const crcDescriptor *crcDescriptorPtr;
 
+// Carry-less multiply fold constants, filled in at table init when the CPU
+// supports PCLMULQDQ.  Each pair advances a 128 bit accumulator by 128 or
+// 512 bits modulo the model polynomial.
+
+typedef struct crcFold_t {
+    int enabled;
+    uint64_t k128[2];
+    uint64_t k512[2];
+} crcFold;
+
+struct crcInfo_t;
+typedef uint64_t (*crc_update_p)(struct crcInfo_t *crc, const uint8_t *p, size_t len, uint64_t current);
+typedef void (*crc_batch_p)(struct crcInfo_t *crc, const uint8_t *const *p, size_t len, uint64_t *current);
+
 typedef struct crcInfo_t {
     dispatch_once_t table_init;
     crcDescriptorPtr descriptor;
     size_t size;
+    crcFold fold;
+    crc_update_p update; // width and reflection specific kernel, set at table init
+    crc_batch_p batch;
     union {
-        uint8_t *bytes;
-        uint16_t *b16;
-        uint32_t *b32;
-        uint64_t *b64;
+        const uint8_t *bytes;
+        const uint16_t *b16;
+        const uint32_t *b32;
+        const uint64_t *b64;
     } table;
 } crcInfo, *crcInfoPtr;
 
 
+crcInfoPtr crc_custom_info(const crcModelParms *parms);
+
 void gen_std_crc_table(void *c);
+void *gen_crc_table(crcDescriptorPtr crcdesc);
 void dump_crc_table(crcInfoPtr crc);
+uint64_t crc_multiply(crcDescriptorPtr descriptor, uint64_t a, uint64_t b);
+uint64_t crc_xpow(crcDescriptorPtr descriptor, uint64_t e);
+uint64_t crc_shift(crcDescriptorPtr descriptor, uint64_t current, size_t len);
+
+void crc_clmul_init(crcInfoPtr crc);
+uint64_t crc_clmul_update(crcInfoPtr crc, const uint8_t *p, size_t len, uint64_t current);
+
+// Below this length the slicing tables are faster than setting up a fold.
+#define CRC_CLMUL_MIN 128
+
+crc_update_p crc_normal_select(size_t width, int fold);
+crc_update_p crc_reverse_select(size_t width, int fold);
+crc_batch_p crc_normal_select_batch(size_t width);
+crc_batch_p crc_reverse_select_batch(size_t width);
+
 uint64_t crc_normal_init(crcInfoPtr crc);
 uint64_t crc_normal_update(crcInfoPtr crc, uint8_t *p, size_t len, uint64_t current);
 uint64_t crc_normal_final(crcInfoPtr crc, uint64_t current);
@@ -117,6 +190,18 @@ uint64_t crc_reverse_update(crcInfoPtr crc, uint8_t *p, size_t len, uint64_t cur
 uint64_t crc_reverse_final(crcInfoPtr crc, uint64_t current);
 uint64_t crc_reverse_oneshot(crcInfoPtr crc, uint8_t *p, size_t len);
 
+static inline uint64_t
+crc_load64_le(const uint8_t *p) {
+    return ((uint64_t) p[0]) | ((uint64_t) p[1] << 8) | ((uint64_t) p[2] << 16) | ((uint64_t) p[3] << 24) |
+           ((uint64_t) p[4] << 32) | ((uint64_t) p[5] << 40) | ((uint64_t) p[6] << 48) | ((uint64_t) p[7] << 56);
+}
+
+static inline uint64_t
+crc_load64_be(const uint8_t *p) {
+    return ((uint64_t) p[0] << 56) | ((uint64_t) p[1] << 48) | ((uint64_t) p[2] << 40) | ((uint64_t) p[3] << 32) |
+           ((uint64_t) p[4] << 24) | ((uint64_t) p[5] << 16) | ((uint64_t) p[6] << 8) | ((uint64_t) p[7]);
+}
+
 static inline uint64_t descmaskfunc(crcDescriptorPtr descriptor) {
     switch(descriptor->def.parms.width) {
         case 1: return MASK08;
@@ -127,6 +212,26 @@ static inline uint64_t descmaskfunc(crcDescriptorPtr descriptor) {
     return 0;
 }
 
+// Precomputed tables from crc_tables.c, one per distinct width, polynomial
+// and reflection.  Regenerate with tools/gen_crc_tables.c.
+
+extern const uint8_t crc8_07_crc_table[];
+extern const uint8_t crc8_07_reflected_crc_table[];
+extern const uint8_t crc8_1d_crc_table[];
+extern const uint8_t crc8_9b_reflected_crc_table[];
+extern const uint16_t crc16_0589_crc_table[];
+extern const uint16_t crc16_1021_crc_table[];
+extern const uint16_t crc16_1021_reflected_crc_table[];
+extern const uint16_t crc16_8005_crc_table[];
+extern const uint16_t crc16_8005_reflected_crc_table[];
+extern const uint16_t crc16_8408_reflected_crc_table[];
+extern const uint32_t crc32_000000af_crc_table[];
+extern const uint32_t crc32_04c11db7_crc_table[];
+extern const uint32_t crc32_04c11db7_reflected_crc_table[];
+extern const uint32_t crc32_1edc6f41_reflected_crc_table[];
+extern const uint32_t crc32_864cfb00_crc_table[];
+extern const uint64_t crc64_42f0e1eba9ea3693_crc_table[];
+
 extern const crcDescriptor crc8;
 extern const crcDescriptor crc8_icode;
 extern const crcDescriptor crc8_itu;
@@ -143,6 +248,7 @@ extern const crcDescriptor crc16_icode;
 extern const crcDescriptor crc16_verifone;
 extern const crcDescriptor crc16_a;
 extern const crcDescriptor crc16_b;
+extern const crcDescriptor crc24_openpgp;
 extern const crcDescriptor crc32;
 extern const crcDescriptor crc32_castagnoli;
 extern const crcDescriptor crc32_bzip2;
@@ -150,6 +256,8 @@ extern const crcDescriptor crc32_mpeg_2;
 extern const crcDescriptor crc32_posix;
 extern const crcDescriptor crc32_xfer;
 extern const crcDescriptor adler32;
+extern const crcDescriptor fletcher16;
+extern const crcDescriptor fletcher32;
 extern const crcDescriptor crc64_ecma_182;
 
 #endif
@@ -34,4 +34,5 @@ const crcDescriptor crc16_a = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0xBF05,
     .def.parms.reflect_reverse = REFLECT_REVERSE,
+    .def.parms.table = crc16_1021_reflected_crc_table,
 };
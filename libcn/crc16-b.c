@@ -31,4 +31,5 @@ const crcDescriptor crc16_b = {
     .def.parms.final_xor = 0xFFFF,
     .def.parms.weak_check = 0x906E,
     .def.parms.reflect_reverse = REFLECT_REVERSE,
+    .def.parms.table = crc16_1021_reflected_crc_table,
 };
@@ -33,4 +33,5 @@ const crcDescriptor crc16_ccitt_false = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0x29B1,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc16_1021_crc_table,
 };
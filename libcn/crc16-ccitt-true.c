@@ -33,4 +33,5 @@ const crcDescriptor crc16_ccitt_true = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0x2189,
     .def.parms.reflect_reverse = REFLECT_REVERSE,
+    .def.parms.table = crc16_1021_reflected_crc_table,
 };
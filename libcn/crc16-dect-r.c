@@ -31,4 +31,5 @@ const crcDescriptor crc16_dect_r = {
     .def.parms.final_xor = 1,
     .def.parms.weak_check = 0x007E,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc16_0589_crc_table,
 };
@@ -31,4 +31,5 @@ const crcDescriptor crc16_dect_x = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0x007F,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc16_0589_crc_table,
 };
@@ -31,4 +31,5 @@ const crcDescriptor crc16_icode = {
     .def.parms.final_xor = 0xFFFF,
     .def.parms.weak_check = 0xD64E,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc16_1021_crc_table,
 };
@@ -33,4 +33,5 @@ const crcDescriptor crc16_usb = {
     .def.parms.final_xor = 0xffff,
     .def.parms.weak_check = 0xB4C8,
     .def.parms.reflect_reverse = REFLECT_REVERSE,
+    .def.parms.table = crc16_8005_reflected_crc_table,
 };
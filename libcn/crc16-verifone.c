@@ -31,4 +31,5 @@ const crcDescriptor crc16_verifone = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0xFEE8,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc16_8005_crc_table,
 };
@@ -32,4 +32,5 @@ const crcDescriptor crc16_xmodem = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0x0C73,
     .def.parms.reflect_reverse = REFLECT_REVERSE,
+    .def.parms.table = crc16_8408_reflected_crc_table,
 };
@@ -31,4 +31,5 @@ const crcDescriptor crc16 = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0xBB3D,
     .def.parms.reflect_reverse = REFLECT_REVERSE,
+    .def.parms.table = crc16_8005_reflected_crc_table,
 };
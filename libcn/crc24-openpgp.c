@@ -0,0 +1,44 @@
+/* 
+ * Copyright (c) 2012 Apple, Inc. All Rights Reserved.
+ * 
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+
+
+
+#include "crc.h"
+
+/*
+ * CRC-24/OPENPGP (RFC 4880 section 6.1) runs on the 32 bit engine with the
+ * register carried 8 bits up; the final step shifts the pad back out.
+ */
+
+const crcDescriptor crc24_openpgp = {
+    .name = "crc24-openpgp",
+    .defType = model,
+    .def.parms.width = 4,
+    .def.parms.pad = 8,
+    .def.parms.poly = 0x864CFB00,
+    .def.parms.initial_value = 0xB704CE00,
+    .def.parms.final_xor = 0,
+    .def.parms.weak_check = 0x21CF02,
+    .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc32_864cfb00_crc_table,
+};
@@ -22,9 +22,16 @@
  */
 
 
+
 #include "crc.h"
+#include <string.h>
 
-const crcDescriptor crc32_castagnoli = {
+/*
+ * CRC-32C is computed with the SSE4.2 crc32 instruction when the CPU has it,
+ * otherwise through the reflected table path for the model below.
+ */
+
+static const crcDescriptor crc32_castagnoli_model = {
     .name = "crc32-castagnoli",
     .defType = model,
     .def.parms.width = 4,
@@ -33,4 +40,219 @@ const crcDescriptor crc32_castagnoli = {
     .def.parms.final_xor = 0xFFFFFFFF,
     .def.parms.weak_check = 0xE3069283,
     .def.parms.reflect_reverse = REFLECT_REVERSE,
+    .def.parms.table = crc32_1edc6f41_reflected_crc_table,
+};
+
+static crcInfo crc32_castagnoli_table = {
+    .descriptor = &crc32_castagnoli_model,
+};
+
+#if CRC_X86_64
+#include <nmmintrin.h>
+
+/*
+ * Long buffers are cut into three equal lanes that are checksummed as
+ * independent crc32q dependency chains, which keeps the instruction's
+ * 3 cycle latency covered.  The lane CRCs are then merged by advancing the
+ * earlier lanes over the length of one lane with a 4 x 256 shift table.
+ */
+
+#define CRC32C_LONG_LANE 1024
+#define CRC32C_SHORT_LANE 128
+
+typedef struct crc32c_shift_t {
+    uint32_t table[4][256];
+} crc32c_shift;
+
+static struct crc32c_hw_ctx_t {
+    crc32c_shift longShift;
+    crc32c_shift shortShift;
+} crc32c_hw_ctx;
+static dispatch_once_t crc32c_hw_init;
+
+static inline uint64_t
+crc32c_load64(const uint8_t *p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+CRC_TARGET("sse4.2") static uint32_t
+crc32c_hw_zeros(uint32_t crc, size_t len)
+{
+    uint64_t c = crc;
+    for(size_t i=0; i<len/8; i++) c = _mm_crc32_u64(c, 0);
+    return (uint32_t) c;
+}
+
+CRC_TARGET("sse4.2") static void
+crc32c_gen_shift(crc32c_shift *shift, size_t len)
+{
+    uint32_t basis[32];
+    
+    for(int bit=0; bit<32; bit++) basis[bit] = crc32c_hw_zeros(1U << bit, len);
+    for(int k=0; k<4; k++) {
+        for(int i=0; i<256; i++) {
+            uint32_t v = 0;
+            for(int bit=0; bit<8; bit++) if(i & (1 << bit)) v ^= basis[k*8 + bit];
+            shift->table[k][i] = v;
+        }
+    }
+}
+
+static void
+crc32c_hw_setup(void *c)
+{
+    struct crc32c_hw_ctx_t *ctx = c;
+    crc32c_gen_shift(&ctx->longShift, CRC32C_LONG_LANE);
+    crc32c_gen_shift(&ctx->shortShift, CRC32C_SHORT_LANE);
+}
+
+static inline uint32_t
+crc32c_shift_apply(const crc32c_shift *shift, uint32_t crc)
+{
+    return shift->table[0][crc & 0xff] ^ shift->table[1][(crc >> 8) & 0xff] ^
+           shift->table[2][(crc >> 16) & 0xff] ^ shift->table[3][crc >> 24];
+}
+
+CRC_TARGET("sse4.2") static inline uint32_t
+crc32c_hw_3way(uint32_t crc, const uint8_t *p, size_t lane, const crc32c_shift *shift)
+{
+    uint64_t c0 = crc, c1 = 0, c2 = 0;
+    
+    for(size_t i=0; i<lane; i+=8) {
+        c0 = _mm_crc32_u64(c0, crc32c_load64(p + i));
+        c1 = _mm_crc32_u64(c1, crc32c_load64(p + lane + i));
+        c2 = _mm_crc32_u64(c2, crc32c_load64(p + 2*lane + i));
+    }
+    crc = crc32c_shift_apply(shift, (uint32_t) c0) ^ (uint32_t) c1;
+    return crc32c_shift_apply(shift, crc) ^ (uint32_t) c2;
+}
+
+CRC_TARGET("sse4.2") static uint64_t
+crc32c_hw_update(size_t len, const void *in, uint64_t current)
+{
+    const uint8_t *p = in;
+    uint32_t crc = (uint32_t) current;
+    
+    while(len && ((uintptr_t) p & 7)) {
+        crc = _mm_crc32_u8(crc, *p++);
+        len--;
+    }
+    if(len >= 3*CRC32C_SHORT_LANE) cc_dispatch_once(&crc32c_hw_init, &crc32c_hw_ctx, crc32c_hw_setup);
+    while(len >= 3*CRC32C_LONG_LANE) {
+        crc = crc32c_hw_3way(crc, p, CRC32C_LONG_LANE, &crc32c_hw_ctx.longShift);
+        p += 3*CRC32C_LONG_LANE; len -= 3*CRC32C_LONG_LANE;
+    }
+    while(len >= 3*CRC32C_SHORT_LANE) {
+        crc = crc32c_hw_3way(crc, p, CRC32C_SHORT_LANE, &crc32c_hw_ctx.shortShift);
+        p += 3*CRC32C_SHORT_LANE; len -= 3*CRC32C_SHORT_LANE;
+    }
+    while(len >= 8) {
+        crc = (uint32_t) _mm_crc32_u64(crc, crc32c_load64(p));
+        p += 8; len -= 8;
+    }
+    while(len--) crc = _mm_crc32_u8(crc, *p++);
+    return crc;
+}
+
+// Four crc32q chains, one per CRC_BATCH_LANES buffer.
+
+CRC_TARGET("sse4.2") static void
+crc32c_hw_batch(size_t len, const uint8_t *const *p, uint64_t *crc)
+{
+    const uint8_t *p0 = p[0], *p1 = p[1], *p2 = p[2], *p3 = p[3];
+    uint64_t c0 = (uint32_t) crc[0], c1 = (uint32_t) crc[1], c2 = (uint32_t) crc[2], c3 = (uint32_t) crc[3];
+    size_t off = 0;
+    
+    for(; off + 8 <= len; off += 8) {
+        c0 = _mm_crc32_u64(c0, crc32c_load64(p0 + off));
+        c1 = _mm_crc32_u64(c1, crc32c_load64(p1 + off));
+        c2 = _mm_crc32_u64(c2, crc32c_load64(p2 + off));
+        c3 = _mm_crc32_u64(c3, crc32c_load64(p3 + off));
+    }
+    for(; off < len; off++) {
+        c0 = _mm_crc32_u8((uint32_t) c0, p0[off]);
+        c1 = _mm_crc32_u8((uint32_t) c1, p1[off]);
+        c2 = _mm_crc32_u8((uint32_t) c2, p2[off]);
+        c3 = _mm_crc32_u8((uint32_t) c3, p3[off]);
+    }
+    crc[0] = (uint32_t) c0;
+    crc[1] = (uint32_t) c1;
+    crc[2] = (uint32_t) c2;
+    crc[3] = (uint32_t) c3;
+}
+
+static inline int
+crc32c_have_hw(void)
+{
+    return (crc_cpu_features() & CRC_CPU_SSE42) != 0;
+}
+
+#else
+
+static inline int
+crc32c_have_hw(void)
+{
+    return 0;
+}
+
+static uint64_t
+crc32c_hw_update(size_t __unused len, const void * __unused in, uint64_t current)
+{
+    return current;
+}
+
+static void
+crc32c_hw_batch(size_t __unused len, const uint8_t *const * __unused p, uint64_t * __unused crc)
+{
+}
+
+#endif /* CRC_X86_64 */
+
+static uint64_t
+crc32_castagnoli_setup(void)
+{
+    if(crc32c_have_hw()) return crc32_castagnoli_model.def.parms.initial_value;
+    return crc_reverse_init(&crc32_castagnoli_table);
+}
+
+static uint64_t
+crc32_castagnoli_update(size_t len, const void *in, uint64_t crc)
+{
+    if(crc32c_have_hw()) return crc32c_hw_update(len, in, crc);
+    return crc_reverse_update(&crc32_castagnoli_table, (uint8_t *) in, len, crc);
+}
+
+static void
+crc32_castagnoli_batch(size_t len, const uint8_t *const *in, uint64_t *crc)
+{
+    if(crc32c_have_hw()) crc32c_hw_batch(len, in, crc);
+    else crc32_castagnoli_table.batch(&crc32_castagnoli_table, in, len, crc);
+}
+
+static uint64_t
+crc32_castagnoli_final(size_t __unused length, uint64_t crc)
+{
+    return (crc ^ crc32_castagnoli_model.def.parms.final_xor) & MASK32;
+}
+
+static uint64_t
+crc32_castagnoli_oneshot(size_t len, const void *in)
+{
+    uint64_t crc = crc32_castagnoli_setup();
+    crc = crc32_castagnoli_update(len, in, crc);
+    return crc32_castagnoli_final(len, crc);
+}
+
+const crcDescriptor crc32_castagnoli = {
+    .name = "crc32-castagnoli",
+    .defType = functions,
+    .def.funcs.setup = crc32_castagnoli_setup,
+    .def.funcs.update = crc32_castagnoli_update,
+    .def.funcs.final = crc32_castagnoli_final,
+    .def.funcs.oneshot = crc32_castagnoli_oneshot,
+    .def.funcs.batch = crc32_castagnoli_batch,
+    .def.funcs.model = &crc32_castagnoli_model
 };
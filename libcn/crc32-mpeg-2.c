@@ -33,4 +33,5 @@ const crcDescriptor crc32_mpeg_2 = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0x0376E6E7,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc32_04c11db7_crc_table,
 };
@@ -33,4 +33,5 @@ const crcDescriptor crc32_posix = {
     .def.parms.final_xor = 0xFFFFFFFF,
     .def.parms.weak_check = 0x765E7680,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc32_04c11db7_crc_table,
 };
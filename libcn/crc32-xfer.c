@@ -33,4 +33,5 @@ const crcDescriptor crc32_xfer = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0xBD0BE338,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc32_000000af_crc_table,
 };
@@ -33,4 +33,5 @@ const crcDescriptor crc32 = {
     .def.parms.final_xor = 0xFFFFFFFF,
     .def.parms.weak_check = 0xCBF43926,
     .def.parms.reflect_reverse = REFLECT_REVERSE,
+    .def.parms.table = crc32_04c11db7_reflected_crc_table,
 };
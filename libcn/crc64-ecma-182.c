@@ -32,4 +32,5 @@ const crcDescriptor crc64_ecma_182 = {
     .def.parms.final_xor = 0xffffffffffffffffULL,
     .def.parms.weak_check = 0x62EC59E3F1A4F00AULL,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc64_42f0e1eba9ea3693_crc_table,
 };
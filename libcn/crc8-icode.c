@@ -31,4 +31,5 @@ const crcDescriptor crc8_icode = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0x7E,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc8_1d_crc_table,
 };
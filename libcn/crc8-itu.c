@@ -31,4 +31,5 @@ const crcDescriptor crc8_itu = {
     .def.parms.final_xor = 0x55,
     .def.parms.weak_check = 0xA1,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc8_07_crc_table,
 };
@@ -31,4 +31,5 @@ const crcDescriptor crc8_rohc = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0xD0,
     .def.parms.reflect_reverse = REFLECT_REVERSE,
+    .def.parms.table = crc8_07_reflected_crc_table,
 };
@@ -31,4 +31,5 @@ const crcDescriptor crc8_wcdma = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0x25,
     .def.parms.reflect_reverse = REFLECT_REVERSE,
+    .def.parms.table = crc8_9b_reflected_crc_table,
 };
@@ -31,4 +31,5 @@ const crcDescriptor crc8 = {
     .def.parms.final_xor = 0,
     .def.parms.weak_check = 0xF4,
     .def.parms.reflect_reverse = NO_REFLECT_REVERSE,
+    .def.parms.table = crc8_07_crc_table,
 };
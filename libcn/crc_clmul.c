@@ -0,0 +1,150 @@
+/* 
+ * Copyright (c) 2012 Apple, Inc. All Rights Reserved.
+ * 
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+
+
+/*
+ * Carry-less multiply folding for model CRCs.
+ *
+ * The input is consumed as 128 bit polynomials.  Four accumulators walk the
+ * buffer 64 bytes at a time, each advanced by x^512 mod P per step; they are
+ * then folded into one by x^128 mod P.  The folded value is congruent to the
+ * consumed data modulo P, so checksumming its 16 bytes from a zero register
+ * through the slicing tables yields the same CRC as the data itself.
+ *
+ * All constants come from the model's polynomial and width, so any model of
+ * up to 64 bits uses the same code.  Reflected models keep the data in the
+ * natural little-endian bit order, which leaves every product one power of x
+ * high; their constants are taken one power lower to compensate.
+ */
+
+#include "crc.h"
+
+static void
+fold_constants(crcDescriptorPtr descriptor, unsigned bits, uint64_t k[2])
+{
+    if(descriptor->def.parms.reflect_reverse) {
+        k[0] = reflect(crc_xpow(descriptor, bits + 64 - 1), 64);
+        k[1] = reflect(crc_xpow(descriptor, bits - 1), 64);
+    } else {
+        k[0] = crc_xpow(descriptor, bits);
+        k[1] = crc_xpow(descriptor, bits + 64);
+    }
+}
+
+#if CRC_X86_64
+#include <wmmintrin.h>
+#include <tmmintrin.h>
+
+void
+crc_clmul_init(crcInfoPtr crc)
+{
+    uint32_t required = CRC_CPU_PCLMUL | CRC_CPU_SSE42;
+    
+    crc->fold.enabled = 0;
+    if((crc_cpu_features() & required) != required) return;
+    fold_constants(crc->descriptor, 128, crc->fold.k128);
+    fold_constants(crc->descriptor, 512, crc->fold.k512);
+    crc->fold.enabled = 1;
+}
+
+CRC_TARGET("pclmul,ssse3") static inline __m128i
+fold128(__m128i x, __m128i k, __m128i next)
+{
+    __m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), next);
+}
+
+CRC_TARGET("pclmul,ssse3") static inline __m128i
+load128(const uint8_t *p, __m128i order)
+{
+    return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) p), order);
+}
+
+CRC_TARGET("pclmul,ssse3") uint64_t
+crc_clmul_update(crcInfoPtr crc, const uint8_t *p, size_t len, uint64_t current)
+{
+    int reflected = crc->descriptor->def.parms.reflect_reverse;
+    size_t width = crc->descriptor->def.parms.width;
+    __m128i order, k128, k512, x0, x1, x2, x3;
+    uint8_t folded[16];
+    
+    // Normal models treat the first byte as the most significant; reflected
+    // models use the bytes as they lie in memory.
+    if(reflected) order = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    else order = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    k128 = _mm_loadu_si128((const __m128i *) crc->fold.k128);
+    k512 = _mm_loadu_si128((const __m128i *) crc->fold.k512);
+    
+    x0 = load128(p, order);
+    x1 = load128(p + 16, order);
+    x2 = load128(p + 32, order);
+    x3 = load128(p + 48, order);
+    
+    // The running register is XORed into the leading bytes of the input.
+    if(reflected) x0 = _mm_xor_si128(x0, _mm_set_epi64x(0, (long long) current));
+    else x0 = _mm_xor_si128(x0, _mm_set_epi64x((long long) (current << (64 - width*8)), 0));
+    p += 64; len -= 64;
+    
+    while(len >= 64) {
+        x0 = fold128(x0, k512, load128(p, order));
+        x1 = fold128(x1, k512, load128(p + 16, order));
+        x2 = fold128(x2, k512, load128(p + 32, order));
+        x3 = fold128(x3, k512, load128(p + 48, order));
+        p += 64; len -= 64;
+    }
+    
+    x0 = fold128(x0, k128, x1);
+    x0 = fold128(x0, k128, x2);
+    x0 = fold128(x0, k128, x3);
+    
+    while(len >= 16) {
+        x0 = fold128(x0, k128, load128(p, order));
+        p += 16; len -= 16;
+    }
+    
+    _mm_storeu_si128((__m128i *) folded, _mm_shuffle_epi8(x0, order));
+    if(reflected) {
+        current = crc_reverse_update(crc, folded, sizeof(folded), 0);
+        return crc_reverse_update(crc, (uint8_t *) p, len, current);
+    }
+    current = crc_normal_update(crc, folded, sizeof(folded), 0);
+    return crc_normal_update(crc, (uint8_t *) p, len, current);
+}
+
+#else
+
+void
+crc_clmul_init(crcInfoPtr crc)
+{
+    (void) fold_constants;
+    crc->fold.enabled = 0;
+}
+
+uint64_t
+crc_clmul_update(crcInfoPtr __unused crc, const uint8_t * __unused p, size_t __unused len, uint64_t current)
+{
+    return current;
+}
+
+#endif /* CRC_X86_64 */
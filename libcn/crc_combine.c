@@ -0,0 +1,76 @@
+/* 
+ * Copyright (c) 2012 Apple, Inc. All Rights Reserved.
+ * 
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+
+
+/*
+ * GF(2) arithmetic modulo a model polynomial.  Values are in normal bit
+ * order, with the implicit x^width term of the polynomial omitted.
+ */
+
+#include "crc.h"
+
+static inline uint64_t
+crc_times_x(crcDescriptorPtr descriptor, uint64_t a)
+{
+    uint64_t topbit = 1ULL << ((descriptor->def.parms.width * 8) - 1);
+    uint64_t carry = a & topbit;
+    
+    a = (a << 1) & descmaskfunc(descriptor);
+    return (carry) ? a ^ descriptor->def.parms.poly: a;
+}
+
+uint64_t
+crc_multiply(crcDescriptorPtr descriptor, uint64_t a, uint64_t b)
+{
+    uint64_t r = 0;
+    
+    for(int i = descriptor->def.parms.width * 8 - 1; i >= 0; i--) {
+        r = crc_times_x(descriptor, r);
+        if((b >> i) & 1) r ^= a;
+    }
+    return r;
+}
+
+uint64_t
+crc_xpow(crcDescriptorPtr descriptor, uint64_t e)
+{
+    uint64_t r = 1, base = crc_times_x(descriptor, 1);
+    
+    while(e) {
+        if(e & 1) r = crc_multiply(descriptor, r, base);
+        base = crc_multiply(descriptor, base, base);
+        e >>= 1;
+    }
+    return r;
+}
+
+uint64_t
+crc_shift(crcDescriptorPtr descriptor, uint64_t current, size_t len)
+{
+    size_t bits = descriptor->def.parms.width * 8;
+    uint64_t factor = crc_xpow(descriptor, (uint64_t) len * 8);
+    
+    if(!descriptor->def.parms.reflect_reverse) return crc_multiply(descriptor, current, factor);
+    current = crc_multiply(descriptor, reflect(current, bits), factor);
+    return reflect(current, bits);
+}
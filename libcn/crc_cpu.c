@@ -0,0 +1,91 @@
+/* 
+ * Copyright (c) 2012 Apple, Inc. All Rights Reserved.
+ * 
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+
+
+#include "crc.h"
+
+#if CRC_X86_64
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+static uint32_t crc_cpu_feature_bits;
+static dispatch_once_t crc_cpu_init;
+
+static uint64_t
+crc_cpu_xcr0(void)
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t lo, hi;
+    __asm__ __volatile__ ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+    return ((uint64_t) hi << 32) | lo;
+#endif
+}
+
+static void
+crc_cpu_probe(void *ctx)
+{
+    uint32_t *features = ctx;
+    uint32_t ecx, ebx7 = 0;
+    
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 1);
+    ecx = (uint32_t) regs[2];
+    __cpuid(regs, 0);
+    if(regs[0] >= 7) {
+        __cpuidex(regs, 7, 0);
+        ebx7 = (uint32_t) regs[1];
+    }
+#else
+    uint32_t eax, ebx, ecx7, edx;
+    if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return;
+    if(__get_cpuid_max(0, NULL) >= 7) __cpuid_count(7, 0, eax, ebx7, ecx7, edx);
+#endif
+    if(ecx & (1 << 20)) *features |= CRC_CPU_SSE42;
+    if(ecx & (1 << 1)) *features |= CRC_CPU_PCLMUL;
+    if(ecx & (1 << 9)) *features |= CRC_CPU_SSSE3;
+    // AVX2 also needs the OS to save the YMM state (OSXSAVE, XCR0 bits 1-2).
+    if((ebx7 & (1 << 5)) && (ecx & (1 << 27)) && (crc_cpu_xcr0() & 6) == 6) *features |= CRC_CPU_AVX2;
+}
+
+uint32_t
+crc_cpu_features(void)
+{
+    cc_dispatch_once(&crc_cpu_init, &crc_cpu_feature_bits, crc_cpu_probe);
+    return crc_cpu_feature_bits;
+}
+
+#else
+
+uint32_t
+crc_cpu_features(void)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,85 @@
+/* 
+ * Copyright (c) 2012 Apple, Inc. All Rights Reserved.
+ * 
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+
+
+#include "crc.h"
+#include <stdlib.h>
+#include <string.h>
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+/*
+ * Runtime-defined models are kept for the life of the process, one crcInfo
+ * per distinct parameter set, so creating the same model again reuses its
+ * tables and fold constants instead of generating them a second time.
+ */
+
+typedef struct crcCustom_t {
+    struct crcCustom_t *next;
+    crcDescriptor descriptor;
+    crcInfo info;
+} crcCustom;
+
+static crcCustom *crc_custom_models;
+
+#if defined(_WIN32)
+static SRWLOCK crc_custom_lock = SRWLOCK_INIT;
+#define crc_custom_lock_acquire() AcquireSRWLockExclusive(&crc_custom_lock)
+#define crc_custom_lock_release() ReleaseSRWLockExclusive(&crc_custom_lock)
+#else
+static pthread_mutex_t crc_custom_lock = PTHREAD_MUTEX_INITIALIZER;
+#define crc_custom_lock_acquire() pthread_mutex_lock(&crc_custom_lock)
+#define crc_custom_lock_release() pthread_mutex_unlock(&crc_custom_lock)
+#endif
+
+static int
+crc_custom_match(const crcModelParms *a, const crcModelParms *b)
+{
+    return a->width == b->width && a->pad == b->pad && a->reflect_reverse == b->reflect_reverse &&
+           a->poly == b->poly && a->initial_value == b->initial_value && a->final_xor == b->final_xor;
+}
+
+crcInfoPtr
+crc_custom_info(const crcModelParms *parms)
+{
+    crcCustom *entry;
+    
+    crc_custom_lock_acquire();
+    for(entry = crc_custom_models; entry != NULL; entry = entry->next)
+        if(crc_custom_match(&entry->descriptor.def.parms, parms)) break;
+    if(entry == NULL && (entry = calloc(1, sizeof(crcCustom))) != NULL) {
+        crcDescriptor descriptor = {
+            .name = "custom",
+            .defType = model,
+            .def.parms = *parms,
+        };
+        memcpy(&entry->descriptor, &descriptor, sizeof(descriptor));
+        entry->descriptor.def.parms.table = NULL;
+        entry->info.descriptor = &entry->descriptor;
+        entry->next = crc_custom_models;
+        crc_custom_models = entry;
+    }
+    crc_custom_lock_release();
+    return (entry != NULL) ? &entry->info: NULL;
+}
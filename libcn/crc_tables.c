@@ -0,0 +1,3894 @@
+/*
+ * Generated by tools/gen_crc_tables.c -- do not edit.
+ */
+
+#include "crc.h"
+
+const uint8_t crc8_07_crc_table[CRC_SLICES * 256] = {
+ 0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15, 0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
+ 0x70, 0x77, 0x7e, 0x79, 0x6c, 0x6b, 0x62, 0x65, 0x48, 0x4f, 0x46, 0x41, 0x54, 0x53, 0x5a, 0x5d,
+ 0xe0, 0xe7, 0xee, 0xe9, 0xfc, 0xfb, 0xf2, 0xf5, 0xd8, 0xdf, 0xd6, 0xd1, 0xc4, 0xc3, 0xca, 0xcd,
+ 0x90, 0x97, 0x9e, 0x99, 0x8c, 0x8b, 0x82, 0x85, 0xa8, 0xaf, 0xa6, 0xa1, 0xb4, 0xb3, 0xba, 0xbd,
+ 0xc7, 0xc0, 0xc9, 0xce, 0xdb, 0xdc, 0xd5, 0xd2, 0xff, 0xf8, 0xf1, 0xf6, 0xe3, 0xe4, 0xed, 0xea,
+ 0xb7, 0xb0, 0xb9, 0xbe, 0xab, 0xac, 0xa5, 0xa2, 0x8f, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9d, 0x9a,
+ 0x27, 0x20, 0x29, 0x2e, 0x3b, 0x3c, 0x35, 0x32, 0x1f, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0d, 0x0a,
+ 0x57, 0x50, 0x59, 0x5e, 0x4b, 0x4c, 0x45, 0x42, 0x6f, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7d, 0x7a,
+ 0x89, 0x8e, 0x87, 0x80, 0x95, 0x92, 0x9b, 0x9c, 0xb1, 0xb6, 0xbf, 0xb8, 0xad, 0xaa, 0xa3, 0xa4,
+ 0xf9, 0xfe, 0xf7, 0xf0, 0xe5, 0xe2, 0xeb, 0xec, 0xc1, 0xc6, 0xcf, 0xc8, 0xdd, 0xda, 0xd3, 0xd4,
+ 0x69, 0x6e, 0x67, 0x60, 0x75, 0x72, 0x7b, 0x7c, 0x51, 0x56, 0x5f, 0x58, 0x4d, 0x4a, 0x43, 0x44,
+ 0x19, 0x1e, 0x17, 0x10, 0x05, 0x02, 0x0b, 0x0c, 0x21, 0x26, 0x2f, 0x28, 0x3d, 0x3a, 0x33, 0x34,
+ 0x4e, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5c, 0x5b, 0x76, 0x71, 0x78, 0x7f, 0x6a, 0x6d, 0x64, 0x63,
+ 0x3e, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2c, 0x2b, 0x06, 0x01, 0x08, 0x0f, 0x1a, 0x1d, 0x14, 0x13,
+ 0xae, 0xa9, 0xa0, 0xa7, 0xb2, 0xb5, 0xbc, 0xbb, 0x96, 0x91, 0x98, 0x9f, 0x8a, 0x8d, 0x84, 0x83,
+ 0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb, 0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3,
+ 0x00, 0x15, 0x2a, 0x3f, 0x54, 0x41, 0x7e, 0x6b, 0xa8, 0xbd, 0x82, 0x97, 0xfc, 0xe9, 0xd6, 0xc3,
+ 0x57, 0x42, 0x7d, 0x68, 0x03, 0x16, 0x29, 0x3c, 0xff, 0xea, 0xd5, 0xc0, 0xab, 0xbe, 0x81, 0x94,
+ 0xae, 0xbb, 0x84, 0x91, 0xfa, 0xef, 0xd0, 0xc5, 0x06, 0x13, 0x2c, 0x39, 0x52, 0x47, 0x78, 0x6d,
+ 0xf9, 0xec, 0xd3, 0xc6, 0xad, 0xb8, 0x87, 0x92, 0x51, 0x44, 0x7b, 0x6e, 0x05, 0x10, 0x2f, 0x3a,
+ 0x5b, 0x4e, 0x71, 0x64, 0x0f, 0x1a, 0x25, 0x30, 0xf3, 0xe6, 0xd9, 0xcc, 0xa7, 0xb2, 0x8d, 0x98,
+ 0x0c, 0x19, 0x26, 0x33, 0x58, 0x4d, 0x72, 0x67, 0xa4, 0xb1, 0x8e, 0x9b, 0xf0, 0xe5, 0xda, 0xcf,
+ 0xf5, 0xe0, 0xdf, 0xca, 0xa1, 0xb4, 0x8b, 0x9e, 0x5d, 0x48, 0x77, 0x62, 0x09, 0x1c, 0x23, 0x36,
+ 0xa2, 0xb7, 0x88, 0x9d, 0xf6, 0xe3, 0xdc, 0xc9, 0x0a, 0x1f, 0x20, 0x35, 0x5e, 0x4b, 0x74, 0x61,
+ 0xb6, 0xa3, 0x9c, 0x89, 0xe2, 0xf7, 0xc8, 0xdd, 0x1e, 0x0b, 0x34, 0x21, 0x4a, 0x5f, 0x60, 0x75,
+ 0xe1, 0xf4, 0xcb, 0xde, 0xb5, 0xa0, 0x9f, 0x8a, 0x49, 0x5c, 0x63, 0x76, 0x1d, 0x08, 0x37, 0x22,
+ 0x18, 0x0d, 0x32, 0x27, 0x4c, 0x59, 0x66, 0x73, 0xb0, 0xa5, 0x9a, 0x8f, 0xe4, 0xf1, 0xce, 0xdb,
+ 0x4f, 0x5a, 0x65, 0x70, 0x1b, 0x0e, 0x31, 0x24, 0xe7, 0xf2, 0xcd, 0xd8, 0xb3, 0xa6, 0x99, 0x8c,
+ 0xed, 0xf8, 0xc7, 0xd2, 0xb9, 0xac, 0x93, 0x86, 0x45, 0x50, 0x6f, 0x7a, 0x11, 0x04, 0x3b, 0x2e,
+ 0xba, 0xaf, 0x90, 0x85, 0xee, 0xfb, 0xc4, 0xd1, 0x12, 0x07, 0x38, 0x2d, 0x46, 0x53, 0x6c, 0x79,
+ 0x43, 0x56, 0x69, 0x7c, 0x17, 0x02, 0x3d, 0x28, 0xeb, 0xfe, 0xc1, 0xd4, 0xbf, 0xaa, 0x95, 0x80,
+ 0x14, 0x01, 0x3e, 0x2b, 0x40, 0x55, 0x6a, 0x7f, 0xbc, 0xa9, 0x96, 0x83, 0xe8, 0xfd, 0xc2, 0xd7,
+ 0x00, 0x6b, 0xd6, 0xbd, 0xab, 0xc0, 0x7d, 0x16, 0x51, 0x3a, 0x87, 0xec, 0xfa, 0x91, 0x2c, 0x47,
+ 0xa2, 0xc9, 0x74, 0x1f, 0x09, 0x62, 0xdf, 0xb4, 0xf3, 0x98, 0x25, 0x4e, 0x58, 0x33, 0x8e, 0xe5,
+ 0x43, 0x28, 0x95, 0xfe, 0xe8, 0x83, 0x3e, 0x55, 0x12, 0x79, 0xc4, 0xaf, 0xb9, 0xd2, 0x6f, 0x04,
+ 0xe1, 0x8a, 0x37, 0x5c, 0x4a, 0x21, 0x9c, 0xf7, 0xb0, 0xdb, 0x66, 0x0d, 0x1b, 0x70, 0xcd, 0xa6,
+ 0x86, 0xed, 0x50, 0x3b, 0x2d, 0x46, 0xfb, 0x90, 0xd7, 0xbc, 0x01, 0x6a, 0x7c, 0x17, 0xaa, 0xc1,
+ 0x24, 0x4f, 0xf2, 0x99, 0x8f, 0xe4, 0x59, 0x32, 0x75, 0x1e, 0xa3, 0xc8, 0xde, 0xb5, 0x08, 0x63,
+ 0xc5, 0xae, 0x13, 0x78, 0x6e, 0x05, 0xb8, 0xd3, 0x94, 0xff, 0x42, 0x29, 0x3f, 0x54, 0xe9, 0x82,
+ 0x67, 0x0c, 0xb1, 0xda, 0xcc, 0xa7, 0x1a, 0x71, 0x36, 0x5d, 0xe0, 0x8b, 0x9d, 0xf6, 0x4b, 0x20,
+ 0x0b, 0x60, 0xdd, 0xb6, 0xa0, 0xcb, 0x76, 0x1d, 0x5a, 0x31, 0x8c, 0xe7, 0xf1, 0x9a, 0x27, 0x4c,
+ 0xa9, 0xc2, 0x7f, 0x14, 0x02, 0x69, 0xd4, 0xbf, 0xf8, 0x93, 0x2e, 0x45, 0x53, 0x38, 0x85, 0xee,
+ 0x48, 0x23, 0x9e, 0xf5, 0xe3, 0x88, 0x35, 0x5e, 0x19, 0x72, 0xcf, 0xa4, 0xb2, 0xd9, 0x64, 0x0f,
+ 0xea, 0x81, 0x3c, 0x57, 0x41, 0x2a, 0x97, 0xfc, 0xbb, 0xd0, 0x6d, 0x06, 0x10, 0x7b, 0xc6, 0xad,
+ 0x8d, 0xe6, 0x5b, 0x30, 0x26, 0x4d, 0xf0, 0x9b, 0xdc, 0xb7, 0x0a, 0x61, 0x77, 0x1c, 0xa1, 0xca,
+ 0x2f, 0x44, 0xf9, 0x92, 0x84, 0xef, 0x52, 0x39, 0x7e, 0x15, 0xa8, 0xc3, 0xd5, 0xbe, 0x03, 0x68,
+ 0xce, 0xa5, 0x18, 0x73, 0x65, 0x0e, 0xb3, 0xd8, 0x9f, 0xf4, 0x49, 0x22, 0x34, 0x5f, 0xe2, 0x89,
+ 0x6c, 0x07, 0xba, 0xd1, 0xc7, 0xac, 0x11, 0x7a, 0x3d, 0x56, 0xeb, 0x80, 0x96, 0xfd, 0x40, 0x2b,
+ 0x00, 0x16, 0x2c, 0x3a, 0x58, 0x4e, 0x74, 0x62, 0xb0, 0xa6, 0x9c, 0x8a, 0xe8, 0xfe, 0xc4, 0xd2,
+ 0x67, 0x71, 0x4b, 0x5d, 0x3f, 0x29, 0x13, 0x05, 0xd7, 0xc1, 0xfb, 0xed, 0x8f, 0x99, 0xa3, 0xb5,
+ 0xce, 0xd8, 0xe2, 0xf4, 0x96, 0x80, 0xba, 0xac, 0x7e, 0x68, 0x52, 0x44, 0x26, 0x30, 0x0a, 0x1c,
+ 0xa9, 0xbf, 0x85, 0x93, 0xf1, 0xe7, 0xdd, 0xcb, 0x19, 0x0f, 0x35, 0x23, 0x41, 0x57, 0x6d, 0x7b,
+ 0x9b, 0x8d, 0xb7, 0xa1, 0xc3, 0xd5, 0xef, 0xf9, 0x2b, 0x3d, 0x07, 0x11, 0x73, 0x65, 0x5f, 0x49,
+ 0xfc, 0xea, 0xd0, 0xc6, 0xa4, 0xb2, 0x88, 0x9e, 0x4c, 0x5a, 0x60, 0x76, 0x14, 0x02, 0x38, 0x2e,
+ 0x55, 0x43, 0x79, 0x6f, 0x0d, 0x1b, 0x21, 0x37, 0xe5, 0xf3, 0xc9, 0xdf, 0xbd, 0xab, 0x91, 0x87,
+ 0x32, 0x24, 0x1e, 0x08, 0x6a, 0x7c, 0x46, 0x50, 0x82, 0x94, 0xae, 0xb8, 0xda, 0xcc, 0xf6, 0xe0,
+ 0x31, 0x27, 0x1d, 0x0b, 0x69, 0x7f, 0x45, 0x53, 0x81, 0x97, 0xad, 0xbb, 0xd9, 0xcf, 0xf5, 0xe3,
+ 0x56, 0x40, 0x7a, 0x6c, 0x0e, 0x18, 0x22, 0x34, 0xe6, 0xf0, 0xca, 0xdc, 0xbe, 0xa8, 0x92, 0x84,
+ 0xff, 0xe9, 0xd3, 0xc5, 0xa7, 0xb1, 0x8b, 0x9d, 0x4f, 0x59, 0x63, 0x75, 0x17, 0x01, 0x3b, 0x2d,
+ 0x98, 0x8e, 0xb4, 0xa2, 0xc0, 0xd6, 0xec, 0xfa, 0x28, 0x3e, 0x04, 0x12, 0x70, 0x66, 0x5c, 0x4a,
+ 0xaa, 0xbc, 0x86, 0x90, 0xf2, 0xe4, 0xde, 0xc8, 0x1a, 0x0c, 0x36, 0x20, 0x42, 0x54, 0x6e, 0x78,
+ 0xcd, 0xdb, 0xe1, 0xf7, 0x95, 0x83, 0xb9, 0xaf, 0x7d, 0x6b, 0x51, 0x47, 0x25, 0x33, 0x09, 0x1f,
+ 0x64, 0x72, 0x48, 0x5e, 0x3c, 0x2a, 0x10, 0x06, 0xd4, 0xc2, 0xf8, 0xee, 0x8c, 0x9a, 0xa0, 0xb6,
+ 0x03, 0x15, 0x2f, 0x39, 0x5b, 0x4d, 0x77, 0x61, 0xb3, 0xa5, 0x9f, 0x89, 0xeb, 0xfd, 0xc7, 0xd1,
+ 0x00, 0x62, 0xc4, 0xa6, 0x8f, 0xed, 0x4b, 0x29, 0x19, 0x7b, 0xdd, 0xbf, 0x96, 0xf4, 0x52, 0x30,
+ 0x32, 0x50, 0xf6, 0x94, 0xbd, 0xdf, 0x79, 0x1b, 0x2b, 0x49, 0xef, 0x8d, 0xa4, 0xc6, 0x60, 0x02,
+ 0x64, 0x06, 0xa0, 0xc2, 0xeb, 0x89, 0x2f, 0x4d, 0x7d, 0x1f, 0xb9, 0xdb, 0xf2, 0x90, 0x36, 0x54,
+ 0x56, 0x34, 0x92, 0xf0, 0xd9, 0xbb, 0x1d, 0x7f, 0x4f, 0x2d, 0x8b, 0xe9, 0xc0, 0xa2, 0x04, 0x66,
+ 0xc8, 0xaa, 0x0c, 0x6e, 0x47, 0x25, 0x83, 0xe1, 0xd1, 0xb3, 0x15, 0x77, 0x5e, 0x3c, 0x9a, 0xf8,
+ 0xfa, 0x98, 0x3e, 0x5c, 0x75, 0x17, 0xb1, 0xd3, 0xe3, 0x81, 0x27, 0x45, 0x6c, 0x0e, 0xa8, 0xca,
+ 0xac, 0xce, 0x68, 0x0a, 0x23, 0x41, 0xe7, 0x85, 0xb5, 0xd7, 0x71, 0x13, 0x3a, 0x58, 0xfe, 0x9c,
+ 0x9e, 0xfc, 0x5a, 0x38, 0x11, 0x73, 0xd5, 0xb7, 0x87, 0xe5, 0x43, 0x21, 0x08, 0x6a, 0xcc, 0xae,
+ 0x97, 0xf5, 0x53, 0x31, 0x18, 0x7a, 0xdc, 0xbe, 0x8e, 0xec, 0x4a, 0x28, 0x01, 0x63, 0xc5, 0xa7,
+ 0xa5, 0xc7, 0x61, 0x03, 0x2a, 0x48, 0xee, 0x8c, 0xbc, 0xde, 0x78, 0x1a, 0x33, 0x51, 0xf7, 0x95,
+ 0xf3, 0x91, 0x37, 0x55, 0x7c, 0x1e, 0xb8, 0xda, 0xea, 0x88, 0x2e, 0x4c, 0x65, 0x07, 0xa1, 0xc3,
+ 0xc1, 0xa3, 0x05, 0x67, 0x4e, 0x2c, 0x8a, 0xe8, 0xd8, 0xba, 0x1c, 0x7e, 0x57, 0x35, 0x93, 0xf1,
+ 0x5f, 0x3d, 0x9b, 0xf9, 0xd0, 0xb2, 0x14, 0x76, 0x46, 0x24, 0x82, 0xe0, 0xc9, 0xab, 0x0d, 0x6f,
+ 0x6d, 0x0f, 0xa9, 0xcb, 0xe2, 0x80, 0x26, 0x44, 0x74, 0x16, 0xb0, 0xd2, 0xfb, 0x99, 0x3f, 0x5d,
+ 0x3b, 0x59, 0xff, 0x9d, 0xb4, 0xd6, 0x70, 0x12, 0x22, 0x40, 0xe6, 0x84, 0xad, 0xcf, 0x69, 0x0b,
+ 0x09, 0x6b, 0xcd, 0xaf, 0x86, 0xe4, 0x42, 0x20, 0x10, 0x72, 0xd4, 0xb6, 0x9f, 0xfd, 0x5b, 0x39,
+ 0x00, 0x29, 0x52, 0x7b, 0xa4, 0x8d, 0xf6, 0xdf, 0x4f, 0x66, 0x1d, 0x34, 0xeb, 0xc2, 0xb9, 0x90,
+ 0x9e, 0xb7, 0xcc, 0xe5, 0x3a, 0x13, 0x68, 0x41, 0xd1, 0xf8, 0x83, 0xaa, 0x75, 0x5c, 0x27, 0x0e,
+ 0x3b, 0x12, 0x69, 0x40, 0x9f, 0xb6, 0xcd, 0xe4, 0x74, 0x5d, 0x26, 0x0f, 0xd0, 0xf9, 0x82, 0xab,
+ 0xa5, 0x8c, 0xf7, 0xde, 0x01, 0x28, 0x53, 0x7a, 0xea, 0xc3, 0xb8, 0x91, 0x4e, 0x67, 0x1c, 0x35,
+ 0x76, 0x5f, 0x24, 0x0d, 0xd2, 0xfb, 0x80, 0xa9, 0x39, 0x10, 0x6b, 0x42, 0x9d, 0xb4, 0xcf, 0xe6,
+ 0xe8, 0xc1, 0xba, 0x93, 0x4c, 0x65, 0x1e, 0x37, 0xa7, 0x8e, 0xf5, 0xdc, 0x03, 0x2a, 0x51, 0x78,
+ 0x4d, 0x64, 0x1f, 0x36, 0xe9, 0xc0, 0xbb, 0x92, 0x02, 0x2b, 0x50, 0x79, 0xa6, 0x8f, 0xf4, 0xdd,
+ 0xd3, 0xfa, 0x81, 0xa8, 0x77, 0x5e, 0x25, 0x0c, 0x9c, 0xb5, 0xce, 0xe7, 0x38, 0x11, 0x6a, 0x43,
+ 0xec, 0xc5, 0xbe, 0x97, 0x48, 0x61, 0x1a, 0x33, 0xa3, 0x8a, 0xf1, 0xd8, 0x07, 0x2e, 0x55, 0x7c,
+ 0x72, 0x5b, 0x20, 0x09, 0xd6, 0xff, 0x84, 0xad, 0x3d, 0x14, 0x6f, 0x46, 0x99, 0xb0, 0xcb, 0xe2,
+ 0xd7, 0xfe, 0x85, 0xac, 0x73, 0x5a, 0x21, 0x08, 0x98, 0xb1, 0xca, 0xe3, 0x3c, 0x15, 0x6e, 0x47,
+ 0x49, 0x60, 0x1b, 0x32, 0xed, 0xc4, 0xbf, 0x96, 0x06, 0x2f, 0x54, 0x7d, 0xa2, 0x8b, 0xf0, 0xd9,
+ 0x9a, 0xb3, 0xc8, 0xe1, 0x3e, 0x17, 0x6c, 0x45, 0xd5, 0xfc, 0x87, 0xae, 0x71, 0x58, 0x23, 0x0a,
+ 0x04, 0x2d, 0x56, 0x7f, 0xa0, 0x89, 0xf2, 0xdb, 0x4b, 0x62, 0x19, 0x30, 0xef, 0xc6, 0xbd, 0x94,
+ 0xa1, 0x88, 0xf3, 0xda, 0x05, 0x2c, 0x57, 0x7e, 0xee, 0xc7, 0xbc, 0x95, 0x4a, 0x63, 0x18, 0x31,
+ 0x3f, 0x16, 0x6d, 0x44, 0x9b, 0xb2, 0xc9, 0xe0, 0x70, 0x59, 0x22, 0x0b, 0xd4, 0xfd, 0x86, 0xaf,
+ 0x00, 0xdf, 0xb9, 0x66, 0x75, 0xaa, 0xcc, 0x13, 0xea, 0x35, 0x53, 0x8c, 0x9f, 0x40, 0x26, 0xf9,
+ 0xd3, 0x0c, 0x6a, 0xb5, 0xa6, 0x79, 0x1f, 0xc0, 0x39, 0xe6, 0x80, 0x5f, 0x4c, 0x93, 0xf5, 0x2a,
+ 0xa1, 0x7e, 0x18, 0xc7, 0xd4, 0x0b, 0x6d, 0xb2, 0x4b, 0x94, 0xf2, 0x2d, 0x3e, 0xe1, 0x87, 0x58,
+ 0x72, 0xad, 0xcb, 0x14, 0x07, 0xd8, 0xbe, 0x61, 0x98, 0x47, 0x21, 0xfe, 0xed, 0x32, 0x54, 0x8b,
+ 0x45, 0x9a, 0xfc, 0x23, 0x30, 0xef, 0x89, 0x56, 0xaf, 0x70, 0x16, 0xc9, 0xda, 0x05, 0x63, 0xbc,
+ 0x96, 0x49, 0x2f, 0xf0, 0xe3, 0x3c, 0x5a, 0x85, 0x7c, 0xa3, 0xc5, 0x1a, 0x09, 0xd6, 0xb0, 0x6f,
+ 0xe4, 0x3b, 0x5d, 0x82, 0x91, 0x4e, 0x28, 0xf7, 0x0e, 0xd1, 0xb7, 0x68, 0x7b, 0xa4, 0xc2, 0x1d,
+ 0x37, 0xe8, 0x8e, 0x51, 0x42, 0x9d, 0xfb, 0x24, 0xdd, 0x02, 0x64, 0xbb, 0xa8, 0x77, 0x11, 0xce,
+ 0x8a, 0x55, 0x33, 0xec, 0xff, 0x20, 0x46, 0x99, 0x60, 0xbf, 0xd9, 0x06, 0x15, 0xca, 0xac, 0x73,
+ 0x59, 0x86, 0xe0, 0x3f, 0x2c, 0xf3, 0x95, 0x4a, 0xb3, 0x6c, 0x0a, 0xd5, 0xc6, 0x19, 0x7f, 0xa0,
+ 0x2b, 0xf4, 0x92, 0x4d, 0x5e, 0x81, 0xe7, 0x38, 0xc1, 0x1e, 0x78, 0xa7, 0xb4, 0x6b, 0x0d, 0xd2,
+ 0xf8, 0x27, 0x41, 0x9e, 0x8d, 0x52, 0x34, 0xeb, 0x12, 0xcd, 0xab, 0x74, 0x67, 0xb8, 0xde, 0x01,
+ 0xcf, 0x10, 0x76, 0xa9, 0xba, 0x65, 0x03, 0xdc, 0x25, 0xfa, 0x9c, 0x43, 0x50, 0x8f, 0xe9, 0x36,
+ 0x1c, 0xc3, 0xa5, 0x7a, 0x69, 0xb6, 0xd0, 0x0f, 0xf6, 0x29, 0x4f, 0x90, 0x83, 0x5c, 0x3a, 0xe5,
+ 0x6e, 0xb1, 0xd7, 0x08, 0x1b, 0xc4, 0xa2, 0x7d, 0x84, 0x5b, 0x3d, 0xe2, 0xf1, 0x2e, 0x48, 0x97,
+ 0xbd, 0x62, 0x04, 0xdb, 0xc8, 0x17, 0x71, 0xae, 0x57, 0x88, 0xee, 0x31, 0x22, 0xfd, 0x9b, 0x44,
+ 0x00, 0x13, 0x26, 0x35, 0x4c, 0x5f, 0x6a, 0x79, 0x98, 0x8b, 0xbe, 0xad, 0xd4, 0xc7, 0xf2, 0xe1,
+ 0x37, 0x24, 0x11, 0x02, 0x7b, 0x68, 0x5d, 0x4e, 0xaf, 0xbc, 0x89, 0x9a, 0xe3, 0xf0, 0xc5, 0xd6,
+ 0x6e, 0x7d, 0x48, 0x5b, 0x22, 0x31, 0x04, 0x17, 0xf6, 0xe5, 0xd0, 0xc3, 0xba, 0xa9, 0x9c, 0x8f,
+ 0x59, 0x4a, 0x7f, 0x6c, 0x15, 0x06, 0x33, 0x20, 0xc1, 0xd2, 0xe7, 0xf4, 0x8d, 0x9e, 0xab, 0xb8,
+ 0xdc, 0xcf, 0xfa, 0xe9, 0x90, 0x83, 0xb6, 0xa5, 0x44, 0x57, 0x62, 0x71, 0x08, 0x1b, 0x2e, 0x3d,
+ 0xeb, 0xf8, 0xcd, 0xde, 0xa7, 0xb4, 0x81, 0x92, 0x73, 0x60, 0x55, 0x46, 0x3f, 0x2c, 0x19, 0x0a,
+ 0xb2, 0xa1, 0x94, 0x87, 0xfe, 0xed, 0xd8, 0xcb, 0x2a, 0x39, 0x0c, 0x1f, 0x66, 0x75, 0x40, 0x53,
+ 0x85, 0x96, 0xa3, 0xb0, 0xc9, 0xda, 0xef, 0xfc, 0x1d, 0x0e, 0x3b, 0x28, 0x51, 0x42, 0x77, 0x64,
+ 0xbf, 0xac, 0x99, 0x8a, 0xf3, 0xe0, 0xd5, 0xc6, 0x27, 0x34, 0x01, 0x12, 0x6b, 0x78, 0x4d, 0x5e,
+ 0x88, 0x9b, 0xae, 0xbd, 0xc4, 0xd7, 0xe2, 0xf1, 0x10, 0x03, 0x36, 0x25, 0x5c, 0x4f, 0x7a, 0x69,
+ 0xd1, 0xc2, 0xf7, 0xe4, 0x9d, 0x8e, 0xbb, 0xa8, 0x49, 0x5a, 0x6f, 0x7c, 0x05, 0x16, 0x23, 0x30,
+ 0xe6, 0xf5, 0xc0, 0xd3, 0xaa, 0xb9, 0x8c, 0x9f, 0x7e, 0x6d, 0x58, 0x4b, 0x32, 0x21, 0x14, 0x07,
+ 0x63, 0x70, 0x45, 0x56, 0x2f, 0x3c, 0x09, 0x1a, 0xfb, 0xe8, 0xdd, 0xce, 0xb7, 0xa4, 0x91, 0x82,
+ 0x54, 0x47, 0x72, 0x61, 0x18, 0x0b, 0x3e, 0x2d, 0xcc, 0xdf, 0xea, 0xf9, 0x80, 0x93, 0xa6, 0xb5,
+ 0x0d, 0x1e, 0x2b, 0x38, 0x41, 0x52, 0x67, 0x74, 0x95, 0x86, 0xb3, 0xa0, 0xd9, 0xca, 0xff, 0xec,
+ 0x3a, 0x29, 0x1c, 0x0f, 0x76, 0x65, 0x50, 0x43, 0xa2, 0xb1, 0x84, 0x97, 0xee, 0xfd, 0xc8, 0xdb,
+};
+
+const uint8_t crc8_07_reflected_crc_table[CRC_SLICES * 256] = {
+ 0x00, 0x91, 0xe3, 0x72, 0x07, 0x96, 0xe4, 0x75, 0x0e, 0x9f, 0xed, 0x7c, 0x09, 0x98, 0xea, 0x7b,
+ 0x1c, 0x8d, 0xff, 0x6e, 0x1b, 0x8a, 0xf8, 0x69, 0x12, 0x83, 0xf1, 0x60, 0x15, 0x84, 0xf6, 0x67,
+ 0x38, 0xa9, 0xdb, 0x4a, 0x3f, 0xae, 0xdc, 0x4d, 0x36, 0xa7, 0xd5, 0x44, 0x31, 0xa0, 0xd2, 0x43,
+ 0x24, 0xb5, 0xc7, 0x56, 0x23, 0xb2, 0xc0, 0x51, 0x2a, 0xbb, 0xc9, 0x58, 0x2d, 0xbc, 0xce, 0x5f,
+ 0x70, 0xe1, 0x93, 0x02, 0x77, 0xe6, 0x94, 0x05, 0x7e, 0xef, 0x9d, 0x0c, 0x79, 0xe8, 0x9a, 0x0b,
+ 0x6c, 0xfd, 0x8f, 0x1e, 0x6b, 0xfa, 0x88, 0x19, 0x62, 0xf3, 0x81, 0x10, 0x65, 0xf4, 0x86, 0x17,
+ 0x48, 0xd9, 0xab, 0x3a, 0x4f, 0xde, 0xac, 0x3d, 0x46, 0xd7, 0xa5, 0x34, 0x41, 0xd0, 0xa2, 0x33,
+ 0x54, 0xc5, 0xb7, 0x26, 0x53, 0xc2, 0xb0, 0x21, 0x5a, 0xcb, 0xb9, 0x28, 0x5d, 0xcc, 0xbe, 0x2f,
+ 0xe0, 0x71, 0x03, 0x92, 0xe7, 0x76, 0x04, 0x95, 0xee, 0x7f, 0x0d, 0x9c, 0xe9, 0x78, 0x0a, 0x9b,
+ 0xfc, 0x6d, 0x1f, 0x8e, 0xfb, 0x6a, 0x18, 0x89, 0xf2, 0x63, 0x11, 0x80, 0xf5, 0x64, 0x16, 0x87,
+ 0xd8, 0x49, 0x3b, 0xaa, 0xdf, 0x4e, 0x3c, 0xad, 0xd6, 0x47, 0x35, 0xa4, 0xd1, 0x40, 0x32, 0xa3,
+ 0xc4, 0x55, 0x27, 0xb6, 0xc3, 0x52, 0x20, 0xb1, 0xca, 0x5b, 0x29, 0xb8, 0xcd, 0x5c, 0x2e, 0xbf,
+ 0x90, 0x01, 0x73, 0xe2, 0x97, 0x06, 0x74, 0xe5, 0x9e, 0x0f, 0x7d, 0xec, 0x99, 0x08, 0x7a, 0xeb,
+ 0x8c, 0x1d, 0x6f, 0xfe, 0x8b, 0x1a, 0x68, 0xf9, 0x82, 0x13, 0x61, 0xf0, 0x85, 0x14, 0x66, 0xf7,
+ 0xa8, 0x39, 0x4b, 0xda, 0xaf, 0x3e, 0x4c, 0xdd, 0xa6, 0x37, 0x45, 0xd4, 0xa1, 0x30, 0x42, 0xd3,
+ 0xb4, 0x25, 0x57, 0xc6, 0xb3, 0x22, 0x50, 0xc1, 0xba, 0x2b, 0x59, 0xc8, 0xbd, 0x2c, 0x5e, 0xcf,
+ 0x00, 0x6d, 0xda, 0xb7, 0x75, 0x18, 0xaf, 0xc2, 0xea, 0x87, 0x30, 0x5d, 0x9f, 0xf2, 0x45, 0x28,
+ 0x15, 0x78, 0xcf, 0xa2, 0x60, 0x0d, 0xba, 0xd7, 0xff, 0x92, 0x25, 0x48, 0x8a, 0xe7, 0x50, 0x3d,
+ 0x2a, 0x47, 0xf0, 0x9d, 0x5f, 0x32, 0x85, 0xe8, 0xc0, 0xad, 0x1a, 0x77, 0xb5, 0xd8, 0x6f, 0x02,
+ 0x3f, 0x52, 0xe5, 0x88, 0x4a, 0x27, 0x90, 0xfd, 0xd5, 0xb8, 0x0f, 0x62, 0xa0, 0xcd, 0x7a, 0x17,
+ 0x54, 0x39, 0x8e, 0xe3, 0x21, 0x4c, 0xfb, 0x96, 0xbe, 0xd3, 0x64, 0x09, 0xcb, 0xa6, 0x11, 0x7c,
+ 0x41, 0x2c, 0x9b, 0xf6, 0x34, 0x59, 0xee, 0x83, 0xab, 0xc6, 0x71, 0x1c, 0xde, 0xb3, 0x04, 0x69,
+ 0x7e, 0x13, 0xa4, 0xc9, 0x0b, 0x66, 0xd1, 0xbc, 0x94, 0xf9, 0x4e, 0x23, 0xe1, 0x8c, 0x3b, 0x56,
+ 0x6b, 0x06, 0xb1, 0xdc, 0x1e, 0x73, 0xc4, 0xa9, 0x81, 0xec, 0x5b, 0x36, 0xf4, 0x99, 0x2e, 0x43,
+ 0xa8, 0xc5, 0x72, 0x1f, 0xdd, 0xb0, 0x07, 0x6a, 0x42, 0x2f, 0x98, 0xf5, 0x37, 0x5a, 0xed, 0x80,
+ 0xbd, 0xd0, 0x67, 0x0a, 0xc8, 0xa5, 0x12, 0x7f, 0x57, 0x3a, 0x8d, 0xe0, 0x22, 0x4f, 0xf8, 0x95,
+ 0x82, 0xef, 0x58, 0x35, 0xf7, 0x9a, 0x2d, 0x40, 0x68, 0x05, 0xb2, 0xdf, 0x1d, 0x70, 0xc7, 0xaa,
+ 0x97, 0xfa, 0x4d, 0x20, 0xe2, 0x8f, 0x38, 0x55, 0x7d, 0x10, 0xa7, 0xca, 0x08, 0x65, 0xd2, 0xbf,
+ 0xfc, 0x91, 0x26, 0x4b, 0x89, 0xe4, 0x53, 0x3e, 0x16, 0x7b, 0xcc, 0xa1, 0x63, 0x0e, 0xb9, 0xd4,
+ 0xe9, 0x84, 0x33, 0x5e, 0x9c, 0xf1, 0x46, 0x2b, 0x03, 0x6e, 0xd9, 0xb4, 0x76, 0x1b, 0xac, 0xc1,
+ 0xd6, 0xbb, 0x0c, 0x61, 0xa3, 0xce, 0x79, 0x14, 0x3c, 0x51, 0xe6, 0x8b, 0x49, 0x24, 0x93, 0xfe,
+ 0xc3, 0xae, 0x19, 0x74, 0xb6, 0xdb, 0x6c, 0x01, 0x29, 0x44, 0xf3, 0x9e, 0x5c, 0x31, 0x86, 0xeb,
+ 0x00, 0xd0, 0x61, 0xb1, 0xc2, 0x12, 0xa3, 0x73, 0x45, 0x95, 0x24, 0xf4, 0x87, 0x57, 0xe6, 0x36,
+ 0x8a, 0x5a, 0xeb, 0x3b, 0x48, 0x98, 0x29, 0xf9, 0xcf, 0x1f, 0xae, 0x7e, 0x0d, 0xdd, 0x6c, 0xbc,
+ 0xd5, 0x05, 0xb4, 0x64, 0x17, 0xc7, 0x76, 0xa6, 0x90, 0x40, 0xf1, 0x21, 0x52, 0x82, 0x33, 0xe3,
+ 0x5f, 0x8f, 0x3e, 0xee, 0x9d, 0x4d, 0xfc, 0x2c, 0x1a, 0xca, 0x7b, 0xab, 0xd8, 0x08, 0xb9, 0x69,
+ 0x6b, 0xbb, 0x0a, 0xda, 0xa9, 0x79, 0xc8, 0x18, 0x2e, 0xfe, 0x4f, 0x9f, 0xec, 0x3c, 0x8d, 0x5d,
+ 0xe1, 0x31, 0x80, 0x50, 0x23, 0xf3, 0x42, 0x92, 0xa4, 0x74, 0xc5, 0x15, 0x66, 0xb6, 0x07, 0xd7,
+ 0xbe, 0x6e, 0xdf, 0x0f, 0x7c, 0xac, 0x1d, 0xcd, 0xfb, 0x2b, 0x9a, 0x4a, 0x39, 0xe9, 0x58, 0x88,
+ 0x34, 0xe4, 0x55, 0x85, 0xf6, 0x26, 0x97, 0x47, 0x71, 0xa1, 0x10, 0xc0, 0xb3, 0x63, 0xd2, 0x02,
+ 0xd6, 0x06, 0xb7, 0x67, 0x14, 0xc4, 0x75, 0xa5, 0x93, 0x43, 0xf2, 0x22, 0x51, 0x81, 0x30, 0xe0,
+ 0x5c, 0x8c, 0x3d, 0xed, 0x9e, 0x4e, 0xff, 0x2f, 0x19, 0xc9, 0x78, 0xa8, 0xdb, 0x0b, 0xba, 0x6a,
+ 0x03, 0xd3, 0x62, 0xb2, 0xc1, 0x11, 0xa0, 0x70, 0x46, 0x96, 0x27, 0xf7, 0x84, 0x54, 0xe5, 0x35,
+ 0x89, 0x59, 0xe8, 0x38, 0x4b, 0x9b, 0x2a, 0xfa, 0xcc, 0x1c, 0xad, 0x7d, 0x0e, 0xde, 0x6f, 0xbf,
+ 0xbd, 0x6d, 0xdc, 0x0c, 0x7f, 0xaf, 0x1e, 0xce, 0xf8, 0x28, 0x99, 0x49, 0x3a, 0xea, 0x5b, 0x8b,
+ 0x37, 0xe7, 0x56, 0x86, 0xf5, 0x25, 0x94, 0x44, 0x72, 0xa2, 0x13, 0xc3, 0xb0, 0x60, 0xd1, 0x01,
+ 0x68, 0xb8, 0x09, 0xd9, 0xaa, 0x7a, 0xcb, 0x1b, 0x2d, 0xfd, 0x4c, 0x9c, 0xef, 0x3f, 0x8e, 0x5e,
+ 0xe2, 0x32, 0x83, 0x53, 0x20, 0xf0, 0x41, 0x91, 0xa7, 0x77, 0xc6, 0x16, 0x65, 0xb5, 0x04, 0xd4,
+ 0x00, 0x8c, 0xd9, 0x55, 0x73, 0xff, 0xaa, 0x26, 0xe6, 0x6a, 0x3f, 0xb3, 0x95, 0x19, 0x4c, 0xc0,
+ 0x0d, 0x81, 0xd4, 0x58, 0x7e, 0xf2, 0xa7, 0x2b, 0xeb, 0x67, 0x32, 0xbe, 0x98, 0x14, 0x41, 0xcd,
+ 0x1a, 0x96, 0xc3, 0x4f, 0x69, 0xe5, 0xb0, 0x3c, 0xfc, 0x70, 0x25, 0xa9, 0x8f, 0x03, 0x56, 0xda,
+ 0x17, 0x9b, 0xce, 0x42, 0x64, 0xe8, 0xbd, 0x31, 0xf1, 0x7d, 0x28, 0xa4, 0x82, 0x0e, 0x5b, 0xd7,
+ 0x34, 0xb8, 0xed, 0x61, 0x47, 0xcb, 0x9e, 0x12, 0xd2, 0x5e, 0x0b, 0x87, 0xa1, 0x2d, 0x78, 0xf4,
+ 0x39, 0xb5, 0xe0, 0x6c, 0x4a, 0xc6, 0x93, 0x1f, 0xdf, 0x53, 0x06, 0x8a, 0xac, 0x20, 0x75, 0xf9,
+ 0x2e, 0xa2, 0xf7, 0x7b, 0x5d, 0xd1, 0x84, 0x08, 0xc8, 0x44, 0x11, 0x9d, 0xbb, 0x37, 0x62, 0xee,
+ 0x23, 0xaf, 0xfa, 0x76, 0x50, 0xdc, 0x89, 0x05, 0xc5, 0x49, 0x1c, 0x90, 0xb6, 0x3a, 0x6f, 0xe3,
+ 0x68, 0xe4, 0xb1, 0x3d, 0x1b, 0x97, 0xc2, 0x4e, 0x8e, 0x02, 0x57, 0xdb, 0xfd, 0x71, 0x24, 0xa8,
+ 0x65, 0xe9, 0xbc, 0x30, 0x16, 0x9a, 0xcf, 0x43, 0x83, 0x0f, 0x5a, 0xd6, 0xf0, 0x7c, 0x29, 0xa5,
+ 0x72, 0xfe, 0xab, 0x27, 0x01, 0x8d, 0xd8, 0x54, 0x94, 0x18, 0x4d, 0xc1, 0xe7, 0x6b, 0x3e, 0xb2,
+ 0x7f, 0xf3, 0xa6, 0x2a, 0x0c, 0x80, 0xd5, 0x59, 0x99, 0x15, 0x40, 0xcc, 0xea, 0x66, 0x33, 0xbf,
+ 0x5c, 0xd0, 0x85, 0x09, 0x2f, 0xa3, 0xf6, 0x7a, 0xba, 0x36, 0x63, 0xef, 0xc9, 0x45, 0x10, 0x9c,
+ 0x51, 0xdd, 0x88, 0x04, 0x22, 0xae, 0xfb, 0x77, 0xb7, 0x3b, 0x6e, 0xe2, 0xc4, 0x48, 0x1d, 0x91,
+ 0x46, 0xca, 0x9f, 0x13, 0x35, 0xb9, 0xec, 0x60, 0xa0, 0x2c, 0x79, 0xf5, 0xd3, 0x5f, 0x0a, 0x86,
+ 0x4b, 0xc7, 0x92, 0x1e, 0x38, 0xb4, 0xe1, 0x6d, 0xad, 0x21, 0x74, 0xf8, 0xde, 0x52, 0x07, 0x8b,
+ 0x00, 0xe9, 0x13, 0xfa, 0x26, 0xcf, 0x35, 0xdc, 0x4c, 0xa5, 0x5f, 0xb6, 0x6a, 0x83, 0x79, 0x90,
+ 0x98, 0x71, 0x8b, 0x62, 0xbe, 0x57, 0xad, 0x44, 0xd4, 0x3d, 0xc7, 0x2e, 0xf2, 0x1b, 0xe1, 0x08,
+ 0xf1, 0x18, 0xe2, 0x0b, 0xd7, 0x3e, 0xc4, 0x2d, 0xbd, 0x54, 0xae, 0x47, 0x9b, 0x72, 0x88, 0x61,
+ 0x69, 0x80, 0x7a, 0x93, 0x4f, 0xa6, 0x5c, 0xb5, 0x25, 0xcc, 0x36, 0xdf, 0x03, 0xea, 0x10, 0xf9,
+ 0x23, 0xca, 0x30, 0xd9, 0x05, 0xec, 0x16, 0xff, 0x6f, 0x86, 0x7c, 0x95, 0x49, 0xa0, 0x5a, 0xb3,
+ 0xbb, 0x52, 0xa8, 0x41, 0x9d, 0x74, 0x8e, 0x67, 0xf7, 0x1e, 0xe4, 0x0d, 0xd1, 0x38, 0xc2, 0x2b,
+ 0xd2, 0x3b, 0xc1, 0x28, 0xf4, 0x1d, 0xe7, 0x0e, 0x9e, 0x77, 0x8d, 0x64, 0xb8, 0x51, 0xab, 0x42,
+ 0x4a, 0xa3, 0x59, 0xb0, 0x6c, 0x85, 0x7f, 0x96, 0x06, 0xef, 0x15, 0xfc, 0x20, 0xc9, 0x33, 0xda,
+ 0x46, 0xaf, 0x55, 0xbc, 0x60, 0x89, 0x73, 0x9a, 0x0a, 0xe3, 0x19, 0xf0, 0x2c, 0xc5, 0x3f, 0xd6,
+ 0xde, 0x37, 0xcd, 0x24, 0xf8, 0x11, 0xeb, 0x02, 0x92, 0x7b, 0x81, 0x68, 0xb4, 0x5d, 0xa7, 0x4e,
+ 0xb7, 0x5e, 0xa4, 0x4d, 0x91, 0x78, 0x82, 0x6b, 0xfb, 0x12, 0xe8, 0x01, 0xdd, 0x34, 0xce, 0x27,
+ 0x2f, 0xc6, 0x3c, 0xd5, 0x09, 0xe0, 0x1a, 0xf3, 0x63, 0x8a, 0x70, 0x99, 0x45, 0xac, 0x56, 0xbf,
+ 0x65, 0x8c, 0x76, 0x9f, 0x43, 0xaa, 0x50, 0xb9, 0x29, 0xc0, 0x3a, 0xd3, 0x0f, 0xe6, 0x1c, 0xf5,
+ 0xfd, 0x14, 0xee, 0x07, 0xdb, 0x32, 0xc8, 0x21, 0xb1, 0x58, 0xa2, 0x4b, 0x97, 0x7e, 0x84, 0x6d,
+ 0x94, 0x7d, 0x87, 0x6e, 0xb2, 0x5b, 0xa1, 0x48, 0xd8, 0x31, 0xcb, 0x22, 0xfe, 0x17, 0xed, 0x04,
+ 0x0c, 0xe5, 0x1f, 0xf6, 0x2a, 0xc3, 0x39, 0xd0, 0x40, 0xa9, 0x53, 0xba, 0x66, 0x8f, 0x75, 0x9c,
+ 0x00, 0x37, 0x6e, 0x59, 0xdc, 0xeb, 0xb2, 0x85, 0x79, 0x4e, 0x17, 0x20, 0xa5, 0x92, 0xcb, 0xfc,
+ 0xf2, 0xc5, 0x9c, 0xab, 0x2e, 0x19, 0x40, 0x77, 0x8b, 0xbc, 0xe5, 0xd2, 0x57, 0x60, 0x39, 0x0e,
+ 0x25, 0x12, 0x4b, 0x7c, 0xf9, 0xce, 0x97, 0xa0, 0x5c, 0x6b, 0x32, 0x05, 0x80, 0xb7, 0xee, 0xd9,
+ 0xd7, 0xe0, 0xb9, 0x8e, 0x0b, 0x3c, 0x65, 0x52, 0xae, 0x99, 0xc0, 0xf7, 0x72, 0x45, 0x1c, 0x2b,
+ 0x4a, 0x7d, 0x24, 0x13, 0x96, 0xa1, 0xf8, 0xcf, 0x33, 0x04, 0x5d, 0x6a, 0xef, 0xd8, 0x81, 0xb6,
+ 0xb8, 0x8f, 0xd6, 0xe1, 0x64, 0x53, 0x0a, 0x3d, 0xc1, 0xf6, 0xaf, 0x98, 0x1d, 0x2a, 0x73, 0x44,
+ 0x6f, 0x58, 0x01, 0x36, 0xb3, 0x84, 0xdd, 0xea, 0x16, 0x21, 0x78, 0x4f, 0xca, 0xfd, 0xa4, 0x93,
+ 0x9d, 0xaa, 0xf3, 0xc4, 0x41, 0x76, 0x2f, 0x18, 0xe4, 0xd3, 0x8a, 0xbd, 0x38, 0x0f, 0x56, 0x61,
+ 0x94, 0xa3, 0xfa, 0xcd, 0x48, 0x7f, 0x26, 0x11, 0xed, 0xda, 0x83, 0xb4, 0x31, 0x06, 0x5f, 0x68,
+ 0x66, 0x51, 0x08, 0x3f, 0xba, 0x8d, 0xd4, 0xe3, 0x1f, 0x28, 0x71, 0x46, 0xc3, 0xf4, 0xad, 0x9a,
+ 0xb1, 0x86, 0xdf, 0xe8, 0x6d, 0x5a, 0x03, 0x34, 0xc8, 0xff, 0xa6, 0x91, 0x14, 0x23, 0x7a, 0x4d,
+ 0x43, 0x74, 0x2d, 0x1a, 0x9f, 0xa8, 0xf1, 0xc6, 0x3a, 0x0d, 0x54, 0x63, 0xe6, 0xd1, 0x88, 0xbf,
+ 0xde, 0xe9, 0xb0, 0x87, 0x02, 0x35, 0x6c, 0x5b, 0xa7, 0x90, 0xc9, 0xfe, 0x7b, 0x4c, 0x15, 0x22,
+ 0x2c, 0x1b, 0x42, 0x75, 0xf0, 0xc7, 0x9e, 0xa9, 0x55, 0x62, 0x3b, 0x0c, 0x89, 0xbe, 0xe7, 0xd0,
+ 0xfb, 0xcc, 0x95, 0xa2, 0x27, 0x10, 0x49, 0x7e, 0x82, 0xb5, 0xec, 0xdb, 0x5e, 0x69, 0x30, 0x07,
+ 0x09, 0x3e, 0x67, 0x50, 0xd5, 0xe2, 0xbb, 0x8c, 0x70, 0x47, 0x1e, 0x29, 0xac, 0x9b, 0xc2, 0xf5,
+ 0x00, 0x51, 0xa2, 0xf3, 0x85, 0xd4, 0x27, 0x76, 0xcb, 0x9a, 0x69, 0x38, 0x4e, 0x1f, 0xec, 0xbd,
+ 0x57, 0x06, 0xf5, 0xa4, 0xd2, 0x83, 0x70, 0x21, 0x9c, 0xcd, 0x3e, 0x6f, 0x19, 0x48, 0xbb, 0xea,
+ 0xae, 0xff, 0x0c, 0x5d, 0x2b, 0x7a, 0x89, 0xd8, 0x65, 0x34, 0xc7, 0x96, 0xe0, 0xb1, 0x42, 0x13,
+ 0xf9, 0xa8, 0x5b, 0x0a, 0x7c, 0x2d, 0xde, 0x8f, 0x32, 0x63, 0x90, 0xc1, 0xb7, 0xe6, 0x15, 0x44,
+ 0x9d, 0xcc, 0x3f, 0x6e, 0x18, 0x49, 0xba, 0xeb, 0x56, 0x07, 0xf4, 0xa5, 0xd3, 0x82, 0x71, 0x20,
+ 0xca, 0x9b, 0x68, 0x39, 0x4f, 0x1e, 0xed, 0xbc, 0x01, 0x50, 0xa3, 0xf2, 0x84, 0xd5, 0x26, 0x77,
+ 0x33, 0x62, 0x91, 0xc0, 0xb6, 0xe7, 0x14, 0x45, 0xf8, 0xa9, 0x5a, 0x0b, 0x7d, 0x2c, 0xdf, 0x8e,
+ 0x64, 0x35, 0xc6, 0x97, 0xe1, 0xb0, 0x43, 0x12, 0xaf, 0xfe, 0x0d, 0x5c, 0x2a, 0x7b, 0x88, 0xd9,
+ 0xfb, 0xaa, 0x59, 0x08, 0x7e, 0x2f, 0xdc, 0x8d, 0x30, 0x61, 0x92, 0xc3, 0xb5, 0xe4, 0x17, 0x46,
+ 0xac, 0xfd, 0x0e, 0x5f, 0x29, 0x78, 0x8b, 0xda, 0x67, 0x36, 0xc5, 0x94, 0xe2, 0xb3, 0x40, 0x11,
+ 0x55, 0x04, 0xf7, 0xa6, 0xd0, 0x81, 0x72, 0x23, 0x9e, 0xcf, 0x3c, 0x6d, 0x1b, 0x4a, 0xb9, 0xe8,
+ 0x02, 0x53, 0xa0, 0xf1, 0x87, 0xd6, 0x25, 0x74, 0xc9, 0x98, 0x6b, 0x3a, 0x4c, 0x1d, 0xee, 0xbf,
+ 0x66, 0x37, 0xc4, 0x95, 0xe3, 0xb2, 0x41, 0x10, 0xad, 0xfc, 0x0f, 0x5e, 0x28, 0x79, 0x8a, 0xdb,
+ 0x31, 0x60, 0x93, 0xc2, 0xb4, 0xe5, 0x16, 0x47, 0xfa, 0xab, 0x58, 0x09, 0x7f, 0x2e, 0xdd, 0x8c,
+ 0xc8, 0x99, 0x6a, 0x3b, 0x4d, 0x1c, 0xef, 0xbe, 0x03, 0x52, 0xa1, 0xf0, 0x86, 0xd7, 0x24, 0x75,
+ 0x9f, 0xce, 0x3d, 0x6c, 0x1a, 0x4b, 0xb8, 0xe9, 0x54, 0x05, 0xf6, 0xa7, 0xd1, 0x80, 0x73, 0x22,
+ 0x00, 0xfd, 0x3b, 0xc6, 0x76, 0x8b, 0x4d, 0xb0, 0xec, 0x11, 0xd7, 0x2a, 0x9a, 0x67, 0xa1, 0x5c,
+ 0x19, 0xe4, 0x22, 0xdf, 0x6f, 0x92, 0x54, 0xa9, 0xf5, 0x08, 0xce, 0x33, 0x83, 0x7e, 0xb8, 0x45,
+ 0x32, 0xcf, 0x09, 0xf4, 0x44, 0xb9, 0x7f, 0x82, 0xde, 0x23, 0xe5, 0x18, 0xa8, 0x55, 0x93, 0x6e,
+ 0x2b, 0xd6, 0x10, 0xed, 0x5d, 0xa0, 0x66, 0x9b, 0xc7, 0x3a, 0xfc, 0x01, 0xb1, 0x4c, 0x8a, 0x77,
+ 0x64, 0x99, 0x5f, 0xa2, 0x12, 0xef, 0x29, 0xd4, 0x88, 0x75, 0xb3, 0x4e, 0xfe, 0x03, 0xc5, 0x38,
+ 0x7d, 0x80, 0x46, 0xbb, 0x0b, 0xf6, 0x30, 0xcd, 0x91, 0x6c, 0xaa, 0x57, 0xe7, 0x1a, 0xdc, 0x21,
+ 0x56, 0xab, 0x6d, 0x90, 0x20, 0xdd, 0x1b, 0xe6, 0xba, 0x47, 0x81, 0x7c, 0xcc, 0x31, 0xf7, 0x0a,
+ 0x4f, 0xb2, 0x74, 0x89, 0x39, 0xc4, 0x02, 0xff, 0xa3, 0x5e, 0x98, 0x65, 0xd5, 0x28, 0xee, 0x13,
+ 0xc8, 0x35, 0xf3, 0x0e, 0xbe, 0x43, 0x85, 0x78, 0x24, 0xd9, 0x1f, 0xe2, 0x52, 0xaf, 0x69, 0x94,
+ 0xd1, 0x2c, 0xea, 0x17, 0xa7, 0x5a, 0x9c, 0x61, 0x3d, 0xc0, 0x06, 0xfb, 0x4b, 0xb6, 0x70, 0x8d,
+ 0xfa, 0x07, 0xc1, 0x3c, 0x8c, 0x71, 0xb7, 0x4a, 0x16, 0xeb, 0x2d, 0xd0, 0x60, 0x9d, 0x5b, 0xa6,
+ 0xe3, 0x1e, 0xd8, 0x25, 0x95, 0x68, 0xae, 0x53, 0x0f, 0xf2, 0x34, 0xc9, 0x79, 0x84, 0x42, 0xbf,
+ 0xac, 0x51, 0x97, 0x6a, 0xda, 0x27, 0xe1, 0x1c, 0x40, 0xbd, 0x7b, 0x86, 0x36, 0xcb, 0x0d, 0xf0,
+ 0xb5, 0x48, 0x8e, 0x73, 0xc3, 0x3e, 0xf8, 0x05, 0x59, 0xa4, 0x62, 0x9f, 0x2f, 0xd2, 0x14, 0xe9,
+ 0x9e, 0x63, 0xa5, 0x58, 0xe8, 0x15, 0xd3, 0x2e, 0x72, 0x8f, 0x49, 0xb4, 0x04, 0xf9, 0x3f, 0xc2,
+ 0x87, 0x7a, 0xbc, 0x41, 0xf1, 0x0c, 0xca, 0x37, 0x6b, 0x96, 0x50, 0xad, 0x1d, 0xe0, 0x26, 0xdb,
+};
+
+const uint8_t crc8_1d_crc_table[CRC_SLICES * 256] = {
+ 0x00, 0x1d, 0x3a, 0x27, 0x74, 0x69, 0x4e, 0x53, 0xe8, 0xf5, 0xd2, 0xcf, 0x9c, 0x81, 0xa6, 0xbb,
+ 0xcd, 0xd0, 0xf7, 0xea, 0xb9, 0xa4, 0x83, 0x9e, 0x25, 0x38, 0x1f, 0x02, 0x51, 0x4c, 0x6b, 0x76,
+ 0x87, 0x9a, 0xbd, 0xa0, 0xf3, 0xee, 0xc9, 0xd4, 0x6f, 0x72, 0x55, 0x48, 0x1b, 0x06, 0x21, 0x3c,
+ 0x4a, 0x57, 0x70, 0x6d, 0x3e, 0x23, 0x04, 0x19, 0xa2, 0xbf, 0x98, 0x85, 0xd6, 0xcb, 0xec, 0xf1,
+ 0x13, 0x0e, 0x29, 0x34, 0x67, 0x7a, 0x5d, 0x40, 0xfb, 0xe6, 0xc1, 0xdc, 0x8f, 0x92, 0xb5, 0xa8,
+ 0xde, 0xc3, 0xe4, 0xf9, 0xaa, 0xb7, 0x90, 0x8d, 0x36, 0x2b, 0x0c, 0x11, 0x42, 0x5f, 0x78, 0x65,
+ 0x94, 0x89, 0xae, 0xb3, 0xe0, 0xfd, 0xda, 0xc7, 0x7c, 0x61, 0x46, 0x5b, 0x08, 0x15, 0x32, 0x2f,
+ 0x59, 0x44, 0x63, 0x7e, 0x2d, 0x30, 0x17, 0x0a, 0xb1, 0xac, 0x8b, 0x96, 0xc5, 0xd8, 0xff, 0xe2,
+ 0x26, 0x3b, 0x1c, 0x01, 0x52, 0x4f, 0x68, 0x75, 0xce, 0xd3, 0xf4, 0xe9, 0xba, 0xa7, 0x80, 0x9d,
+ 0xeb, 0xf6, 0xd1, 0xcc, 0x9f, 0x82, 0xa5, 0xb8, 0x03, 0x1e, 0x39, 0x24, 0x77, 0x6a, 0x4d, 0x50,
+ 0xa1, 0xbc, 0x9b, 0x86, 0xd5, 0xc8, 0xef, 0xf2, 0x49, 0x54, 0x73, 0x6e, 0x3d, 0x20, 0x07, 0x1a,
+ 0x6c, 0x71, 0x56, 0x4b, 0x18, 0x05, 0x22, 0x3f, 0x84, 0x99, 0xbe, 0xa3, 0xf0, 0xed, 0xca, 0xd7,
+ 0x35, 0x28, 0x0f, 0x12, 0x41, 0x5c, 0x7b, 0x66, 0xdd, 0xc0, 0xe7, 0xfa, 0xa9, 0xb4, 0x93, 0x8e,
+ 0xf8, 0xe5, 0xc2, 0xdf, 0x8c, 0x91, 0xb6, 0xab, 0x10, 0x0d, 0x2a, 0x37, 0x64, 0x79, 0x5e, 0x43,
+ 0xb2, 0xaf, 0x88, 0x95, 0xc6, 0xdb, 0xfc, 0xe1, 0x5a, 0x47, 0x60, 0x7d, 0x2e, 0x33, 0x14, 0x09,
+ 0x7f, 0x62, 0x45, 0x58, 0x0b, 0x16, 0x31, 0x2c, 0x97, 0x8a, 0xad, 0xb0, 0xe3, 0xfe, 0xd9, 0xc4,
+ 0x00, 0x4c, 0x98, 0xd4, 0x2d, 0x61, 0xb5, 0xf9, 0x5a, 0x16, 0xc2, 0x8e, 0x77, 0x3b, 0xef, 0xa3,
+ 0xb4, 0xf8, 0x2c, 0x60, 0x99, 0xd5, 0x01, 0x4d, 0xee, 0xa2, 0x76, 0x3a, 0xc3, 0x8f, 0x5b, 0x17,
+ 0x75, 0x39, 0xed, 0xa1, 0x58, 0x14, 0xc0, 0x8c, 0x2f, 0x63, 0xb7, 0xfb, 0x02, 0x4e, 0x9a, 0xd6,
+ 0xc1, 0x8d, 0x59, 0x15, 0xec, 0xa0, 0x74, 0x38, 0x9b, 0xd7, 0x03, 0x4f, 0xb6, 0xfa, 0x2e, 0x62,
+ 0xea, 0xa6, 0x72, 0x3e, 0xc7, 0x8b, 0x5f, 0x13, 0xb0, 0xfc, 0x28, 0x64, 0x9d, 0xd1, 0x05, 0x49,
+ 0x5e, 0x12, 0xc6, 0x8a, 0x73, 0x3f, 0xeb, 0xa7, 0x04, 0x48, 0x9c, 0xd0, 0x29, 0x65, 0xb1, 0xfd,
+ 0x9f, 0xd3, 0x07, 0x4b, 0xb2, 0xfe, 0x2a, 0x66, 0xc5, 0x89, 0x5d, 0x11, 0xe8, 0xa4, 0x70, 0x3c,
+ 0x2b, 0x67, 0xb3, 0xff, 0x06, 0x4a, 0x9e, 0xd2, 0x71, 0x3d, 0xe9, 0xa5, 0x5c, 0x10, 0xc4, 0x88,
+ 0xc9, 0x85, 0x51, 0x1d, 0xe4, 0xa8, 0x7c, 0x30, 0x93, 0xdf, 0x0b, 0x47, 0xbe, 0xf2, 0x26, 0x6a,
+ 0x7d, 0x31, 0xe5, 0xa9, 0x50, 0x1c, 0xc8, 0x84, 0x27, 0x6b, 0xbf, 0xf3, 0x0a, 0x46, 0x92, 0xde,
+ 0xbc, 0xf0, 0x24, 0x68, 0x91, 0xdd, 0x09, 0x45, 0xe6, 0xaa, 0x7e, 0x32, 0xcb, 0x87, 0x53, 0x1f,
+ 0x08, 0x44, 0x90, 0xdc, 0x25, 0x69, 0xbd, 0xf1, 0x52, 0x1e, 0xca, 0x86, 0x7f, 0x33, 0xe7, 0xab,
+ 0x23, 0x6f, 0xbb, 0xf7, 0x0e, 0x42, 0x96, 0xda, 0x79, 0x35, 0xe1, 0xad, 0x54, 0x18, 0xcc, 0x80,
+ 0x97, 0xdb, 0x0f, 0x43, 0xba, 0xf6, 0x22, 0x6e, 0xcd, 0x81, 0x55, 0x19, 0xe0, 0xac, 0x78, 0x34,
+ 0x56, 0x1a, 0xce, 0x82, 0x7b, 0x37, 0xe3, 0xaf, 0x0c, 0x40, 0x94, 0xd8, 0x21, 0x6d, 0xb9, 0xf5,
+ 0xe2, 0xae, 0x7a, 0x36, 0xcf, 0x83, 0x57, 0x1b, 0xb8, 0xf4, 0x20, 0x6c, 0x95, 0xd9, 0x0d, 0x41,
+ 0x00, 0x8f, 0x03, 0x8c, 0x06, 0x89, 0x05, 0x8a, 0x0c, 0x83, 0x0f, 0x80, 0x0a, 0x85, 0x09, 0x86,
+ 0x18, 0x97, 0x1b, 0x94, 0x1e, 0x91, 0x1d, 0x92, 0x14, 0x9b, 0x17, 0x98, 0x12, 0x9d, 0x11, 0x9e,
+ 0x30, 0xbf, 0x33, 0xbc, 0x36, 0xb9, 0x35, 0xba, 0x3c, 0xb3, 0x3f, 0xb0, 0x3a, 0xb5, 0x39, 0xb6,
+ 0x28, 0xa7, 0x2b, 0xa4, 0x2e, 0xa1, 0x2d, 0xa2, 0x24, 0xab, 0x27, 0xa8, 0x22, 0xad, 0x21, 0xae,
+ 0x60, 0xef, 0x63, 0xec, 0x66, 0xe9, 0x65, 0xea, 0x6c, 0xe3, 0x6f, 0xe0, 0x6a, 0xe5, 0x69, 0xe6,
+ 0x78, 0xf7, 0x7b, 0xf4, 0x7e, 0xf1, 0x7d, 0xf2, 0x74, 0xfb, 0x77, 0xf8, 0x72, 0xfd, 0x71, 0xfe,
+ 0x50, 0xdf, 0x53, 0xdc, 0x56, 0xd9, 0x55, 0xda, 0x5c, 0xd3, 0x5f, 0xd0, 0x5a, 0xd5, 0x59, 0xd6,
+ 0x48, 0xc7, 0x4b, 0xc4, 0x4e, 0xc1, 0x4d, 0xc2, 0x44, 0xcb, 0x47, 0xc8, 0x42, 0xcd, 0x41, 0xce,
+ 0xc0, 0x4f, 0xc3, 0x4c, 0xc6, 0x49, 0xc5, 0x4a, 0xcc, 0x43, 0xcf, 0x40, 0xca, 0x45, 0xc9, 0x46,
+ 0xd8, 0x57, 0xdb, 0x54, 0xde, 0x51, 0xdd, 0x52, 0xd4, 0x5b, 0xd7, 0x58, 0xd2, 0x5d, 0xd1, 0x5e,
+ 0xf0, 0x7f, 0xf3, 0x7c, 0xf6, 0x79, 0xf5, 0x7a, 0xfc, 0x73, 0xff, 0x70, 0xfa, 0x75, 0xf9, 0x76,
+ 0xe8, 0x67, 0xeb, 0x64, 0xee, 0x61, 0xed, 0x62, 0xe4, 0x6b, 0xe7, 0x68, 0xe2, 0x6d, 0xe1, 0x6e,
+ 0xa0, 0x2f, 0xa3, 0x2c, 0xa6, 0x29, 0xa5, 0x2a, 0xac, 0x23, 0xaf, 0x20, 0xaa, 0x25, 0xa9, 0x26,
+ 0xb8, 0x37, 0xbb, 0x34, 0xbe, 0x31, 0xbd, 0x32, 0xb4, 0x3b, 0xb7, 0x38, 0xb2, 0x3d, 0xb1, 0x3e,
+ 0x90, 0x1f, 0x93, 0x1c, 0x96, 0x19, 0x95, 0x1a, 0x9c, 0x13, 0x9f, 0x10, 0x9a, 0x15, 0x99, 0x16,
+ 0x88, 0x07, 0x8b, 0x04, 0x8e, 0x01, 0x8d, 0x02, 0x84, 0x0b, 0x87, 0x08, 0x82, 0x0d, 0x81, 0x0e,
+ 0x00, 0x9d, 0x27, 0xba, 0x4e, 0xd3, 0x69, 0xf4, 0x9c, 0x01, 0xbb, 0x26, 0xd2, 0x4f, 0xf5, 0x68,
+ 0x25, 0xb8, 0x02, 0x9f, 0x6b, 0xf6, 0x4c, 0xd1, 0xb9, 0x24, 0x9e, 0x03, 0xf7, 0x6a, 0xd0, 0x4d,
+ 0x4a, 0xd7, 0x6d, 0xf0, 0x04, 0x99, 0x23, 0xbe, 0xd6, 0x4b, 0xf1, 0x6c, 0x98, 0x05, 0xbf, 0x22,
+ 0x6f, 0xf2, 0x48, 0xd5, 0x21, 0xbc, 0x06, 0x9b, 0xf3, 0x6e, 0xd4, 0x49, 0xbd, 0x20, 0x9a, 0x07,
+ 0x94, 0x09, 0xb3, 0x2e, 0xda, 0x47, 0xfd, 0x60, 0x08, 0x95, 0x2f, 0xb2, 0x46, 0xdb, 0x61, 0xfc,
+ 0xb1, 0x2c, 0x96, 0x0b, 0xff, 0x62, 0xd8, 0x45, 0x2d, 0xb0, 0x0a, 0x97, 0x63, 0xfe, 0x44, 0xd9,
+ 0xde, 0x43, 0xf9, 0x64, 0x90, 0x0d, 0xb7, 0x2a, 0x42, 0xdf, 0x65, 0xf8, 0x0c, 0x91, 0x2b, 0xb6,
+ 0xfb, 0x66, 0xdc, 0x41, 0xb5, 0x28, 0x92, 0x0f, 0x67, 0xfa, 0x40, 0xdd, 0x29, 0xb4, 0x0e, 0x93,
+ 0x35, 0xa8, 0x12, 0x8f, 0x7b, 0xe6, 0x5c, 0xc1, 0xa9, 0x34, 0x8e, 0x13, 0xe7, 0x7a, 0xc0, 0x5d,
+ 0x10, 0x8d, 0x37, 0xaa, 0x5e, 0xc3, 0x79, 0xe4, 0x8c, 0x11, 0xab, 0x36, 0xc2, 0x5f, 0xe5, 0x78,
+ 0x7f, 0xe2, 0x58, 0xc5, 0x31, 0xac, 0x16, 0x8b, 0xe3, 0x7e, 0xc4, 0x59, 0xad, 0x30, 0x8a, 0x17,
+ 0x5a, 0xc7, 0x7d, 0xe0, 0x14, 0x89, 0x33, 0xae, 0xc6, 0x5b, 0xe1, 0x7c, 0x88, 0x15, 0xaf, 0x32,
+ 0xa1, 0x3c, 0x86, 0x1b, 0xef, 0x72, 0xc8, 0x55, 0x3d, 0xa0, 0x1a, 0x87, 0x73, 0xee, 0x54, 0xc9,
+ 0x84, 0x19, 0xa3, 0x3e, 0xca, 0x57, 0xed, 0x70, 0x18, 0x85, 0x3f, 0xa2, 0x56, 0xcb, 0x71, 0xec,
+ 0xeb, 0x76, 0xcc, 0x51, 0xa5, 0x38, 0x82, 0x1f, 0x77, 0xea, 0x50, 0xcd, 0x39, 0xa4, 0x1e, 0x83,
+ 0xce, 0x53, 0xe9, 0x74, 0x80, 0x1d, 0xa7, 0x3a, 0x52, 0xcf, 0x75, 0xe8, 0x1c, 0x81, 0x3b, 0xa6,
+ 0x00, 0x6a, 0xd4, 0xbe, 0xb5, 0xdf, 0x61, 0x0b, 0x77, 0x1d, 0xa3, 0xc9, 0xc2, 0xa8, 0x16, 0x7c,
+ 0xee, 0x84, 0x3a, 0x50, 0x5b, 0x31, 0x8f, 0xe5, 0x99, 0xf3, 0x4d, 0x27, 0x2c, 0x46, 0xf8, 0x92,
+ 0xc1, 0xab, 0x15, 0x7f, 0x74, 0x1e, 0xa0, 0xca, 0xb6, 0xdc, 0x62, 0x08, 0x03, 0x69, 0xd7, 0xbd,
+ 0x2f, 0x45, 0xfb, 0x91, 0x9a, 0xf0, 0x4e, 0x24, 0x58, 0x32, 0x8c, 0xe6, 0xed, 0x87, 0x39, 0x53,
+ 0x9f, 0xf5, 0x4b, 0x21, 0x2a, 0x40, 0xfe, 0x94, 0xe8, 0x82, 0x3c, 0x56, 0x5d, 0x37, 0x89, 0xe3,
+ 0x71, 0x1b, 0xa5, 0xcf, 0xc4, 0xae, 0x10, 0x7a, 0x06, 0x6c, 0xd2, 0xb8, 0xb3, 0xd9, 0x67, 0x0d,
+ 0x5e, 0x34, 0x8a, 0xe0, 0xeb, 0x81, 0x3f, 0x55, 0x29, 0x43, 0xfd, 0x97, 0x9c, 0xf6, 0x48, 0x22,
+ 0xb0, 0xda, 0x64, 0x0e, 0x05, 0x6f, 0xd1, 0xbb, 0xc7, 0xad, 0x13, 0x79, 0x72, 0x18, 0xa6, 0xcc,
+ 0x23, 0x49, 0xf7, 0x9d, 0x96, 0xfc, 0x42, 0x28, 0x54, 0x3e, 0x80, 0xea, 0xe1, 0x8b, 0x35, 0x5f,
+ 0xcd, 0xa7, 0x19, 0x73, 0x78, 0x12, 0xac, 0xc6, 0xba, 0xd0, 0x6e, 0x04, 0x0f, 0x65, 0xdb, 0xb1,
+ 0xe2, 0x88, 0x36, 0x5c, 0x57, 0x3d, 0x83, 0xe9, 0x95, 0xff, 0x41, 0x2b, 0x20, 0x4a, 0xf4, 0x9e,
+ 0x0c, 0x66, 0xd8, 0xb2, 0xb9, 0xd3, 0x6d, 0x07, 0x7b, 0x11, 0xaf, 0xc5, 0xce, 0xa4, 0x1a, 0x70,
+ 0xbc, 0xd6, 0x68, 0x02, 0x09, 0x63, 0xdd, 0xb7, 0xcb, 0xa1, 0x1f, 0x75, 0x7e, 0x14, 0xaa, 0xc0,
+ 0x52, 0x38, 0x86, 0xec, 0xe7, 0x8d, 0x33, 0x59, 0x25, 0x4f, 0xf1, 0x9b, 0x90, 0xfa, 0x44, 0x2e,
+ 0x7d, 0x17, 0xa9, 0xc3, 0xc8, 0xa2, 0x1c, 0x76, 0x0a, 0x60, 0xde, 0xb4, 0xbf, 0xd5, 0x6b, 0x01,
+ 0x93, 0xf9, 0x47, 0x2d, 0x26, 0x4c, 0xf2, 0x98, 0xe4, 0x8e, 0x30, 0x5a, 0x51, 0x3b, 0x85, 0xef,
+ 0x00, 0x46, 0x8c, 0xca, 0x05, 0x43, 0x89, 0xcf, 0x0a, 0x4c, 0x86, 0xc0, 0x0f, 0x49, 0x83, 0xc5,
+ 0x14, 0x52, 0x98, 0xde, 0x11, 0x57, 0x9d, 0xdb, 0x1e, 0x58, 0x92, 0xd4, 0x1b, 0x5d, 0x97, 0xd1,
+ 0x28, 0x6e, 0xa4, 0xe2, 0x2d, 0x6b, 0xa1, 0xe7, 0x22, 0x64, 0xae, 0xe8, 0x27, 0x61, 0xab, 0xed,
+ 0x3c, 0x7a, 0xb0, 0xf6, 0x39, 0x7f, 0xb5, 0xf3, 0x36, 0x70, 0xba, 0xfc, 0x33, 0x75, 0xbf, 0xf9,
+ 0x50, 0x16, 0xdc, 0x9a, 0x55, 0x13, 0xd9, 0x9f, 0x5a, 0x1c, 0xd6, 0x90, 0x5f, 0x19, 0xd3, 0x95,
+ 0x44, 0x02, 0xc8, 0x8e, 0x41, 0x07, 0xcd, 0x8b, 0x4e, 0x08, 0xc2, 0x84, 0x4b, 0x0d, 0xc7, 0x81,
+ 0x78, 0x3e, 0xf4, 0xb2, 0x7d, 0x3b, 0xf1, 0xb7, 0x72, 0x34, 0xfe, 0xb8, 0x77, 0x31, 0xfb, 0xbd,
+ 0x6c, 0x2a, 0xe0, 0xa6, 0x69, 0x2f, 0xe5, 0xa3, 0x66, 0x20, 0xea, 0xac, 0x63, 0x25, 0xef, 0xa9,
+ 0xa0, 0xe6, 0x2c, 0x6a, 0xa5, 0xe3, 0x29, 0x6f, 0xaa, 0xec, 0x26, 0x60, 0xaf, 0xe9, 0x23, 0x65,
+ 0xb4, 0xf2, 0x38, 0x7e, 0xb1, 0xf7, 0x3d, 0x7b, 0xbe, 0xf8, 0x32, 0x74, 0xbb, 0xfd, 0x37, 0x71,
+ 0x88, 0xce, 0x04, 0x42, 0x8d, 0xcb, 0x01, 0x47, 0x82, 0xc4, 0x0e, 0x48, 0x87, 0xc1, 0x0b, 0x4d,
+ 0x9c, 0xda, 0x10, 0x56, 0x99, 0xdf, 0x15, 0x53, 0x96, 0xd0, 0x1a, 0x5c, 0x93, 0xd5, 0x1f, 0x59,
+ 0xf0, 0xb6, 0x7c, 0x3a, 0xf5, 0xb3, 0x79, 0x3f, 0xfa, 0xbc, 0x76, 0x30, 0xff, 0xb9, 0x73, 0x35,
+ 0xe4, 0xa2, 0x68, 0x2e, 0xe1, 0xa7, 0x6d, 0x2b, 0xee, 0xa8, 0x62, 0x24, 0xeb, 0xad, 0x67, 0x21,
+ 0xd8, 0x9e, 0x54, 0x12, 0xdd, 0x9b, 0x51, 0x17, 0xd2, 0x94, 0x5e, 0x18, 0xd7, 0x91, 0x5b, 0x1d,
+ 0xcc, 0x8a, 0x40, 0x06, 0xc9, 0x8f, 0x45, 0x03, 0xc6, 0x80, 0x4a, 0x0c, 0xc3, 0x85, 0x4f, 0x09,
+ 0x00, 0x5d, 0xba, 0xe7, 0x69, 0x34, 0xd3, 0x8e, 0xd2, 0x8f, 0x68, 0x35, 0xbb, 0xe6, 0x01, 0x5c,
+ 0xb9, 0xe4, 0x03, 0x5e, 0xd0, 0x8d, 0x6a, 0x37, 0x6b, 0x36, 0xd1, 0x8c, 0x02, 0x5f, 0xb8, 0xe5,
+ 0x6f, 0x32, 0xd5, 0x88, 0x06, 0x5b, 0xbc, 0xe1, 0xbd, 0xe0, 0x07, 0x5a, 0xd4, 0x89, 0x6e, 0x33,
+ 0xd6, 0x8b, 0x6c, 0x31, 0xbf, 0xe2, 0x05, 0x58, 0x04, 0x59, 0xbe, 0xe3, 0x6d, 0x30, 0xd7, 0x8a,
+ 0xde, 0x83, 0x64, 0x39, 0xb7, 0xea, 0x0d, 0x50, 0x0c, 0x51, 0xb6, 0xeb, 0x65, 0x38, 0xdf, 0x82,
+ 0x67, 0x3a, 0xdd, 0x80, 0x0e, 0x53, 0xb4, 0xe9, 0xb5, 0xe8, 0x0f, 0x52, 0xdc, 0x81, 0x66, 0x3b,
+ 0xb1, 0xec, 0x0b, 0x56, 0xd8, 0x85, 0x62, 0x3f, 0x63, 0x3e, 0xd9, 0x84, 0x0a, 0x57, 0xb0, 0xed,
+ 0x08, 0x55, 0xb2, 0xef, 0x61, 0x3c, 0xdb, 0x86, 0xda, 0x87, 0x60, 0x3d, 0xb3, 0xee, 0x09, 0x54,
+ 0xa1, 0xfc, 0x1b, 0x46, 0xc8, 0x95, 0x72, 0x2f, 0x73, 0x2e, 0xc9, 0x94, 0x1a, 0x47, 0xa0, 0xfd,
+ 0x18, 0x45, 0xa2, 0xff, 0x71, 0x2c, 0xcb, 0x96, 0xca, 0x97, 0x70, 0x2d, 0xa3, 0xfe, 0x19, 0x44,
+ 0xce, 0x93, 0x74, 0x29, 0xa7, 0xfa, 0x1d, 0x40, 0x1c, 0x41, 0xa6, 0xfb, 0x75, 0x28, 0xcf, 0x92,
+ 0x77, 0x2a, 0xcd, 0x90, 0x1e, 0x43, 0xa4, 0xf9, 0xa5, 0xf8, 0x1f, 0x42, 0xcc, 0x91, 0x76, 0x2b,
+ 0x7f, 0x22, 0xc5, 0x98, 0x16, 0x4b, 0xac, 0xf1, 0xad, 0xf0, 0x17, 0x4a, 0xc4, 0x99, 0x7e, 0x23,
+ 0xc6, 0x9b, 0x7c, 0x21, 0xaf, 0xf2, 0x15, 0x48, 0x14, 0x49, 0xae, 0xf3, 0x7d, 0x20, 0xc7, 0x9a,
+ 0x10, 0x4d, 0xaa, 0xf7, 0x79, 0x24, 0xc3, 0x9e, 0xc2, 0x9f, 0x78, 0x25, 0xab, 0xf6, 0x11, 0x4c,
+ 0xa9, 0xf4, 0x13, 0x4e, 0xc0, 0x9d, 0x7a, 0x27, 0x7b, 0x26, 0xc1, 0x9c, 0x12, 0x4f, 0xa8, 0xf5,
+ 0x00, 0x5f, 0xbe, 0xe1, 0x61, 0x3e, 0xdf, 0x80, 0xc2, 0x9d, 0x7c, 0x23, 0xa3, 0xfc, 0x1d, 0x42,
+ 0x99, 0xc6, 0x27, 0x78, 0xf8, 0xa7, 0x46, 0x19, 0x5b, 0x04, 0xe5, 0xba, 0x3a, 0x65, 0x84, 0xdb,
+ 0x2f, 0x70, 0x91, 0xce, 0x4e, 0x11, 0xf0, 0xaf, 0xed, 0xb2, 0x53, 0x0c, 0x8c, 0xd3, 0x32, 0x6d,
+ 0xb6, 0xe9, 0x08, 0x57, 0xd7, 0x88, 0x69, 0x36, 0x74, 0x2b, 0xca, 0x95, 0x15, 0x4a, 0xab, 0xf4,
+ 0x5e, 0x01, 0xe0, 0xbf, 0x3f, 0x60, 0x81, 0xde, 0x9c, 0xc3, 0x22, 0x7d, 0xfd, 0xa2, 0x43, 0x1c,
+ 0xc7, 0x98, 0x79, 0x26, 0xa6, 0xf9, 0x18, 0x47, 0x05, 0x5a, 0xbb, 0xe4, 0x64, 0x3b, 0xda, 0x85,
+ 0x71, 0x2e, 0xcf, 0x90, 0x10, 0x4f, 0xae, 0xf1, 0xb3, 0xec, 0x0d, 0x52, 0xd2, 0x8d, 0x6c, 0x33,
+ 0xe8, 0xb7, 0x56, 0x09, 0x89, 0xd6, 0x37, 0x68, 0x2a, 0x75, 0x94, 0xcb, 0x4b, 0x14, 0xf5, 0xaa,
+ 0xbc, 0xe3, 0x02, 0x5d, 0xdd, 0x82, 0x63, 0x3c, 0x7e, 0x21, 0xc0, 0x9f, 0x1f, 0x40, 0xa1, 0xfe,
+ 0x25, 0x7a, 0x9b, 0xc4, 0x44, 0x1b, 0xfa, 0xa5, 0xe7, 0xb8, 0x59, 0x06, 0x86, 0xd9, 0x38, 0x67,
+ 0x93, 0xcc, 0x2d, 0x72, 0xf2, 0xad, 0x4c, 0x13, 0x51, 0x0e, 0xef, 0xb0, 0x30, 0x6f, 0x8e, 0xd1,
+ 0x0a, 0x55, 0xb4, 0xeb, 0x6b, 0x34, 0xd5, 0x8a, 0xc8, 0x97, 0x76, 0x29, 0xa9, 0xf6, 0x17, 0x48,
+ 0xe2, 0xbd, 0x5c, 0x03, 0x83, 0xdc, 0x3d, 0x62, 0x20, 0x7f, 0x9e, 0xc1, 0x41, 0x1e, 0xff, 0xa0,
+ 0x7b, 0x24, 0xc5, 0x9a, 0x1a, 0x45, 0xa4, 0xfb, 0xb9, 0xe6, 0x07, 0x58, 0xd8, 0x87, 0x66, 0x39,
+ 0xcd, 0x92, 0x73, 0x2c, 0xac, 0xf3, 0x12, 0x4d, 0x0f, 0x50, 0xb1, 0xee, 0x6e, 0x31, 0xd0, 0x8f,
+ 0x54, 0x0b, 0xea, 0xb5, 0x35, 0x6a, 0x8b, 0xd4, 0x96, 0xc9, 0x28, 0x77, 0xf7, 0xa8, 0x49, 0x16,
+};
+
+const uint8_t crc8_9b_reflected_crc_table[CRC_SLICES * 256] = {
+ 0x00, 0xd0, 0x13, 0xc3, 0x26, 0xf6, 0x35, 0xe5, 0x4c, 0x9c, 0x5f, 0x8f, 0x6a, 0xba, 0x79, 0xa9,
+ 0x98, 0x48, 0x8b, 0x5b, 0xbe, 0x6e, 0xad, 0x7d, 0xd4, 0x04, 0xc7, 0x17, 0xf2, 0x22, 0xe1, 0x31,
+ 0x83, 0x53, 0x90, 0x40, 0xa5, 0x75, 0xb6, 0x66, 0xcf, 0x1f, 0xdc, 0x0c, 0xe9, 0x39, 0xfa, 0x2a,
+ 0x1b, 0xcb, 0x08, 0xd8, 0x3d, 0xed, 0x2e, 0xfe, 0x57, 0x87, 0x44, 0x94, 0x71, 0xa1, 0x62, 0xb2,
+ 0xb5, 0x65, 0xa6, 0x76, 0x93, 0x43, 0x80, 0x50, 0xf9, 0x29, 0xea, 0x3a, 0xdf, 0x0f, 0xcc, 0x1c,
+ 0x2d, 0xfd, 0x3e, 0xee, 0x0b, 0xdb, 0x18, 0xc8, 0x61, 0xb1, 0x72, 0xa2, 0x47, 0x97, 0x54, 0x84,
+ 0x36, 0xe6, 0x25, 0xf5, 0x10, 0xc0, 0x03, 0xd3, 0x7a, 0xaa, 0x69, 0xb9, 0x5c, 0x8c, 0x4f, 0x9f,
+ 0xae, 0x7e, 0xbd, 0x6d, 0x88, 0x58, 0x9b, 0x4b, 0xe2, 0x32, 0xf1, 0x21, 0xc4, 0x14, 0xd7, 0x07,
+ 0xd9, 0x09, 0xca, 0x1a, 0xff, 0x2f, 0xec, 0x3c, 0x95, 0x45, 0x86, 0x56, 0xb3, 0x63, 0xa0, 0x70,
+ 0x41, 0x91, 0x52, 0x82, 0x67, 0xb7, 0x74, 0xa4, 0x0d, 0xdd, 0x1e, 0xce, 0x2b, 0xfb, 0x38, 0xe8,
+ 0x5a, 0x8a, 0x49, 0x99, 0x7c, 0xac, 0x6f, 0xbf, 0x16, 0xc6, 0x05, 0xd5, 0x30, 0xe0, 0x23, 0xf3,
+ 0xc2, 0x12, 0xd1, 0x01, 0xe4, 0x34, 0xf7, 0x27, 0x8e, 0x5e, 0x9d, 0x4d, 0xa8, 0x78, 0xbb, 0x6b,
+ 0x6c, 0xbc, 0x7f, 0xaf, 0x4a, 0x9a, 0x59, 0x89, 0x20, 0xf0, 0x33, 0xe3, 0x06, 0xd6, 0x15, 0xc5,
+ 0xf4, 0x24, 0xe7, 0x37, 0xd2, 0x02, 0xc1, 0x11, 0xb8, 0x68, 0xab, 0x7b, 0x9e, 0x4e, 0x8d, 0x5d,
+ 0xef, 0x3f, 0xfc, 0x2c, 0xc9, 0x19, 0xda, 0x0a, 0xa3, 0x73, 0xb0, 0x60, 0x85, 0x55, 0x96, 0x46,
+ 0x77, 0xa7, 0x64, 0xb4, 0x51, 0x81, 0x42, 0x92, 0x3b, 0xeb, 0x28, 0xf8, 0x1d, 0xcd, 0x0e, 0xde,
+ 0x00, 0xf4, 0x5b, 0xaf, 0xb6, 0x42, 0xed, 0x19, 0xdf, 0x2b, 0x84, 0x70, 0x69, 0x9d, 0x32, 0xc6,
+ 0x0d, 0xf9, 0x56, 0xa2, 0xbb, 0x4f, 0xe0, 0x14, 0xd2, 0x26, 0x89, 0x7d, 0x64, 0x90, 0x3f, 0xcb,
+ 0x1a, 0xee, 0x41, 0xb5, 0xac, 0x58, 0xf7, 0x03, 0xc5, 0x31, 0x9e, 0x6a, 0x73, 0x87, 0x28, 0xdc,
+ 0x17, 0xe3, 0x4c, 0xb8, 0xa1, 0x55, 0xfa, 0x0e, 0xc8, 0x3c, 0x93, 0x67, 0x7e, 0x8a, 0x25, 0xd1,
+ 0x34, 0xc0, 0x6f, 0x9b, 0x82, 0x76, 0xd9, 0x2d, 0xeb, 0x1f, 0xb0, 0x44, 0x5d, 0xa9, 0x06, 0xf2,
+ 0x39, 0xcd, 0x62, 0x96, 0x8f, 0x7b, 0xd4, 0x20, 0xe6, 0x12, 0xbd, 0x49, 0x50, 0xa4, 0x0b, 0xff,
+ 0x2e, 0xda, 0x75, 0x81, 0x98, 0x6c, 0xc3, 0x37, 0xf1, 0x05, 0xaa, 0x5e, 0x47, 0xb3, 0x1c, 0xe8,
+ 0x23, 0xd7, 0x78, 0x8c, 0x95, 0x61, 0xce, 0x3a, 0xfc, 0x08, 0xa7, 0x53, 0x4a, 0xbe, 0x11, 0xe5,
+ 0x68, 0x9c, 0x33, 0xc7, 0xde, 0x2a, 0x85, 0x71, 0xb7, 0x43, 0xec, 0x18, 0x01, 0xf5, 0x5a, 0xae,
+ 0x65, 0x91, 0x3e, 0xca, 0xd3, 0x27, 0x88, 0x7c, 0xba, 0x4e, 0xe1, 0x15, 0x0c, 0xf8, 0x57, 0xa3,
+ 0x72, 0x86, 0x29, 0xdd, 0xc4, 0x30, 0x9f, 0x6b, 0xad, 0x59, 0xf6, 0x02, 0x1b, 0xef, 0x40, 0xb4,
+ 0x7f, 0x8b, 0x24, 0xd0, 0xc9, 0x3d, 0x92, 0x66, 0xa0, 0x54, 0xfb, 0x0f, 0x16, 0xe2, 0x4d, 0xb9,
+ 0x5c, 0xa8, 0x07, 0xf3, 0xea, 0x1e, 0xb1, 0x45, 0x83, 0x77, 0xd8, 0x2c, 0x35, 0xc1, 0x6e, 0x9a,
+ 0x51, 0xa5, 0x0a, 0xfe, 0xe7, 0x13, 0xbc, 0x48, 0x8e, 0x7a, 0xd5, 0x21, 0x38, 0xcc, 0x63, 0x97,
+ 0x46, 0xb2, 0x1d, 0xe9, 0xf0, 0x04, 0xab, 0x5f, 0x99, 0x6d, 0xc2, 0x36, 0x2f, 0xdb, 0x74, 0x80,
+ 0x4b, 0xbf, 0x10, 0xe4, 0xfd, 0x09, 0xa6, 0x52, 0x94, 0x60, 0xcf, 0x3b, 0x22, 0xd6, 0x79, 0x8d,
+ 0x00, 0x51, 0xa2, 0xf3, 0xf7, 0xa6, 0x55, 0x04, 0x5d, 0x0c, 0xff, 0xae, 0xaa, 0xfb, 0x08, 0x59,
+ 0xba, 0xeb, 0x18, 0x49, 0x4d, 0x1c, 0xef, 0xbe, 0xe7, 0xb6, 0x45, 0x14, 0x10, 0x41, 0xb2, 0xe3,
+ 0xc7, 0x96, 0x65, 0x34, 0x30, 0x61, 0x92, 0xc3, 0x9a, 0xcb, 0x38, 0x69, 0x6d, 0x3c, 0xcf, 0x9e,
+ 0x7d, 0x2c, 0xdf, 0x8e, 0x8a, 0xdb, 0x28, 0x79, 0x20, 0x71, 0x82, 0xd3, 0xd7, 0x86, 0x75, 0x24,
+ 0x3d, 0x6c, 0x9f, 0xce, 0xca, 0x9b, 0x68, 0x39, 0x60, 0x31, 0xc2, 0x93, 0x97, 0xc6, 0x35, 0x64,
+ 0x87, 0xd6, 0x25, 0x74, 0x70, 0x21, 0xd2, 0x83, 0xda, 0x8b, 0x78, 0x29, 0x2d, 0x7c, 0x8f, 0xde,
+ 0xfa, 0xab, 0x58, 0x09, 0x0d, 0x5c, 0xaf, 0xfe, 0xa7, 0xf6, 0x05, 0x54, 0x50, 0x01, 0xf2, 0xa3,
+ 0x40, 0x11, 0xe2, 0xb3, 0xb7, 0xe6, 0x15, 0x44, 0x1d, 0x4c, 0xbf, 0xee, 0xea, 0xbb, 0x48, 0x19,
+ 0x7a, 0x2b, 0xd8, 0x89, 0x8d, 0xdc, 0x2f, 0x7e, 0x27, 0x76, 0x85, 0xd4, 0xd0, 0x81, 0x72, 0x23,
+ 0xc0, 0x91, 0x62, 0x33, 0x37, 0x66, 0x95, 0xc4, 0x9d, 0xcc, 0x3f, 0x6e, 0x6a, 0x3b, 0xc8, 0x99,
+ 0xbd, 0xec, 0x1f, 0x4e, 0x4a, 0x1b, 0xe8, 0xb9, 0xe0, 0xb1, 0x42, 0x13, 0x17, 0x46, 0xb5, 0xe4,
+ 0x07, 0x56, 0xa5, 0xf4, 0xf0, 0xa1, 0x52, 0x03, 0x5a, 0x0b, 0xf8, 0xa9, 0xad, 0xfc, 0x0f, 0x5e,
+ 0x47, 0x16, 0xe5, 0xb4, 0xb0, 0xe1, 0x12, 0x43, 0x1a, 0x4b, 0xb8, 0xe9, 0xed, 0xbc, 0x4f, 0x1e,
+ 0xfd, 0xac, 0x5f, 0x0e, 0x0a, 0x5b, 0xa8, 0xf9, 0xa0, 0xf1, 0x02, 0x53, 0x57, 0x06, 0xf5, 0xa4,
+ 0x80, 0xd1, 0x22, 0x73, 0x77, 0x26, 0xd5, 0x84, 0xdd, 0x8c, 0x7f, 0x2e, 0x2a, 0x7b, 0x88, 0xd9,
+ 0x3a, 0x6b, 0x98, 0xc9, 0xcd, 0x9c, 0x6f, 0x3e, 0x67, 0x36, 0xc5, 0x94, 0x90, 0xc1, 0x32, 0x63,
+ 0x00, 0xfd, 0x49, 0xb4, 0x92, 0x6f, 0xdb, 0x26, 0x97, 0x6a, 0xde, 0x23, 0x05, 0xf8, 0x4c, 0xb1,
+ 0x9d, 0x60, 0xd4, 0x29, 0x0f, 0xf2, 0x46, 0xbb, 0x0a, 0xf7, 0x43, 0xbe, 0x98, 0x65, 0xd1, 0x2c,
+ 0x89, 0x74, 0xc0, 0x3d, 0x1b, 0xe6, 0x52, 0xaf, 0x1e, 0xe3, 0x57, 0xaa, 0x8c, 0x71, 0xc5, 0x38,
+ 0x14, 0xe9, 0x5d, 0xa0, 0x86, 0x7b, 0xcf, 0x32, 0x83, 0x7e, 0xca, 0x37, 0x11, 0xec, 0x58, 0xa5,
+ 0xa1, 0x5c, 0xe8, 0x15, 0x33, 0xce, 0x7a, 0x87, 0x36, 0xcb, 0x7f, 0x82, 0xa4, 0x59, 0xed, 0x10,
+ 0x3c, 0xc1, 0x75, 0x88, 0xae, 0x53, 0xe7, 0x1a, 0xab, 0x56, 0xe2, 0x1f, 0x39, 0xc4, 0x70, 0x8d,
+ 0x28, 0xd5, 0x61, 0x9c, 0xba, 0x47, 0xf3, 0x0e, 0xbf, 0x42, 0xf6, 0x0b, 0x2d, 0xd0, 0x64, 0x99,
+ 0xb5, 0x48, 0xfc, 0x01, 0x27, 0xda, 0x6e, 0x93, 0x22, 0xdf, 0x6b, 0x96, 0xb0, 0x4d, 0xf9, 0x04,
+ 0xf1, 0x0c, 0xb8, 0x45, 0x63, 0x9e, 0x2a, 0xd7, 0x66, 0x9b, 0x2f, 0xd2, 0xf4, 0x09, 0xbd, 0x40,
+ 0x6c, 0x91, 0x25, 0xd8, 0xfe, 0x03, 0xb7, 0x4a, 0xfb, 0x06, 0xb2, 0x4f, 0x69, 0x94, 0x20, 0xdd,
+ 0x78, 0x85, 0x31, 0xcc, 0xea, 0x17, 0xa3, 0x5e, 0xef, 0x12, 0xa6, 0x5b, 0x7d, 0x80, 0x34, 0xc9,
+ 0xe5, 0x18, 0xac, 0x51, 0x77, 0x8a, 0x3e, 0xc3, 0x72, 0x8f, 0x3b, 0xc6, 0xe0, 0x1d, 0xa9, 0x54,
+ 0x50, 0xad, 0x19, 0xe4, 0xc2, 0x3f, 0x8b, 0x76, 0xc7, 0x3a, 0x8e, 0x73, 0x55, 0xa8, 0x1c, 0xe1,
+ 0xcd, 0x30, 0x84, 0x79, 0x5f, 0xa2, 0x16, 0xeb, 0x5a, 0xa7, 0x13, 0xee, 0xc8, 0x35, 0x81, 0x7c,
+ 0xd9, 0x24, 0x90, 0x6d, 0x4b, 0xb6, 0x02, 0xff, 0x4e, 0xb3, 0x07, 0xfa, 0xdc, 0x21, 0x95, 0x68,
+ 0x44, 0xb9, 0x0d, 0xf0, 0xd6, 0x2b, 0x9f, 0x62, 0xd3, 0x2e, 0x9a, 0x67, 0x41, 0xbc, 0x08, 0xf5,
+ 0x00, 0xcd, 0x29, 0xe4, 0x52, 0x9f, 0x7b, 0xb6, 0xa4, 0x69, 0x8d, 0x40, 0xf6, 0x3b, 0xdf, 0x12,
+ 0xfb, 0x36, 0xd2, 0x1f, 0xa9, 0x64, 0x80, 0x4d, 0x5f, 0x92, 0x76, 0xbb, 0x0d, 0xc0, 0x24, 0xe9,
+ 0x45, 0x88, 0x6c, 0xa1, 0x17, 0xda, 0x3e, 0xf3, 0xe1, 0x2c, 0xc8, 0x05, 0xb3, 0x7e, 0x9a, 0x57,
+ 0xbe, 0x73, 0x97, 0x5a, 0xec, 0x21, 0xc5, 0x08, 0x1a, 0xd7, 0x33, 0xfe, 0x48, 0x85, 0x61, 0xac,
+ 0x8a, 0x47, 0xa3, 0x6e, 0xd8, 0x15, 0xf1, 0x3c, 0x2e, 0xe3, 0x07, 0xca, 0x7c, 0xb1, 0x55, 0x98,
+ 0x71, 0xbc, 0x58, 0x95, 0x23, 0xee, 0x0a, 0xc7, 0xd5, 0x18, 0xfc, 0x31, 0x87, 0x4a, 0xae, 0x63,
+ 0xcf, 0x02, 0xe6, 0x2b, 0x9d, 0x50, 0xb4, 0x79, 0x6b, 0xa6, 0x42, 0x8f, 0x39, 0xf4, 0x10, 0xdd,
+ 0x34, 0xf9, 0x1d, 0xd0, 0x66, 0xab, 0x4f, 0x82, 0x90, 0x5d, 0xb9, 0x74, 0xc2, 0x0f, 0xeb, 0x26,
+ 0xa7, 0x6a, 0x8e, 0x43, 0xf5, 0x38, 0xdc, 0x11, 0x03, 0xce, 0x2a, 0xe7, 0x51, 0x9c, 0x78, 0xb5,
+ 0x5c, 0x91, 0x75, 0xb8, 0x0e, 0xc3, 0x27, 0xea, 0xf8, 0x35, 0xd1, 0x1c, 0xaa, 0x67, 0x83, 0x4e,
+ 0xe2, 0x2f, 0xcb, 0x06, 0xb0, 0x7d, 0x99, 0x54, 0x46, 0x8b, 0x6f, 0xa2, 0x14, 0xd9, 0x3d, 0xf0,
+ 0x19, 0xd4, 0x30, 0xfd, 0x4b, 0x86, 0x62, 0xaf, 0xbd, 0x70, 0x94, 0x59, 0xef, 0x22, 0xc6, 0x0b,
+ 0x2d, 0xe0, 0x04, 0xc9, 0x7f, 0xb2, 0x56, 0x9b, 0x89, 0x44, 0xa0, 0x6d, 0xdb, 0x16, 0xf2, 0x3f,
+ 0xd6, 0x1b, 0xff, 0x32, 0x84, 0x49, 0xad, 0x60, 0x72, 0xbf, 0x5b, 0x96, 0x20, 0xed, 0x09, 0xc4,
+ 0x68, 0xa5, 0x41, 0x8c, 0x3a, 0xf7, 0x13, 0xde, 0xcc, 0x01, 0xe5, 0x28, 0x9e, 0x53, 0xb7, 0x7a,
+ 0x93, 0x5e, 0xba, 0x77, 0xc1, 0x0c, 0xe8, 0x25, 0x37, 0xfa, 0x1e, 0xd3, 0x65, 0xa8, 0x4c, 0x81,
+ 0x00, 0xd6, 0x1f, 0xc9, 0x3e, 0xe8, 0x21, 0xf7, 0x7c, 0xaa, 0x63, 0xb5, 0x42, 0x94, 0x5d, 0x8b,
+ 0xf8, 0x2e, 0xe7, 0x31, 0xc6, 0x10, 0xd9, 0x0f, 0x84, 0x52, 0x9b, 0x4d, 0xba, 0x6c, 0xa5, 0x73,
+ 0x43, 0x95, 0x5c, 0x8a, 0x7d, 0xab, 0x62, 0xb4, 0x3f, 0xe9, 0x20, 0xf6, 0x01, 0xd7, 0x1e, 0xc8,
+ 0xbb, 0x6d, 0xa4, 0x72, 0x85, 0x53, 0x9a, 0x4c, 0xc7, 0x11, 0xd8, 0x0e, 0xf9, 0x2f, 0xe6, 0x30,
+ 0x86, 0x50, 0x99, 0x4f, 0xb8, 0x6e, 0xa7, 0x71, 0xfa, 0x2c, 0xe5, 0x33, 0xc4, 0x12, 0xdb, 0x0d,
+ 0x7e, 0xa8, 0x61, 0xb7, 0x40, 0x96, 0x5f, 0x89, 0x02, 0xd4, 0x1d, 0xcb, 0x3c, 0xea, 0x23, 0xf5,
+ 0xc5, 0x13, 0xda, 0x0c, 0xfb, 0x2d, 0xe4, 0x32, 0xb9, 0x6f, 0xa6, 0x70, 0x87, 0x51, 0x98, 0x4e,
+ 0x3d, 0xeb, 0x22, 0xf4, 0x03, 0xd5, 0x1c, 0xca, 0x41, 0x97, 0x5e, 0x88, 0x7f, 0xa9, 0x60, 0xb6,
+ 0xbf, 0x69, 0xa0, 0x76, 0x81, 0x57, 0x9e, 0x48, 0xc3, 0x15, 0xdc, 0x0a, 0xfd, 0x2b, 0xe2, 0x34,
+ 0x47, 0x91, 0x58, 0x8e, 0x79, 0xaf, 0x66, 0xb0, 0x3b, 0xed, 0x24, 0xf2, 0x05, 0xd3, 0x1a, 0xcc,
+ 0xfc, 0x2a, 0xe3, 0x35, 0xc2, 0x14, 0xdd, 0x0b, 0x80, 0x56, 0x9f, 0x49, 0xbe, 0x68, 0xa1, 0x77,
+ 0x04, 0xd2, 0x1b, 0xcd, 0x3a, 0xec, 0x25, 0xf3, 0x78, 0xae, 0x67, 0xb1, 0x46, 0x90, 0x59, 0x8f,
+ 0x39, 0xef, 0x26, 0xf0, 0x07, 0xd1, 0x18, 0xce, 0x45, 0x93, 0x5a, 0x8c, 0x7b, 0xad, 0x64, 0xb2,
+ 0xc1, 0x17, 0xde, 0x08, 0xff, 0x29, 0xe0, 0x36, 0xbd, 0x6b, 0xa2, 0x74, 0x83, 0x55, 0x9c, 0x4a,
+ 0x7a, 0xac, 0x65, 0xb3, 0x44, 0x92, 0x5b, 0x8d, 0x06, 0xd0, 0x19, 0xcf, 0x38, 0xee, 0x27, 0xf1,
+ 0x82, 0x54, 0x9d, 0x4b, 0xbc, 0x6a, 0xa3, 0x75, 0xfe, 0x28, 0xe1, 0x37, 0xc0, 0x16, 0xdf, 0x09,
+ 0x00, 0xc1, 0x31, 0xf0, 0x62, 0xa3, 0x53, 0x92, 0xc4, 0x05, 0xf5, 0x34, 0xa6, 0x67, 0x97, 0x56,
+ 0x3b, 0xfa, 0x0a, 0xcb, 0x59, 0x98, 0x68, 0xa9, 0xff, 0x3e, 0xce, 0x0f, 0x9d, 0x5c, 0xac, 0x6d,
+ 0x76, 0xb7, 0x47, 0x86, 0x14, 0xd5, 0x25, 0xe4, 0xb2, 0x73, 0x83, 0x42, 0xd0, 0x11, 0xe1, 0x20,
+ 0x4d, 0x8c, 0x7c, 0xbd, 0x2f, 0xee, 0x1e, 0xdf, 0x89, 0x48, 0xb8, 0x79, 0xeb, 0x2a, 0xda, 0x1b,
+ 0xec, 0x2d, 0xdd, 0x1c, 0x8e, 0x4f, 0xbf, 0x7e, 0x28, 0xe9, 0x19, 0xd8, 0x4a, 0x8b, 0x7b, 0xba,
+ 0xd7, 0x16, 0xe6, 0x27, 0xb5, 0x74, 0x84, 0x45, 0x13, 0xd2, 0x22, 0xe3, 0x71, 0xb0, 0x40, 0x81,
+ 0x9a, 0x5b, 0xab, 0x6a, 0xf8, 0x39, 0xc9, 0x08, 0x5e, 0x9f, 0x6f, 0xae, 0x3c, 0xfd, 0x0d, 0xcc,
+ 0xa1, 0x60, 0x90, 0x51, 0xc3, 0x02, 0xf2, 0x33, 0x65, 0xa4, 0x54, 0x95, 0x07, 0xc6, 0x36, 0xf7,
+ 0x6b, 0xaa, 0x5a, 0x9b, 0x09, 0xc8, 0x38, 0xf9, 0xaf, 0x6e, 0x9e, 0x5f, 0xcd, 0x0c, 0xfc, 0x3d,
+ 0x50, 0x91, 0x61, 0xa0, 0x32, 0xf3, 0x03, 0xc2, 0x94, 0x55, 0xa5, 0x64, 0xf6, 0x37, 0xc7, 0x06,
+ 0x1d, 0xdc, 0x2c, 0xed, 0x7f, 0xbe, 0x4e, 0x8f, 0xd9, 0x18, 0xe8, 0x29, 0xbb, 0x7a, 0x8a, 0x4b,
+ 0x26, 0xe7, 0x17, 0xd6, 0x44, 0x85, 0x75, 0xb4, 0xe2, 0x23, 0xd3, 0x12, 0x80, 0x41, 0xb1, 0x70,
+ 0x87, 0x46, 0xb6, 0x77, 0xe5, 0x24, 0xd4, 0x15, 0x43, 0x82, 0x72, 0xb3, 0x21, 0xe0, 0x10, 0xd1,
+ 0xbc, 0x7d, 0x8d, 0x4c, 0xde, 0x1f, 0xef, 0x2e, 0x78, 0xb9, 0x49, 0x88, 0x1a, 0xdb, 0x2b, 0xea,
+ 0xf1, 0x30, 0xc0, 0x01, 0x93, 0x52, 0xa2, 0x63, 0x35, 0xf4, 0x04, 0xc5, 0x57, 0x96, 0x66, 0xa7,
+ 0xca, 0x0b, 0xfb, 0x3a, 0xa8, 0x69, 0x99, 0x58, 0x0e, 0xcf, 0x3f, 0xfe, 0x6c, 0xad, 0x5d, 0x9c,
+ 0x00, 0xbc, 0xcb, 0x77, 0x25, 0x99, 0xee, 0x52, 0x4a, 0xf6, 0x81, 0x3d, 0x6f, 0xd3, 0xa4, 0x18,
+ 0x94, 0x28, 0x5f, 0xe3, 0xb1, 0x0d, 0x7a, 0xc6, 0xde, 0x62, 0x15, 0xa9, 0xfb, 0x47, 0x30, 0x8c,
+ 0x9b, 0x27, 0x50, 0xec, 0xbe, 0x02, 0x75, 0xc9, 0xd1, 0x6d, 0x1a, 0xa6, 0xf4, 0x48, 0x3f, 0x83,
+ 0x0f, 0xb3, 0xc4, 0x78, 0x2a, 0x96, 0xe1, 0x5d, 0x45, 0xf9, 0x8e, 0x32, 0x60, 0xdc, 0xab, 0x17,
+ 0x85, 0x39, 0x4e, 0xf2, 0xa0, 0x1c, 0x6b, 0xd7, 0xcf, 0x73, 0x04, 0xb8, 0xea, 0x56, 0x21, 0x9d,
+ 0x11, 0xad, 0xda, 0x66, 0x34, 0x88, 0xff, 0x43, 0x5b, 0xe7, 0x90, 0x2c, 0x7e, 0xc2, 0xb5, 0x09,
+ 0x1e, 0xa2, 0xd5, 0x69, 0x3b, 0x87, 0xf0, 0x4c, 0x54, 0xe8, 0x9f, 0x23, 0x71, 0xcd, 0xba, 0x06,
+ 0x8a, 0x36, 0x41, 0xfd, 0xaf, 0x13, 0x64, 0xd8, 0xc0, 0x7c, 0x0b, 0xb7, 0xe5, 0x59, 0x2e, 0x92,
+ 0xb9, 0x05, 0x72, 0xce, 0x9c, 0x20, 0x57, 0xeb, 0xf3, 0x4f, 0x38, 0x84, 0xd6, 0x6a, 0x1d, 0xa1,
+ 0x2d, 0x91, 0xe6, 0x5a, 0x08, 0xb4, 0xc3, 0x7f, 0x67, 0xdb, 0xac, 0x10, 0x42, 0xfe, 0x89, 0x35,
+ 0x22, 0x9e, 0xe9, 0x55, 0x07, 0xbb, 0xcc, 0x70, 0x68, 0xd4, 0xa3, 0x1f, 0x4d, 0xf1, 0x86, 0x3a,
+ 0xb6, 0x0a, 0x7d, 0xc1, 0x93, 0x2f, 0x58, 0xe4, 0xfc, 0x40, 0x37, 0x8b, 0xd9, 0x65, 0x12, 0xae,
+ 0x3c, 0x80, 0xf7, 0x4b, 0x19, 0xa5, 0xd2, 0x6e, 0x76, 0xca, 0xbd, 0x01, 0x53, 0xef, 0x98, 0x24,
+ 0xa8, 0x14, 0x63, 0xdf, 0x8d, 0x31, 0x46, 0xfa, 0xe2, 0x5e, 0x29, 0x95, 0xc7, 0x7b, 0x0c, 0xb0,
+ 0xa7, 0x1b, 0x6c, 0xd0, 0x82, 0x3e, 0x49, 0xf5, 0xed, 0x51, 0x26, 0x9a, 0xc8, 0x74, 0x03, 0xbf,
+ 0x33, 0x8f, 0xf8, 0x44, 0x16, 0xaa, 0xdd, 0x61, 0x79, 0xc5, 0xb2, 0x0e, 0x5c, 0xe0, 0x97, 0x2b,
+};
+
+const uint16_t crc16_0589_crc_table[CRC_SLICES * 256] = {
+ 0x0000, 0x0589, 0x0b12, 0x0e9b, 0x1624, 0x13ad, 0x1d36, 0x18bf,
+ 0x2c48, 0x29c1, 0x275a, 0x22d3, 0x3a6c, 0x3fe5, 0x317e, 0x34f7,
+ 0x5890, 0x5d19, 0x5382, 0x560b, 0x4eb4, 0x4b3d, 0x45a6, 0x402f,
+ 0x74d8, 0x7151, 0x7fca, 0x7a43, 0x62fc, 0x6775, 0x69ee, 0x6c67,
+ 0xb120, 0xb4a9, 0xba32, 0xbfbb, 0xa704, 0xa28d, 0xac16, 0xa99f,
+ 0x9d68, 0x98e1, 0x967a, 0x93f3, 0x8b4c, 0x8ec5, 0x805e, 0x85d7,
+ 0xe9b0, 0xec39, 0xe2a2, 0xe72b, 0xff94, 0xfa1d, 0xf486, 0xf10f,
+ 0xc5f8, 0xc071, 0xceea, 0xcb63, 0xd3dc, 0xd655, 0xd8ce, 0xdd47,
+ 0x67c9, 0x6240, 0x6cdb, 0x6952, 0x71ed, 0x7464, 0x7aff, 0x7f76,
+ 0x4b81, 0x4e08, 0x4093, 0x451a, 0x5da5, 0x582c, 0x56b7, 0x533e,
+ 0x3f59, 0x3ad0, 0x344b, 0x31c2, 0x297d, 0x2cf4, 0x226f, 0x27e6,
+ 0x1311, 0x1698, 0x1803, 0x1d8a, 0x0535, 0x00bc, 0x0e27, 0x0bae,
+ 0xd6e9, 0xd360, 0xddfb, 0xd872, 0xc0cd, 0xc544, 0xcbdf, 0xce56,
+ 0xfaa1, 0xff28, 0xf1b3, 0xf43a, 0xec85, 0xe90c, 0xe797, 0xe21e,
+ 0x8e79, 0x8bf0, 0x856b, 0x80e2, 0x985d, 0x9dd4, 0x934f, 0x96c6,
+ 0xa231, 0xa7b8, 0xa923, 0xacaa, 0xb415, 0xb19c, 0xbf07, 0xba8e,
+ 0xcf92, 0xca1b, 0xc480, 0xc109, 0xd9b6, 0xdc3f, 0xd2a4, 0xd72d,
+ 0xe3da, 0xe653, 0xe8c8, 0xed41, 0xf5fe, 0xf077, 0xfeec, 0xfb65,
+ 0x9702, 0x928b, 0x9c10, 0x9999, 0x8126, 0x84af, 0x8a34, 0x8fbd,
+ 0xbb4a, 0xbec3, 0xb058, 0xb5d1, 0xad6e, 0xa8e7, 0xa67c, 0xa3f5,
+ 0x7eb2, 0x7b3b, 0x75a0, 0x7029, 0x6896, 0x6d1f, 0x6384, 0x660d,
+ 0x52fa, 0x5773, 0x59e8, 0x5c61, 0x44de, 0x4157, 0x4fcc, 0x4a45,
+ 0x2622, 0x23ab, 0x2d30, 0x28b9, 0x3006, 0x358f, 0x3b14, 0x3e9d,
+ 0x0a6a, 0x0fe3, 0x0178, 0x04f1, 0x1c4e, 0x19c7, 0x175c, 0x12d5,
+ 0xa85b, 0xadd2, 0xa349, 0xa6c0, 0xbe7f, 0xbbf6, 0xb56d, 0xb0e4,
+ 0x8413, 0x819a, 0x8f01, 0x8a88, 0x9237, 0x97be, 0x9925, 0x9cac,
+ 0xf0cb, 0xf542, 0xfbd9, 0xfe50, 0xe6ef, 0xe366, 0xedfd, 0xe874,
+ 0xdc83, 0xd90a, 0xd791, 0xd218, 0xcaa7, 0xcf2e, 0xc1b5, 0xc43c,
+ 0x197b, 0x1cf2, 0x1269, 0x17e0, 0x0f5f, 0x0ad6, 0x044d, 0x01c4,
+ 0x3533, 0x30ba, 0x3e21, 0x3ba8, 0x2317, 0x269e, 0x2805, 0x2d8c,
+ 0x41eb, 0x4462, 0x4af9, 0x4f70, 0x57cf, 0x5246, 0x5cdd, 0x5954,
+ 0x6da3, 0x682a, 0x66b1, 0x6338, 0x7b87, 0x7e0e, 0x7095, 0x751c,
+ 0x0000, 0x9aad, 0x30d3, 0xaa7e, 0x61a6, 0xfb0b, 0x5175, 0xcbd8,
+ 0xc34c, 0x59e1, 0xf39f, 0x6932, 0xa2ea, 0x3847, 0x9239, 0x0894,
+ 0x8311, 0x19bc, 0xb3c2, 0x296f, 0xe2b7, 0x781a, 0xd264, 0x48c9,
+ 0x405d, 0xdaf0, 0x708e, 0xea23, 0x21fb, 0xbb56, 0x1128, 0x8b85,
+ 0x03ab, 0x9906, 0x3378, 0xa9d5, 0x620d, 0xf8a0, 0x52de, 0xc873,
+ 0xc0e7, 0x5a4a, 0xf034, 0x6a99, 0xa141, 0x3bec, 0x9192, 0x0b3f,
+ 0x80ba, 0x1a17, 0xb069, 0x2ac4, 0xe11c, 0x7bb1, 0xd1cf, 0x4b62,
+ 0x43f6, 0xd95b, 0x7325, 0xe988, 0x2250, 0xb8fd, 0x1283, 0x882e,
+ 0x0756, 0x9dfb, 0x3785, 0xad28, 0x66f0, 0xfc5d, 0x5623, 0xcc8e,
+ 0xc41a, 0x5eb7, 0xf4c9, 0x6e64, 0xa5bc, 0x3f11, 0x956f, 0x0fc2,
+ 0x8447, 0x1eea, 0xb494, 0x2e39, 0xe5e1, 0x7f4c, 0xd532, 0x4f9f,
+ 0x470b, 0xdda6, 0x77d8, 0xed75, 0x26ad, 0xbc00, 0x167e, 0x8cd3,
+ 0x04fd, 0x9e50, 0x342e, 0xae83, 0x655b, 0xfff6, 0x5588, 0xcf25,
+ 0xc7b1, 0x5d1c, 0xf762, 0x6dcf, 0xa617, 0x3cba, 0x96c4, 0x0c69,
+ 0x87ec, 0x1d41, 0xb73f, 0x2d92, 0xe64a, 0x7ce7, 0xd699, 0x4c34,
+ 0x44a0, 0xde0d, 0x7473, 0xeede, 0x2506, 0xbfab, 0x15d5, 0x8f78,
+ 0x0eac, 0x9401, 0x3e7f, 0xa4d2, 0x6f0a, 0xf5a7, 0x5fd9, 0xc574,
+ 0xcde0, 0x574d, 0xfd33, 0x679e, 0xac46, 0x36eb, 0x9c95, 0x0638,
+ 0x8dbd, 0x1710, 0xbd6e, 0x27c3, 0xec1b, 0x76b6, 0xdcc8, 0x4665,
+ 0x4ef1, 0xd45c, 0x7e22, 0xe48f, 0x2f57, 0xb5fa, 0x1f84, 0x8529,
+ 0x0d07, 0x97aa, 0x3dd4, 0xa779, 0x6ca1, 0xf60c, 0x5c72, 0xc6df,
+ 0xce4b, 0x54e6, 0xfe98, 0x6435, 0xafed, 0x3540, 0x9f3e, 0x0593,
+ 0x8e16, 0x14bb, 0xbec5, 0x2468, 0xefb0, 0x751d, 0xdf63, 0x45ce,
+ 0x4d5a, 0xd7f7, 0x7d89, 0xe724, 0x2cfc, 0xb651, 0x1c2f, 0x8682,
+ 0x09fa, 0x9357, 0x3929, 0xa384, 0x685c, 0xf2f1, 0x588f, 0xc222,
+ 0xcab6, 0x501b, 0xfa65, 0x60c8, 0xab10, 0x31bd, 0x9bc3, 0x016e,
+ 0x8aeb, 0x1046, 0xba38, 0x2095, 0xeb4d, 0x71e0, 0xdb9e, 0x4133,
+ 0x49a7, 0xd30a, 0x7974, 0xe3d9, 0x2801, 0xb2ac, 0x18d2, 0x827f,
+ 0x0a51, 0x90fc, 0x3a82, 0xa02f, 0x6bf7, 0xf15a, 0x5b24, 0xc189,
+ 0xc91d, 0x53b0, 0xf9ce, 0x6363, 0xa8bb, 0x3216, 0x9868, 0x02c5,
+ 0x8940, 0x13ed, 0xb993, 0x233e, 0xe8e6, 0x724b, 0xd835, 0x4298,
+ 0x4a0c, 0xd0a1, 0x7adf, 0xe072, 0x2baa, 0xb107, 0x1b79, 0x81d4,
+ 0x0000, 0x1d58, 0x3ab0, 0x27e8, 0x7560, 0x6838, 0x4fd0, 0x5288,
+ 0xeac0, 0xf798, 0xd070, 0xcd28, 0x9fa0, 0x82f8, 0xa510, 0xb848,
+ 0xd009, 0xcd51, 0xeab9, 0xf7e1, 0xa569, 0xb831, 0x9fd9, 0x8281,
+ 0x3ac9, 0x2791, 0x0079, 0x1d21, 0x4fa9, 0x52f1, 0x7519, 0x6841,
+ 0xa59b, 0xb8c3, 0x9f2b, 0x8273, 0xd0fb, 0xcda3, 0xea4b, 0xf713,
+ 0x4f5b, 0x5203, 0x75eb, 0x68b3, 0x3a3b, 0x2763, 0x008b, 0x1dd3,
+ 0x7592, 0x68ca, 0x4f22, 0x527a, 0x00f2, 0x1daa, 0x3a42, 0x271a,
+ 0x9f52, 0x820a, 0xa5e2, 0xb8ba, 0xea32, 0xf76a, 0xd082, 0xcdda,
+ 0x4ebf, 0x53e7, 0x740f, 0x6957, 0x3bdf, 0x2687, 0x016f, 0x1c37,
+ 0xa47f, 0xb927, 0x9ecf, 0x8397, 0xd11f, 0xcc47, 0xebaf, 0xf6f7,
+ 0x9eb6, 0x83ee, 0xa406, 0xb95e, 0xebd6, 0xf68e, 0xd166, 0xcc3e,
+ 0x7476, 0x692e, 0x4ec6, 0x539e, 0x0116, 0x1c4e, 0x3ba6, 0x26fe,
+ 0xeb24, 0xf67c, 0xd194, 0xcccc, 0x9e44, 0x831c, 0xa4f4, 0xb9ac,
+ 0x01e4, 0x1cbc, 0x3b54, 0x260c, 0x7484, 0x69dc, 0x4e34, 0x536c,
+ 0x3b2d, 0x2675, 0x019d, 0x1cc5, 0x4e4d, 0x5315, 0x74fd, 0x69a5,
+ 0xd1ed, 0xccb5, 0xeb5d, 0xf605, 0xa48d, 0xb9d5, 0x9e3d, 0x8365,
+ 0x9d7e, 0x8026, 0xa7ce, 0xba96, 0xe81e, 0xf546, 0xd2ae, 0xcff6,
+ 0x77be, 0x6ae6, 0x4d0e, 0x5056, 0x02de, 0x1f86, 0x386e, 0x2536,
+ 0x4d77, 0x502f, 0x77c7, 0x6a9f, 0x3817, 0x254f, 0x02a7, 0x1fff,
+ 0xa7b7, 0xbaef, 0x9d07, 0x805f, 0xd2d7, 0xcf8f, 0xe867, 0xf53f,
+ 0x38e5, 0x25bd, 0x0255, 0x1f0d, 0x4d85, 0x50dd, 0x7735, 0x6a6d,
+ 0xd225, 0xcf7d, 0xe895, 0xf5cd, 0xa745, 0xba1d, 0x9df5, 0x80ad,
+ 0xe8ec, 0xf5b4, 0xd25c, 0xcf04, 0x9d8c, 0x80d4, 0xa73c, 0xba64,
+ 0x022c, 0x1f74, 0x389c, 0x25c4, 0x774c, 0x6a14, 0x4dfc, 0x50a4,
+ 0xd3c1, 0xce99, 0xe971, 0xf429, 0xa6a1, 0xbbf9, 0x9c11, 0x8149,
+ 0x3901, 0x2459, 0x03b1, 0x1ee9, 0x4c61, 0x5139, 0x76d1, 0x6b89,
+ 0x03c8, 0x1e90, 0x3978, 0x2420, 0x76a8, 0x6bf0, 0x4c18, 0x5140,
+ 0xe908, 0xf450, 0xd3b8, 0xcee0, 0x9c68, 0x8130, 0xa6d8, 0xbb80,
+ 0x765a, 0x6b02, 0x4cea, 0x51b2, 0x033a, 0x1e62, 0x398a, 0x24d2,
+ 0x9c9a, 0x81c2, 0xa62a, 0xbb72, 0xe9fa, 0xf4a2, 0xd34a, 0xce12,
+ 0xa653, 0xbb0b, 0x9ce3, 0x81bb, 0xd333, 0xce6b, 0xe983, 0xf4db,
+ 0x4c93, 0x51cb, 0x7623, 0x6b7b, 0x39f3, 0x24ab, 0x0343, 0x1e1b,
+ 0x0000, 0x3f75, 0x7eea, 0x419f, 0xfdd4, 0xc2a1, 0x833e, 0xbc4b,
+ 0xfe21, 0xc154, 0x80cb, 0xbfbe, 0x03f5, 0x3c80, 0x7d1f, 0x426a,
+ 0xf9cb, 0xc6be, 0x8721, 0xb854, 0x041f, 0x3b6a, 0x7af5, 0x4580,
+ 0x07ea, 0x389f, 0x7900, 0x4675, 0xfa3e, 0xc54b, 0x84d4, 0xbba1,
+ 0xf61f, 0xc96a, 0x88f5, 0xb780, 0x0bcb, 0x34be, 0x7521, 0x4a54,
+ 0x083e, 0x374b, 0x76d4, 0x49a1, 0xf5ea, 0xca9f, 0x8b00, 0xb475,
+ 0x0fd4, 0x30a1, 0x713e, 0x4e4b, 0xf200, 0xcd75, 0x8cea, 0xb39f,
+ 0xf1f5, 0xce80, 0x8f1f, 0xb06a, 0x0c21, 0x3354, 0x72cb, 0x4dbe,
+ 0xe9b7, 0xd6c2, 0x975d, 0xa828, 0x1463, 0x2b16, 0x6a89, 0x55fc,
+ 0x1796, 0x28e3, 0x697c, 0x5609, 0xea42, 0xd537, 0x94a8, 0xabdd,
+ 0x107c, 0x2f09, 0x6e96, 0x51e3, 0xeda8, 0xd2dd, 0x9342, 0xac37,
+ 0xee5d, 0xd128, 0x90b7, 0xafc2, 0x1389, 0x2cfc, 0x6d63, 0x5216,
+ 0x1fa8, 0x20dd, 0x6142, 0x5e37, 0xe27c, 0xdd09, 0x9c96, 0xa3e3,
+ 0xe189, 0xdefc, 0x9f63, 0xa016, 0x1c5d, 0x2328, 0x62b7, 0x5dc2,
+ 0xe663, 0xd916, 0x9889, 0xa7fc, 0x1bb7, 0x24c2, 0x655d, 0x5a28,
+ 0x1842, 0x2737, 0x66a8, 0x59dd, 0xe596, 0xdae3, 0x9b7c, 0xa409,
+ 0xd6e7, 0xe992, 0xa80d, 0x9778, 0x2b33, 0x1446, 0x55d9, 0x6aac,
+ 0x28c6, 0x17b3, 0x562c, 0x6959, 0xd512, 0xea67, 0xabf8, 0x948d,
+ 0x2f2c, 0x1059, 0x51c6, 0x6eb3, 0xd2f8, 0xed8d, 0xac12, 0x9367,
+ 0xd10d, 0xee78, 0xafe7, 0x9092, 0x2cd9, 0x13ac, 0x5233, 0x6d46,
+ 0x20f8, 0x1f8d, 0x5e12, 0x6167, 0xdd2c, 0xe259, 0xa3c6, 0x9cb3,
+ 0xded9, 0xe1ac, 0xa033, 0x9f46, 0x230d, 0x1c78, 0x5de7, 0x6292,
+ 0xd933, 0xe646, 0xa7d9, 0x98ac, 0x24e7, 0x1b92, 0x5a0d, 0x6578,
+ 0x2712, 0x1867, 0x59f8, 0x668d, 0xdac6, 0xe5b3, 0xa42c, 0x9b59,
+ 0x3f50, 0x0025, 0x41ba, 0x7ecf, 0xc284, 0xfdf1, 0xbc6e, 0x831b,
+ 0xc171, 0xfe04, 0xbf9b, 0x80ee, 0x3ca5, 0x03d0, 0x424f, 0x7d3a,
+ 0xc69b, 0xf9ee, 0xb871, 0x8704, 0x3b4f, 0x043a, 0x45a5, 0x7ad0,
+ 0x38ba, 0x07cf, 0x4650, 0x7925, 0xc56e, 0xfa1b, 0xbb84, 0x84f1,
+ 0xc94f, 0xf63a, 0xb7a5, 0x88d0, 0x349b, 0x0bee, 0x4a71, 0x7504,
+ 0x376e, 0x081b, 0x4984, 0x76f1, 0xcaba, 0xf5cf, 0xb450, 0x8b25,
+ 0x3084, 0x0ff1, 0x4e6e, 0x711b, 0xcd50, 0xf225, 0xb3ba, 0x8ccf,
+ 0xcea5, 0xf1d0, 0xb04f, 0x8f3a, 0x3371, 0x0c04, 0x4d9b, 0x72ee,
+ 0x0000, 0xa847, 0x5507, 0xfd40, 0xaa0e, 0x0249, 0xff09, 0x574e,
+ 0x5195, 0xf9d2, 0x0492, 0xacd5, 0xfb9b, 0x53dc, 0xae9c, 0x06db,
+ 0xa32a, 0x0b6d, 0xf62d, 0x5e6a, 0x0924, 0xa163, 0x5c23, 0xf464,
+ 0xf2bf, 0x5af8, 0xa7b8, 0x0fff, 0x58b1, 0xf0f6, 0x0db6, 0xa5f1,
+ 0x43dd, 0xeb9a, 0x16da, 0xbe9d, 0xe9d3, 0x4194, 0xbcd4, 0x1493,
+ 0x1248, 0xba0f, 0x474f, 0xef08, 0xb846, 0x1001, 0xed41, 0x4506,
+ 0xe0f7, 0x48b0, 0xb5f0, 0x1db7, 0x4af9, 0xe2be, 0x1ffe, 0xb7b9,
+ 0xb162, 0x1925, 0xe465, 0x4c22, 0x1b6c, 0xb32b, 0x4e6b, 0xe62c,
+ 0x87ba, 0x2ffd, 0xd2bd, 0x7afa, 0x2db4, 0x85f3, 0x78b3, 0xd0f4,
+ 0xd62f, 0x7e68, 0x8328, 0x2b6f, 0x7c21, 0xd466, 0x2926, 0x8161,
+ 0x2490, 0x8cd7, 0x7197, 0xd9d0, 0x8e9e, 0x26d9, 0xdb99, 0x73de,
+ 0x7505, 0xdd42, 0x2002, 0x8845, 0xdf0b, 0x774c, 0x8a0c, 0x224b,
+ 0xc467, 0x6c20, 0x9160, 0x3927, 0x6e69, 0xc62e, 0x3b6e, 0x9329,
+ 0x95f2, 0x3db5, 0xc0f5, 0x68b2, 0x3ffc, 0x97bb, 0x6afb, 0xc2bc,
+ 0x674d, 0xcf0a, 0x324a, 0x9a0d, 0xcd43, 0x6504, 0x9844, 0x3003,
+ 0x36d8, 0x9e9f, 0x63df, 0xcb98, 0x9cd6, 0x3491, 0xc9d1, 0x6196,
+ 0x0afd, 0xa2ba, 0x5ffa, 0xf7bd, 0xa0f3, 0x08b4, 0xf5f4, 0x5db3,
+ 0x5b68, 0xf32f, 0x0e6f, 0xa628, 0xf166, 0x5921, 0xa461, 0x0c26,
+ 0xa9d7, 0x0190, 0xfcd0, 0x5497, 0x03d9, 0xab9e, 0x56de, 0xfe99,
+ 0xf842, 0x5005, 0xad45, 0x0502, 0x524c, 0xfa0b, 0x074b, 0xaf0c,
+ 0x4920, 0xe167, 0x1c27, 0xb460, 0xe32e, 0x4b69, 0xb629, 0x1e6e,
+ 0x18b5, 0xb0f2, 0x4db2, 0xe5f5, 0xb2bb, 0x1afc, 0xe7bc, 0x4ffb,
+ 0xea0a, 0x424d, 0xbf0d, 0x174a, 0x4004, 0xe843, 0x1503, 0xbd44,
+ 0xbb9f, 0x13d8, 0xee98, 0x46df, 0x1191, 0xb9d6, 0x4496, 0xecd1,
+ 0x8d47, 0x2500, 0xd840, 0x7007, 0x2749, 0x8f0e, 0x724e, 0xda09,
+ 0xdcd2, 0x7495, 0x89d5, 0x2192, 0x76dc, 0xde9b, 0x23db, 0x8b9c,
+ 0x2e6d, 0x862a, 0x7b6a, 0xd32d, 0x8463, 0x2c24, 0xd164, 0x7923,
+ 0x7ff8, 0xd7bf, 0x2aff, 0x82b8, 0xd5f6, 0x7db1, 0x80f1, 0x28b6,
+ 0xce9a, 0x66dd, 0x9b9d, 0x33da, 0x6494, 0xccd3, 0x3193, 0x99d4,
+ 0x9f0f, 0x3748, 0xca08, 0x624f, 0x3501, 0x9d46, 0x6006, 0xc841,
+ 0x6db0, 0xc5f7, 0x38b7, 0x90f0, 0xc7be, 0x6ff9, 0x92b9, 0x3afe,
+ 0x3c25, 0x9462, 0x6922, 0xc165, 0x962b, 0x3e6c, 0xc32c, 0x6b6b,
+ 0x0000, 0x15fa, 0x2bf4, 0x3e0e, 0x57e8, 0x4212, 0x7c1c, 0x69e6,
+ 0xafd0, 0xba2a, 0x8424, 0x91de, 0xf838, 0xedc2, 0xd3cc, 0xc636,
+ 0x5a29, 0x4fd3, 0x71dd, 0x6427, 0x0dc1, 0x183b, 0x2635, 0x33cf,
+ 0xf5f9, 0xe003, 0xde0d, 0xcbf7, 0xa211, 0xb7eb, 0x89e5, 0x9c1f,
+ 0xb452, 0xa1a8, 0x9fa6, 0x8a5c, 0xe3ba, 0xf640, 0xc84e, 0xddb4,
+ 0x1b82, 0x0e78, 0x3076, 0x258c, 0x4c6a, 0x5990, 0x679e, 0x7264,
+ 0xee7b, 0xfb81, 0xc58f, 0xd075, 0xb993, 0xac69, 0x9267, 0x879d,
+ 0x41ab, 0x5451, 0x6a5f, 0x7fa5, 0x1643, 0x03b9, 0x3db7, 0x284d,
+ 0x6d2d, 0x78d7, 0x46d9, 0x5323, 0x3ac5, 0x2f3f, 0x1131, 0x04cb,
+ 0xc2fd, 0xd707, 0xe909, 0xfcf3, 0x9515, 0x80ef, 0xbee1, 0xab1b,
+ 0x3704, 0x22fe, 0x1cf0, 0x090a, 0x60ec, 0x7516, 0x4b18, 0x5ee2,
+ 0x98d4, 0x8d2e, 0xb320, 0xa6da, 0xcf3c, 0xdac6, 0xe4c8, 0xf132,
+ 0xd97f, 0xcc85, 0xf28b, 0xe771, 0x8e97, 0x9b6d, 0xa563, 0xb099,
+ 0x76af, 0x6355, 0x5d5b, 0x48a1, 0x2147, 0x34bd, 0x0ab3, 0x1f49,
+ 0x8356, 0x96ac, 0xa8a2, 0xbd58, 0xd4be, 0xc144, 0xff4a, 0xeab0,
+ 0x2c86, 0x397c, 0x0772, 0x1288, 0x7b6e, 0x6e94, 0x509a, 0x4560,
+ 0xda5a, 0xcfa0, 0xf1ae, 0xe454, 0x8db2, 0x9848, 0xa646, 0xb3bc,
+ 0x758a, 0x6070, 0x5e7e, 0x4b84, 0x2262, 0x3798, 0x0996, 0x1c6c,
+ 0x8073, 0x9589, 0xab87, 0xbe7d, 0xd79b, 0xc261, 0xfc6f, 0xe995,
+ 0x2fa3, 0x3a59, 0x0457, 0x11ad, 0x784b, 0x6db1, 0x53bf, 0x4645,
+ 0x6e08, 0x7bf2, 0x45fc, 0x5006, 0x39e0, 0x2c1a, 0x1214, 0x07ee,
+ 0xc1d8, 0xd422, 0xea2c, 0xffd6, 0x9630, 0x83ca, 0xbdc4, 0xa83e,
+ 0x3421, 0x21db, 0x1fd5, 0x0a2f, 0x63c9, 0x7633, 0x483d, 0x5dc7,
+ 0x9bf1, 0x8e0b, 0xb005, 0xa5ff, 0xcc19, 0xd9e3, 0xe7ed, 0xf217,
+ 0xb777, 0xa28d, 0x9c83, 0x8979, 0xe09f, 0xf565, 0xcb6b, 0xde91,
+ 0x18a7, 0x0d5d, 0x3353, 0x26a9, 0x4f4f, 0x5ab5, 0x64bb, 0x7141,
+ 0xed5e, 0xf8a4, 0xc6aa, 0xd350, 0xbab6, 0xaf4c, 0x9142, 0x84b8,
+ 0x428e, 0x5774, 0x697a, 0x7c80, 0x1566, 0x009c, 0x3e92, 0x2b68,
+ 0x0325, 0x16df, 0x28d1, 0x3d2b, 0x54cd, 0x4137, 0x7f39, 0x6ac3,
+ 0xacf5, 0xb90f, 0x8701, 0x92fb, 0xfb1d, 0xeee7, 0xd0e9, 0xc513,
+ 0x590c, 0x4cf6, 0x72f8, 0x6702, 0x0ee4, 0x1b1e, 0x2510, 0x30ea,
+ 0xf6dc, 0xe326, 0xdd28, 0xc8d2, 0xa134, 0xb4ce, 0x8ac0, 0x9f3a,
+ 0x0000, 0xb13d, 0x67f3, 0xd6ce, 0xcfe6, 0x7edb, 0xa815, 0x1928,
+ 0x9a45, 0x2b78, 0xfdb6, 0x4c8b, 0x55a3, 0xe49e, 0x3250, 0x836d,
+ 0x3103, 0x803e, 0x56f0, 0xe7cd, 0xfee5, 0x4fd8, 0x9916, 0x282b,
+ 0xab46, 0x1a7b, 0xccb5, 0x7d88, 0x64a0, 0xd59d, 0x0353, 0xb26e,
+ 0x6206, 0xd33b, 0x05f5, 0xb4c8, 0xade0, 0x1cdd, 0xca13, 0x7b2e,
+ 0xf843, 0x497e, 0x9fb0, 0x2e8d, 0x37a5, 0x8698, 0x5056, 0xe16b,
+ 0x5305, 0xe238, 0x34f6, 0x85cb, 0x9ce3, 0x2dde, 0xfb10, 0x4a2d,
+ 0xc940, 0x787d, 0xaeb3, 0x1f8e, 0x06a6, 0xb79b, 0x6155, 0xd068,
+ 0xc40c, 0x7531, 0xa3ff, 0x12c2, 0x0bea, 0xbad7, 0x6c19, 0xdd24,
+ 0x5e49, 0xef74, 0x39ba, 0x8887, 0x91af, 0x2092, 0xf65c, 0x4761,
+ 0xf50f, 0x4432, 0x92fc, 0x23c1, 0x3ae9, 0x8bd4, 0x5d1a, 0xec27,
+ 0x6f4a, 0xde77, 0x08b9, 0xb984, 0xa0ac, 0x1191, 0xc75f, 0x7662,
+ 0xa60a, 0x1737, 0xc1f9, 0x70c4, 0x69ec, 0xd8d1, 0x0e1f, 0xbf22,
+ 0x3c4f, 0x8d72, 0x5bbc, 0xea81, 0xf3a9, 0x4294, 0x945a, 0x2567,
+ 0x9709, 0x2634, 0xf0fa, 0x41c7, 0x58ef, 0xe9d2, 0x3f1c, 0x8e21,
+ 0x0d4c, 0xbc71, 0x6abf, 0xdb82, 0xc2aa, 0x7397, 0xa559, 0x1464,
+ 0x8d91, 0x3cac, 0xea62, 0x5b5f, 0x4277, 0xf34a, 0x2584, 0x94b9,
+ 0x17d4, 0xa6e9, 0x7027, 0xc11a, 0xd832, 0x690f, 0xbfc1, 0x0efc,
+ 0xbc92, 0x0daf, 0xdb61, 0x6a5c, 0x7374, 0xc249, 0x1487, 0xa5ba,
+ 0x26d7, 0x97ea, 0x4124, 0xf019, 0xe931, 0x580c, 0x8ec2, 0x3fff,
+ 0xef97, 0x5eaa, 0x8864, 0x3959, 0x2071, 0x914c, 0x4782, 0xf6bf,
+ 0x75d2, 0xc4ef, 0x1221, 0xa31c, 0xba34, 0x0b09, 0xddc7, 0x6cfa,
+ 0xde94, 0x6fa9, 0xb967, 0x085a, 0x1172, 0xa04f, 0x7681, 0xc7bc,
+ 0x44d1, 0xf5ec, 0x2322, 0x921f, 0x8b37, 0x3a0a, 0xecc4, 0x5df9,
+ 0x499d, 0xf8a0, 0x2e6e, 0x9f53, 0x867b, 0x3746, 0xe188, 0x50b5,
+ 0xd3d8, 0x62e5, 0xb42b, 0x0516, 0x1c3e, 0xad03, 0x7bcd, 0xcaf0,
+ 0x789e, 0xc9a3, 0x1f6d, 0xae50, 0xb778, 0x0645, 0xd08b, 0x61b6,
+ 0xe2db, 0x53e6, 0x8528, 0x3415, 0x2d3d, 0x9c00, 0x4ace, 0xfbf3,
+ 0x2b9b, 0x9aa6, 0x4c68, 0xfd55, 0xe47d, 0x5540, 0x838e, 0x32b3,
+ 0xb1de, 0x00e3, 0xd62d, 0x6710, 0x7e38, 0xcf05, 0x19cb, 0xa8f6,
+ 0x1a98, 0xaba5, 0x7d6b, 0xcc56, 0xd57e, 0x6443, 0xb28d, 0x03b0,
+ 0x80dd, 0x31e0, 0xe72e, 0x5613, 0x4f3b, 0xfe06, 0x28c8, 0x99f5,
+ 0x0000, 0x1eab, 0x3d56, 0x23fd, 0x7aac, 0x6407, 0x47fa, 0x5951,
+ 0xf558, 0xebf3, 0xc80e, 0xd6a5, 0x8ff4, 0x915f, 0xb2a2, 0xac09,
+ 0xef39, 0xf192, 0xd26f, 0xccc4, 0x9595, 0x8b3e, 0xa8c3, 0xb668,
+ 0x1a61, 0x04ca, 0x2737, 0x399c, 0x60cd, 0x7e66, 0x5d9b, 0x4330,
+ 0xdbfb, 0xc550, 0xe6ad, 0xf806, 0xa157, 0xbffc, 0x9c01, 0x82aa,
+ 0x2ea3, 0x3008, 0x13f5, 0x0d5e, 0x540f, 0x4aa4, 0x6959, 0x77f2,
+ 0x34c2, 0x2a69, 0x0994, 0x173f, 0x4e6e, 0x50c5, 0x7338, 0x6d93,
+ 0xc19a, 0xdf31, 0xfccc, 0xe267, 0xbb36, 0xa59d, 0x8660, 0x98cb,
+ 0xb27f, 0xacd4, 0x8f29, 0x9182, 0xc8d3, 0xd678, 0xf585, 0xeb2e,
+ 0x4727, 0x598c, 0x7a71, 0x64da, 0x3d8b, 0x2320, 0x00dd, 0x1e76,
+ 0x5d46, 0x43ed, 0x6010, 0x7ebb, 0x27ea, 0x3941, 0x1abc, 0x0417,
+ 0xa81e, 0xb6b5, 0x9548, 0x8be3, 0xd2b2, 0xcc19, 0xefe4, 0xf14f,
+ 0x6984, 0x772f, 0x54d2, 0x4a79, 0x1328, 0x0d83, 0x2e7e, 0x30d5,
+ 0x9cdc, 0x8277, 0xa18a, 0xbf21, 0xe670, 0xf8db, 0xdb26, 0xc58d,
+ 0x86bd, 0x9816, 0xbbeb, 0xa540, 0xfc11, 0xe2ba, 0xc147, 0xdfec,
+ 0x73e5, 0x6d4e, 0x4eb3, 0x5018, 0x0949, 0x17e2, 0x341f, 0x2ab4,
+ 0x6177, 0x7fdc, 0x5c21, 0x428a, 0x1bdb, 0x0570, 0x268d, 0x3826,
+ 0x942f, 0x8a84, 0xa979, 0xb7d2, 0xee83, 0xf028, 0xd3d5, 0xcd7e,
+ 0x8e4e, 0x90e5, 0xb318, 0xadb3, 0xf4e2, 0xea49, 0xc9b4, 0xd71f,
+ 0x7b16, 0x65bd, 0x4640, 0x58eb, 0x01ba, 0x1f11, 0x3cec, 0x2247,
+ 0xba8c, 0xa427, 0x87da, 0x9971, 0xc020, 0xde8b, 0xfd76, 0xe3dd,
+ 0x4fd4, 0x517f, 0x7282, 0x6c29, 0x3578, 0x2bd3, 0x082e, 0x1685,
+ 0x55b5, 0x4b1e, 0x68e3, 0x7648, 0x2f19, 0x31b2, 0x124f, 0x0ce4,
+ 0xa0ed, 0xbe46, 0x9dbb, 0x8310, 0xda41, 0xc4ea, 0xe717, 0xf9bc,
+ 0xd308, 0xcda3, 0xee5e, 0xf0f5, 0xa9a4, 0xb70f, 0x94f2, 0x8a59,
+ 0x2650, 0x38fb, 0x1b06, 0x05ad, 0x5cfc, 0x4257, 0x61aa, 0x7f01,
+ 0x3c31, 0x229a, 0x0167, 0x1fcc, 0x469d, 0x5836, 0x7bcb, 0x6560,
+ 0xc969, 0xd7c2, 0xf43f, 0xea94, 0xb3c5, 0xad6e, 0x8e93, 0x9038,
+ 0x08f3, 0x1658, 0x35a5, 0x2b0e, 0x725f, 0x6cf4, 0x4f09, 0x51a2,
+ 0xfdab, 0xe300, 0xc0fd, 0xde56, 0x8707, 0x99ac, 0xba51, 0xa4fa,
+ 0xe7ca, 0xf961, 0xda9c, 0xc437, 0x9d66, 0x83cd, 0xa030, 0xbe9b,
+ 0x1292, 0x0c39, 0x2fc4, 0x316f, 0x683e, 0x7695, 0x5568, 0x4bc3,
+};
+
+const uint16_t crc16_1021_crc_table[CRC_SLICES * 256] = {
+ 0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+ 0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+ 0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6,
+ 0x9339, 0x8318, 0xb37b, 0xa35a, 0xd3bd, 0xc39c, 0xf3ff, 0xe3de,
+ 0x2462, 0x3443, 0x0420, 0x1401, 0x64e6, 0x74c7, 0x44a4, 0x5485,
+ 0xa56a, 0xb54b, 0x8528, 0x9509, 0xe5ee, 0xf5cf, 0xc5ac, 0xd58d,
+ 0x3653, 0x2672, 0x1611, 0x0630, 0x76d7, 0x66f6, 0x5695, 0x46b4,
+ 0xb75b, 0xa77a, 0x9719, 0x8738, 0xf7df, 0xe7fe, 0xd79d, 0xc7bc,
+ 0x48c4, 0x58e5, 0x6886, 0x78a7, 0x0840, 0x1861, 0x2802, 0x3823,
+ 0xc9cc, 0xd9ed, 0xe98e, 0xf9af, 0x8948, 0x9969, 0xa90a, 0xb92b,
+ 0x5af5, 0x4ad4, 0x7ab7, 0x6a96, 0x1a71, 0x0a50, 0x3a33, 0x2a12,
+ 0xdbfd, 0xcbdc, 0xfbbf, 0xeb9e, 0x9b79, 0x8b58, 0xbb3b, 0xab1a,
+ 0x6ca6, 0x7c87, 0x4ce4, 0x5cc5, 0x2c22, 0x3c03, 0x0c60, 0x1c41,
+ 0xedae, 0xfd8f, 0xcdec, 0xddcd, 0xad2a, 0xbd0b, 0x8d68, 0x9d49,
+ 0x7e97, 0x6eb6, 0x5ed5, 0x4ef4, 0x3e13, 0x2e32, 0x1e51, 0x0e70,
+ 0xff9f, 0xefbe, 0xdfdd, 0xcffc, 0xbf1b, 0xaf3a, 0x9f59, 0x8f78,
+ 0x9188, 0x81a9, 0xb1ca, 0xa1eb, 0xd10c, 0xc12d, 0xf14e, 0xe16f,
+ 0x1080, 0x00a1, 0x30c2, 0x20e3, 0x5004, 0x4025, 0x7046, 0x6067,
+ 0x83b9, 0x9398, 0xa3fb, 0xb3da, 0xc33d, 0xd31c, 0xe37f, 0xf35e,
+ 0x02b1, 0x1290, 0x22f3, 0x32d2, 0x4235, 0x5214, 0x6277, 0x7256,
+ 0xb5ea, 0xa5cb, 0x95a8, 0x8589, 0xf56e, 0xe54f, 0xd52c, 0xc50d,
+ 0x34e2, 0x24c3, 0x14a0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+ 0xa7db, 0xb7fa, 0x8799, 0x97b8, 0xe75f, 0xf77e, 0xc71d, 0xd73c,
+ 0x26d3, 0x36f2, 0x0691, 0x16b0, 0x6657, 0x7676, 0x4615, 0x5634,
+ 0xd94c, 0xc96d, 0xf90e, 0xe92f, 0x99c8, 0x89e9, 0xb98a, 0xa9ab,
+ 0x5844, 0x4865, 0x7806, 0x6827, 0x18c0, 0x08e1, 0x3882, 0x28a3,
+ 0xcb7d, 0xdb5c, 0xeb3f, 0xfb1e, 0x8bf9, 0x9bd8, 0xabbb, 0xbb9a,
+ 0x4a75, 0x5a54, 0x6a37, 0x7a16, 0x0af1, 0x1ad0, 0x2ab3, 0x3a92,
+ 0xfd2e, 0xed0f, 0xdd6c, 0xcd4d, 0xbdaa, 0xad8b, 0x9de8, 0x8dc9,
+ 0x7c26, 0x6c07, 0x5c64, 0x4c45, 0x3ca2, 0x2c83, 0x1ce0, 0x0cc1,
+ 0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8,
+ 0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0,
+ 0x0000, 0x3331, 0x6662, 0x5553, 0xccc4, 0xfff5, 0xaaa6, 0x9997,
+ 0x89a9, 0xba98, 0xefcb, 0xdcfa, 0x456d, 0x765c, 0x230f, 0x103e,
+ 0x0373, 0x3042, 0x6511, 0x5620, 0xcfb7, 0xfc86, 0xa9d5, 0x9ae4,
+ 0x8ada, 0xb9eb, 0xecb8, 0xdf89, 0x461e, 0x752f, 0x207c, 0x134d,
+ 0x06e6, 0x35d7, 0x6084, 0x53b5, 0xca22, 0xf913, 0xac40, 0x9f71,
+ 0x8f4f, 0xbc7e, 0xe92d, 0xda1c, 0x438b, 0x70ba, 0x25e9, 0x16d8,
+ 0x0595, 0x36a4, 0x63f7, 0x50c6, 0xc951, 0xfa60, 0xaf33, 0x9c02,
+ 0x8c3c, 0xbf0d, 0xea5e, 0xd96f, 0x40f8, 0x73c9, 0x269a, 0x15ab,
+ 0x0dcc, 0x3efd, 0x6bae, 0x589f, 0xc108, 0xf239, 0xa76a, 0x945b,
+ 0x8465, 0xb754, 0xe207, 0xd136, 0x48a1, 0x7b90, 0x2ec3, 0x1df2,
+ 0x0ebf, 0x3d8e, 0x68dd, 0x5bec, 0xc27b, 0xf14a, 0xa419, 0x9728,
+ 0x8716, 0xb427, 0xe174, 0xd245, 0x4bd2, 0x78e3, 0x2db0, 0x1e81,
+ 0x0b2a, 0x381b, 0x6d48, 0x5e79, 0xc7ee, 0xf4df, 0xa18c, 0x92bd,
+ 0x8283, 0xb1b2, 0xe4e1, 0xd7d0, 0x4e47, 0x7d76, 0x2825, 0x1b14,
+ 0x0859, 0x3b68, 0x6e3b, 0x5d0a, 0xc49d, 0xf7ac, 0xa2ff, 0x91ce,
+ 0x81f0, 0xb2c1, 0xe792, 0xd4a3, 0x4d34, 0x7e05, 0x2b56, 0x1867,
+ 0x1b98, 0x28a9, 0x7dfa, 0x4ecb, 0xd75c, 0xe46d, 0xb13e, 0x820f,
+ 0x9231, 0xa100, 0xf453, 0xc762, 0x5ef5, 0x6dc4, 0x3897, 0x0ba6,
+ 0x18eb, 0x2bda, 0x7e89, 0x4db8, 0xd42f, 0xe71e, 0xb24d, 0x817c,
+ 0x9142, 0xa273, 0xf720, 0xc411, 0x5d86, 0x6eb7, 0x3be4, 0x08d5,
+ 0x1d7e, 0x2e4f, 0x7b1c, 0x482d, 0xd1ba, 0xe28b, 0xb7d8, 0x84e9,
+ 0x94d7, 0xa7e6, 0xf2b5, 0xc184, 0x5813, 0x6b22, 0x3e71, 0x0d40,
+ 0x1e0d, 0x2d3c, 0x786f, 0x4b5e, 0xd2c9, 0xe1f8, 0xb4ab, 0x879a,
+ 0x97a4, 0xa495, 0xf1c6, 0xc2f7, 0x5b60, 0x6851, 0x3d02, 0x0e33,
+ 0x1654, 0x2565, 0x7036, 0x4307, 0xda90, 0xe9a1, 0xbcf2, 0x8fc3,
+ 0x9ffd, 0xaccc, 0xf99f, 0xcaae, 0x5339, 0x6008, 0x355b, 0x066a,
+ 0x1527, 0x2616, 0x7345, 0x4074, 0xd9e3, 0xead2, 0xbf81, 0x8cb0,
+ 0x9c8e, 0xafbf, 0xfaec, 0xc9dd, 0x504a, 0x637b, 0x3628, 0x0519,
+ 0x10b2, 0x2383, 0x76d0, 0x45e1, 0xdc76, 0xef47, 0xba14, 0x8925,
+ 0x991b, 0xaa2a, 0xff79, 0xcc48, 0x55df, 0x66ee, 0x33bd, 0x008c,
+ 0x13c1, 0x20f0, 0x75a3, 0x4692, 0xdf05, 0xec34, 0xb967, 0x8a56,
+ 0x9a68, 0xa959, 0xfc0a, 0xcf3b, 0x56ac, 0x659d, 0x30ce, 0x03ff,
+ 0x0000, 0x3730, 0x6e60, 0x5950, 0xdcc0, 0xebf0, 0xb2a0, 0x8590,
+ 0xa9a1, 0x9e91, 0xc7c1, 0xf0f1, 0x7561, 0x4251, 0x1b01, 0x2c31,
+ 0x4363, 0x7453, 0x2d03, 0x1a33, 0x9fa3, 0xa893, 0xf1c3, 0xc6f3,
+ 0xeac2, 0xddf2, 0x84a2, 0xb392, 0x3602, 0x0132, 0x5862, 0x6f52,
+ 0x86c6, 0xb1f6, 0xe8a6, 0xdf96, 0x5a06, 0x6d36, 0x3466, 0x0356,
+ 0x2f67, 0x1857, 0x4107, 0x7637, 0xf3a7, 0xc497, 0x9dc7, 0xaaf7,
+ 0xc5a5, 0xf295, 0xabc5, 0x9cf5, 0x1965, 0x2e55, 0x7705, 0x4035,
+ 0x6c04, 0x5b34, 0x0264, 0x3554, 0xb0c4, 0x87f4, 0xdea4, 0xe994,
+ 0x1dad, 0x2a9d, 0x73cd, 0x44fd, 0xc16d, 0xf65d, 0xaf0d, 0x983d,
+ 0xb40c, 0x833c, 0xda6c, 0xed5c, 0x68cc, 0x5ffc, 0x06ac, 0x319c,
+ 0x5ece, 0x69fe, 0x30ae, 0x079e, 0x820e, 0xb53e, 0xec6e, 0xdb5e,
+ 0xf76f, 0xc05f, 0x990f, 0xae3f, 0x2baf, 0x1c9f, 0x45cf, 0x72ff,
+ 0x9b6b, 0xac5b, 0xf50b, 0xc23b, 0x47ab, 0x709b, 0x29cb, 0x1efb,
+ 0x32ca, 0x05fa, 0x5caa, 0x6b9a, 0xee0a, 0xd93a, 0x806a, 0xb75a,
+ 0xd808, 0xef38, 0xb668, 0x8158, 0x04c8, 0x33f8, 0x6aa8, 0x5d98,
+ 0x71a9, 0x4699, 0x1fc9, 0x28f9, 0xad69, 0x9a59, 0xc309, 0xf439,
+ 0x3b5a, 0x0c6a, 0x553a, 0x620a, 0xe79a, 0xd0aa, 0x89fa, 0xbeca,
+ 0x92fb, 0xa5cb, 0xfc9b, 0xcbab, 0x4e3b, 0x790b, 0x205b, 0x176b,
+ 0x7839, 0x4f09, 0x1659, 0x2169, 0xa4f9, 0x93c9, 0xca99, 0xfda9,
+ 0xd198, 0xe6a8, 0xbff8, 0x88c8, 0x0d58, 0x3a68, 0x6338, 0x5408,
+ 0xbd9c, 0x8aac, 0xd3fc, 0xe4cc, 0x615c, 0x566c, 0x0f3c, 0x380c,
+ 0x143d, 0x230d, 0x7a5d, 0x4d6d, 0xc8fd, 0xffcd, 0xa69d, 0x91ad,
+ 0xfeff, 0xc9cf, 0x909f, 0xa7af, 0x223f, 0x150f, 0x4c5f, 0x7b6f,
+ 0x575e, 0x606e, 0x393e, 0x0e0e, 0x8b9e, 0xbcae, 0xe5fe, 0xd2ce,
+ 0x26f7, 0x11c7, 0x4897, 0x7fa7, 0xfa37, 0xcd07, 0x9457, 0xa367,
+ 0x8f56, 0xb866, 0xe136, 0xd606, 0x5396, 0x64a6, 0x3df6, 0x0ac6,
+ 0x6594, 0x52a4, 0x0bf4, 0x3cc4, 0xb954, 0x8e64, 0xd734, 0xe004,
+ 0xcc35, 0xfb05, 0xa255, 0x9565, 0x10f5, 0x27c5, 0x7e95, 0x49a5,
+ 0xa031, 0x9701, 0xce51, 0xf961, 0x7cf1, 0x4bc1, 0x1291, 0x25a1,
+ 0x0990, 0x3ea0, 0x67f0, 0x50c0, 0xd550, 0xe260, 0xbb30, 0x8c00,
+ 0xe352, 0xd462, 0x8d32, 0xba02, 0x3f92, 0x08a2, 0x51f2, 0x66c2,
+ 0x4af3, 0x7dc3, 0x2493, 0x13a3, 0x9633, 0xa103, 0xf853, 0xcf63,
+ 0x0000, 0x76b4, 0xed68, 0x9bdc, 0xcaf1, 0xbc45, 0x2799, 0x512d,
+ 0x85c3, 0xf377, 0x68ab, 0x1e1f, 0x4f32, 0x3986, 0xa25a, 0xd4ee,
+ 0x1ba7, 0x6d13, 0xf6cf, 0x807b, 0xd156, 0xa7e2, 0x3c3e, 0x4a8a,
+ 0x9e64, 0xe8d0, 0x730c, 0x05b8, 0x5495, 0x2221, 0xb9fd, 0xcf49,
+ 0x374e, 0x41fa, 0xda26, 0xac92, 0xfdbf, 0x8b0b, 0x10d7, 0x6663,
+ 0xb28d, 0xc439, 0x5fe5, 0x2951, 0x787c, 0x0ec8, 0x9514, 0xe3a0,
+ 0x2ce9, 0x5a5d, 0xc181, 0xb735, 0xe618, 0x90ac, 0x0b70, 0x7dc4,
+ 0xa92a, 0xdf9e, 0x4442, 0x32f6, 0x63db, 0x156f, 0x8eb3, 0xf807,
+ 0x6e9c, 0x1828, 0x83f4, 0xf540, 0xa46d, 0xd2d9, 0x4905, 0x3fb1,
+ 0xeb5f, 0x9deb, 0x0637, 0x7083, 0x21ae, 0x571a, 0xccc6, 0xba72,
+ 0x753b, 0x038f, 0x9853, 0xeee7, 0xbfca, 0xc97e, 0x52a2, 0x2416,
+ 0xf0f8, 0x864c, 0x1d90, 0x6b24, 0x3a09, 0x4cbd, 0xd761, 0xa1d5,
+ 0x59d2, 0x2f66, 0xb4ba, 0xc20e, 0x9323, 0xe597, 0x7e4b, 0x08ff,
+ 0xdc11, 0xaaa5, 0x3179, 0x47cd, 0x16e0, 0x6054, 0xfb88, 0x8d3c,
+ 0x4275, 0x34c1, 0xaf1d, 0xd9a9, 0x8884, 0xfe30, 0x65ec, 0x1358,
+ 0xc7b6, 0xb102, 0x2ade, 0x5c6a, 0x0d47, 0x7bf3, 0xe02f, 0x969b,
+ 0xdd38, 0xab8c, 0x3050, 0x46e4, 0x17c9, 0x617d, 0xfaa1, 0x8c15,
+ 0x58fb, 0x2e4f, 0xb593, 0xc327, 0x920a, 0xe4be, 0x7f62, 0x09d6,
+ 0xc69f, 0xb02b, 0x2bf7, 0x5d43, 0x0c6e, 0x7ada, 0xe106, 0x97b2,
+ 0x435c, 0x35e8, 0xae34, 0xd880, 0x89ad, 0xff19, 0x64c5, 0x1271,
+ 0xea76, 0x9cc2, 0x071e, 0x71aa, 0x2087, 0x5633, 0xcdef, 0xbb5b,
+ 0x6fb5, 0x1901, 0x82dd, 0xf469, 0xa544, 0xd3f0, 0x482c, 0x3e98,
+ 0xf1d1, 0x8765, 0x1cb9, 0x6a0d, 0x3b20, 0x4d94, 0xd648, 0xa0fc,
+ 0x7412, 0x02a6, 0x997a, 0xefce, 0xbee3, 0xc857, 0x538b, 0x253f,
+ 0xb3a4, 0xc510, 0x5ecc, 0x2878, 0x7955, 0x0fe1, 0x943d, 0xe289,
+ 0x3667, 0x40d3, 0xdb0f, 0xadbb, 0xfc96, 0x8a22, 0x11fe, 0x674a,
+ 0xa803, 0xdeb7, 0x456b, 0x33df, 0x62f2, 0x1446, 0x8f9a, 0xf92e,
+ 0x2dc0, 0x5b74, 0xc0a8, 0xb61c, 0xe731, 0x9185, 0x0a59, 0x7ced,
+ 0x84ea, 0xf25e, 0x6982, 0x1f36, 0x4e1b, 0x38af, 0xa373, 0xd5c7,
+ 0x0129, 0x779d, 0xec41, 0x9af5, 0xcbd8, 0xbd6c, 0x26b0, 0x5004,
+ 0x9f4d, 0xe9f9, 0x7225, 0x0491, 0x55bc, 0x2308, 0xb8d4, 0xce60,
+ 0x1a8e, 0x6c3a, 0xf7e6, 0x8152, 0xd07f, 0xa6cb, 0x3d17, 0x4ba3,
+ 0x0000, 0xaa51, 0x4483, 0xeed2, 0x8906, 0x2357, 0xcd85, 0x67d4,
+ 0x022d, 0xa87c, 0x46ae, 0xecff, 0x8b2b, 0x217a, 0xcfa8, 0x65f9,
+ 0x045a, 0xae0b, 0x40d9, 0xea88, 0x8d5c, 0x270d, 0xc9df, 0x638e,
+ 0x0677, 0xac26, 0x42f4, 0xe8a5, 0x8f71, 0x2520, 0xcbf2, 0x61a3,
+ 0x08b4, 0xa2e5, 0x4c37, 0xe666, 0x81b2, 0x2be3, 0xc531, 0x6f60,
+ 0x0a99, 0xa0c8, 0x4e1a, 0xe44b, 0x839f, 0x29ce, 0xc71c, 0x6d4d,
+ 0x0cee, 0xa6bf, 0x486d, 0xe23c, 0x85e8, 0x2fb9, 0xc16b, 0x6b3a,
+ 0x0ec3, 0xa492, 0x4a40, 0xe011, 0x87c5, 0x2d94, 0xc346, 0x6917,
+ 0x1168, 0xbb39, 0x55eb, 0xffba, 0x986e, 0x323f, 0xdced, 0x76bc,
+ 0x1345, 0xb914, 0x57c6, 0xfd97, 0x9a43, 0x3012, 0xdec0, 0x7491,
+ 0x1532, 0xbf63, 0x51b1, 0xfbe0, 0x9c34, 0x3665, 0xd8b7, 0x72e6,
+ 0x171f, 0xbd4e, 0x539c, 0xf9cd, 0x9e19, 0x3448, 0xda9a, 0x70cb,
+ 0x19dc, 0xb38d, 0x5d5f, 0xf70e, 0x90da, 0x3a8b, 0xd459, 0x7e08,
+ 0x1bf1, 0xb1a0, 0x5f72, 0xf523, 0x92f7, 0x38a6, 0xd674, 0x7c25,
+ 0x1d86, 0xb7d7, 0x5905, 0xf354, 0x9480, 0x3ed1, 0xd003, 0x7a52,
+ 0x1fab, 0xb5fa, 0x5b28, 0xf179, 0x96ad, 0x3cfc, 0xd22e, 0x787f,
+ 0x22d0, 0x8881, 0x6653, 0xcc02, 0xabd6, 0x0187, 0xef55, 0x4504,
+ 0x20fd, 0x8aac, 0x647e, 0xce2f, 0xa9fb, 0x03aa, 0xed78, 0x4729,
+ 0x268a, 0x8cdb, 0x6209, 0xc858, 0xaf8c, 0x05dd, 0xeb0f, 0x415e,
+ 0x24a7, 0x8ef6, 0x6024, 0xca75, 0xada1, 0x07f0, 0xe922, 0x4373,
+ 0x2a64, 0x8035, 0x6ee7, 0xc4b6, 0xa362, 0x0933, 0xe7e1, 0x4db0,
+ 0x2849, 0x8218, 0x6cca, 0xc69b, 0xa14f, 0x0b1e, 0xe5cc, 0x4f9d,
+ 0x2e3e, 0x846f, 0x6abd, 0xc0ec, 0xa738, 0x0d69, 0xe3bb, 0x49ea,
+ 0x2c13, 0x8642, 0x6890, 0xc2c1, 0xa515, 0x0f44, 0xe196, 0x4bc7,
+ 0x33b8, 0x99e9, 0x773b, 0xdd6a, 0xbabe, 0x10ef, 0xfe3d, 0x546c,
+ 0x3195, 0x9bc4, 0x7516, 0xdf47, 0xb893, 0x12c2, 0xfc10, 0x5641,
+ 0x37e2, 0x9db3, 0x7361, 0xd930, 0xbee4, 0x14b5, 0xfa67, 0x5036,
+ 0x35cf, 0x9f9e, 0x714c, 0xdb1d, 0xbcc9, 0x1698, 0xf84a, 0x521b,
+ 0x3b0c, 0x915d, 0x7f8f, 0xd5de, 0xb20a, 0x185b, 0xf689, 0x5cd8,
+ 0x3921, 0x9370, 0x7da2, 0xd7f3, 0xb027, 0x1a76, 0xf4a4, 0x5ef5,
+ 0x3f56, 0x9507, 0x7bd5, 0xd184, 0xb650, 0x1c01, 0xf2d3, 0x5882,
+ 0x3d7b, 0x972a, 0x79f8, 0xd3a9, 0xb47d, 0x1e2c, 0xf0fe, 0x5aaf,
+ 0x0000, 0x45a0, 0x8b40, 0xcee0, 0x06a1, 0x4301, 0x8de1, 0xc841,
+ 0x0d42, 0x48e2, 0x8602, 0xc3a2, 0x0be3, 0x4e43, 0x80a3, 0xc503,
+ 0x1a84, 0x5f24, 0x91c4, 0xd464, 0x1c25, 0x5985, 0x9765, 0xd2c5,
+ 0x17c6, 0x5266, 0x9c86, 0xd926, 0x1167, 0x54c7, 0x9a27, 0xdf87,
+ 0x3508, 0x70a8, 0xbe48, 0xfbe8, 0x33a9, 0x7609, 0xb8e9, 0xfd49,
+ 0x384a, 0x7dea, 0xb30a, 0xf6aa, 0x3eeb, 0x7b4b, 0xb5ab, 0xf00b,
+ 0x2f8c, 0x6a2c, 0xa4cc, 0xe16c, 0x292d, 0x6c8d, 0xa26d, 0xe7cd,
+ 0x22ce, 0x676e, 0xa98e, 0xec2e, 0x246f, 0x61cf, 0xaf2f, 0xea8f,
+ 0x6a10, 0x2fb0, 0xe150, 0xa4f0, 0x6cb1, 0x2911, 0xe7f1, 0xa251,
+ 0x6752, 0x22f2, 0xec12, 0xa9b2, 0x61f3, 0x2453, 0xeab3, 0xaf13,
+ 0x7094, 0x3534, 0xfbd4, 0xbe74, 0x7635, 0x3395, 0xfd75, 0xb8d5,
+ 0x7dd6, 0x3876, 0xf696, 0xb336, 0x7b77, 0x3ed7, 0xf037, 0xb597,
+ 0x5f18, 0x1ab8, 0xd458, 0x91f8, 0x59b9, 0x1c19, 0xd2f9, 0x9759,
+ 0x525a, 0x17fa, 0xd91a, 0x9cba, 0x54fb, 0x115b, 0xdfbb, 0x9a1b,
+ 0x459c, 0x003c, 0xcedc, 0x8b7c, 0x433d, 0x069d, 0xc87d, 0x8ddd,
+ 0x48de, 0x0d7e, 0xc39e, 0x863e, 0x4e7f, 0x0bdf, 0xc53f, 0x809f,
+ 0xd420, 0x9180, 0x5f60, 0x1ac0, 0xd281, 0x9721, 0x59c1, 0x1c61,
+ 0xd962, 0x9cc2, 0x5222, 0x1782, 0xdfc3, 0x9a63, 0x5483, 0x1123,
+ 0xcea4, 0x8b04, 0x45e4, 0x0044, 0xc805, 0x8da5, 0x4345, 0x06e5,
+ 0xc3e6, 0x8646, 0x48a6, 0x0d06, 0xc547, 0x80e7, 0x4e07, 0x0ba7,
+ 0xe128, 0xa488, 0x6a68, 0x2fc8, 0xe789, 0xa229, 0x6cc9, 0x2969,
+ 0xec6a, 0xa9ca, 0x672a, 0x228a, 0xeacb, 0xaf6b, 0x618b, 0x242b,
+ 0xfbac, 0xbe0c, 0x70ec, 0x354c, 0xfd0d, 0xb8ad, 0x764d, 0x33ed,
+ 0xf6ee, 0xb34e, 0x7dae, 0x380e, 0xf04f, 0xb5ef, 0x7b0f, 0x3eaf,
+ 0xbe30, 0xfb90, 0x3570, 0x70d0, 0xb891, 0xfd31, 0x33d1, 0x7671,
+ 0xb372, 0xf6d2, 0x3832, 0x7d92, 0xb5d3, 0xf073, 0x3e93, 0x7b33,
+ 0xa4b4, 0xe114, 0x2ff4, 0x6a54, 0xa215, 0xe7b5, 0x2955, 0x6cf5,
+ 0xa9f6, 0xec56, 0x22b6, 0x6716, 0xaf57, 0xeaf7, 0x2417, 0x61b7,
+ 0x8b38, 0xce98, 0x0078, 0x45d8, 0x8d99, 0xc839, 0x06d9, 0x4379,
+ 0x867a, 0xc3da, 0x0d3a, 0x489a, 0x80db, 0xc57b, 0x0b9b, 0x4e3b,
+ 0x91bc, 0xd41c, 0x1afc, 0x5f5c, 0x971d, 0xd2bd, 0x1c5d, 0x59fd,
+ 0x9cfe, 0xd95e, 0x17be, 0x521e, 0x9a5f, 0xdfff, 0x111f, 0x54bf,
+ 0x0000, 0xb861, 0x60e3, 0xd882, 0xc1c6, 0x79a7, 0xa125, 0x1944,
+ 0x93ad, 0x2bcc, 0xf34e, 0x4b2f, 0x526b, 0xea0a, 0x3288, 0x8ae9,
+ 0x377b, 0x8f1a, 0x5798, 0xeff9, 0xf6bd, 0x4edc, 0x965e, 0x2e3f,
+ 0xa4d6, 0x1cb7, 0xc435, 0x7c54, 0x6510, 0xdd71, 0x05f3, 0xbd92,
+ 0x6ef6, 0xd697, 0x0e15, 0xb674, 0xaf30, 0x1751, 0xcfd3, 0x77b2,
+ 0xfd5b, 0x453a, 0x9db8, 0x25d9, 0x3c9d, 0x84fc, 0x5c7e, 0xe41f,
+ 0x598d, 0xe1ec, 0x396e, 0x810f, 0x984b, 0x202a, 0xf8a8, 0x40c9,
+ 0xca20, 0x7241, 0xaac3, 0x12a2, 0x0be6, 0xb387, 0x6b05, 0xd364,
+ 0xddec, 0x658d, 0xbd0f, 0x056e, 0x1c2a, 0xa44b, 0x7cc9, 0xc4a8,
+ 0x4e41, 0xf620, 0x2ea2, 0x96c3, 0x8f87, 0x37e6, 0xef64, 0x5705,
+ 0xea97, 0x52f6, 0x8a74, 0x3215, 0x2b51, 0x9330, 0x4bb2, 0xf3d3,
+ 0x793a, 0xc15b, 0x19d9, 0xa1b8, 0xb8fc, 0x009d, 0xd81f, 0x607e,
+ 0xb31a, 0x0b7b, 0xd3f9, 0x6b98, 0x72dc, 0xcabd, 0x123f, 0xaa5e,
+ 0x20b7, 0x98d6, 0x4054, 0xf835, 0xe171, 0x5910, 0x8192, 0x39f3,
+ 0x8461, 0x3c00, 0xe482, 0x5ce3, 0x45a7, 0xfdc6, 0x2544, 0x9d25,
+ 0x17cc, 0xafad, 0x772f, 0xcf4e, 0xd60a, 0x6e6b, 0xb6e9, 0x0e88,
+ 0xabf9, 0x1398, 0xcb1a, 0x737b, 0x6a3f, 0xd25e, 0x0adc, 0xb2bd,
+ 0x3854, 0x8035, 0x58b7, 0xe0d6, 0xf992, 0x41f3, 0x9971, 0x2110,
+ 0x9c82, 0x24e3, 0xfc61, 0x4400, 0x5d44, 0xe525, 0x3da7, 0x85c6,
+ 0x0f2f, 0xb74e, 0x6fcc, 0xd7ad, 0xcee9, 0x7688, 0xae0a, 0x166b,
+ 0xc50f, 0x7d6e, 0xa5ec, 0x1d8d, 0x04c9, 0xbca8, 0x642a, 0xdc4b,
+ 0x56a2, 0xeec3, 0x3641, 0x8e20, 0x9764, 0x2f05, 0xf787, 0x4fe6,
+ 0xf274, 0x4a15, 0x9297, 0x2af6, 0x33b2, 0x8bd3, 0x5351, 0xeb30,
+ 0x61d9, 0xd9b8, 0x013a, 0xb95b, 0xa01f, 0x187e, 0xc0fc, 0x789d,
+ 0x7615, 0xce74, 0x16f6, 0xae97, 0xb7d3, 0x0fb2, 0xd730, 0x6f51,
+ 0xe5b8, 0x5dd9, 0x855b, 0x3d3a, 0x247e, 0x9c1f, 0x449d, 0xfcfc,
+ 0x416e, 0xf90f, 0x218d, 0x99ec, 0x80a8, 0x38c9, 0xe04b, 0x582a,
+ 0xd2c3, 0x6aa2, 0xb220, 0x0a41, 0x1305, 0xab64, 0x73e6, 0xcb87,
+ 0x18e3, 0xa082, 0x7800, 0xc061, 0xd925, 0x6144, 0xb9c6, 0x01a7,
+ 0x8b4e, 0x332f, 0xebad, 0x53cc, 0x4a88, 0xf2e9, 0x2a6b, 0x920a,
+ 0x2f98, 0x97f9, 0x4f7b, 0xf71a, 0xee5e, 0x563f, 0x8ebd, 0x36dc,
+ 0xbc35, 0x0454, 0xdcd6, 0x64b7, 0x7df3, 0xc592, 0x1d10, 0xa571,
+ 0x0000, 0x47d3, 0x8fa6, 0xc875, 0x0f6d, 0x48be, 0x80cb, 0xc718,
+ 0x1eda, 0x5909, 0x917c, 0xd6af, 0x11b7, 0x5664, 0x9e11, 0xd9c2,
+ 0x3db4, 0x7a67, 0xb212, 0xf5c1, 0x32d9, 0x750a, 0xbd7f, 0xfaac,
+ 0x236e, 0x64bd, 0xacc8, 0xeb1b, 0x2c03, 0x6bd0, 0xa3a5, 0xe476,
+ 0x7b68, 0x3cbb, 0xf4ce, 0xb31d, 0x7405, 0x33d6, 0xfba3, 0xbc70,
+ 0x65b2, 0x2261, 0xea14, 0xadc7, 0x6adf, 0x2d0c, 0xe579, 0xa2aa,
+ 0x46dc, 0x010f, 0xc97a, 0x8ea9, 0x49b1, 0x0e62, 0xc617, 0x81c4,
+ 0x5806, 0x1fd5, 0xd7a0, 0x9073, 0x576b, 0x10b8, 0xd8cd, 0x9f1e,
+ 0xf6d0, 0xb103, 0x7976, 0x3ea5, 0xf9bd, 0xbe6e, 0x761b, 0x31c8,
+ 0xe80a, 0xafd9, 0x67ac, 0x207f, 0xe767, 0xa0b4, 0x68c1, 0x2f12,
+ 0xcb64, 0x8cb7, 0x44c2, 0x0311, 0xc409, 0x83da, 0x4baf, 0x0c7c,
+ 0xd5be, 0x926d, 0x5a18, 0x1dcb, 0xdad3, 0x9d00, 0x5575, 0x12a6,
+ 0x8db8, 0xca6b, 0x021e, 0x45cd, 0x82d5, 0xc506, 0x0d73, 0x4aa0,
+ 0x9362, 0xd4b1, 0x1cc4, 0x5b17, 0x9c0f, 0xdbdc, 0x13a9, 0x547a,
+ 0xb00c, 0xf7df, 0x3faa, 0x7879, 0xbf61, 0xf8b2, 0x30c7, 0x7714,
+ 0xaed6, 0xe905, 0x2170, 0x66a3, 0xa1bb, 0xe668, 0x2e1d, 0x69ce,
+ 0xfd81, 0xba52, 0x7227, 0x35f4, 0xf2ec, 0xb53f, 0x7d4a, 0x3a99,
+ 0xe35b, 0xa488, 0x6cfd, 0x2b2e, 0xec36, 0xabe5, 0x6390, 0x2443,
+ 0xc035, 0x87e6, 0x4f93, 0x0840, 0xcf58, 0x888b, 0x40fe, 0x072d,
+ 0xdeef, 0x993c, 0x5149, 0x169a, 0xd182, 0x9651, 0x5e24, 0x19f7,
+ 0x86e9, 0xc13a, 0x094f, 0x4e9c, 0x8984, 0xce57, 0x0622, 0x41f1,
+ 0x9833, 0xdfe0, 0x1795, 0x5046, 0x975e, 0xd08d, 0x18f8, 0x5f2b,
+ 0xbb5d, 0xfc8e, 0x34fb, 0x7328, 0xb430, 0xf3e3, 0x3b96, 0x7c45,
+ 0xa587, 0xe254, 0x2a21, 0x6df2, 0xaaea, 0xed39, 0x254c, 0x629f,
+ 0x0b51, 0x4c82, 0x84f7, 0xc324, 0x043c, 0x43ef, 0x8b9a, 0xcc49,
+ 0x158b, 0x5258, 0x9a2d, 0xddfe, 0x1ae6, 0x5d35, 0x9540, 0xd293,
+ 0x36e5, 0x7136, 0xb943, 0xfe90, 0x3988, 0x7e5b, 0xb62e, 0xf1fd,
+ 0x283f, 0x6fec, 0xa799, 0xe04a, 0x2752, 0x6081, 0xa8f4, 0xef27,
+ 0x7039, 0x37ea, 0xff9f, 0xb84c, 0x7f54, 0x3887, 0xf0f2, 0xb721,
+ 0x6ee3, 0x2930, 0xe145, 0xa696, 0x618e, 0x265d, 0xee28, 0xa9fb,
+ 0x4d8d, 0x0a5e, 0xc22b, 0x85f8, 0x42e0, 0x0533, 0xcd46, 0x8a95,
+ 0x5357, 0x1484, 0xdcf1, 0x9b22, 0x5c3a, 0x1be9, 0xd39c, 0x944f,
+};
+
+const uint16_t crc16_1021_reflected_crc_table[CRC_SLICES * 256] = {
+ 0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
+ 0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
+ 0x1081, 0x0108, 0x3393, 0x221a, 0x56a5, 0x472c, 0x75b7, 0x643e,
+ 0x9cc9, 0x8d40, 0xbfdb, 0xae52, 0xdaed, 0xcb64, 0xf9ff, 0xe876,
+ 0x2102, 0x308b, 0x0210, 0x1399, 0x6726, 0x76af, 0x4434, 0x55bd,
+ 0xad4a, 0xbcc3, 0x8e58, 0x9fd1, 0xeb6e, 0xfae7, 0xc87c, 0xd9f5,
+ 0x3183, 0x200a, 0x1291, 0x0318, 0x77a7, 0x662e, 0x54b5, 0x453c,
+ 0xbdcb, 0xac42, 0x9ed9, 0x8f50, 0xfbef, 0xea66, 0xd8fd, 0xc974,
+ 0x4204, 0x538d, 0x6116, 0x709f, 0x0420, 0x15a9, 0x2732, 0x36bb,
+ 0xce4c, 0xdfc5, 0xed5e, 0xfcd7, 0x8868, 0x99e1, 0xab7a, 0xbaf3,
+ 0x5285, 0x430c, 0x7197, 0x601e, 0x14a1, 0x0528, 0x37b3, 0x263a,
+ 0xdecd, 0xcf44, 0xfddf, 0xec56, 0x98e9, 0x8960, 0xbbfb, 0xaa72,
+ 0x6306, 0x728f, 0x4014, 0x519d, 0x2522, 0x34ab, 0x0630, 0x17b9,
+ 0xef4e, 0xfec7, 0xcc5c, 0xddd5, 0xa96a, 0xb8e3, 0x8a78, 0x9bf1,
+ 0x7387, 0x620e, 0x5095, 0x411c, 0x35a3, 0x242a, 0x16b1, 0x0738,
+ 0xffcf, 0xee46, 0xdcdd, 0xcd54, 0xb9eb, 0xa862, 0x9af9, 0x8b70,
+ 0x8408, 0x9581, 0xa71a, 0xb693, 0xc22c, 0xd3a5, 0xe13e, 0xf0b7,
+ 0x0840, 0x19c9, 0x2b52, 0x3adb, 0x4e64, 0x5fed, 0x6d76, 0x7cff,
+ 0x9489, 0x8500, 0xb79b, 0xa612, 0xd2ad, 0xc324, 0xf1bf, 0xe036,
+ 0x18c1, 0x0948, 0x3bd3, 0x2a5a, 0x5ee5, 0x4f6c, 0x7df7, 0x6c7e,
+ 0xa50a, 0xb483, 0x8618, 0x9791, 0xe32e, 0xf2a7, 0xc03c, 0xd1b5,
+ 0x2942, 0x38cb, 0x0a50, 0x1bd9, 0x6f66, 0x7eef, 0x4c74, 0x5dfd,
+ 0xb58b, 0xa402, 0x9699, 0x8710, 0xf3af, 0xe226, 0xd0bd, 0xc134,
+ 0x39c3, 0x284a, 0x1ad1, 0x0b58, 0x7fe7, 0x6e6e, 0x5cf5, 0x4d7c,
+ 0xc60c, 0xd785, 0xe51e, 0xf497, 0x8028, 0x91a1, 0xa33a, 0xb2b3,
+ 0x4a44, 0x5bcd, 0x6956, 0x78df, 0x0c60, 0x1de9, 0x2f72, 0x3efb,
+ 0xd68d, 0xc704, 0xf59f, 0xe416, 0x90a9, 0x8120, 0xb3bb, 0xa232,
+ 0x5ac5, 0x4b4c, 0x79d7, 0x685e, 0x1ce1, 0x0d68, 0x3ff3, 0x2e7a,
+ 0xe70e, 0xf687, 0xc41c, 0xd595, 0xa12a, 0xb0a3, 0x8238, 0x93b1,
+ 0x6b46, 0x7acf, 0x4854, 0x59dd, 0x2d62, 0x3ceb, 0x0e70, 0x1ff9,
+ 0xf78f, 0xe606, 0xd49d, 0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330,
+ 0x7bc7, 0x6a4e, 0x58d5, 0x495c, 0x3de3, 0x2c6a, 0x1ef1, 0x0f78,
+ 0x0000, 0x19d8, 0x33b0, 0x2a68, 0x6760, 0x7eb8, 0x54d0, 0x4d08,
+ 0xcec0, 0xd718, 0xfd70, 0xe4a8, 0xa9a0, 0xb078, 0x9a10, 0x83c8,
+ 0x9591, 0x8c49, 0xa621, 0xbff9, 0xf2f1, 0xeb29, 0xc141, 0xd899,
+ 0x5b51, 0x4289, 0x68e1, 0x7139, 0x3c31, 0x25e9, 0x0f81, 0x1659,
+ 0x2333, 0x3aeb, 0x1083, 0x095b, 0x4453, 0x5d8b, 0x77e3, 0x6e3b,
+ 0xedf3, 0xf42b, 0xde43, 0xc79b, 0x8a93, 0x934b, 0xb923, 0xa0fb,
+ 0xb6a2, 0xaf7a, 0x8512, 0x9cca, 0xd1c2, 0xc81a, 0xe272, 0xfbaa,
+ 0x7862, 0x61ba, 0x4bd2, 0x520a, 0x1f02, 0x06da, 0x2cb2, 0x356a,
+ 0x4666, 0x5fbe, 0x75d6, 0x6c0e, 0x2106, 0x38de, 0x12b6, 0x0b6e,
+ 0x88a6, 0x917e, 0xbb16, 0xa2ce, 0xefc6, 0xf61e, 0xdc76, 0xc5ae,
+ 0xd3f7, 0xca2f, 0xe047, 0xf99f, 0xb497, 0xad4f, 0x8727, 0x9eff,
+ 0x1d37, 0x04ef, 0x2e87, 0x375f, 0x7a57, 0x638f, 0x49e7, 0x503f,
+ 0x6555, 0x7c8d, 0x56e5, 0x4f3d, 0x0235, 0x1bed, 0x3185, 0x285d,
+ 0xab95, 0xb24d, 0x9825, 0x81fd, 0xccf5, 0xd52d, 0xff45, 0xe69d,
+ 0xf0c4, 0xe91c, 0xc374, 0xdaac, 0x97a4, 0x8e7c, 0xa414, 0xbdcc,
+ 0x3e04, 0x27dc, 0x0db4, 0x146c, 0x5964, 0x40bc, 0x6ad4, 0x730c,
+ 0x8ccc, 0x9514, 0xbf7c, 0xa6a4, 0xebac, 0xf274, 0xd81c, 0xc1c4,
+ 0x420c, 0x5bd4, 0x71bc, 0x6864, 0x256c, 0x3cb4, 0x16dc, 0x0f04,
+ 0x195d, 0x0085, 0x2aed, 0x3335, 0x7e3d, 0x67e5, 0x4d8d, 0x5455,
+ 0xd79d, 0xce45, 0xe42d, 0xfdf5, 0xb0fd, 0xa925, 0x834d, 0x9a95,
+ 0xafff, 0xb627, 0x9c4f, 0x8597, 0xc89f, 0xd147, 0xfb2f, 0xe2f7,
+ 0x613f, 0x78e7, 0x528f, 0x4b57, 0x065f, 0x1f87, 0x35ef, 0x2c37,
+ 0x3a6e, 0x23b6, 0x09de, 0x1006, 0x5d0e, 0x44d6, 0x6ebe, 0x7766,
+ 0xf4ae, 0xed76, 0xc71e, 0xdec6, 0x93ce, 0x8a16, 0xa07e, 0xb9a6,
+ 0xcaaa, 0xd372, 0xf91a, 0xe0c2, 0xadca, 0xb412, 0x9e7a, 0x87a2,
+ 0x046a, 0x1db2, 0x37da, 0x2e02, 0x630a, 0x7ad2, 0x50ba, 0x4962,
+ 0x5f3b, 0x46e3, 0x6c8b, 0x7553, 0x385b, 0x2183, 0x0beb, 0x1233,
+ 0x91fb, 0x8823, 0xa24b, 0xbb93, 0xf69b, 0xef43, 0xc52b, 0xdcf3,
+ 0xe999, 0xf041, 0xda29, 0xc3f1, 0x8ef9, 0x9721, 0xbd49, 0xa491,
+ 0x2759, 0x3e81, 0x14e9, 0x0d31, 0x4039, 0x59e1, 0x7389, 0x6a51,
+ 0x7c08, 0x65d0, 0x4fb8, 0x5660, 0x1b68, 0x02b0, 0x28d8, 0x3100,
+ 0xb2c8, 0xab10, 0x8178, 0x98a0, 0xd5a8, 0xcc70, 0xe618, 0xffc0,
+ 0x0000, 0x5adc, 0xb5b8, 0xef64, 0x6361, 0x39bd, 0xd6d9, 0x8c05,
+ 0xc6c2, 0x9c1e, 0x737a, 0x29a6, 0xa5a3, 0xff7f, 0x101b, 0x4ac7,
+ 0x8595, 0xdf49, 0x302d, 0x6af1, 0xe6f4, 0xbc28, 0x534c, 0x0990,
+ 0x4357, 0x198b, 0xf6ef, 0xac33, 0x2036, 0x7aea, 0x958e, 0xcf52,
+ 0x033b, 0x59e7, 0xb683, 0xec5f, 0x605a, 0x3a86, 0xd5e2, 0x8f3e,
+ 0xc5f9, 0x9f25, 0x7041, 0x2a9d, 0xa698, 0xfc44, 0x1320, 0x49fc,
+ 0x86ae, 0xdc72, 0x3316, 0x69ca, 0xe5cf, 0xbf13, 0x5077, 0x0aab,
+ 0x406c, 0x1ab0, 0xf5d4, 0xaf08, 0x230d, 0x79d1, 0x96b5, 0xcc69,
+ 0x0676, 0x5caa, 0xb3ce, 0xe912, 0x6517, 0x3fcb, 0xd0af, 0x8a73,
+ 0xc0b4, 0x9a68, 0x750c, 0x2fd0, 0xa3d5, 0xf909, 0x166d, 0x4cb1,
+ 0x83e3, 0xd93f, 0x365b, 0x6c87, 0xe082, 0xba5e, 0x553a, 0x0fe6,
+ 0x4521, 0x1ffd, 0xf099, 0xaa45, 0x2640, 0x7c9c, 0x93f8, 0xc924,
+ 0x054d, 0x5f91, 0xb0f5, 0xea29, 0x662c, 0x3cf0, 0xd394, 0x8948,
+ 0xc38f, 0x9953, 0x7637, 0x2ceb, 0xa0ee, 0xfa32, 0x1556, 0x4f8a,
+ 0x80d8, 0xda04, 0x3560, 0x6fbc, 0xe3b9, 0xb965, 0x5601, 0x0cdd,
+ 0x461a, 0x1cc6, 0xf3a2, 0xa97e, 0x257b, 0x7fa7, 0x90c3, 0xca1f,
+ 0x0cec, 0x5630, 0xb954, 0xe388, 0x6f8d, 0x3551, 0xda35, 0x80e9,
+ 0xca2e, 0x90f2, 0x7f96, 0x254a, 0xa94f, 0xf393, 0x1cf7, 0x462b,
+ 0x8979, 0xd3a5, 0x3cc1, 0x661d, 0xea18, 0xb0c4, 0x5fa0, 0x057c,
+ 0x4fbb, 0x1567, 0xfa03, 0xa0df, 0x2cda, 0x7606, 0x9962, 0xc3be,
+ 0x0fd7, 0x550b, 0xba6f, 0xe0b3, 0x6cb6, 0x366a, 0xd90e, 0x83d2,
+ 0xc915, 0x93c9, 0x7cad, 0x2671, 0xaa74, 0xf0a8, 0x1fcc, 0x4510,
+ 0x8a42, 0xd09e, 0x3ffa, 0x6526, 0xe923, 0xb3ff, 0x5c9b, 0x0647,
+ 0x4c80, 0x165c, 0xf938, 0xa3e4, 0x2fe1, 0x753d, 0x9a59, 0xc085,
+ 0x0a9a, 0x5046, 0xbf22, 0xe5fe, 0x69fb, 0x3327, 0xdc43, 0x869f,
+ 0xcc58, 0x9684, 0x79e0, 0x233c, 0xaf39, 0xf5e5, 0x1a81, 0x405d,
+ 0x8f0f, 0xd5d3, 0x3ab7, 0x606b, 0xec6e, 0xb6b2, 0x59d6, 0x030a,
+ 0x49cd, 0x1311, 0xfc75, 0xa6a9, 0x2aac, 0x7070, 0x9f14, 0xc5c8,
+ 0x09a1, 0x537d, 0xbc19, 0xe6c5, 0x6ac0, 0x301c, 0xdf78, 0x85a4,
+ 0xcf63, 0x95bf, 0x7adb, 0x2007, 0xac02, 0xf6de, 0x19ba, 0x4366,
+ 0x8c34, 0xd6e8, 0x398c, 0x6350, 0xef55, 0xb589, 0x5aed, 0x0031,
+ 0x4af6, 0x102a, 0xff4e, 0xa592, 0x2997, 0x734b, 0x9c2f, 0xc6f3,
+ 0x0000, 0x1cbb, 0x3976, 0x25cd, 0x72ec, 0x6e57, 0x4b9a, 0x5721,
+ 0xe5d8, 0xf963, 0xdcae, 0xc015, 0x9734, 0x8b8f, 0xae42, 0xb2f9,
+ 0xc3a1, 0xdf1a, 0xfad7, 0xe66c, 0xb14d, 0xadf6, 0x883b, 0x9480,
+ 0x2679, 0x3ac2, 0x1f0f, 0x03b4, 0x5495, 0x482e, 0x6de3, 0x7158,
+ 0x8f53, 0x93e8, 0xb625, 0xaa9e, 0xfdbf, 0xe104, 0xc4c9, 0xd872,
+ 0x6a8b, 0x7630, 0x53fd, 0x4f46, 0x1867, 0x04dc, 0x2111, 0x3daa,
+ 0x4cf2, 0x5049, 0x7584, 0x693f, 0x3e1e, 0x22a5, 0x0768, 0x1bd3,
+ 0xa92a, 0xb591, 0x905c, 0x8ce7, 0xdbc6, 0xc77d, 0xe2b0, 0xfe0b,
+ 0x16b7, 0x0a0c, 0x2fc1, 0x337a, 0x645b, 0x78e0, 0x5d2d, 0x4196,
+ 0xf36f, 0xefd4, 0xca19, 0xd6a2, 0x8183, 0x9d38, 0xb8f5, 0xa44e,
+ 0xd516, 0xc9ad, 0xec60, 0xf0db, 0xa7fa, 0xbb41, 0x9e8c, 0x8237,
+ 0x30ce, 0x2c75, 0x09b8, 0x1503, 0x4222, 0x5e99, 0x7b54, 0x67ef,
+ 0x99e4, 0x855f, 0xa092, 0xbc29, 0xeb08, 0xf7b3, 0xd27e, 0xcec5,
+ 0x7c3c, 0x6087, 0x454a, 0x59f1, 0x0ed0, 0x126b, 0x37a6, 0x2b1d,
+ 0x5a45, 0x46fe, 0x6333, 0x7f88, 0x28a9, 0x3412, 0x11df, 0x0d64,
+ 0xbf9d, 0xa326, 0x86eb, 0x9a50, 0xcd71, 0xd1ca, 0xf407, 0xe8bc,
+ 0x2d6e, 0x31d5, 0x1418, 0x08a3, 0x5f82, 0x4339, 0x66f4, 0x7a4f,
+ 0xc8b6, 0xd40d, 0xf1c0, 0xed7b, 0xba5a, 0xa6e1, 0x832c, 0x9f97,
+ 0xeecf, 0xf274, 0xd7b9, 0xcb02, 0x9c23, 0x8098, 0xa555, 0xb9ee,
+ 0x0b17, 0x17ac, 0x3261, 0x2eda, 0x79fb, 0x6540, 0x408d, 0x5c36,
+ 0xa23d, 0xbe86, 0x9b4b, 0x87f0, 0xd0d1, 0xcc6a, 0xe9a7, 0xf51c,
+ 0x47e5, 0x5b5e, 0x7e93, 0x6228, 0x3509, 0x29b2, 0x0c7f, 0x10c4,
+ 0x619c, 0x7d27, 0x58ea, 0x4451, 0x1370, 0x0fcb, 0x2a06, 0x36bd,
+ 0x8444, 0x98ff, 0xbd32, 0xa189, 0xf6a8, 0xea13, 0xcfde, 0xd365,
+ 0x3bd9, 0x2762, 0x02af, 0x1e14, 0x4935, 0x558e, 0x7043, 0x6cf8,
+ 0xde01, 0xc2ba, 0xe777, 0xfbcc, 0xaced, 0xb056, 0x959b, 0x8920,
+ 0xf878, 0xe4c3, 0xc10e, 0xddb5, 0x8a94, 0x962f, 0xb3e2, 0xaf59,
+ 0x1da0, 0x011b, 0x24d6, 0x386d, 0x6f4c, 0x73f7, 0x563a, 0x4a81,
+ 0xb48a, 0xa831, 0x8dfc, 0x9147, 0xc666, 0xdadd, 0xff10, 0xe3ab,
+ 0x5152, 0x4de9, 0x6824, 0x749f, 0x23be, 0x3f05, 0x1ac8, 0x0673,
+ 0x772b, 0x6b90, 0x4e5d, 0x52e6, 0x05c7, 0x197c, 0x3cb1, 0x200a,
+ 0x92f3, 0x8e48, 0xab85, 0xb73e, 0xe01f, 0xfca4, 0xd969, 0xc5d2,
+ 0x0000, 0x0b44, 0x1688, 0x1dcc, 0x2d10, 0x2654, 0x3b98, 0x30dc,
+ 0x5a20, 0x5164, 0x4ca8, 0x47ec, 0x7730, 0x7c74, 0x61b8, 0x6afc,
+ 0xb440, 0xbf04, 0xa2c8, 0xa98c, 0x9950, 0x9214, 0x8fd8, 0x849c,
+ 0xee60, 0xe524, 0xf8e8, 0xf3ac, 0xc370, 0xc834, 0xd5f8, 0xdebc,
+ 0x6091, 0x6bd5, 0x7619, 0x7d5d, 0x4d81, 0x46c5, 0x5b09, 0x504d,
+ 0x3ab1, 0x31f5, 0x2c39, 0x277d, 0x17a1, 0x1ce5, 0x0129, 0x0a6d,
+ 0xd4d1, 0xdf95, 0xc259, 0xc91d, 0xf9c1, 0xf285, 0xef49, 0xe40d,
+ 0x8ef1, 0x85b5, 0x9879, 0x933d, 0xa3e1, 0xa8a5, 0xb569, 0xbe2d,
+ 0xc122, 0xca66, 0xd7aa, 0xdcee, 0xec32, 0xe776, 0xfaba, 0xf1fe,
+ 0x9b02, 0x9046, 0x8d8a, 0x86ce, 0xb612, 0xbd56, 0xa09a, 0xabde,
+ 0x7562, 0x7e26, 0x63ea, 0x68ae, 0x5872, 0x5336, 0x4efa, 0x45be,
+ 0x2f42, 0x2406, 0x39ca, 0x328e, 0x0252, 0x0916, 0x14da, 0x1f9e,
+ 0xa1b3, 0xaaf7, 0xb73b, 0xbc7f, 0x8ca3, 0x87e7, 0x9a2b, 0x916f,
+ 0xfb93, 0xf0d7, 0xed1b, 0xe65f, 0xd683, 0xddc7, 0xc00b, 0xcb4f,
+ 0x15f3, 0x1eb7, 0x037b, 0x083f, 0x38e3, 0x33a7, 0x2e6b, 0x252f,
+ 0x4fd3, 0x4497, 0x595b, 0x521f, 0x62c3, 0x6987, 0x744b, 0x7f0f,
+ 0x8a55, 0x8111, 0x9cdd, 0x9799, 0xa745, 0xac01, 0xb1cd, 0xba89,
+ 0xd075, 0xdb31, 0xc6fd, 0xcdb9, 0xfd65, 0xf621, 0xebed, 0xe0a9,
+ 0x3e15, 0x3551, 0x289d, 0x23d9, 0x1305, 0x1841, 0x058d, 0x0ec9,
+ 0x6435, 0x6f71, 0x72bd, 0x79f9, 0x4925, 0x4261, 0x5fad, 0x54e9,
+ 0xeac4, 0xe180, 0xfc4c, 0xf708, 0xc7d4, 0xcc90, 0xd15c, 0xda18,
+ 0xb0e4, 0xbba0, 0xa66c, 0xad28, 0x9df4, 0x96b0, 0x8b7c, 0x8038,
+ 0x5e84, 0x55c0, 0x480c, 0x4348, 0x7394, 0x78d0, 0x651c, 0x6e58,
+ 0x04a4, 0x0fe0, 0x122c, 0x1968, 0x29b4, 0x22f0, 0x3f3c, 0x3478,
+ 0x4b77, 0x4033, 0x5dff, 0x56bb, 0x6667, 0x6d23, 0x70ef, 0x7bab,
+ 0x1157, 0x1a13, 0x07df, 0x0c9b, 0x3c47, 0x3703, 0x2acf, 0x218b,
+ 0xff37, 0xf473, 0xe9bf, 0xe2fb, 0xd227, 0xd963, 0xc4af, 0xcfeb,
+ 0xa517, 0xae53, 0xb39f, 0xb8db, 0x8807, 0x8343, 0x9e8f, 0x95cb,
+ 0x2be6, 0x20a2, 0x3d6e, 0x362a, 0x06f6, 0x0db2, 0x107e, 0x1b3a,
+ 0x71c6, 0x7a82, 0x674e, 0x6c0a, 0x5cd6, 0x5792, 0x4a5e, 0x411a,
+ 0x9fa6, 0x94e2, 0x892e, 0x826a, 0xb2b6, 0xb9f2, 0xa43e, 0xaf7a,
+ 0xc586, 0xcec2, 0xd30e, 0xd84a, 0xe896, 0xe3d2, 0xfe1e, 0xf55a,
+ 0x0000, 0x042b, 0x0856, 0x0c7d, 0x10ac, 0x1487, 0x18fa, 0x1cd1,
+ 0x2158, 0x2573, 0x290e, 0x2d25, 0x31f4, 0x35df, 0x39a2, 0x3d89,
+ 0x42b0, 0x469b, 0x4ae6, 0x4ecd, 0x521c, 0x5637, 0x5a4a, 0x5e61,
+ 0x63e8, 0x67c3, 0x6bbe, 0x6f95, 0x7344, 0x776f, 0x7b12, 0x7f39,
+ 0x8560, 0x814b, 0x8d36, 0x891d, 0x95cc, 0x91e7, 0x9d9a, 0x99b1,
+ 0xa438, 0xa013, 0xac6e, 0xa845, 0xb494, 0xb0bf, 0xbcc2, 0xb8e9,
+ 0xc7d0, 0xc3fb, 0xcf86, 0xcbad, 0xd77c, 0xd357, 0xdf2a, 0xdb01,
+ 0xe688, 0xe2a3, 0xeede, 0xeaf5, 0xf624, 0xf20f, 0xfe72, 0xfa59,
+ 0x02d1, 0x06fa, 0x0a87, 0x0eac, 0x127d, 0x1656, 0x1a2b, 0x1e00,
+ 0x2389, 0x27a2, 0x2bdf, 0x2ff4, 0x3325, 0x370e, 0x3b73, 0x3f58,
+ 0x4061, 0x444a, 0x4837, 0x4c1c, 0x50cd, 0x54e6, 0x589b, 0x5cb0,
+ 0x6139, 0x6512, 0x696f, 0x6d44, 0x7195, 0x75be, 0x79c3, 0x7de8,
+ 0x87b1, 0x839a, 0x8fe7, 0x8bcc, 0x971d, 0x9336, 0x9f4b, 0x9b60,
+ 0xa6e9, 0xa2c2, 0xaebf, 0xaa94, 0xb645, 0xb26e, 0xbe13, 0xba38,
+ 0xc501, 0xc12a, 0xcd57, 0xc97c, 0xd5ad, 0xd186, 0xddfb, 0xd9d0,
+ 0xe459, 0xe072, 0xec0f, 0xe824, 0xf4f5, 0xf0de, 0xfca3, 0xf888,
+ 0x05a2, 0x0189, 0x0df4, 0x09df, 0x150e, 0x1125, 0x1d58, 0x1973,
+ 0x24fa, 0x20d1, 0x2cac, 0x2887, 0x3456, 0x307d, 0x3c00, 0x382b,
+ 0x4712, 0x4339, 0x4f44, 0x4b6f, 0x57be, 0x5395, 0x5fe8, 0x5bc3,
+ 0x664a, 0x6261, 0x6e1c, 0x6a37, 0x76e6, 0x72cd, 0x7eb0, 0x7a9b,
+ 0x80c2, 0x84e9, 0x8894, 0x8cbf, 0x906e, 0x9445, 0x9838, 0x9c13,
+ 0xa19a, 0xa5b1, 0xa9cc, 0xade7, 0xb136, 0xb51d, 0xb960, 0xbd4b,
+ 0xc272, 0xc659, 0xca24, 0xce0f, 0xd2de, 0xd6f5, 0xda88, 0xdea3,
+ 0xe32a, 0xe701, 0xeb7c, 0xef57, 0xf386, 0xf7ad, 0xfbd0, 0xfffb,
+ 0x0773, 0x0358, 0x0f25, 0x0b0e, 0x17df, 0x13f4, 0x1f89, 0x1ba2,
+ 0x262b, 0x2200, 0x2e7d, 0x2a56, 0x3687, 0x32ac, 0x3ed1, 0x3afa,
+ 0x45c3, 0x41e8, 0x4d95, 0x49be, 0x556f, 0x5144, 0x5d39, 0x5912,
+ 0x649b, 0x60b0, 0x6ccd, 0x68e6, 0x7437, 0x701c, 0x7c61, 0x784a,
+ 0x8213, 0x8638, 0x8a45, 0x8e6e, 0x92bf, 0x9694, 0x9ae9, 0x9ec2,
+ 0xa34b, 0xa760, 0xab1d, 0xaf36, 0xb3e7, 0xb7cc, 0xbbb1, 0xbf9a,
+ 0xc0a3, 0xc488, 0xc8f5, 0xccde, 0xd00f, 0xd424, 0xd859, 0xdc72,
+ 0xe1fb, 0xe5d0, 0xe9ad, 0xed86, 0xf157, 0xf57c, 0xf901, 0xfd2a,
+ 0x0000, 0x9fd5, 0x37bb, 0xa86e, 0x6f76, 0xf0a3, 0x58cd, 0xc718,
+ 0xdeec, 0x4139, 0xe957, 0x7682, 0xb19a, 0x2e4f, 0x8621, 0x19f4,
+ 0xb5c9, 0x2a1c, 0x8272, 0x1da7, 0xdabf, 0x456a, 0xed04, 0x72d1,
+ 0x6b25, 0xf4f0, 0x5c9e, 0xc34b, 0x0453, 0x9b86, 0x33e8, 0xac3d,
+ 0x6383, 0xfc56, 0x5438, 0xcbed, 0x0cf5, 0x9320, 0x3b4e, 0xa49b,
+ 0xbd6f, 0x22ba, 0x8ad4, 0x1501, 0xd219, 0x4dcc, 0xe5a2, 0x7a77,
+ 0xd64a, 0x499f, 0xe1f1, 0x7e24, 0xb93c, 0x26e9, 0x8e87, 0x1152,
+ 0x08a6, 0x9773, 0x3f1d, 0xa0c8, 0x67d0, 0xf805, 0x506b, 0xcfbe,
+ 0xc706, 0x58d3, 0xf0bd, 0x6f68, 0xa870, 0x37a5, 0x9fcb, 0x001e,
+ 0x19ea, 0x863f, 0x2e51, 0xb184, 0x769c, 0xe949, 0x4127, 0xdef2,
+ 0x72cf, 0xed1a, 0x4574, 0xdaa1, 0x1db9, 0x826c, 0x2a02, 0xb5d7,
+ 0xac23, 0x33f6, 0x9b98, 0x044d, 0xc355, 0x5c80, 0xf4ee, 0x6b3b,
+ 0xa485, 0x3b50, 0x933e, 0x0ceb, 0xcbf3, 0x5426, 0xfc48, 0x639d,
+ 0x7a69, 0xe5bc, 0x4dd2, 0xd207, 0x151f, 0x8aca, 0x22a4, 0xbd71,
+ 0x114c, 0x8e99, 0x26f7, 0xb922, 0x7e3a, 0xe1ef, 0x4981, 0xd654,
+ 0xcfa0, 0x5075, 0xf81b, 0x67ce, 0xa0d6, 0x3f03, 0x976d, 0x08b8,
+ 0x861d, 0x19c8, 0xb1a6, 0x2e73, 0xe96b, 0x76be, 0xded0, 0x4105,
+ 0x58f1, 0xc724, 0x6f4a, 0xf09f, 0x3787, 0xa852, 0x003c, 0x9fe9,
+ 0x33d4, 0xac01, 0x046f, 0x9bba, 0x5ca2, 0xc377, 0x6b19, 0xf4cc,
+ 0xed38, 0x72ed, 0xda83, 0x4556, 0x824e, 0x1d9b, 0xb5f5, 0x2a20,
+ 0xe59e, 0x7a4b, 0xd225, 0x4df0, 0x8ae8, 0x153d, 0xbd53, 0x2286,
+ 0x3b72, 0xa4a7, 0x0cc9, 0x931c, 0x5404, 0xcbd1, 0x63bf, 0xfc6a,
+ 0x5057, 0xcf82, 0x67ec, 0xf839, 0x3f21, 0xa0f4, 0x089a, 0x974f,
+ 0x8ebb, 0x116e, 0xb900, 0x26d5, 0xe1cd, 0x7e18, 0xd676, 0x49a3,
+ 0x411b, 0xdece, 0x76a0, 0xe975, 0x2e6d, 0xb1b8, 0x19d6, 0x8603,
+ 0x9ff7, 0x0022, 0xa84c, 0x3799, 0xf081, 0x6f54, 0xc73a, 0x58ef,
+ 0xf4d2, 0x6b07, 0xc369, 0x5cbc, 0x9ba4, 0x0471, 0xac1f, 0x33ca,
+ 0x2a3e, 0xb5eb, 0x1d85, 0x8250, 0x4548, 0xda9d, 0x72f3, 0xed26,
+ 0x2298, 0xbd4d, 0x1523, 0x8af6, 0x4dee, 0xd23b, 0x7a55, 0xe580,
+ 0xfc74, 0x63a1, 0xcbcf, 0x541a, 0x9302, 0x0cd7, 0xa4b9, 0x3b6c,
+ 0x9751, 0x0884, 0xa0ea, 0x3f3f, 0xf827, 0x67f2, 0xcf9c, 0x5049,
+ 0x49bd, 0xd668, 0x7e06, 0xe1d3, 0x26cb, 0xb91e, 0x1170, 0x8ea5,
+ 0x0000, 0x81bf, 0x0b6f, 0x8ad0, 0x16de, 0x9761, 0x1db1, 0x9c0e,
+ 0x2dbc, 0xac03, 0x26d3, 0xa76c, 0x3b62, 0xbadd, 0x300d, 0xb1b2,
+ 0x5b78, 0xdac7, 0x5017, 0xd1a8, 0x4da6, 0xcc19, 0x46c9, 0xc776,
+ 0x76c4, 0xf77b, 0x7dab, 0xfc14, 0x601a, 0xe1a5, 0x6b75, 0xeaca,
+ 0xb6f0, 0x374f, 0xbd9f, 0x3c20, 0xa02e, 0x2191, 0xab41, 0x2afe,
+ 0x9b4c, 0x1af3, 0x9023, 0x119c, 0x8d92, 0x0c2d, 0x86fd, 0x0742,
+ 0xed88, 0x6c37, 0xe6e7, 0x6758, 0xfb56, 0x7ae9, 0xf039, 0x7186,
+ 0xc034, 0x418b, 0xcb5b, 0x4ae4, 0xd6ea, 0x5755, 0xdd85, 0x5c3a,
+ 0x65f1, 0xe44e, 0x6e9e, 0xef21, 0x732f, 0xf290, 0x7840, 0xf9ff,
+ 0x484d, 0xc9f2, 0x4322, 0xc29d, 0x5e93, 0xdf2c, 0x55fc, 0xd443,
+ 0x3e89, 0xbf36, 0x35e6, 0xb459, 0x2857, 0xa9e8, 0x2338, 0xa287,
+ 0x1335, 0x928a, 0x185a, 0x99e5, 0x05eb, 0x8454, 0x0e84, 0x8f3b,
+ 0xd301, 0x52be, 0xd86e, 0x59d1, 0xc5df, 0x4460, 0xceb0, 0x4f0f,
+ 0xfebd, 0x7f02, 0xf5d2, 0x746d, 0xe863, 0x69dc, 0xe30c, 0x62b3,
+ 0x8879, 0x09c6, 0x8316, 0x02a9, 0x9ea7, 0x1f18, 0x95c8, 0x1477,
+ 0xa5c5, 0x247a, 0xaeaa, 0x2f15, 0xb31b, 0x32a4, 0xb874, 0x39cb,
+ 0xcbe2, 0x4a5d, 0xc08d, 0x4132, 0xdd3c, 0x5c83, 0xd653, 0x57ec,
+ 0xe65e, 0x67e1, 0xed31, 0x6c8e, 0xf080, 0x713f, 0xfbef, 0x7a50,
+ 0x909a, 0x1125, 0x9bf5, 0x1a4a, 0x8644, 0x07fb, 0x8d2b, 0x0c94,
+ 0xbd26, 0x3c99, 0xb649, 0x37f6, 0xabf8, 0x2a47, 0xa097, 0x2128,
+ 0x7d12, 0xfcad, 0x767d, 0xf7c2, 0x6bcc, 0xea73, 0x60a3, 0xe11c,
+ 0x50ae, 0xd111, 0x5bc1, 0xda7e, 0x4670, 0xc7cf, 0x4d1f, 0xcca0,
+ 0x266a, 0xa7d5, 0x2d05, 0xacba, 0x30b4, 0xb10b, 0x3bdb, 0xba64,
+ 0x0bd6, 0x8a69, 0x00b9, 0x8106, 0x1d08, 0x9cb7, 0x1667, 0x97d8,
+ 0xae13, 0x2fac, 0xa57c, 0x24c3, 0xb8cd, 0x3972, 0xb3a2, 0x321d,
+ 0x83af, 0x0210, 0x88c0, 0x097f, 0x9571, 0x14ce, 0x9e1e, 0x1fa1,
+ 0xf56b, 0x74d4, 0xfe04, 0x7fbb, 0xe3b5, 0x620a, 0xe8da, 0x6965,
+ 0xd8d7, 0x5968, 0xd3b8, 0x5207, 0xce09, 0x4fb6, 0xc566, 0x44d9,
+ 0x18e3, 0x995c, 0x138c, 0x9233, 0x0e3d, 0x8f82, 0x0552, 0x84ed,
+ 0x355f, 0xb4e0, 0x3e30, 0xbf8f, 0x2381, 0xa23e, 0x28ee, 0xa951,
+ 0x439b, 0xc224, 0x48f4, 0xc94b, 0x5545, 0xd4fa, 0x5e2a, 0xdf95,
+ 0x6e27, 0xef98, 0x6548, 0xe4f7, 0x78f9, 0xf946, 0x7396, 0xf229,
+};
+
+const uint16_t crc16_8005_crc_table[CRC_SLICES * 256] = {
+ 0x0000, 0x8005, 0x800f, 0x000a, 0x801b, 0x001e, 0x0014, 0x8011,
+ 0x8033, 0x0036, 0x003c, 0x8039, 0x0028, 0x802d, 0x8027, 0x0022,
+ 0x8063, 0x0066, 0x006c, 0x8069, 0x0078, 0x807d, 0x8077, 0x0072,
+ 0x0050, 0x8055, 0x805f, 0x005a, 0x804b, 0x004e, 0x0044, 0x8041,
+ 0x80c3, 0x00c6, 0x00cc, 0x80c9, 0x00d8, 0x80dd, 0x80d7, 0x00d2,
+ 0x00f0, 0x80f5, 0x80ff, 0x00fa, 0x80eb, 0x00ee, 0x00e4, 0x80e1,
+ 0x00a0, 0x80a5, 0x80af, 0x00aa, 0x80bb, 0x00be, 0x00b4, 0x80b1,
+ 0x8093, 0x0096, 0x009c, 0x8099, 0x0088, 0x808d, 0x8087, 0x0082,
+ 0x8183, 0x0186, 0x018c, 0x8189, 0x0198, 0x819d, 0x8197, 0x0192,
+ 0x01b0, 0x81b5, 0x81bf, 0x01ba, 0x81ab, 0x01ae, 0x01a4, 0x81a1,
+ 0x01e0, 0x81e5, 0x81ef, 0x01ea, 0x81fb, 0x01fe, 0x01f4, 0x81f1,
+ 0x81d3, 0x01d6, 0x01dc, 0x81d9, 0x01c8, 0x81cd, 0x81c7, 0x01c2,
+ 0x0140, 0x8145, 0x814f, 0x014a, 0x815b, 0x015e, 0x0154, 0x8151,
+ 0x8173, 0x0176, 0x017c, 0x8179, 0x0168, 0x816d, 0x8167, 0x0162,
+ 0x8123, 0x0126, 0x012c, 0x8129, 0x0138, 0x813d, 0x8137, 0x0132,
+ 0x0110, 0x8115, 0x811f, 0x011a, 0x810b, 0x010e, 0x0104, 0x8101,
+ 0x8303, 0x0306, 0x030c, 0x8309, 0x0318, 0x831d, 0x8317, 0x0312,
+ 0x0330, 0x8335, 0x833f, 0x033a, 0x832b, 0x032e, 0x0324, 0x8321,
+ 0x0360, 0x8365, 0x836f, 0x036a, 0x837b, 0x037e, 0x0374, 0x8371,
+ 0x8353, 0x0356, 0x035c, 0x8359, 0x0348, 0x834d, 0x8347, 0x0342,
+ 0x03c0, 0x83c5, 0x83cf, 0x03ca, 0x83db, 0x03de, 0x03d4, 0x83d1,
+ 0x83f3, 0x03f6, 0x03fc, 0x83f9, 0x03e8, 0x83ed, 0x83e7, 0x03e2,
+ 0x83a3, 0x03a6, 0x03ac, 0x83a9, 0x03b8, 0x83bd, 0x83b7, 0x03b2,
+ 0x0390, 0x8395, 0x839f, 0x039a, 0x838b, 0x038e, 0x0384, 0x8381,
+ 0x0280, 0x8285, 0x828f, 0x028a, 0x829b, 0x029e, 0x0294, 0x8291,
+ 0x82b3, 0x02b6, 0x02bc, 0x82b9, 0x02a8, 0x82ad, 0x82a7, 0x02a2,
+ 0x82e3, 0x02e6, 0x02ec, 0x82e9, 0x02f8, 0x82fd, 0x82f7, 0x02f2,
+ 0x02d0, 0x82d5, 0x82df, 0x02da, 0x82cb, 0x02ce, 0x02c4, 0x82c1,
+ 0x8243, 0x0246, 0x024c, 0x8249, 0x0258, 0x825d, 0x8257, 0x0252,
+ 0x0270, 0x8275, 0x827f, 0x027a, 0x826b, 0x026e, 0x0264, 0x8261,
+ 0x0220, 0x8225, 0x822f, 0x022a, 0x823b, 0x023e, 0x0234, 0x8231,
+ 0x8213, 0x0216, 0x021c, 0x8219, 0x0208, 0x820d, 0x8207, 0x0202,
+ 0x0000, 0x8603, 0x8c03, 0x0a00, 0x9803, 0x1e00, 0x1400, 0x9203,
+ 0xb003, 0x3600, 0x3c00, 0xba03, 0x2800, 0xae03, 0xa403, 0x2200,
+ 0xe003, 0x6600, 0x6c00, 0xea03, 0x7800, 0xfe03, 0xf403, 0x7200,
+ 0x5000, 0xd603, 0xdc03, 0x5a00, 0xc803, 0x4e00, 0x4400, 0xc203,
+ 0x4003, 0xc600, 0xcc00, 0x4a03, 0xd800, 0x5e03, 0x5403, 0xd200,
+ 0xf000, 0x7603, 0x7c03, 0xfa00, 0x6803, 0xee00, 0xe400, 0x6203,
+ 0xa000, 0x2603, 0x2c03, 0xaa00, 0x3803, 0xbe00, 0xb400, 0x3203,
+ 0x1003, 0x9600, 0x9c00, 0x1a03, 0x8800, 0x0e03, 0x0403, 0x8200,
+ 0x8006, 0x0605, 0x0c05, 0x8a06, 0x1805, 0x9e06, 0x9406, 0x1205,
+ 0x3005, 0xb606, 0xbc06, 0x3a05, 0xa806, 0x2e05, 0x2405, 0xa206,
+ 0x6005, 0xe606, 0xec06, 0x6a05, 0xf806, 0x7e05, 0x7405, 0xf206,
+ 0xd006, 0x5605, 0x5c05, 0xda06, 0x4805, 0xce06, 0xc406, 0x4205,
+ 0xc005, 0x4606, 0x4c06, 0xca05, 0x5806, 0xde05, 0xd405, 0x5206,
+ 0x7006, 0xf605, 0xfc05, 0x7a06, 0xe805, 0x6e06, 0x6406, 0xe205,
+ 0x2006, 0xa605, 0xac05, 0x2a06, 0xb805, 0x3e06, 0x3406, 0xb205,
+ 0x9005, 0x1606, 0x1c06, 0x9a05, 0x0806, 0x8e05, 0x8405, 0x0206,
+ 0x8009, 0x060a, 0x0c0a, 0x8a09, 0x180a, 0x9e09, 0x9409, 0x120a,
+ 0x300a, 0xb609, 0xbc09, 0x3a0a, 0xa809, 0x2e0a, 0x240a, 0xa209,
+ 0x600a, 0xe609, 0xec09, 0x6a0a, 0xf809, 0x7e0a, 0x740a, 0xf209,
+ 0xd009, 0x560a, 0x5c0a, 0xda09, 0x480a, 0xce09, 0xc409, 0x420a,
+ 0xc00a, 0x4609, 0x4c09, 0xca0a, 0x5809, 0xde0a, 0xd40a, 0x5209,
+ 0x7009, 0xf60a, 0xfc0a, 0x7a09, 0xe80a, 0x6e09, 0x6409, 0xe20a,
+ 0x2009, 0xa60a, 0xac0a, 0x2a09, 0xb80a, 0x3e09, 0x3409, 0xb20a,
+ 0x900a, 0x1609, 0x1c09, 0x9a0a, 0x0809, 0x8e0a, 0x840a, 0x0209,
+ 0x000f, 0x860c, 0x8c0c, 0x0a0f, 0x980c, 0x1e0f, 0x140f, 0x920c,
+ 0xb00c, 0x360f, 0x3c0f, 0xba0c, 0x280f, 0xae0c, 0xa40c, 0x220f,
+ 0xe00c, 0x660f, 0x6c0f, 0xea0c, 0x780f, 0xfe0c, 0xf40c, 0x720f,
+ 0x500f, 0xd60c, 0xdc0c, 0x5a0f, 0xc80c, 0x4e0f, 0x440f, 0xc20c,
+ 0x400c, 0xc60f, 0xcc0f, 0x4a0c, 0xd80f, 0x5e0c, 0x540c, 0xd20f,
+ 0xf00f, 0x760c, 0x7c0c, 0xfa0f, 0x680c, 0xee0f, 0xe40f, 0x620c,
+ 0xa00f, 0x260c, 0x2c0c, 0xaa0f, 0x380c, 0xbe0f, 0xb40f, 0x320c,
+ 0x100c, 0x960f, 0x9c0f, 0x1a0c, 0x880f, 0x0e0c, 0x040c, 0x820f,
+ 0x0000, 0x8017, 0x802b, 0x003c, 0x8053, 0x0044, 0x0078, 0x806f,
+ 0x80a3, 0x00b4, 0x0088, 0x809f, 0x00f0, 0x80e7, 0x80db, 0x00cc,
+ 0x8143, 0x0154, 0x0168, 0x817f, 0x0110, 0x8107, 0x813b, 0x012c,
+ 0x01e0, 0x81f7, 0x81cb, 0x01dc, 0x81b3, 0x01a4, 0x0198, 0x818f,
+ 0x8283, 0x0294, 0x02a8, 0x82bf, 0x02d0, 0x82c7, 0x82fb, 0x02ec,
+ 0x0220, 0x8237, 0x820b, 0x021c, 0x8273, 0x0264, 0x0258, 0x824f,
+ 0x03c0, 0x83d7, 0x83eb, 0x03fc, 0x8393, 0x0384, 0x03b8, 0x83af,
+ 0x8363, 0x0374, 0x0348, 0x835f, 0x0330, 0x8327, 0x831b, 0x030c,
+ 0x8503, 0x0514, 0x0528, 0x853f, 0x0550, 0x8547, 0x857b, 0x056c,
+ 0x05a0, 0x85b7, 0x858b, 0x059c, 0x85f3, 0x05e4, 0x05d8, 0x85cf,
+ 0x0440, 0x8457, 0x846b, 0x047c, 0x8413, 0x0404, 0x0438, 0x842f,
+ 0x84e3, 0x04f4, 0x04c8, 0x84df, 0x04b0, 0x84a7, 0x849b, 0x048c,
+ 0x0780, 0x8797, 0x87ab, 0x07bc, 0x87d3, 0x07c4, 0x07f8, 0x87ef,
+ 0x8723, 0x0734, 0x0708, 0x871f, 0x0770, 0x8767, 0x875b, 0x074c,
+ 0x86c3, 0x06d4, 0x06e8, 0x86ff, 0x0690, 0x8687, 0x86bb, 0x06ac,
+ 0x0660, 0x8677, 0x864b, 0x065c, 0x8633, 0x0624, 0x0618, 0x860f,
+ 0x8a03, 0x0a14, 0x0a28, 0x8a3f, 0x0a50, 0x8a47, 0x8a7b, 0x0a6c,
+ 0x0aa0, 0x8ab7, 0x8a8b, 0x0a9c, 0x8af3, 0x0ae4, 0x0ad8, 0x8acf,
+ 0x0b40, 0x8b57, 0x8b6b, 0x0b7c, 0x8b13, 0x0b04, 0x0b38, 0x8b2f,
+ 0x8be3, 0x0bf4, 0x0bc8, 0x8bdf, 0x0bb0, 0x8ba7, 0x8b9b, 0x0b8c,
+ 0x0880, 0x8897, 0x88ab, 0x08bc, 0x88d3, 0x08c4, 0x08f8, 0x88ef,
+ 0x8823, 0x0834, 0x0808, 0x881f, 0x0870, 0x8867, 0x885b, 0x084c,
+ 0x89c3, 0x09d4, 0x09e8, 0x89ff, 0x0990, 0x8987, 0x89bb, 0x09ac,
+ 0x0960, 0x8977, 0x894b, 0x095c, 0x8933, 0x0924, 0x0918, 0x890f,
+ 0x0f00, 0x8f17, 0x8f2b, 0x0f3c, 0x8f53, 0x0f44, 0x0f78, 0x8f6f,
+ 0x8fa3, 0x0fb4, 0x0f88, 0x8f9f, 0x0ff0, 0x8fe7, 0x8fdb, 0x0fcc,
+ 0x8e43, 0x0e54, 0x0e68, 0x8e7f, 0x0e10, 0x8e07, 0x8e3b, 0x0e2c,
+ 0x0ee0, 0x8ef7, 0x8ecb, 0x0edc, 0x8eb3, 0x0ea4, 0x0e98, 0x8e8f,
+ 0x8d83, 0x0d94, 0x0da8, 0x8dbf, 0x0dd0, 0x8dc7, 0x8dfb, 0x0dec,
+ 0x0d20, 0x8d37, 0x8d0b, 0x0d1c, 0x8d73, 0x0d64, 0x0d58, 0x8d4f,
+ 0x0cc0, 0x8cd7, 0x8ceb, 0x0cfc, 0x8c93, 0x0c84, 0x0cb8, 0x8caf,
+ 0x8c63, 0x0c74, 0x0c48, 0x8c5f, 0x0c30, 0x8c27, 0x8c1b, 0x0c0c,
+ 0x0000, 0x9403, 0xa803, 0x3c00, 0xd003, 0x4400, 0x7800, 0xec03,
+ 0x2003, 0xb400, 0x8800, 0x1c03, 0xf000, 0x6403, 0x5803, 0xcc00,
+ 0x4006, 0xd405, 0xe805, 0x7c06, 0x9005, 0x0406, 0x3806, 0xac05,
+ 0x6005, 0xf406, 0xc806, 0x5c05, 0xb006, 0x2405, 0x1805, 0x8c06,
+ 0x800c, 0x140f, 0x280f, 0xbc0c, 0x500f, 0xc40c, 0xf80c, 0x6c0f,
+ 0xa00f, 0x340c, 0x080c, 0x9c0f, 0x700c, 0xe40f, 0xd80f, 0x4c0c,
+ 0xc00a, 0x5409, 0x6809, 0xfc0a, 0x1009, 0x840a, 0xb80a, 0x2c09,
+ 0xe009, 0x740a, 0x480a, 0xdc09, 0x300a, 0xa409, 0x9809, 0x0c0a,
+ 0x801d, 0x141e, 0x281e, 0xbc1d, 0x501e, 0xc41d, 0xf81d, 0x6c1e,
+ 0xa01e, 0x341d, 0x081d, 0x9c1e, 0x701d, 0xe41e, 0xd81e, 0x4c1d,
+ 0xc01b, 0x5418, 0x6818, 0xfc1b, 0x1018, 0x841b, 0xb81b, 0x2c18,
+ 0xe018, 0x741b, 0x481b, 0xdc18, 0x301b, 0xa418, 0x9818, 0x0c1b,
+ 0x0011, 0x9412, 0xa812, 0x3c11, 0xd012, 0x4411, 0x7811, 0xec12,
+ 0x2012, 0xb411, 0x8811, 0x1c12, 0xf011, 0x6412, 0x5812, 0xcc11,
+ 0x4017, 0xd414, 0xe814, 0x7c17, 0x9014, 0x0417, 0x3817, 0xac14,
+ 0x6014, 0xf417, 0xc817, 0x5c14, 0xb017, 0x2414, 0x1814, 0x8c17,
+ 0x803f, 0x143c, 0x283c, 0xbc3f, 0x503c, 0xc43f, 0xf83f, 0x6c3c,
+ 0xa03c, 0x343f, 0x083f, 0x9c3c, 0x703f, 0xe43c, 0xd83c, 0x4c3f,
+ 0xc039, 0x543a, 0x683a, 0xfc39, 0x103a, 0x8439, 0xb839, 0x2c3a,
+ 0xe03a, 0x7439, 0x4839, 0xdc3a, 0x3039, 0xa43a, 0x983a, 0x0c39,
+ 0x0033, 0x9430, 0xa830, 0x3c33, 0xd030, 0x4433, 0x7833, 0xec30,
+ 0x2030, 0xb433, 0x8833, 0x1c30, 0xf033, 0x6430, 0x5830, 0xcc33,
+ 0x4035, 0xd436, 0xe836, 0x7c35, 0x9036, 0x0435, 0x3835, 0xac36,
+ 0x6036, 0xf435, 0xc835, 0x5c36, 0xb035, 0x2436, 0x1836, 0x8c35,
+ 0x0022, 0x9421, 0xa821, 0x3c22, 0xd021, 0x4422, 0x7822, 0xec21,
+ 0x2021, 0xb422, 0x8822, 0x1c21, 0xf022, 0x6421, 0x5821, 0xcc22,
+ 0x4024, 0xd427, 0xe827, 0x7c24, 0x9027, 0x0424, 0x3824, 0xac27,
+ 0x6027, 0xf424, 0xc824, 0x5c27, 0xb024, 0x2427, 0x1827, 0x8c24,
+ 0x802e, 0x142d, 0x282d, 0xbc2e, 0x502d, 0xc42e, 0xf82e, 0x6c2d,
+ 0xa02d, 0x342e, 0x082e, 0x9c2d, 0x702e, 0xe42d, 0xd82d, 0x4c2e,
+ 0xc028, 0x542b, 0x682b, 0xfc28, 0x102b, 0x8428, 0xb828, 0x2c2b,
+ 0xe02b, 0x7428, 0x4828, 0xdc2b, 0x3028, 0xa42b, 0x982b, 0x0c28,
+ 0x0000, 0x807b, 0x80f3, 0x0088, 0x81e3, 0x0198, 0x0110, 0x816b,
+ 0x83c3, 0x03b8, 0x0330, 0x834b, 0x0220, 0x825b, 0x82d3, 0x02a8,
+ 0x8783, 0x07f8, 0x0770, 0x870b, 0x0660, 0x861b, 0x8693, 0x06e8,
+ 0x0440, 0x843b, 0x84b3, 0x04c8, 0x85a3, 0x05d8, 0x0550, 0x852b,
+ 0x8f03, 0x0f78, 0x0ff0, 0x8f8b, 0x0ee0, 0x8e9b, 0x8e13, 0x0e68,
+ 0x0cc0, 0x8cbb, 0x8c33, 0x0c48, 0x8d23, 0x0d58, 0x0dd0, 0x8dab,
+ 0x0880, 0x88fb, 0x8873, 0x0808, 0x8963, 0x0918, 0x0990, 0x89eb,
+ 0x8b43, 0x0b38, 0x0bb0, 0x8bcb, 0x0aa0, 0x8adb, 0x8a53, 0x0a28,
+ 0x9e03, 0x1e78, 0x1ef0, 0x9e8b, 0x1fe0, 0x9f9b, 0x9f13, 0x1f68,
+ 0x1dc0, 0x9dbb, 0x9d33, 0x1d48, 0x9c23, 0x1c58, 0x1cd0, 0x9cab,
+ 0x1980, 0x99fb, 0x9973, 0x1908, 0x9863, 0x1818, 0x1890, 0x98eb,
+ 0x9a43, 0x1a38, 0x1ab0, 0x9acb, 0x1ba0, 0x9bdb, 0x9b53, 0x1b28,
+ 0x1100, 0x917b, 0x91f3, 0x1188, 0x90e3, 0x1098, 0x1010, 0x906b,
+ 0x92c3, 0x12b8, 0x1230, 0x924b, 0x1320, 0x935b, 0x93d3, 0x13a8,
+ 0x9683, 0x16f8, 0x1670, 0x960b, 0x1760, 0x971b, 0x9793, 0x17e8,
+ 0x1540, 0x953b, 0x95b3, 0x15c8, 0x94a3, 0x14d8, 0x1450, 0x942b,
+ 0xbc03, 0x3c78, 0x3cf0, 0xbc8b, 0x3de0, 0xbd9b, 0xbd13, 0x3d68,
+ 0x3fc0, 0xbfbb, 0xbf33, 0x3f48, 0xbe23, 0x3e58, 0x3ed0, 0xbeab,
+ 0x3b80, 0xbbfb, 0xbb73, 0x3b08, 0xba63, 0x3a18, 0x3a90, 0xbaeb,
+ 0xb843, 0x3838, 0x38b0, 0xb8cb, 0x39a0, 0xb9db, 0xb953, 0x3928,
+ 0x3300, 0xb37b, 0xb3f3, 0x3388, 0xb2e3, 0x3298, 0x3210, 0xb26b,
+ 0xb0c3, 0x30b8, 0x3030, 0xb04b, 0x3120, 0xb15b, 0xb1d3, 0x31a8,
+ 0xb483, 0x34f8, 0x3470, 0xb40b, 0x3560, 0xb51b, 0xb593, 0x35e8,
+ 0x3740, 0xb73b, 0xb7b3, 0x37c8, 0xb6a3, 0x36d8, 0x3650, 0xb62b,
+ 0x2200, 0xa27b, 0xa2f3, 0x2288, 0xa3e3, 0x2398, 0x2310, 0xa36b,
+ 0xa1c3, 0x21b8, 0x2130, 0xa14b, 0x2020, 0xa05b, 0xa0d3, 0x20a8,
+ 0xa583, 0x25f8, 0x2570, 0xa50b, 0x2460, 0xa41b, 0xa493, 0x24e8,
+ 0x2640, 0xa63b, 0xa6b3, 0x26c8, 0xa7a3, 0x27d8, 0x2750, 0xa72b,
+ 0xad03, 0x2d78, 0x2df0, 0xad8b, 0x2ce0, 0xac9b, 0xac13, 0x2c68,
+ 0x2ec0, 0xaebb, 0xae33, 0x2e48, 0xaf23, 0x2f58, 0x2fd0, 0xafab,
+ 0x2a80, 0xaafb, 0xaa73, 0x2a08, 0xab63, 0x2b18, 0x2b90, 0xabeb,
+ 0xa943, 0x2938, 0x29b0, 0xa9cb, 0x28a0, 0xa8db, 0xa853, 0x2828,
+ 0x0000, 0xf803, 0x7003, 0x8800, 0xe006, 0x1805, 0x9005, 0x6806,
+ 0x4009, 0xb80a, 0x300a, 0xc809, 0xa00f, 0x580c, 0xd00c, 0x280f,
+ 0x8012, 0x7811, 0xf011, 0x0812, 0x6014, 0x9817, 0x1017, 0xe814,
+ 0xc01b, 0x3818, 0xb018, 0x481b, 0x201d, 0xd81e, 0x501e, 0xa81d,
+ 0x8021, 0x7822, 0xf022, 0x0821, 0x6027, 0x9824, 0x1024, 0xe827,
+ 0xc028, 0x382b, 0xb02b, 0x4828, 0x202e, 0xd82d, 0x502d, 0xa82e,
+ 0x0033, 0xf830, 0x7030, 0x8833, 0xe035, 0x1836, 0x9036, 0x6835,
+ 0x403a, 0xb839, 0x3039, 0xc83a, 0xa03c, 0x583f, 0xd03f, 0x283c,
+ 0x8047, 0x7844, 0xf044, 0x0847, 0x6041, 0x9842, 0x1042, 0xe841,
+ 0xc04e, 0x384d, 0xb04d, 0x484e, 0x2048, 0xd84b, 0x504b, 0xa848,
+ 0x0055, 0xf856, 0x7056, 0x8855, 0xe053, 0x1850, 0x9050, 0x6853,
+ 0x405c, 0xb85f, 0x305f, 0xc85c, 0xa05a, 0x5859, 0xd059, 0x285a,
+ 0x0066, 0xf865, 0x7065, 0x8866, 0xe060, 0x1863, 0x9063, 0x6860,
+ 0x406f, 0xb86c, 0x306c, 0xc86f, 0xa069, 0x586a, 0xd06a, 0x2869,
+ 0x8074, 0x7877, 0xf077, 0x0874, 0x6072, 0x9871, 0x1071, 0xe872,
+ 0xc07d, 0x387e, 0xb07e, 0x487d, 0x207b, 0xd878, 0x5078, 0xa87b,
+ 0x808b, 0x7888, 0xf088, 0x088b, 0x608d, 0x988e, 0x108e, 0xe88d,
+ 0xc082, 0x3881, 0xb081, 0x4882, 0x2084, 0xd887, 0x5087, 0xa884,
+ 0x0099, 0xf89a, 0x709a, 0x8899, 0xe09f, 0x189c, 0x909c, 0x689f,
+ 0x4090, 0xb893, 0x3093, 0xc890, 0xa096, 0x5895, 0xd095, 0x2896,
+ 0x00aa, 0xf8a9, 0x70a9, 0x88aa, 0xe0ac, 0x18af, 0x90af, 0x68ac,
+ 0x40a3, 0xb8a0, 0x30a0, 0xc8a3, 0xa0a5, 0x58a6, 0xd0a6, 0x28a5,
+ 0x80b8, 0x78bb, 0xf0bb, 0x08b8, 0x60be, 0x98bd, 0x10bd, 0xe8be,
+ 0xc0b1, 0x38b2, 0xb0b2, 0x48b1, 0x20b7, 0xd8b4, 0x50b4, 0xa8b7,
+ 0x00cc, 0xf8cf, 0x70cf, 0x88cc, 0xe0ca, 0x18c9, 0x90c9, 0x68ca,
+ 0x40c5, 0xb8c6, 0x30c6, 0xc8c5, 0xa0c3, 0x58c0, 0xd0c0, 0x28c3,
+ 0x80de, 0x78dd, 0xf0dd, 0x08de, 0x60d8, 0x98db, 0x10db, 0xe8d8,
+ 0xc0d7, 0x38d4, 0xb0d4, 0x48d7, 0x20d1, 0xd8d2, 0x50d2, 0xa8d1,
+ 0x80ed, 0x78ee, 0xf0ee, 0x08ed, 0x60eb, 0x98e8, 0x10e8, 0xe8eb,
+ 0xc0e4, 0x38e7, 0xb0e7, 0x48e4, 0x20e2, 0xd8e1, 0x50e1, 0xa8e2,
+ 0x00ff, 0xf8fc, 0x70fc, 0x88ff, 0xe0f9, 0x18fa, 0x90fa, 0x68f9,
+ 0x40f6, 0xb8f5, 0x30f5, 0xc8f6, 0xa0f0, 0x58f3, 0xd0f3, 0x28f0,
+ 0x0000, 0x8113, 0x8223, 0x0330, 0x8443, 0x0550, 0x0660, 0x8773,
+ 0x8883, 0x0990, 0x0aa0, 0x8bb3, 0x0cc0, 0x8dd3, 0x8ee3, 0x0ff0,
+ 0x9103, 0x1010, 0x1320, 0x9233, 0x1540, 0x9453, 0x9763, 0x1670,
+ 0x1980, 0x9893, 0x9ba3, 0x1ab0, 0x9dc3, 0x1cd0, 0x1fe0, 0x9ef3,
+ 0xa203, 0x2310, 0x2020, 0xa133, 0x2640, 0xa753, 0xa463, 0x2570,
+ 0x2a80, 0xab93, 0xa8a3, 0x29b0, 0xaec3, 0x2fd0, 0x2ce0, 0xadf3,
+ 0x3300, 0xb213, 0xb123, 0x3030, 0xb743, 0x3650, 0x3560, 0xb473,
+ 0xbb83, 0x3a90, 0x39a0, 0xb8b3, 0x3fc0, 0xbed3, 0xbde3, 0x3cf0,
+ 0xc403, 0x4510, 0x4620, 0xc733, 0x4040, 0xc153, 0xc263, 0x4370,
+ 0x4c80, 0xcd93, 0xcea3, 0x4fb0, 0xc8c3, 0x49d0, 0x4ae0, 0xcbf3,
+ 0x5500, 0xd413, 0xd723, 0x5630, 0xd143, 0x5050, 0x5360, 0xd273,
+ 0xdd83, 0x5c90, 0x5fa0, 0xdeb3, 0x59c0, 0xd8d3, 0xdbe3, 0x5af0,
+ 0x6600, 0xe713, 0xe423, 0x6530, 0xe243, 0x6350, 0x6060, 0xe173,
+ 0xee83, 0x6f90, 0x6ca0, 0xedb3, 0x6ac0, 0xebd3, 0xe8e3, 0x69f0,
+ 0xf703, 0x7610, 0x7520, 0xf433, 0x7340, 0xf253, 0xf163, 0x7070,
+ 0x7f80, 0xfe93, 0xfda3, 0x7cb0, 0xfbc3, 0x7ad0, 0x79e0, 0xf8f3,
+ 0x0803, 0x8910, 0x8a20, 0x0b33, 0x8c40, 0x0d53, 0x0e63, 0x8f70,
+ 0x8080, 0x0193, 0x02a3, 0x83b0, 0x04c3, 0x85d0, 0x86e0, 0x07f3,
+ 0x9900, 0x1813, 0x1b23, 0x9a30, 0x1d43, 0x9c50, 0x9f60, 0x1e73,
+ 0x1183, 0x9090, 0x93a0, 0x12b3, 0x95c0, 0x14d3, 0x17e3, 0x96f0,
+ 0xaa00, 0x2b13, 0x2823, 0xa930, 0x2e43, 0xaf50, 0xac60, 0x2d73,
+ 0x2283, 0xa390, 0xa0a0, 0x21b3, 0xa6c0, 0x27d3, 0x24e3, 0xa5f0,
+ 0x3b03, 0xba10, 0xb920, 0x3833, 0xbf40, 0x3e53, 0x3d63, 0xbc70,
+ 0xb380, 0x3293, 0x31a3, 0xb0b0, 0x37c3, 0xb6d0, 0xb5e0, 0x34f3,
+ 0xcc00, 0x4d13, 0x4e23, 0xcf30, 0x4843, 0xc950, 0xca60, 0x4b73,
+ 0x4483, 0xc590, 0xc6a0, 0x47b3, 0xc0c0, 0x41d3, 0x42e3, 0xc3f0,
+ 0x5d03, 0xdc10, 0xdf20, 0x5e33, 0xd940, 0x5853, 0x5b63, 0xda70,
+ 0xd580, 0x5493, 0x57a3, 0xd6b0, 0x51c3, 0xd0d0, 0xd3e0, 0x52f3,
+ 0x6e03, 0xef10, 0xec20, 0x6d33, 0xea40, 0x6b53, 0x6863, 0xe970,
+ 0xe680, 0x6793, 0x64a3, 0xe5b0, 0x62c3, 0xe3d0, 0xe0e0, 0x61f3,
+ 0xff00, 0x7e13, 0x7d23, 0xfc30, 0x7b43, 0xfa50, 0xf960, 0x7873,
+ 0x7783, 0xf690, 0xf5a0, 0x74b3, 0xf3c0, 0x72d3, 0x71e3, 0xf0f0,
+ 0x0000, 0x1006, 0x200c, 0x300a, 0x4018, 0x501e, 0x6014, 0x7012,
+ 0x8030, 0x9036, 0xa03c, 0xb03a, 0xc028, 0xd02e, 0xe024, 0xf022,
+ 0x8065, 0x9063, 0xa069, 0xb06f, 0xc07d, 0xd07b, 0xe071, 0xf077,
+ 0x0055, 0x1053, 0x2059, 0x305f, 0x404d, 0x504b, 0x6041, 0x7047,
+ 0x80cf, 0x90c9, 0xa0c3, 0xb0c5, 0xc0d7, 0xd0d1, 0xe0db, 0xf0dd,
+ 0x00ff, 0x10f9, 0x20f3, 0x30f5, 0x40e7, 0x50e1, 0x60eb, 0x70ed,
+ 0x00aa, 0x10ac, 0x20a6, 0x30a0, 0x40b2, 0x50b4, 0x60be, 0x70b8,
+ 0x809a, 0x909c, 0xa096, 0xb090, 0xc082, 0xd084, 0xe08e, 0xf088,
+ 0x819b, 0x919d, 0xa197, 0xb191, 0xc183, 0xd185, 0xe18f, 0xf189,
+ 0x01ab, 0x11ad, 0x21a7, 0x31a1, 0x41b3, 0x51b5, 0x61bf, 0x71b9,
+ 0x01fe, 0x11f8, 0x21f2, 0x31f4, 0x41e6, 0x51e0, 0x61ea, 0x71ec,
+ 0x81ce, 0x91c8, 0xa1c2, 0xb1c4, 0xc1d6, 0xd1d0, 0xe1da, 0xf1dc,
+ 0x0154, 0x1152, 0x2158, 0x315e, 0x414c, 0x514a, 0x6140, 0x7146,
+ 0x8164, 0x9162, 0xa168, 0xb16e, 0xc17c, 0xd17a, 0xe170, 0xf176,
+ 0x8131, 0x9137, 0xa13d, 0xb13b, 0xc129, 0xd12f, 0xe125, 0xf123,
+ 0x0101, 0x1107, 0x210d, 0x310b, 0x4119, 0x511f, 0x6115, 0x7113,
+ 0x8333, 0x9335, 0xa33f, 0xb339, 0xc32b, 0xd32d, 0xe327, 0xf321,
+ 0x0303, 0x1305, 0x230f, 0x3309, 0x431b, 0x531d, 0x6317, 0x7311,
+ 0x0356, 0x1350, 0x235a, 0x335c, 0x434e, 0x5348, 0x6342, 0x7344,
+ 0x8366, 0x9360, 0xa36a, 0xb36c, 0xc37e, 0xd378, 0xe372, 0xf374,
+ 0x03fc, 0x13fa, 0x23f0, 0x33f6, 0x43e4, 0x53e2, 0x63e8, 0x73ee,
+ 0x83cc, 0x93ca, 0xa3c0, 0xb3c6, 0xc3d4, 0xd3d2, 0xe3d8, 0xf3de,
+ 0x8399, 0x939f, 0xa395, 0xb393, 0xc381, 0xd387, 0xe38d, 0xf38b,
+ 0x03a9, 0x13af, 0x23a5, 0x33a3, 0x43b1, 0x53b7, 0x63bd, 0x73bb,
+ 0x02a8, 0x12ae, 0x22a4, 0x32a2, 0x42b0, 0x52b6, 0x62bc, 0x72ba,
+ 0x8298, 0x929e, 0xa294, 0xb292, 0xc280, 0xd286, 0xe28c, 0xf28a,
+ 0x82cd, 0x92cb, 0xa2c1, 0xb2c7, 0xc2d5, 0xd2d3, 0xe2d9, 0xf2df,
+ 0x02fd, 0x12fb, 0x22f1, 0x32f7, 0x42e5, 0x52e3, 0x62e9, 0x72ef,
+ 0x8267, 0x9261, 0xa26b, 0xb26d, 0xc27f, 0xd279, 0xe273, 0xf275,
+ 0x0257, 0x1251, 0x225b, 0x325d, 0x424f, 0x5249, 0x6243, 0x7245,
+ 0x0202, 0x1204, 0x220e, 0x3208, 0x421a, 0x521c, 0x6216, 0x7210,
+ 0x8232, 0x9234, 0xa23e, 0xb238, 0xc22a, 0xd22c, 0xe226, 0xf220,
+};
+
+const uint16_t crc16_8005_reflected_crc_table[CRC_SLICES * 256] = {
+ 0x0000, 0xc0c1, 0xc181, 0x0140, 0xc301, 0x03c0, 0x0280, 0xc241,
+ 0xc601, 0x06c0, 0x0780, 0xc741, 0x0500, 0xc5c1, 0xc481, 0x0440,
+ 0xcc01, 0x0cc0, 0x0d80, 0xcd41, 0x0f00, 0xcfc1, 0xce81, 0x0e40,
+ 0x0a00, 0xcac1, 0xcb81, 0x0b40, 0xc901, 0x09c0, 0x0880, 0xc841,
+ 0xd801, 0x18c0, 0x1980, 0xd941, 0x1b00, 0xdbc1, 0xda81, 0x1a40,
+ 0x1e00, 0xdec1, 0xdf81, 0x1f40, 0xdd01, 0x1dc0, 0x1c80, 0xdc41,
+ 0x1400, 0xd4c1, 0xd581, 0x1540, 0xd701, 0x17c0, 0x1680, 0xd641,
+ 0xd201, 0x12c0, 0x1380, 0xd341, 0x1100, 0xd1c1, 0xd081, 0x1040,
+ 0xf001, 0x30c0, 0x3180, 0xf141, 0x3300, 0xf3c1, 0xf281, 0x3240,
+ 0x3600, 0xf6c1, 0xf781, 0x3740, 0xf501, 0x35c0, 0x3480, 0xf441,
+ 0x3c00, 0xfcc1, 0xfd81, 0x3d40, 0xff01, 0x3fc0, 0x3e80, 0xfe41,
+ 0xfa01, 0x3ac0, 0x3b80, 0xfb41, 0x3900, 0xf9c1, 0xf881, 0x3840,
+ 0x2800, 0xe8c1, 0xe981, 0x2940, 0xeb01, 0x2bc0, 0x2a80, 0xea41,
+ 0xee01, 0x2ec0, 0x2f80, 0xef41, 0x2d00, 0xedc1, 0xec81, 0x2c40,
+ 0xe401, 0x24c0, 0x2580, 0xe541, 0x2700, 0xe7c1, 0xe681, 0x2640,
+ 0x2200, 0xe2c1, 0xe381, 0x2340, 0xe101, 0x21c0, 0x2080, 0xe041,
+ 0xa001, 0x60c0, 0x6180, 0xa141, 0x6300, 0xa3c1, 0xa281, 0x6240,
+ 0x6600, 0xa6c1, 0xa781, 0x6740, 0xa501, 0x65c0, 0x6480, 0xa441,
+ 0x6c00, 0xacc1, 0xad81, 0x6d40, 0xaf01, 0x6fc0, 0x6e80, 0xae41,
+ 0xaa01, 0x6ac0, 0x6b80, 0xab41, 0x6900, 0xa9c1, 0xa881, 0x6840,
+ 0x7800, 0xb8c1, 0xb981, 0x7940, 0xbb01, 0x7bc0, 0x7a80, 0xba41,
+ 0xbe01, 0x7ec0, 0x7f80, 0xbf41, 0x7d00, 0xbdc1, 0xbc81, 0x7c40,
+ 0xb401, 0x74c0, 0x7580, 0xb541, 0x7700, 0xb7c1, 0xb681, 0x7640,
+ 0x7200, 0xb2c1, 0xb381, 0x7340, 0xb101, 0x71c0, 0x7080, 0xb041,
+ 0x5000, 0x90c1, 0x9181, 0x5140, 0x9301, 0x53c0, 0x5280, 0x9241,
+ 0x9601, 0x56c0, 0x5780, 0x9741, 0x5500, 0x95c1, 0x9481, 0x5440,
+ 0x9c01, 0x5cc0, 0x5d80, 0x9d41, 0x5f00, 0x9fc1, 0x9e81, 0x5e40,
+ 0x5a00, 0x9ac1, 0x9b81, 0x5b40, 0x9901, 0x59c0, 0x5880, 0x9841,
+ 0x8801, 0x48c0, 0x4980, 0x8941, 0x4b00, 0x8bc1, 0x8a81, 0x4a40,
+ 0x4e00, 0x8ec1, 0x8f81, 0x4f40, 0x8d01, 0x4dc0, 0x4c80, 0x8c41,
+ 0x4400, 0x84c1, 0x8581, 0x4540, 0x8701, 0x47c0, 0x4680, 0x8641,
+ 0x8201, 0x42c0, 0x4380, 0x8341, 0x4100, 0x81c1, 0x8081, 0x4040,
+ 0x0000, 0x9001, 0x6001, 0xf000, 0xc002, 0x5003, 0xa003, 0x3002,
+ 0xc007, 0x5006, 0xa006, 0x3007, 0x0005, 0x9004, 0x6004, 0xf005,
+ 0xc00d, 0x500c, 0xa00c, 0x300d, 0x000f, 0x900e, 0x600e, 0xf00f,
+ 0x000a, 0x900b, 0x600b, 0xf00a, 0xc008, 0x5009, 0xa009, 0x3008,
+ 0xc019, 0x5018, 0xa018, 0x3019, 0x001b, 0x901a, 0x601a, 0xf01b,
+ 0x001e, 0x901f, 0x601f, 0xf01e, 0xc01c, 0x501d, 0xa01d, 0x301c,
+ 0x0014, 0x9015, 0x6015, 0xf014, 0xc016, 0x5017, 0xa017, 0x3016,
+ 0xc013, 0x5012, 0xa012, 0x3013, 0x0011, 0x9010, 0x6010, 0xf011,
+ 0xc031, 0x5030, 0xa030, 0x3031, 0x0033, 0x9032, 0x6032, 0xf033,
+ 0x0036, 0x9037, 0x6037, 0xf036, 0xc034, 0x5035, 0xa035, 0x3034,
+ 0x003c, 0x903d, 0x603d, 0xf03c, 0xc03e, 0x503f, 0xa03f, 0x303e,
+ 0xc03b, 0x503a, 0xa03a, 0x303b, 0x0039, 0x9038, 0x6038, 0xf039,
+ 0x0028, 0x9029, 0x6029, 0xf028, 0xc02a, 0x502b, 0xa02b, 0x302a,
+ 0xc02f, 0x502e, 0xa02e, 0x302f, 0x002d, 0x902c, 0x602c, 0xf02d,
+ 0xc025, 0x5024, 0xa024, 0x3025, 0x0027, 0x9026, 0x6026, 0xf027,
+ 0x0022, 0x9023, 0x6023, 0xf022, 0xc020, 0x5021, 0xa021, 0x3020,
+ 0xc061, 0x5060, 0xa060, 0x3061, 0x0063, 0x9062, 0x6062, 0xf063,
+ 0x0066, 0x9067, 0x6067, 0xf066, 0xc064, 0x5065, 0xa065, 0x3064,
+ 0x006c, 0x906d, 0x606d, 0xf06c, 0xc06e, 0x506f, 0xa06f, 0x306e,
+ 0xc06b, 0x506a, 0xa06a, 0x306b, 0x0069, 0x9068, 0x6068, 0xf069,
+ 0x0078, 0x9079, 0x6079, 0xf078, 0xc07a, 0x507b, 0xa07b, 0x307a,
+ 0xc07f, 0x507e, 0xa07e, 0x307f, 0x007d, 0x907c, 0x607c, 0xf07d,
+ 0xc075, 0x5074, 0xa074, 0x3075, 0x0077, 0x9076, 0x6076, 0xf077,
+ 0x0072, 0x9073, 0x6073, 0xf072, 0xc070, 0x5071, 0xa071, 0x3070,
+ 0x0050, 0x9051, 0x6051, 0xf050, 0xc052, 0x5053, 0xa053, 0x3052,
+ 0xc057, 0x5056, 0xa056, 0x3057, 0x0055, 0x9054, 0x6054, 0xf055,
+ 0xc05d, 0x505c, 0xa05c, 0x305d, 0x005f, 0x905e, 0x605e, 0xf05f,
+ 0x005a, 0x905b, 0x605b, 0xf05a, 0xc058, 0x5059, 0xa059, 0x3058,
+ 0xc049, 0x5048, 0xa048, 0x3049, 0x004b, 0x904a, 0x604a, 0xf04b,
+ 0x004e, 0x904f, 0x604f, 0xf04e, 0xc04c, 0x504d, 0xa04d, 0x304c,
+ 0x0044, 0x9045, 0x6045, 0xf044, 0xc046, 0x5047, 0xa047, 0x3046,
+ 0xc043, 0x5042, 0xa042, 0x3043, 0x0041, 0x9040, 0x6040, 0xf041,
+ 0x0000, 0xc051, 0xc0a1, 0x00f0, 0xc141, 0x0110, 0x01e0, 0xc1b1,
+ 0xc281, 0x02d0, 0x0220, 0xc271, 0x03c0, 0xc391, 0xc361, 0x0330,
+ 0xc501, 0x0550, 0x05a0, 0xc5f1, 0x0440, 0xc411, 0xc4e1, 0x04b0,
+ 0x0780, 0xc7d1, 0xc721, 0x0770, 0xc6c1, 0x0690, 0x0660, 0xc631,
+ 0xca01, 0x0a50, 0x0aa0, 0xcaf1, 0x0b40, 0xcb11, 0xcbe1, 0x0bb0,
+ 0x0880, 0xc8d1, 0xc821, 0x0870, 0xc9c1, 0x0990, 0x0960, 0xc931,
+ 0x0f00, 0xcf51, 0xcfa1, 0x0ff0, 0xce41, 0x0e10, 0x0ee0, 0xceb1,
+ 0xcd81, 0x0dd0, 0x0d20, 0xcd71, 0x0cc0, 0xcc91, 0xcc61, 0x0c30,
+ 0xd401, 0x1450, 0x14a0, 0xd4f1, 0x1540, 0xd511, 0xd5e1, 0x15b0,
+ 0x1680, 0xd6d1, 0xd621, 0x1670, 0xd7c1, 0x1790, 0x1760, 0xd731,
+ 0x1100, 0xd151, 0xd1a1, 0x11f0, 0xd041, 0x1010, 0x10e0, 0xd0b1,
+ 0xd381, 0x13d0, 0x1320, 0xd371, 0x12c0, 0xd291, 0xd261, 0x1230,
+ 0x1e00, 0xde51, 0xdea1, 0x1ef0, 0xdf41, 0x1f10, 0x1fe0, 0xdfb1,
+ 0xdc81, 0x1cd0, 0x1c20, 0xdc71, 0x1dc0, 0xdd91, 0xdd61, 0x1d30,
+ 0xdb01, 0x1b50, 0x1ba0, 0xdbf1, 0x1a40, 0xda11, 0xdae1, 0x1ab0,
+ 0x1980, 0xd9d1, 0xd921, 0x1970, 0xd8c1, 0x1890, 0x1860, 0xd831,
+ 0xe801, 0x2850, 0x28a0, 0xe8f1, 0x2940, 0xe911, 0xe9e1, 0x29b0,
+ 0x2a80, 0xead1, 0xea21, 0x2a70, 0xebc1, 0x2b90, 0x2b60, 0xeb31,
+ 0x2d00, 0xed51, 0xeda1, 0x2df0, 0xec41, 0x2c10, 0x2ce0, 0xecb1,
+ 0xef81, 0x2fd0, 0x2f20, 0xef71, 0x2ec0, 0xee91, 0xee61, 0x2e30,
+ 0x2200, 0xe251, 0xe2a1, 0x22f0, 0xe341, 0x2310, 0x23e0, 0xe3b1,
+ 0xe081, 0x20d0, 0x2020, 0xe071, 0x21c0, 0xe191, 0xe161, 0x2130,
+ 0xe701, 0x2750, 0x27a0, 0xe7f1, 0x2640, 0xe611, 0xe6e1, 0x26b0,
+ 0x2580, 0xe5d1, 0xe521, 0x2570, 0xe4c1, 0x2490, 0x2460, 0xe431,
+ 0x3c00, 0xfc51, 0xfca1, 0x3cf0, 0xfd41, 0x3d10, 0x3de0, 0xfdb1,
+ 0xfe81, 0x3ed0, 0x3e20, 0xfe71, 0x3fc0, 0xff91, 0xff61, 0x3f30,
+ 0xf901, 0x3950, 0x39a0, 0xf9f1, 0x3840, 0xf811, 0xf8e1, 0x38b0,
+ 0x3b80, 0xfbd1, 0xfb21, 0x3b70, 0xfac1, 0x3a90, 0x3a60, 0xfa31,
+ 0xf601, 0x3650, 0x36a0, 0xf6f1, 0x3740, 0xf711, 0xf7e1, 0x37b0,
+ 0x3480, 0xf4d1, 0xf421, 0x3470, 0xf5c1, 0x3590, 0x3560, 0xf531,
+ 0x3300, 0xf351, 0xf3a1, 0x33f0, 0xf241, 0x3210, 0x32e0, 0xf2b1,
+ 0xf181, 0x31d0, 0x3120, 0xf171, 0x30c0, 0xf091, 0xf061, 0x3030,
+ 0x0000, 0xfc01, 0xb801, 0x4400, 0x3001, 0xcc00, 0x8800, 0x7401,
+ 0x6002, 0x9c03, 0xd803, 0x2402, 0x5003, 0xac02, 0xe802, 0x1403,
+ 0xc004, 0x3c05, 0x7805, 0x8404, 0xf005, 0x0c04, 0x4804, 0xb405,
+ 0xa006, 0x5c07, 0x1807, 0xe406, 0x9007, 0x6c06, 0x2806, 0xd407,
+ 0xc00b, 0x3c0a, 0x780a, 0x840b, 0xf00a, 0x0c0b, 0x480b, 0xb40a,
+ 0xa009, 0x5c08, 0x1808, 0xe409, 0x9008, 0x6c09, 0x2809, 0xd408,
+ 0x000f, 0xfc0e, 0xb80e, 0x440f, 0x300e, 0xcc0f, 0x880f, 0x740e,
+ 0x600d, 0x9c0c, 0xd80c, 0x240d, 0x500c, 0xac0d, 0xe80d, 0x140c,
+ 0xc015, 0x3c14, 0x7814, 0x8415, 0xf014, 0x0c15, 0x4815, 0xb414,
+ 0xa017, 0x5c16, 0x1816, 0xe417, 0x9016, 0x6c17, 0x2817, 0xd416,
+ 0x0011, 0xfc10, 0xb810, 0x4411, 0x3010, 0xcc11, 0x8811, 0x7410,
+ 0x6013, 0x9c12, 0xd812, 0x2413, 0x5012, 0xac13, 0xe813, 0x1412,
+ 0x001e, 0xfc1f, 0xb81f, 0x441e, 0x301f, 0xcc1e, 0x881e, 0x741f,
+ 0x601c, 0x9c1d, 0xd81d, 0x241c, 0x501d, 0xac1c, 0xe81c, 0x141d,
+ 0xc01a, 0x3c1b, 0x781b, 0x841a, 0xf01b, 0x0c1a, 0x481a, 0xb41b,
+ 0xa018, 0x5c19, 0x1819, 0xe418, 0x9019, 0x6c18, 0x2818, 0xd419,
+ 0xc029, 0x3c28, 0x7828, 0x8429, 0xf028, 0x0c29, 0x4829, 0xb428,
+ 0xa02b, 0x5c2a, 0x182a, 0xe42b, 0x902a, 0x6c2b, 0x282b, 0xd42a,
+ 0x002d, 0xfc2c, 0xb82c, 0x442d, 0x302c, 0xcc2d, 0x882d, 0x742c,
+ 0x602f, 0x9c2e, 0xd82e, 0x242f, 0x502e, 0xac2f, 0xe82f, 0x142e,
+ 0x0022, 0xfc23, 0xb823, 0x4422, 0x3023, 0xcc22, 0x8822, 0x7423,
+ 0x6020, 0x9c21, 0xd821, 0x2420, 0x5021, 0xac20, 0xe820, 0x1421,
+ 0xc026, 0x3c27, 0x7827, 0x8426, 0xf027, 0x0c26, 0x4826, 0xb427,
+ 0xa024, 0x5c25, 0x1825, 0xe424, 0x9025, 0x6c24, 0x2824, 0xd425,
+ 0x003c, 0xfc3d, 0xb83d, 0x443c, 0x303d, 0xcc3c, 0x883c, 0x743d,
+ 0x603e, 0x9c3f, 0xd83f, 0x243e, 0x503f, 0xac3e, 0xe83e, 0x143f,
+ 0xc038, 0x3c39, 0x7839, 0x8438, 0xf039, 0x0c38, 0x4838, 0xb439,
+ 0xa03a, 0x5c3b, 0x183b, 0xe43a, 0x903b, 0x6c3a, 0x283a, 0xd43b,
+ 0xc037, 0x3c36, 0x7836, 0x8437, 0xf036, 0x0c37, 0x4837, 0xb436,
+ 0xa035, 0x5c34, 0x1834, 0xe435, 0x9034, 0x6c35, 0x2835, 0xd434,
+ 0x0033, 0xfc32, 0xb832, 0x4433, 0x3032, 0xcc33, 0x8833, 0x7432,
+ 0x6031, 0x9c30, 0xd830, 0x2431, 0x5030, 0xac31, 0xe831, 0x1430,
+ 0x0000, 0xc03d, 0xc079, 0x0044, 0xc0f1, 0x00cc, 0x0088, 0xc0b5,
+ 0xc1e1, 0x01dc, 0x0198, 0xc1a5, 0x0110, 0xc12d, 0xc169, 0x0154,
+ 0xc3c1, 0x03fc, 0x03b8, 0xc385, 0x0330, 0xc30d, 0xc349, 0x0374,
+ 0x0220, 0xc21d, 0xc259, 0x0264, 0xc2d1, 0x02ec, 0x02a8, 0xc295,
+ 0xc781, 0x07bc, 0x07f8, 0xc7c5, 0x0770, 0xc74d, 0xc709, 0x0734,
+ 0x0660, 0xc65d, 0xc619, 0x0624, 0xc691, 0x06ac, 0x06e8, 0xc6d5,
+ 0x0440, 0xc47d, 0xc439, 0x0404, 0xc4b1, 0x048c, 0x04c8, 0xc4f5,
+ 0xc5a1, 0x059c, 0x05d8, 0xc5e5, 0x0550, 0xc56d, 0xc529, 0x0514,
+ 0xcf01, 0x0f3c, 0x0f78, 0xcf45, 0x0ff0, 0xcfcd, 0xcf89, 0x0fb4,
+ 0x0ee0, 0xcedd, 0xce99, 0x0ea4, 0xce11, 0x0e2c, 0x0e68, 0xce55,
+ 0x0cc0, 0xccfd, 0xccb9, 0x0c84, 0xcc31, 0x0c0c, 0x0c48, 0xcc75,
+ 0xcd21, 0x0d1c, 0x0d58, 0xcd65, 0x0dd0, 0xcded, 0xcda9, 0x0d94,
+ 0x0880, 0xc8bd, 0xc8f9, 0x08c4, 0xc871, 0x084c, 0x0808, 0xc835,
+ 0xc961, 0x095c, 0x0918, 0xc925, 0x0990, 0xc9ad, 0xc9e9, 0x09d4,
+ 0xcb41, 0x0b7c, 0x0b38, 0xcb05, 0x0bb0, 0xcb8d, 0xcbc9, 0x0bf4,
+ 0x0aa0, 0xca9d, 0xcad9, 0x0ae4, 0xca51, 0x0a6c, 0x0a28, 0xca15,
+ 0xde01, 0x1e3c, 0x1e78, 0xde45, 0x1ef0, 0xdecd, 0xde89, 0x1eb4,
+ 0x1fe0, 0xdfdd, 0xdf99, 0x1fa4, 0xdf11, 0x1f2c, 0x1f68, 0xdf55,
+ 0x1dc0, 0xddfd, 0xddb9, 0x1d84, 0xdd31, 0x1d0c, 0x1d48, 0xdd75,
+ 0xdc21, 0x1c1c, 0x1c58, 0xdc65, 0x1cd0, 0xdced, 0xdca9, 0x1c94,
+ 0x1980, 0xd9bd, 0xd9f9, 0x19c4, 0xd971, 0x194c, 0x1908, 0xd935,
+ 0xd861, 0x185c, 0x1818, 0xd825, 0x1890, 0xd8ad, 0xd8e9, 0x18d4,
+ 0xda41, 0x1a7c, 0x1a38, 0xda05, 0x1ab0, 0xda8d, 0xdac9, 0x1af4,
+ 0x1ba0, 0xdb9d, 0xdbd9, 0x1be4, 0xdb51, 0x1b6c, 0x1b28, 0xdb15,
+ 0x1100, 0xd13d, 0xd179, 0x1144, 0xd1f1, 0x11cc, 0x1188, 0xd1b5,
+ 0xd0e1, 0x10dc, 0x1098, 0xd0a5, 0x1010, 0xd02d, 0xd069, 0x1054,
+ 0xd2c1, 0x12fc, 0x12b8, 0xd285, 0x1230, 0xd20d, 0xd249, 0x1274,
+ 0x1320, 0xd31d, 0xd359, 0x1364, 0xd3d1, 0x13ec, 0x13a8, 0xd395,
+ 0xd681, 0x16bc, 0x16f8, 0xd6c5, 0x1670, 0xd64d, 0xd609, 0x1634,
+ 0x1760, 0xd75d, 0xd719, 0x1724, 0xd791, 0x17ac, 0x17e8, 0xd7d5,
+ 0x1540, 0xd57d, 0xd539, 0x1504, 0xd5b1, 0x158c, 0x15c8, 0xd5f5,
+ 0xd4a1, 0x149c, 0x14d8, 0xd4e5, 0x1450, 0xd46d, 0xd429, 0x1414,
+ 0x0000, 0xd101, 0xe201, 0x3300, 0x8401, 0x5500, 0x6600, 0xb701,
+ 0x4801, 0x9900, 0xaa00, 0x7b01, 0xcc00, 0x1d01, 0x2e01, 0xff00,
+ 0x9002, 0x4103, 0x7203, 0xa302, 0x1403, 0xc502, 0xf602, 0x2703,
+ 0xd803, 0x0902, 0x3a02, 0xeb03, 0x5c02, 0x8d03, 0xbe03, 0x6f02,
+ 0x6007, 0xb106, 0x8206, 0x5307, 0xe406, 0x3507, 0x0607, 0xd706,
+ 0x2806, 0xf907, 0xca07, 0x1b06, 0xac07, 0x7d06, 0x4e06, 0x9f07,
+ 0xf005, 0x2104, 0x1204, 0xc305, 0x7404, 0xa505, 0x9605, 0x4704,
+ 0xb804, 0x6905, 0x5a05, 0x8b04, 0x3c05, 0xed04, 0xde04, 0x0f05,
+ 0xc00e, 0x110f, 0x220f, 0xf30e, 0x440f, 0x950e, 0xa60e, 0x770f,
+ 0x880f, 0x590e, 0x6a0e, 0xbb0f, 0x0c0e, 0xdd0f, 0xee0f, 0x3f0e,
+ 0x500c, 0x810d, 0xb20d, 0x630c, 0xd40d, 0x050c, 0x360c, 0xe70d,
+ 0x180d, 0xc90c, 0xfa0c, 0x2b0d, 0x9c0c, 0x4d0d, 0x7e0d, 0xaf0c,
+ 0xa009, 0x7108, 0x4208, 0x9309, 0x2408, 0xf509, 0xc609, 0x1708,
+ 0xe808, 0x3909, 0x0a09, 0xdb08, 0x6c09, 0xbd08, 0x8e08, 0x5f09,
+ 0x300b, 0xe10a, 0xd20a, 0x030b, 0xb40a, 0x650b, 0x560b, 0x870a,
+ 0x780a, 0xa90b, 0x9a0b, 0x4b0a, 0xfc0b, 0x2d0a, 0x1e0a, 0xcf0b,
+ 0xc01f, 0x111e, 0x221e, 0xf31f, 0x441e, 0x951f, 0xa61f, 0x771e,
+ 0x881e, 0x591f, 0x6a1f, 0xbb1e, 0x0c1f, 0xdd1e, 0xee1e, 0x3f1f,
+ 0x501d, 0x811c, 0xb21c, 0x631d, 0xd41c, 0x051d, 0x361d, 0xe71c,
+ 0x181c, 0xc91d, 0xfa1d, 0x2b1c, 0x9c1d, 0x4d1c, 0x7e1c, 0xaf1d,
+ 0xa018, 0x7119, 0x4219, 0x9318, 0x2419, 0xf518, 0xc618, 0x1719,
+ 0xe819, 0x3918, 0x0a18, 0xdb19, 0x6c18, 0xbd19, 0x8e19, 0x5f18,
+ 0x301a, 0xe11b, 0xd21b, 0x031a, 0xb41b, 0x651a, 0x561a, 0x871b,
+ 0x781b, 0xa91a, 0x9a1a, 0x4b1b, 0xfc1a, 0x2d1b, 0x1e1b, 0xcf1a,
+ 0x0011, 0xd110, 0xe210, 0x3311, 0x8410, 0x5511, 0x6611, 0xb710,
+ 0x4810, 0x9911, 0xaa11, 0x7b10, 0xcc11, 0x1d10, 0x2e10, 0xff11,
+ 0x9013, 0x4112, 0x7212, 0xa313, 0x1412, 0xc513, 0xf613, 0x2712,
+ 0xd812, 0x0913, 0x3a13, 0xeb12, 0x5c13, 0x8d12, 0xbe12, 0x6f13,
+ 0x6016, 0xb117, 0x8217, 0x5316, 0xe417, 0x3516, 0x0616, 0xd717,
+ 0x2817, 0xf916, 0xca16, 0x1b17, 0xac16, 0x7d17, 0x4e17, 0x9f16,
+ 0xf014, 0x2115, 0x1215, 0xc314, 0x7415, 0xa514, 0x9614, 0x4715,
+ 0xb815, 0x6914, 0x5a14, 0x8b15, 0x3c14, 0xed15, 0xde15, 0x0f14,
+ 0x0000, 0xc010, 0xc023, 0x0033, 0xc045, 0x0055, 0x0066, 0xc076,
+ 0xc089, 0x0099, 0x00aa, 0xc0ba, 0x00cc, 0xc0dc, 0xc0ef, 0x00ff,
+ 0xc111, 0x0101, 0x0132, 0xc122, 0x0154, 0xc144, 0xc177, 0x0167,
+ 0x0198, 0xc188, 0xc1bb, 0x01ab, 0xc1dd, 0x01cd, 0x01fe, 0xc1ee,
+ 0xc221, 0x0231, 0x0202, 0xc212, 0x0264, 0xc274, 0xc247, 0x0257,
+ 0x02a8, 0xc2b8, 0xc28b, 0x029b, 0xc2ed, 0x02fd, 0x02ce, 0xc2de,
+ 0x0330, 0xc320, 0xc313, 0x0303, 0xc375, 0x0365, 0x0356, 0xc346,
+ 0xc3b9, 0x03a9, 0x039a, 0xc38a, 0x03fc, 0xc3ec, 0xc3df, 0x03cf,
+ 0xc441, 0x0451, 0x0462, 0xc472, 0x0404, 0xc414, 0xc427, 0x0437,
+ 0x04c8, 0xc4d8, 0xc4eb, 0x04fb, 0xc48d, 0x049d, 0x04ae, 0xc4be,
+ 0x0550, 0xc540, 0xc573, 0x0563, 0xc515, 0x0505, 0x0536, 0xc526,
+ 0xc5d9, 0x05c9, 0x05fa, 0xc5ea, 0x059c, 0xc58c, 0xc5bf, 0x05af,
+ 0x0660, 0xc670, 0xc643, 0x0653, 0xc625, 0x0635, 0x0606, 0xc616,
+ 0xc6e9, 0x06f9, 0x06ca, 0xc6da, 0x06ac, 0xc6bc, 0xc68f, 0x069f,
+ 0xc771, 0x0761, 0x0752, 0xc742, 0x0734, 0xc724, 0xc717, 0x0707,
+ 0x07f8, 0xc7e8, 0xc7db, 0x07cb, 0xc7bd, 0x07ad, 0x079e, 0xc78e,
+ 0xc881, 0x0891, 0x08a2, 0xc8b2, 0x08c4, 0xc8d4, 0xc8e7, 0x08f7,
+ 0x0808, 0xc818, 0xc82b, 0x083b, 0xc84d, 0x085d, 0x086e, 0xc87e,
+ 0x0990, 0xc980, 0xc9b3, 0x09a3, 0xc9d5, 0x09c5, 0x09f6, 0xc9e6,
+ 0xc919, 0x0909, 0x093a, 0xc92a, 0x095c, 0xc94c, 0xc97f, 0x096f,
+ 0x0aa0, 0xcab0, 0xca83, 0x0a93, 0xcae5, 0x0af5, 0x0ac6, 0xcad6,
+ 0xca29, 0x0a39, 0x0a0a, 0xca1a, 0x0a6c, 0xca7c, 0xca4f, 0x0a5f,
+ 0xcbb1, 0x0ba1, 0x0b92, 0xcb82, 0x0bf4, 0xcbe4, 0xcbd7, 0x0bc7,
+ 0x0b38, 0xcb28, 0xcb1b, 0x0b0b, 0xcb7d, 0x0b6d, 0x0b5e, 0xcb4e,
+ 0x0cc0, 0xccd0, 0xcce3, 0x0cf3, 0xcc85, 0x0c95, 0x0ca6, 0xccb6,
+ 0xcc49, 0x0c59, 0x0c6a, 0xcc7a, 0x0c0c, 0xcc1c, 0xcc2f, 0x0c3f,
+ 0xcdd1, 0x0dc1, 0x0df2, 0xcde2, 0x0d94, 0xcd84, 0xcdb7, 0x0da7,
+ 0x0d58, 0xcd48, 0xcd7b, 0x0d6b, 0xcd1d, 0x0d0d, 0x0d3e, 0xcd2e,
+ 0xcee1, 0x0ef1, 0x0ec2, 0xced2, 0x0ea4, 0xceb4, 0xce87, 0x0e97,
+ 0x0e68, 0xce78, 0xce4b, 0x0e5b, 0xce2d, 0x0e3d, 0x0e0e, 0xce1e,
+ 0x0ff0, 0xcfe0, 0xcfd3, 0x0fc3, 0xcfb5, 0x0fa5, 0x0f96, 0xcf86,
+ 0xcf79, 0x0f69, 0x0f5a, 0xcf4a, 0x0f3c, 0xcf2c, 0xcf1f, 0x0f0f,
+ 0x0000, 0xccc1, 0xd981, 0x1540, 0xf301, 0x3fc0, 0x2a80, 0xe641,
+ 0xa601, 0x6ac0, 0x7f80, 0xb341, 0x5500, 0x99c1, 0x8c81, 0x4040,
+ 0x0c01, 0xc0c0, 0xd580, 0x1941, 0xff00, 0x33c1, 0x2681, 0xea40,
+ 0xaa00, 0x66c1, 0x7381, 0xbf40, 0x5901, 0x95c0, 0x8080, 0x4c41,
+ 0x1802, 0xd4c3, 0xc183, 0x0d42, 0xeb03, 0x27c2, 0x3282, 0xfe43,
+ 0xbe03, 0x72c2, 0x6782, 0xab43, 0x4d02, 0x81c3, 0x9483, 0x5842,
+ 0x1403, 0xd8c2, 0xcd82, 0x0143, 0xe702, 0x2bc3, 0x3e83, 0xf242,
+ 0xb202, 0x7ec3, 0x6b83, 0xa742, 0x4103, 0x8dc2, 0x9882, 0x5443,
+ 0x3004, 0xfcc5, 0xe985, 0x2544, 0xc305, 0x0fc4, 0x1a84, 0xd645,
+ 0x9605, 0x5ac4, 0x4f84, 0x8345, 0x6504, 0xa9c5, 0xbc85, 0x7044,
+ 0x3c05, 0xf0c4, 0xe584, 0x2945, 0xcf04, 0x03c5, 0x1685, 0xda44,
+ 0x9a04, 0x56c5, 0x4385, 0x8f44, 0x6905, 0xa5c4, 0xb084, 0x7c45,
+ 0x2806, 0xe4c7, 0xf187, 0x3d46, 0xdb07, 0x17c6, 0x0286, 0xce47,
+ 0x8e07, 0x42c6, 0x5786, 0x9b47, 0x7d06, 0xb1c7, 0xa487, 0x6846,
+ 0x2407, 0xe8c6, 0xfd86, 0x3147, 0xd706, 0x1bc7, 0x0e87, 0xc246,
+ 0x8206, 0x4ec7, 0x5b87, 0x9746, 0x7107, 0xbdc6, 0xa886, 0x6447,
+ 0x6008, 0xacc9, 0xb989, 0x7548, 0x9309, 0x5fc8, 0x4a88, 0x8649,
+ 0xc609, 0x0ac8, 0x1f88, 0xd349, 0x3508, 0xf9c9, 0xec89, 0x2048,
+ 0x6c09, 0xa0c8, 0xb588, 0x7949, 0x9f08, 0x53c9, 0x4689, 0x8a48,
+ 0xca08, 0x06c9, 0x1389, 0xdf48, 0x3909, 0xf5c8, 0xe088, 0x2c49,
+ 0x780a, 0xb4cb, 0xa18b, 0x6d4a, 0x8b0b, 0x47ca, 0x528a, 0x9e4b,
+ 0xde0b, 0x12ca, 0x078a, 0xcb4b, 0x2d0a, 0xe1cb, 0xf48b, 0x384a,
+ 0x740b, 0xb8ca, 0xad8a, 0x614b, 0x870a, 0x4bcb, 0x5e8b, 0x924a,
+ 0xd20a, 0x1ecb, 0x0b8b, 0xc74a, 0x210b, 0xedca, 0xf88a, 0x344b,
+ 0x500c, 0x9ccd, 0x898d, 0x454c, 0xa30d, 0x6fcc, 0x7a8c, 0xb64d,
+ 0xf60d, 0x3acc, 0x2f8c, 0xe34d, 0x050c, 0xc9cd, 0xdc8d, 0x104c,
+ 0x5c0d, 0x90cc, 0x858c, 0x494d, 0xaf0c, 0x63cd, 0x768d, 0xba4c,
+ 0xfa0c, 0x36cd, 0x238d, 0xef4c, 0x090d, 0xc5cc, 0xd08c, 0x1c4d,
+ 0x480e, 0x84cf, 0x918f, 0x5d4e, 0xbb0f, 0x77ce, 0x628e, 0xae4f,
+ 0xee0f, 0x22ce, 0x378e, 0xfb4f, 0x1d0e, 0xd1cf, 0xc48f, 0x084e,
+ 0x440f, 0x88ce, 0x9d8e, 0x514f, 0xb70e, 0x7bcf, 0x6e8f, 0xa24e,
+ 0xe20e, 0x2ecf, 0x3b8f, 0xf74e, 0x110f, 0xddce, 0xc88e, 0x044f,
+};
+
+const uint16_t crc16_8408_reflected_crc_table[CRC_SLICES * 256] = {
+ 0x0000, 0x17ce, 0x0fdf, 0x1811, 0x1fbe, 0x0870, 0x1061, 0x07af,
+ 0x1f3f, 0x08f1, 0x10e0, 0x072e, 0x0081, 0x174f, 0x0f5e, 0x1890,
+ 0x1e3d, 0x09f3, 0x11e2, 0x062c, 0x0183, 0x164d, 0x0e5c, 0x1992,
+ 0x0102, 0x16cc, 0x0edd, 0x1913, 0x1ebc, 0x0972, 0x1163, 0x06ad,
+ 0x1c39, 0x0bf7, 0x13e6, 0x0428, 0x0387, 0x1449, 0x0c58, 0x1b96,
+ 0x0306, 0x14c8, 0x0cd9, 0x1b17, 0x1cb8, 0x0b76, 0x1367, 0x04a9,
+ 0x0204, 0x15ca, 0x0ddb, 0x1a15, 0x1dba, 0x0a74, 0x1265, 0x05ab,
+ 0x1d3b, 0x0af5, 0x12e4, 0x052a, 0x0285, 0x154b, 0x0d5a, 0x1a94,
+ 0x1831, 0x0fff, 0x17ee, 0x0020, 0x078f, 0x1041, 0x0850, 0x1f9e,
+ 0x070e, 0x10c0, 0x08d1, 0x1f1f, 0x18b0, 0x0f7e, 0x176f, 0x00a1,
+ 0x060c, 0x11c2, 0x09d3, 0x1e1d, 0x19b2, 0x0e7c, 0x166d, 0x01a3,
+ 0x1933, 0x0efd, 0x16ec, 0x0122, 0x068d, 0x1143, 0x0952, 0x1e9c,
+ 0x0408, 0x13c6, 0x0bd7, 0x1c19, 0x1bb6, 0x0c78, 0x1469, 0x03a7,
+ 0x1b37, 0x0cf9, 0x14e8, 0x0326, 0x0489, 0x1347, 0x0b56, 0x1c98,
+ 0x1a35, 0x0dfb, 0x15ea, 0x0224, 0x058b, 0x1245, 0x0a54, 0x1d9a,
+ 0x050a, 0x12c4, 0x0ad5, 0x1d1b, 0x1ab4, 0x0d7a, 0x156b, 0x02a5,
+ 0x1021, 0x07ef, 0x1ffe, 0x0830, 0x0f9f, 0x1851, 0x0040, 0x178e,
+ 0x0f1e, 0x18d0, 0x00c1, 0x170f, 0x10a0, 0x076e, 0x1f7f, 0x08b1,
+ 0x0e1c, 0x19d2, 0x01c3, 0x160d, 0x11a2, 0x066c, 0x1e7d, 0x09b3,
+ 0x1123, 0x06ed, 0x1efc, 0x0932, 0x0e9d, 0x1953, 0x0142, 0x168c,
+ 0x0c18, 0x1bd6, 0x03c7, 0x1409, 0x13a6, 0x0468, 0x1c79, 0x0bb7,
+ 0x1327, 0x04e9, 0x1cf8, 0x0b36, 0x0c99, 0x1b57, 0x0346, 0x1488,
+ 0x1225, 0x05eb, 0x1dfa, 0x0a34, 0x0d9b, 0x1a55, 0x0244, 0x158a,
+ 0x0d1a, 0x1ad4, 0x02c5, 0x150b, 0x12a4, 0x056a, 0x1d7b, 0x0ab5,
+ 0x0810, 0x1fde, 0x07cf, 0x1001, 0x17ae, 0x0060, 0x1871, 0x0fbf,
+ 0x172f, 0x00e1, 0x18f0, 0x0f3e, 0x0891, 0x1f5f, 0x074e, 0x1080,
+ 0x162d, 0x01e3, 0x19f2, 0x0e3c, 0x0993, 0x1e5d, 0x064c, 0x1182,
+ 0x0912, 0x1edc, 0x06cd, 0x1103, 0x16ac, 0x0162, 0x1973, 0x0ebd,
+ 0x1429, 0x03e7, 0x1bf6, 0x0c38, 0x0b97, 0x1c59, 0x0448, 0x1386,
+ 0x0b16, 0x1cd8, 0x04c9, 0x1307, 0x14a8, 0x0366, 0x1b77, 0x0cb9,
+ 0x0a14, 0x1dda, 0x05cb, 0x1205, 0x15aa, 0x0264, 0x1a75, 0x0dbb,
+ 0x152b, 0x02e5, 0x1af4, 0x0d3a, 0x0a95, 0x1d5b, 0x054a, 0x1284,
+ 0x0000, 0x0759, 0x0eb2, 0x09eb, 0x1d64, 0x1a3d, 0x13d6, 0x148f,
+ 0x1a8b, 0x1dd2, 0x1439, 0x1360, 0x07ef, 0x00b6, 0x095d, 0x0e04,
+ 0x1555, 0x120c, 0x1be7, 0x1cbe, 0x0831, 0x0f68, 0x0683, 0x01da,
+ 0x0fde, 0x0887, 0x016c, 0x0635, 0x12ba, 0x15e3, 0x1c08, 0x1b51,
+ 0x0ae9, 0x0db0, 0x045b, 0x0302, 0x178d, 0x10d4, 0x193f, 0x1e66,
+ 0x1062, 0x173b, 0x1ed0, 0x1989, 0x0d06, 0x0a5f, 0x03b4, 0x04ed,
+ 0x1fbc, 0x18e5, 0x110e, 0x1657, 0x02d8, 0x0581, 0x0c6a, 0x0b33,
+ 0x0537, 0x026e, 0x0b85, 0x0cdc, 0x1853, 0x1f0a, 0x16e1, 0x11b8,
+ 0x15d2, 0x128b, 0x1b60, 0x1c39, 0x08b6, 0x0fef, 0x0604, 0x015d,
+ 0x0f59, 0x0800, 0x01eb, 0x06b2, 0x123d, 0x1564, 0x1c8f, 0x1bd6,
+ 0x0087, 0x07de, 0x0e35, 0x096c, 0x1de3, 0x1aba, 0x1351, 0x1408,
+ 0x1a0c, 0x1d55, 0x14be, 0x13e7, 0x0768, 0x0031, 0x09da, 0x0e83,
+ 0x1f3b, 0x1862, 0x1189, 0x16d0, 0x025f, 0x0506, 0x0ced, 0x0bb4,
+ 0x05b0, 0x02e9, 0x0b02, 0x0c5b, 0x18d4, 0x1f8d, 0x1666, 0x113f,
+ 0x0a6e, 0x0d37, 0x04dc, 0x0385, 0x170a, 0x1053, 0x19b8, 0x1ee1,
+ 0x10e5, 0x17bc, 0x1e57, 0x190e, 0x0d81, 0x0ad8, 0x0333, 0x046a,
+ 0x0be7, 0x0cbe, 0x0555, 0x020c, 0x1683, 0x11da, 0x1831, 0x1f68,
+ 0x116c, 0x1635, 0x1fde, 0x1887, 0x0c08, 0x0b51, 0x02ba, 0x05e3,
+ 0x1eb2, 0x19eb, 0x1000, 0x1759, 0x03d6, 0x048f, 0x0d64, 0x0a3d,
+ 0x0439, 0x0360, 0x0a8b, 0x0dd2, 0x195d, 0x1e04, 0x17ef, 0x10b6,
+ 0x010e, 0x0657, 0x0fbc, 0x08e5, 0x1c6a, 0x1b33, 0x12d8, 0x1581,
+ 0x1b85, 0x1cdc, 0x1537, 0x126e, 0x06e1, 0x01b8, 0x0853, 0x0f0a,
+ 0x145b, 0x1302, 0x1ae9, 0x1db0, 0x093f, 0x0e66, 0x078d, 0x00d4,
+ 0x0ed0, 0x0989, 0x0062, 0x073b, 0x13b4, 0x14ed, 0x1d06, 0x1a5f,
+ 0x1e35, 0x196c, 0x1087, 0x17de, 0x0351, 0x0408, 0x0de3, 0x0aba,
+ 0x04be, 0x03e7, 0x0a0c, 0x0d55, 0x19da, 0x1e83, 0x1768, 0x1031,
+ 0x0b60, 0x0c39, 0x05d2, 0x028b, 0x1604, 0x115d, 0x18b6, 0x1fef,
+ 0x11eb, 0x16b2, 0x1f59, 0x1800, 0x0c8f, 0x0bd6, 0x023d, 0x0564,
+ 0x14dc, 0x1385, 0x1a6e, 0x1d37, 0x09b8, 0x0ee1, 0x070a, 0x0053,
+ 0x0e57, 0x090e, 0x00e5, 0x07bc, 0x1333, 0x146a, 0x1d81, 0x1ad8,
+ 0x0189, 0x06d0, 0x0f3b, 0x0862, 0x1ced, 0x1bb4, 0x125f, 0x1506,
+ 0x1b02, 0x1c5b, 0x15b0, 0x12e9, 0x0666, 0x013f, 0x08d4, 0x0f8d,
+ 0x0000, 0x0efa, 0x1df4, 0x130e, 0x1bab, 0x1551, 0x065f, 0x08a5,
+ 0x1715, 0x19ef, 0x0ae1, 0x041b, 0x0cbe, 0x0244, 0x114a, 0x1fb0,
+ 0x0e69, 0x0093, 0x139d, 0x1d67, 0x15c2, 0x1b38, 0x0836, 0x06cc,
+ 0x197c, 0x1786, 0x0488, 0x0a72, 0x02d7, 0x0c2d, 0x1f23, 0x11d9,
+ 0x1cd2, 0x1228, 0x0126, 0x0fdc, 0x0779, 0x0983, 0x1a8d, 0x1477,
+ 0x0bc7, 0x053d, 0x1633, 0x18c9, 0x106c, 0x1e96, 0x0d98, 0x0362,
+ 0x12bb, 0x1c41, 0x0f4f, 0x01b5, 0x0910, 0x07ea, 0x14e4, 0x1a1e,
+ 0x05ae, 0x0b54, 0x185a, 0x16a0, 0x1e05, 0x10ff, 0x03f1, 0x0d0b,
+ 0x19e7, 0x171d, 0x0413, 0x0ae9, 0x024c, 0x0cb6, 0x1fb8, 0x1142,
+ 0x0ef2, 0x0008, 0x1306, 0x1dfc, 0x1559, 0x1ba3, 0x08ad, 0x0657,
+ 0x178e, 0x1974, 0x0a7a, 0x0480, 0x0c25, 0x02df, 0x11d1, 0x1f2b,
+ 0x009b, 0x0e61, 0x1d6f, 0x1395, 0x1b30, 0x15ca, 0x06c4, 0x083e,
+ 0x0535, 0x0bcf, 0x18c1, 0x163b, 0x1e9e, 0x1064, 0x036a, 0x0d90,
+ 0x1220, 0x1cda, 0x0fd4, 0x012e, 0x098b, 0x0771, 0x147f, 0x1a85,
+ 0x0b5c, 0x05a6, 0x16a8, 0x1852, 0x10f7, 0x1e0d, 0x0d03, 0x03f9,
+ 0x1c49, 0x12b3, 0x01bd, 0x0f47, 0x07e2, 0x0918, 0x1a16, 0x14ec,
+ 0x138d, 0x1d77, 0x0e79, 0x0083, 0x0826, 0x06dc, 0x15d2, 0x1b28,
+ 0x0498, 0x0a62, 0x196c, 0x1796, 0x1f33, 0x11c9, 0x02c7, 0x0c3d,
+ 0x1de4, 0x131e, 0x0010, 0x0eea, 0x064f, 0x08b5, 0x1bbb, 0x1541,
+ 0x0af1, 0x040b, 0x1705, 0x19ff, 0x115a, 0x1fa0, 0x0cae, 0x0254,
+ 0x0f5f, 0x01a5, 0x12ab, 0x1c51, 0x14f4, 0x1a0e, 0x0900, 0x07fa,
+ 0x184a, 0x16b0, 0x05be, 0x0b44, 0x03e1, 0x0d1b, 0x1e15, 0x10ef,
+ 0x0136, 0x0fcc, 0x1cc2, 0x1238, 0x1a9d, 0x1467, 0x0769, 0x0993,
+ 0x1623, 0x18d9, 0x0bd7, 0x052d, 0x0d88, 0x0372, 0x107c, 0x1e86,
+ 0x0a6a, 0x0490, 0x179e, 0x1964, 0x11c1, 0x1f3b, 0x0c35, 0x02cf,
+ 0x1d7f, 0x1385, 0x008b, 0x0e71, 0x06d4, 0x082e, 0x1b20, 0x15da,
+ 0x0403, 0x0af9, 0x19f7, 0x170d, 0x1fa8, 0x1152, 0x025c, 0x0ca6,
+ 0x1316, 0x1dec, 0x0ee2, 0x0018, 0x08bd, 0x0647, 0x1549, 0x1bb3,
+ 0x16b8, 0x1842, 0x0b4c, 0x05b6, 0x0d13, 0x03e9, 0x10e7, 0x1e1d,
+ 0x01ad, 0x0f57, 0x1c59, 0x12a3, 0x1a06, 0x14fc, 0x07f2, 0x0908,
+ 0x18d1, 0x162b, 0x0525, 0x0bdf, 0x037a, 0x0d80, 0x1e8e, 0x1074,
+ 0x0fc4, 0x013e, 0x1230, 0x1cca, 0x146f, 0x1a95, 0x099b, 0x0761,
+ 0x0000, 0x1afa, 0x15b7, 0x0f4d, 0x0b2d, 0x11d7, 0x1e9a, 0x0460,
+ 0x165a, 0x0ca0, 0x03ed, 0x1917, 0x1d77, 0x078d, 0x08c0, 0x123a,
+ 0x0cf7, 0x160d, 0x1940, 0x03ba, 0x07da, 0x1d20, 0x126d, 0x0897,
+ 0x1aad, 0x0057, 0x0f1a, 0x15e0, 0x1180, 0x0b7a, 0x0437, 0x1ecd,
+ 0x19ee, 0x0314, 0x0c59, 0x16a3, 0x12c3, 0x0839, 0x0774, 0x1d8e,
+ 0x0fb4, 0x154e, 0x1a03, 0x00f9, 0x0499, 0x1e63, 0x112e, 0x0bd4,
+ 0x1519, 0x0fe3, 0x00ae, 0x1a54, 0x1e34, 0x04ce, 0x0b83, 0x1179,
+ 0x0343, 0x19b9, 0x16f4, 0x0c0e, 0x086e, 0x1294, 0x1dd9, 0x0723,
+ 0x139f, 0x0965, 0x0628, 0x1cd2, 0x18b2, 0x0248, 0x0d05, 0x17ff,
+ 0x05c5, 0x1f3f, 0x1072, 0x0a88, 0x0ee8, 0x1412, 0x1b5f, 0x01a5,
+ 0x1f68, 0x0592, 0x0adf, 0x1025, 0x1445, 0x0ebf, 0x01f2, 0x1b08,
+ 0x0932, 0x13c8, 0x1c85, 0x067f, 0x021f, 0x18e5, 0x17a8, 0x0d52,
+ 0x0a71, 0x108b, 0x1fc6, 0x053c, 0x015c, 0x1ba6, 0x14eb, 0x0e11,
+ 0x1c2b, 0x06d1, 0x099c, 0x1366, 0x1706, 0x0dfc, 0x02b1, 0x184b,
+ 0x0686, 0x1c7c, 0x1331, 0x09cb, 0x0dab, 0x1751, 0x181c, 0x02e6,
+ 0x10dc, 0x0a26, 0x056b, 0x1f91, 0x1bf1, 0x010b, 0x0e46, 0x14bc,
+ 0x077d, 0x1d87, 0x12ca, 0x0830, 0x0c50, 0x16aa, 0x19e7, 0x031d,
+ 0x1127, 0x0bdd, 0x0490, 0x1e6a, 0x1a0a, 0x00f0, 0x0fbd, 0x1547,
+ 0x0b8a, 0x1170, 0x1e3d, 0x04c7, 0x00a7, 0x1a5d, 0x1510, 0x0fea,
+ 0x1dd0, 0x072a, 0x0867, 0x129d, 0x16fd, 0x0c07, 0x034a, 0x19b0,
+ 0x1e93, 0x0469, 0x0b24, 0x11de, 0x15be, 0x0f44, 0x0009, 0x1af3,
+ 0x08c9, 0x1233, 0x1d7e, 0x0784, 0x03e4, 0x191e, 0x1653, 0x0ca9,
+ 0x1264, 0x089e, 0x07d3, 0x1d29, 0x1949, 0x03b3, 0x0cfe, 0x1604,
+ 0x043e, 0x1ec4, 0x1189, 0x0b73, 0x0f13, 0x15e9, 0x1aa4, 0x005e,
+ 0x14e2, 0x0e18, 0x0155, 0x1baf, 0x1fcf, 0x0535, 0x0a78, 0x1082,
+ 0x02b8, 0x1842, 0x170f, 0x0df5, 0x0995, 0x136f, 0x1c22, 0x06d8,
+ 0x1815, 0x02ef, 0x0da2, 0x1758, 0x1338, 0x09c2, 0x068f, 0x1c75,
+ 0x0e4f, 0x14b5, 0x1bf8, 0x0102, 0x0562, 0x1f98, 0x10d5, 0x0a2f,
+ 0x0d0c, 0x17f6, 0x18bb, 0x0241, 0x0621, 0x1cdb, 0x1396, 0x096c,
+ 0x1b56, 0x01ac, 0x0ee1, 0x141b, 0x107b, 0x0a81, 0x05cc, 0x1f36,
+ 0x01fb, 0x1b01, 0x144c, 0x0eb6, 0x0ad6, 0x102c, 0x1f61, 0x059b,
+ 0x17a1, 0x0d5b, 0x0216, 0x18ec, 0x1c8c, 0x0676, 0x093b, 0x13c1,
+ 0x0000, 0x1aee, 0x159f, 0x0f71, 0x0b7d, 0x1193, 0x1ee2, 0x040c,
+ 0x16fa, 0x0c14, 0x0365, 0x198b, 0x1d87, 0x0769, 0x0818, 0x12f6,
+ 0x0db7, 0x1759, 0x1828, 0x02c6, 0x06ca, 0x1c24, 0x1355, 0x09bb,
+ 0x1b4d, 0x01a3, 0x0ed2, 0x143c, 0x1030, 0x0ade, 0x05af, 0x1f41,
+ 0x1b6e, 0x0180, 0x0ef1, 0x141f, 0x1013, 0x0afd, 0x058c, 0x1f62,
+ 0x0d94, 0x177a, 0x180b, 0x02e5, 0x06e9, 0x1c07, 0x1376, 0x0998,
+ 0x16d9, 0x0c37, 0x0346, 0x19a8, 0x1da4, 0x074a, 0x083b, 0x12d5,
+ 0x0023, 0x1acd, 0x15bc, 0x0f52, 0x0b5e, 0x11b0, 0x1ec1, 0x042f,
+ 0x169f, 0x0c71, 0x0300, 0x19ee, 0x1de2, 0x070c, 0x087d, 0x1293,
+ 0x0065, 0x1a8b, 0x15fa, 0x0f14, 0x0b18, 0x11f6, 0x1e87, 0x0469,
+ 0x1b28, 0x01c6, 0x0eb7, 0x1459, 0x1055, 0x0abb, 0x05ca, 0x1f24,
+ 0x0dd2, 0x173c, 0x184d, 0x02a3, 0x06af, 0x1c41, 0x1330, 0x09de,
+ 0x0df1, 0x171f, 0x186e, 0x0280, 0x068c, 0x1c62, 0x1313, 0x09fd,
+ 0x1b0b, 0x01e5, 0x0e94, 0x147a, 0x1076, 0x0a98, 0x05e9, 0x1f07,
+ 0x0046, 0x1aa8, 0x15d9, 0x0f37, 0x0b3b, 0x11d5, 0x1ea4, 0x044a,
+ 0x16bc, 0x0c52, 0x0323, 0x19cd, 0x1dc1, 0x072f, 0x085e, 0x12b0,
+ 0x0d7d, 0x1793, 0x18e2, 0x020c, 0x0600, 0x1cee, 0x139f, 0x0971,
+ 0x1b87, 0x0169, 0x0e18, 0x14f6, 0x10fa, 0x0a14, 0x0565, 0x1f8b,
+ 0x00ca, 0x1a24, 0x1555, 0x0fbb, 0x0bb7, 0x1159, 0x1e28, 0x04c6,
+ 0x1630, 0x0cde, 0x03af, 0x1941, 0x1d4d, 0x07a3, 0x08d2, 0x123c,
+ 0x1613, 0x0cfd, 0x038c, 0x1962, 0x1d6e, 0x0780, 0x08f1, 0x121f,
+ 0x00e9, 0x1a07, 0x1576, 0x0f98, 0x0b94, 0x117a, 0x1e0b, 0x04e5,
+ 0x1ba4, 0x014a, 0x0e3b, 0x14d5, 0x10d9, 0x0a37, 0x0546, 0x1fa8,
+ 0x0d5e, 0x17b0, 0x18c1, 0x022f, 0x0623, 0x1ccd, 0x13bc, 0x0952,
+ 0x1be2, 0x010c, 0x0e7d, 0x1493, 0x109f, 0x0a71, 0x0500, 0x1fee,
+ 0x0d18, 0x17f6, 0x1887, 0x0269, 0x0665, 0x1c8b, 0x13fa, 0x0914,
+ 0x1655, 0x0cbb, 0x03ca, 0x1924, 0x1d28, 0x07c6, 0x08b7, 0x1259,
+ 0x00af, 0x1a41, 0x1530, 0x0fde, 0x0bd2, 0x113c, 0x1e4d, 0x04a3,
+ 0x008c, 0x1a62, 0x1513, 0x0ffd, 0x0bf1, 0x111f, 0x1e6e, 0x0480,
+ 0x1676, 0x0c98, 0x03e9, 0x1907, 0x1d0b, 0x07e5, 0x0894, 0x127a,
+ 0x0d3b, 0x17d5, 0x18a4, 0x024a, 0x0646, 0x1ca8, 0x13d9, 0x0937,
+ 0x1bc1, 0x012f, 0x0e5e, 0x14b0, 0x10bc, 0x0a52, 0x0523, 0x1fcd,
+ 0x0000, 0x1b6d, 0x1699, 0x0df4, 0x0d71, 0x161c, 0x1be8, 0x0085,
+ 0x1ae2, 0x018f, 0x0c7b, 0x1716, 0x1793, 0x0cfe, 0x010a, 0x1a67,
+ 0x1587, 0x0eea, 0x031e, 0x1873, 0x18f6, 0x039b, 0x0e6f, 0x1502,
+ 0x0f65, 0x1408, 0x19fc, 0x0291, 0x0214, 0x1979, 0x148d, 0x0fe0,
+ 0x0b4d, 0x1020, 0x1dd4, 0x06b9, 0x063c, 0x1d51, 0x10a5, 0x0bc8,
+ 0x11af, 0x0ac2, 0x0736, 0x1c5b, 0x1cde, 0x07b3, 0x0a47, 0x112a,
+ 0x1eca, 0x05a7, 0x0853, 0x133e, 0x13bb, 0x08d6, 0x0522, 0x1e4f,
+ 0x0428, 0x1f45, 0x12b1, 0x09dc, 0x0959, 0x1234, 0x1fc0, 0x04ad,
+ 0x169a, 0x0df7, 0x0003, 0x1b6e, 0x1beb, 0x0086, 0x0d72, 0x161f,
+ 0x0c78, 0x1715, 0x1ae1, 0x018c, 0x0109, 0x1a64, 0x1790, 0x0cfd,
+ 0x031d, 0x1870, 0x1584, 0x0ee9, 0x0e6c, 0x1501, 0x18f5, 0x0398,
+ 0x19ff, 0x0292, 0x0f66, 0x140b, 0x148e, 0x0fe3, 0x0217, 0x197a,
+ 0x1dd7, 0x06ba, 0x0b4e, 0x1023, 0x10a6, 0x0bcb, 0x063f, 0x1d52,
+ 0x0735, 0x1c58, 0x11ac, 0x0ac1, 0x0a44, 0x1129, 0x1cdd, 0x07b0,
+ 0x0850, 0x133d, 0x1ec9, 0x05a4, 0x0521, 0x1e4c, 0x13b8, 0x08d5,
+ 0x12b2, 0x09df, 0x042b, 0x1f46, 0x1fc3, 0x04ae, 0x095a, 0x1237,
+ 0x0d77, 0x161a, 0x1bee, 0x0083, 0x0006, 0x1b6b, 0x169f, 0x0df2,
+ 0x1795, 0x0cf8, 0x010c, 0x1a61, 0x1ae4, 0x0189, 0x0c7d, 0x1710,
+ 0x18f0, 0x039d, 0x0e69, 0x1504, 0x1581, 0x0eec, 0x0318, 0x1875,
+ 0x0212, 0x197f, 0x148b, 0x0fe6, 0x0f63, 0x140e, 0x19fa, 0x0297,
+ 0x063a, 0x1d57, 0x10a3, 0x0bce, 0x0b4b, 0x1026, 0x1dd2, 0x06bf,
+ 0x1cd8, 0x07b5, 0x0a41, 0x112c, 0x11a9, 0x0ac4, 0x0730, 0x1c5d,
+ 0x13bd, 0x08d0, 0x0524, 0x1e49, 0x1ecc, 0x05a1, 0x0855, 0x1338,
+ 0x095f, 0x1232, 0x1fc6, 0x04ab, 0x042e, 0x1f43, 0x12b7, 0x09da,
+ 0x1bed, 0x0080, 0x0d74, 0x1619, 0x169c, 0x0df1, 0x0005, 0x1b68,
+ 0x010f, 0x1a62, 0x1796, 0x0cfb, 0x0c7e, 0x1713, 0x1ae7, 0x018a,
+ 0x0e6a, 0x1507, 0x18f3, 0x039e, 0x031b, 0x1876, 0x1582, 0x0eef,
+ 0x1488, 0x0fe5, 0x0211, 0x197c, 0x19f9, 0x0294, 0x0f60, 0x140d,
+ 0x10a0, 0x0bcd, 0x0639, 0x1d54, 0x1dd1, 0x06bc, 0x0b48, 0x1025,
+ 0x0a42, 0x112f, 0x1cdb, 0x07b6, 0x0733, 0x1c5e, 0x11aa, 0x0ac7,
+ 0x0527, 0x1e4a, 0x13be, 0x08d3, 0x0856, 0x133b, 0x1ecf, 0x05a2,
+ 0x1fc5, 0x04a8, 0x095c, 0x1231, 0x12b4, 0x09d9, 0x042d, 0x1f40,
+ 0x0000, 0x135c, 0x06fb, 0x15a7, 0x0df6, 0x1eaa, 0x0b0d, 0x1851,
+ 0x1bec, 0x08b0, 0x1d17, 0x0e4b, 0x161a, 0x0546, 0x10e1, 0x03bd,
+ 0x179b, 0x04c7, 0x1160, 0x023c, 0x1a6d, 0x0931, 0x1c96, 0x0fca,
+ 0x0c77, 0x1f2b, 0x0a8c, 0x19d0, 0x0181, 0x12dd, 0x077a, 0x1426,
+ 0x0f75, 0x1c29, 0x098e, 0x1ad2, 0x0283, 0x11df, 0x0478, 0x1724,
+ 0x1499, 0x07c5, 0x1262, 0x013e, 0x196f, 0x0a33, 0x1f94, 0x0cc8,
+ 0x18ee, 0x0bb2, 0x1e15, 0x0d49, 0x1518, 0x0644, 0x13e3, 0x00bf,
+ 0x0302, 0x105e, 0x05f9, 0x16a5, 0x0ef4, 0x1da8, 0x080f, 0x1b53,
+ 0x1eea, 0x0db6, 0x1811, 0x0b4d, 0x131c, 0x0040, 0x15e7, 0x06bb,
+ 0x0506, 0x165a, 0x03fd, 0x10a1, 0x08f0, 0x1bac, 0x0e0b, 0x1d57,
+ 0x0971, 0x1a2d, 0x0f8a, 0x1cd6, 0x0487, 0x17db, 0x027c, 0x1120,
+ 0x129d, 0x01c1, 0x1466, 0x073a, 0x1f6b, 0x0c37, 0x1990, 0x0acc,
+ 0x119f, 0x02c3, 0x1764, 0x0438, 0x1c69, 0x0f35, 0x1a92, 0x09ce,
+ 0x0a73, 0x192f, 0x0c88, 0x1fd4, 0x0785, 0x14d9, 0x017e, 0x1222,
+ 0x0604, 0x1558, 0x00ff, 0x13a3, 0x0bf2, 0x18ae, 0x0d09, 0x1e55,
+ 0x1de8, 0x0eb4, 0x1b13, 0x084f, 0x101e, 0x0342, 0x16e5, 0x05b9,
+ 0x1d97, 0x0ecb, 0x1b6c, 0x0830, 0x1061, 0x033d, 0x169a, 0x05c6,
+ 0x067b, 0x1527, 0x0080, 0x13dc, 0x0b8d, 0x18d1, 0x0d76, 0x1e2a,
+ 0x0a0c, 0x1950, 0x0cf7, 0x1fab, 0x07fa, 0x14a6, 0x0101, 0x125d,
+ 0x11e0, 0x02bc, 0x171b, 0x0447, 0x1c16, 0x0f4a, 0x1aed, 0x09b1,
+ 0x12e2, 0x01be, 0x1419, 0x0745, 0x1f14, 0x0c48, 0x19ef, 0x0ab3,
+ 0x090e, 0x1a52, 0x0ff5, 0x1ca9, 0x04f8, 0x17a4, 0x0203, 0x115f,
+ 0x0579, 0x1625, 0x0382, 0x10de, 0x088f, 0x1bd3, 0x0e74, 0x1d28,
+ 0x1e95, 0x0dc9, 0x186e, 0x0b32, 0x1363, 0x003f, 0x1598, 0x06c4,
+ 0x037d, 0x1021, 0x0586, 0x16da, 0x0e8b, 0x1dd7, 0x0870, 0x1b2c,
+ 0x1891, 0x0bcd, 0x1e6a, 0x0d36, 0x1567, 0x063b, 0x139c, 0x00c0,
+ 0x14e6, 0x07ba, 0x121d, 0x0141, 0x1910, 0x0a4c, 0x1feb, 0x0cb7,
+ 0x0f0a, 0x1c56, 0x09f1, 0x1aad, 0x02fc, 0x11a0, 0x0407, 0x175b,
+ 0x0c08, 0x1f54, 0x0af3, 0x19af, 0x01fe, 0x12a2, 0x0705, 0x1459,
+ 0x17e4, 0x04b8, 0x111f, 0x0243, 0x1a12, 0x094e, 0x1ce9, 0x0fb5,
+ 0x1b93, 0x08cf, 0x1d68, 0x0e34, 0x1665, 0x0539, 0x109e, 0x03c2,
+ 0x007f, 0x1323, 0x0684, 0x15d8, 0x0d89, 0x1ed5, 0x0b72, 0x182e,
+ 0x0000, 0x069e, 0x0d3c, 0x0ba2, 0x1a78, 0x1ce6, 0x1744, 0x11da,
+ 0x14b3, 0x122d, 0x198f, 0x1f11, 0x0ecb, 0x0855, 0x03f7, 0x0569,
+ 0x0925, 0x0fbb, 0x0419, 0x0287, 0x135d, 0x15c3, 0x1e61, 0x18ff,
+ 0x1d96, 0x1b08, 0x10aa, 0x1634, 0x07ee, 0x0170, 0x0ad2, 0x0c4c,
+ 0x124a, 0x14d4, 0x1f76, 0x19e8, 0x0832, 0x0eac, 0x050e, 0x0390,
+ 0x06f9, 0x0067, 0x0bc5, 0x0d5b, 0x1c81, 0x1a1f, 0x11bd, 0x1723,
+ 0x1b6f, 0x1df1, 0x1653, 0x10cd, 0x0117, 0x0789, 0x0c2b, 0x0ab5,
+ 0x0fdc, 0x0942, 0x02e0, 0x047e, 0x15a4, 0x133a, 0x1898, 0x1e06,
+ 0x04d7, 0x0249, 0x09eb, 0x0f75, 0x1eaf, 0x1831, 0x1393, 0x150d,
+ 0x1064, 0x16fa, 0x1d58, 0x1bc6, 0x0a1c, 0x0c82, 0x0720, 0x01be,
+ 0x0df2, 0x0b6c, 0x00ce, 0x0650, 0x178a, 0x1114, 0x1ab6, 0x1c28,
+ 0x1941, 0x1fdf, 0x147d, 0x12e3, 0x0339, 0x05a7, 0x0e05, 0x089b,
+ 0x169d, 0x1003, 0x1ba1, 0x1d3f, 0x0ce5, 0x0a7b, 0x01d9, 0x0747,
+ 0x022e, 0x04b0, 0x0f12, 0x098c, 0x1856, 0x1ec8, 0x156a, 0x13f4,
+ 0x1fb8, 0x1926, 0x1284, 0x141a, 0x05c0, 0x035e, 0x08fc, 0x0e62,
+ 0x0b0b, 0x0d95, 0x0637, 0x00a9, 0x1173, 0x17ed, 0x1c4f, 0x1ad1,
+ 0x09ae, 0x0f30, 0x0492, 0x020c, 0x13d6, 0x1548, 0x1eea, 0x1874,
+ 0x1d1d, 0x1b83, 0x1021, 0x16bf, 0x0765, 0x01fb, 0x0a59, 0x0cc7,
+ 0x008b, 0x0615, 0x0db7, 0x0b29, 0x1af3, 0x1c6d, 0x17cf, 0x1151,
+ 0x1438, 0x12a6, 0x1904, 0x1f9a, 0x0e40, 0x08de, 0x037c, 0x05e2,
+ 0x1be4, 0x1d7a, 0x16d8, 0x1046, 0x019c, 0x0702, 0x0ca0, 0x0a3e,
+ 0x0f57, 0x09c9, 0x026b, 0x04f5, 0x152f, 0x13b1, 0x1813, 0x1e8d,
+ 0x12c1, 0x145f, 0x1ffd, 0x1963, 0x08b9, 0x0e27, 0x0585, 0x031b,
+ 0x0672, 0x00ec, 0x0b4e, 0x0dd0, 0x1c0a, 0x1a94, 0x1136, 0x17a8,
+ 0x0d79, 0x0be7, 0x0045, 0x06db, 0x1701, 0x119f, 0x1a3d, 0x1ca3,
+ 0x19ca, 0x1f54, 0x14f6, 0x1268, 0x03b2, 0x052c, 0x0e8e, 0x0810,
+ 0x045c, 0x02c2, 0x0960, 0x0ffe, 0x1e24, 0x18ba, 0x1318, 0x1586,
+ 0x10ef, 0x1671, 0x1dd3, 0x1b4d, 0x0a97, 0x0c09, 0x07ab, 0x0135,
+ 0x1f33, 0x19ad, 0x120f, 0x1491, 0x054b, 0x03d5, 0x0877, 0x0ee9,
+ 0x0b80, 0x0d1e, 0x06bc, 0x0022, 0x11f8, 0x1766, 0x1cc4, 0x1a5a,
+ 0x1616, 0x1088, 0x1b2a, 0x1db4, 0x0c6e, 0x0af0, 0x0152, 0x07cc,
+ 0x02a5, 0x043b, 0x0f99, 0x0907, 0x18dd, 0x1e43, 0x15e1, 0x137f,
+};
+
+const uint32_t crc32_000000af_crc_table[CRC_SLICES * 256] = {
+ 0x00000000, 0x000000af, 0x0000015e, 0x000001f1, 0x000002bc, 0x00000213, 0x000003e2, 0x0000034d,
+ 0x00000578, 0x000005d7, 0x00000426, 0x00000489, 0x000007c4, 0x0000076b, 0x0000069a, 0x00000635,
+ 0x00000af0, 0x00000a5f, 0x00000bae, 0x00000b01, 0x0000084c, 0x000008e3, 0x00000912, 0x000009bd,
+ 0x00000f88, 0x00000f27, 0x00000ed6, 0x00000e79, 0x00000d34, 0x00000d9b, 0x00000c6a, 0x00000cc5,
+ 0x000015e0, 0x0000154f, 0x000014be, 0x00001411, 0x0000175c, 0x000017f3, 0x00001602, 0x000016ad,
+ 0x00001098, 0x00001037, 0x000011c6, 0x00001169, 0x00001224, 0x0000128b, 0x0000137a, 0x000013d5,
+ 0x00001f10, 0x00001fbf, 0x00001e4e, 0x00001ee1, 0x00001dac, 0x00001d03, 0x00001cf2, 0x00001c5d,
+ 0x00001a68, 0x00001ac7, 0x00001b36, 0x00001b99, 0x000018d4, 0x0000187b, 0x0000198a, 0x00001925,
+ 0x00002bc0, 0x00002b6f, 0x00002a9e, 0x00002a31, 0x0000297c, 0x000029d3, 0x00002822, 0x0000288d,
+ 0x00002eb8, 0x00002e17, 0x00002fe6, 0x00002f49, 0x00002c04, 0x00002cab, 0x00002d5a, 0x00002df5,
+ 0x00002130, 0x0000219f, 0x0000206e, 0x000020c1, 0x0000238c, 0x00002323, 0x000022d2, 0x0000227d,
+ 0x00002448, 0x000024e7, 0x00002516, 0x000025b9, 0x000026f4, 0x0000265b, 0x000027aa, 0x00002705,
+ 0x00003e20, 0x00003e8f, 0x00003f7e, 0x00003fd1, 0x00003c9c, 0x00003c33, 0x00003dc2, 0x00003d6d,
+ 0x00003b58, 0x00003bf7, 0x00003a06, 0x00003aa9, 0x000039e4, 0x0000394b, 0x000038ba, 0x00003815,
+ 0x000034d0, 0x0000347f, 0x0000358e, 0x00003521, 0x0000366c, 0x000036c3, 0x00003732, 0x0000379d,
+ 0x000031a8, 0x00003107, 0x000030f6, 0x00003059, 0x00003314, 0x000033bb, 0x0000324a, 0x000032e5,
+ 0x00005780, 0x0000572f, 0x000056de, 0x00005671, 0x0000553c, 0x00005593, 0x00005462, 0x000054cd,
+ 0x000052f8, 0x00005257, 0x000053a6, 0x00005309, 0x00005044, 0x000050eb, 0x0000511a, 0x000051b5,
+ 0x00005d70, 0x00005ddf, 0x00005c2e, 0x00005c81, 0x00005fcc, 0x00005f63, 0x00005e92, 0x00005e3d,
+ 0x00005808, 0x000058a7, 0x00005956, 0x000059f9, 0x00005ab4, 0x00005a1b, 0x00005bea, 0x00005b45,
+ 0x00004260, 0x000042cf, 0x0000433e, 0x00004391, 0x000040dc, 0x00004073, 0x00004182, 0x0000412d,
+ 0x00004718, 0x000047b7, 0x00004646, 0x000046e9, 0x000045a4, 0x0000450b, 0x000044fa, 0x00004455,
+ 0x00004890, 0x0000483f, 0x000049ce, 0x00004961, 0x00004a2c, 0x00004a83, 0x00004b72, 0x00004bdd,
+ 0x00004de8, 0x00004d47, 0x00004cb6, 0x00004c19, 0x00004f54, 0x00004ffb, 0x00004e0a, 0x00004ea5,
+ 0x00007c40, 0x00007cef, 0x00007d1e, 0x00007db1, 0x00007efc, 0x00007e53, 0x00007fa2, 0x00007f0d,
+ 0x00007938, 0x00007997, 0x00007866, 0x000078c9, 0x00007b84, 0x00007b2b, 0x00007ada, 0x00007a75,
+ 0x000076b0, 0x0000761f, 0x000077ee, 0x00007741, 0x0000740c, 0x000074a3, 0x00007552, 0x000075fd,
+ 0x000073c8, 0x00007367, 0x00007296, 0x00007239, 0x00007174, 0x000071db, 0x0000702a, 0x00007085,
+ 0x000069a0, 0x0000690f, 0x000068fe, 0x00006851, 0x00006b1c, 0x00006bb3, 0x00006a42, 0x00006aed,
+ 0x00006cd8, 0x00006c77, 0x00006d86, 0x00006d29, 0x00006e64, 0x00006ecb, 0x00006f3a, 0x00006f95,
+ 0x00006350, 0x000063ff, 0x0000620e, 0x000062a1, 0x000061ec, 0x00006143, 0x000060b2, 0x0000601d,
+ 0x00006628, 0x00006687, 0x00006776, 0x000067d9, 0x00006494, 0x0000643b, 0x000065ca, 0x00006565,
+ 0x00000000, 0x0000af00, 0x00015e00, 0x0001f100, 0x0002bc00, 0x00021300, 0x0003e200, 0x00034d00,
+ 0x00057800, 0x0005d700, 0x00042600, 0x00048900, 0x0007c400, 0x00076b00, 0x00069a00, 0x00063500,
+ 0x000af000, 0x000a5f00, 0x000bae00, 0x000b0100, 0x00084c00, 0x0008e300, 0x00091200, 0x0009bd00,
+ 0x000f8800, 0x000f2700, 0x000ed600, 0x000e7900, 0x000d3400, 0x000d9b00, 0x000c6a00, 0x000cc500,
+ 0x0015e000, 0x00154f00, 0x0014be00, 0x00141100, 0x00175c00, 0x0017f300, 0x00160200, 0x0016ad00,
+ 0x00109800, 0x00103700, 0x0011c600, 0x00116900, 0x00122400, 0x00128b00, 0x00137a00, 0x0013d500,
+ 0x001f1000, 0x001fbf00, 0x001e4e00, 0x001ee100, 0x001dac00, 0x001d0300, 0x001cf200, 0x001c5d00,
+ 0x001a6800, 0x001ac700, 0x001b3600, 0x001b9900, 0x0018d400, 0x00187b00, 0x00198a00, 0x00192500,
+ 0x002bc000, 0x002b6f00, 0x002a9e00, 0x002a3100, 0x00297c00, 0x0029d300, 0x00282200, 0x00288d00,
+ 0x002eb800, 0x002e1700, 0x002fe600, 0x002f4900, 0x002c0400, 0x002cab00, 0x002d5a00, 0x002df500,
+ 0x00213000, 0x00219f00, 0x00206e00, 0x0020c100, 0x00238c00, 0x00232300, 0x0022d200, 0x00227d00,
+ 0x00244800, 0x0024e700, 0x00251600, 0x0025b900, 0x0026f400, 0x00265b00, 0x0027aa00, 0x00270500,
+ 0x003e2000, 0x003e8f00, 0x003f7e00, 0x003fd100, 0x003c9c00, 0x003c3300, 0x003dc200, 0x003d6d00,
+ 0x003b5800, 0x003bf700, 0x003a0600, 0x003aa900, 0x0039e400, 0x00394b00, 0x0038ba00, 0x00381500,
+ 0x0034d000, 0x00347f00, 0x00358e00, 0x00352100, 0x00366c00, 0x0036c300, 0x00373200, 0x00379d00,
+ 0x0031a800, 0x00310700, 0x0030f600, 0x00305900, 0x00331400, 0x0033bb00, 0x00324a00, 0x0032e500,
+ 0x00578000, 0x00572f00, 0x0056de00, 0x00567100, 0x00553c00, 0x00559300, 0x00546200, 0x0054cd00,
+ 0x0052f800, 0x00525700, 0x0053a600, 0x00530900, 0x00504400, 0x0050eb00, 0x00511a00, 0x0051b500,
+ 0x005d7000, 0x005ddf00, 0x005c2e00, 0x005c8100, 0x005fcc00, 0x005f6300, 0x005e9200, 0x005e3d00,
+ 0x00580800, 0x0058a700, 0x00595600, 0x0059f900, 0x005ab400, 0x005a1b00, 0x005bea00, 0x005b4500,
+ 0x00426000, 0x0042cf00, 0x00433e00, 0x00439100, 0x0040dc00, 0x00407300, 0x00418200, 0x00412d00,
+ 0x00471800, 0x0047b700, 0x00464600, 0x0046e900, 0x0045a400, 0x00450b00, 0x0044fa00, 0x00445500,
+ 0x00489000, 0x00483f00, 0x0049ce00, 0x00496100, 0x004a2c00, 0x004a8300, 0x004b7200, 0x004bdd00,
+ 0x004de800, 0x004d4700, 0x004cb600, 0x004c1900, 0x004f5400, 0x004ffb00, 0x004e0a00, 0x004ea500,
+ 0x007c4000, 0x007cef00, 0x007d1e00, 0x007db100, 0x007efc00, 0x007e5300, 0x007fa200, 0x007f0d00,
+ 0x00793800, 0x00799700, 0x00786600, 0x0078c900, 0x007b8400, 0x007b2b00, 0x007ada00, 0x007a7500,
+ 0x0076b000, 0x00761f00, 0x0077ee00, 0x00774100, 0x00740c00, 0x0074a300, 0x00755200, 0x0075fd00,
+ 0x0073c800, 0x00736700, 0x00729600, 0x00723900, 0x00717400, 0x0071db00, 0x00702a00, 0x00708500,
+ 0x0069a000, 0x00690f00, 0x0068fe00, 0x00685100, 0x006b1c00, 0x006bb300, 0x006a4200, 0x006aed00,
+ 0x006cd800, 0x006c7700, 0x006d8600, 0x006d2900, 0x006e6400, 0x006ecb00, 0x006f3a00, 0x006f9500,
+ 0x00635000, 0x0063ff00, 0x00620e00, 0x0062a100, 0x0061ec00, 0x00614300, 0x0060b200, 0x00601d00,
+ 0x00662800, 0x00668700, 0x00677600, 0x0067d900, 0x00649400, 0x00643b00, 0x0065ca00, 0x00656500,
+ 0x00000000, 0x00af0000, 0x015e0000, 0x01f10000, 0x02bc0000, 0x02130000, 0x03e20000, 0x034d0000,
+ 0x05780000, 0x05d70000, 0x04260000, 0x04890000, 0x07c40000, 0x076b0000, 0x069a0000, 0x06350000,
+ 0x0af00000, 0x0a5f0000, 0x0bae0000, 0x0b010000, 0x084c0000, 0x08e30000, 0x09120000, 0x09bd0000,
+ 0x0f880000, 0x0f270000, 0x0ed60000, 0x0e790000, 0x0d340000, 0x0d9b0000, 0x0c6a0000, 0x0cc50000,
+ 0x15e00000, 0x154f0000, 0x14be0000, 0x14110000, 0x175c0000, 0x17f30000, 0x16020000, 0x16ad0000,
+ 0x10980000, 0x10370000, 0x11c60000, 0x11690000, 0x12240000, 0x128b0000, 0x137a0000, 0x13d50000,
+ 0x1f100000, 0x1fbf0000, 0x1e4e0000, 0x1ee10000, 0x1dac0000, 0x1d030000, 0x1cf20000, 0x1c5d0000,
+ 0x1a680000, 0x1ac70000, 0x1b360000, 0x1b990000, 0x18d40000, 0x187b0000, 0x198a0000, 0x19250000,
+ 0x2bc00000, 0x2b6f0000, 0x2a9e0000, 0x2a310000, 0x297c0000, 0x29d30000, 0x28220000, 0x288d0000,
+ 0x2eb80000, 0x2e170000, 0x2fe60000, 0x2f490000, 0x2c040000, 0x2cab0000, 0x2d5a0000, 0x2df50000,
+ 0x21300000, 0x219f0000, 0x206e0000, 0x20c10000, 0x238c0000, 0x23230000, 0x22d20000, 0x227d0000,
+ 0x24480000, 0x24e70000, 0x25160000, 0x25b90000, 0x26f40000, 0x265b0000, 0x27aa0000, 0x27050000,
+ 0x3e200000, 0x3e8f0000, 0x3f7e0000, 0x3fd10000, 0x3c9c0000, 0x3c330000, 0x3dc20000, 0x3d6d0000,
+ 0x3b580000, 0x3bf70000, 0x3a060000, 0x3aa90000, 0x39e40000, 0x394b0000, 0x38ba0000, 0x38150000,
+ 0x34d00000, 0x347f0000, 0x358e0000, 0x35210000, 0x366c0000, 0x36c30000, 0x37320000, 0x379d0000,
+ 0x31a80000, 0x31070000, 0x30f60000, 0x30590000, 0x33140000, 0x33bb0000, 0x324a0000, 0x32e50000,
+ 0x57800000, 0x572f0000, 0x56de0000, 0x56710000, 0x553c0000, 0x55930000, 0x54620000, 0x54cd0000,
+ 0x52f80000, 0x52570000, 0x53a60000, 0x53090000, 0x50440000, 0x50eb0000, 0x511a0000, 0x51b50000,
+ 0x5d700000, 0x5ddf0000, 0x5c2e0000, 0x5c810000, 0x5fcc0000, 0x5f630000, 0x5e920000, 0x5e3d0000,
+ 0x58080000, 0x58a70000, 0x59560000, 0x59f90000, 0x5ab40000, 0x5a1b0000, 0x5bea0000, 0x5b450000,
+ 0x42600000, 0x42cf0000, 0x433e0000, 0x43910000, 0x40dc0000, 0x40730000, 0x41820000, 0x412d0000,
+ 0x47180000, 0x47b70000, 0x46460000, 0x46e90000, 0x45a40000, 0x450b0000, 0x44fa0000, 0x44550000,
+ 0x48900000, 0x483f0000, 0x49ce0000, 0x49610000, 0x4a2c0000, 0x4a830000, 0x4b720000, 0x4bdd0000,
+ 0x4de80000, 0x4d470000, 0x4cb60000, 0x4c190000, 0x4f540000, 0x4ffb0000, 0x4e0a0000, 0x4ea50000,
+ 0x7c400000, 0x7cef0000, 0x7d1e0000, 0x7db10000, 0x7efc0000, 0x7e530000, 0x7fa20000, 0x7f0d0000,
+ 0x79380000, 0x79970000, 0x78660000, 0x78c90000, 0x7b840000, 0x7b2b0000, 0x7ada0000, 0x7a750000,
+ 0x76b00000, 0x761f0000, 0x77ee0000, 0x77410000, 0x740c0000, 0x74a30000, 0x75520000, 0x75fd0000,
+ 0x73c80000, 0x73670000, 0x72960000, 0x72390000, 0x71740000, 0x71db0000, 0x702a0000, 0x70850000,
+ 0x69a00000, 0x690f0000, 0x68fe0000, 0x68510000, 0x6b1c0000, 0x6bb30000, 0x6a420000, 0x6aed0000,
+ 0x6cd80000, 0x6c770000, 0x6d860000, 0x6d290000, 0x6e640000, 0x6ecb0000, 0x6f3a0000, 0x6f950000,
+ 0x63500000, 0x63ff0000, 0x620e0000, 0x62a10000, 0x61ec0000, 0x61430000, 0x60b20000, 0x601d0000,
+ 0x66280000, 0x66870000, 0x67760000, 0x67d90000, 0x64940000, 0x643b0000, 0x65ca0000, 0x65650000,
+ 0x00000000, 0xaf000000, 0x5e0000af, 0xf10000af, 0xbc00015e, 0x1300015e, 0xe20001f1, 0x4d0001f1,
+ 0x78000213, 0xd7000213, 0x260002bc, 0x890002bc, 0xc400034d, 0x6b00034d, 0x9a0003e2, 0x350003e2,
+ 0xf0000426, 0x5f000426, 0xae000489, 0x01000489, 0x4c000578, 0xe3000578, 0x120005d7, 0xbd0005d7,
+ 0x88000635, 0x27000635, 0xd600069a, 0x7900069a, 0x3400076b, 0x9b00076b, 0x6a0007c4, 0xc50007c4,
+ 0xe00008e3, 0x4f0008e3, 0xbe00084c, 0x1100084c, 0x5c0009bd, 0xf30009bd, 0x02000912, 0xad000912,
+ 0x98000af0, 0x37000af0, 0xc6000a5f, 0x69000a5f, 0x24000bae, 0x8b000bae, 0x7a000b01, 0xd5000b01,
+ 0x10000cc5, 0xbf000cc5, 0x4e000c6a, 0xe1000c6a, 0xac000d9b, 0x03000d9b, 0xf2000d34, 0x5d000d34,
+ 0x68000ed6, 0xc7000ed6, 0x36000e79, 0x99000e79, 0xd4000f88, 0x7b000f88, 0x8a000f27, 0x25000f27,
+ 0xc0001169, 0x6f001169, 0x9e0011c6, 0x310011c6, 0x7c001037, 0xd3001037, 0x22001098, 0x8d001098,
+ 0xb800137a, 0x1700137a, 0xe60013d5, 0x490013d5, 0x04001224, 0xab001224, 0x5a00128b, 0xf500128b,
+ 0x3000154f, 0x9f00154f, 0x6e0015e0, 0xc10015e0, 0x8c001411, 0x23001411, 0xd20014be, 0x7d0014be,
+ 0x4800175c, 0xe700175c, 0x160017f3, 0xb90017f3, 0xf4001602, 0x5b001602, 0xaa0016ad, 0x050016ad,
+ 0x2000198a, 0x8f00198a, 0x7e001925, 0xd1001925, 0x9c0018d4, 0x330018d4, 0xc200187b, 0x6d00187b,
+ 0x58001b99, 0xf7001b99, 0x06001b36, 0xa9001b36, 0xe4001ac7, 0x4b001ac7, 0xba001a68, 0x15001a68,
+ 0xd0001dac, 0x7f001dac, 0x8e001d03, 0x21001d03, 0x6c001cf2, 0xc3001cf2, 0x32001c5d, 0x9d001c5d,
+ 0xa8001fbf, 0x07001fbf, 0xf6001f10, 0x59001f10, 0x14001ee1, 0xbb001ee1, 0x4a001e4e, 0xe5001e4e,
+ 0x8000227d, 0x2f00227d, 0xde0022d2, 0x710022d2, 0x3c002323, 0x93002323, 0x6200238c, 0xcd00238c,
+ 0xf800206e, 0x5700206e, 0xa60020c1, 0x090020c1, 0x44002130, 0xeb002130, 0x1a00219f, 0xb500219f,
+ 0x7000265b, 0xdf00265b, 0x2e0026f4, 0x810026f4, 0xcc002705, 0x63002705, 0x920027aa, 0x3d0027aa,
+ 0x08002448, 0xa7002448, 0x560024e7, 0xf90024e7, 0xb4002516, 0x1b002516, 0xea0025b9, 0x450025b9,
+ 0x60002a9e, 0xcf002a9e, 0x3e002a31, 0x91002a31, 0xdc002bc0, 0x73002bc0, 0x82002b6f, 0x2d002b6f,
+ 0x1800288d, 0xb700288d, 0x46002822, 0xe9002822, 0xa40029d3, 0x0b0029d3, 0xfa00297c, 0x5500297c,
+ 0x90002eb8, 0x3f002eb8, 0xce002e17, 0x61002e17, 0x2c002fe6, 0x83002fe6, 0x72002f49, 0xdd002f49,
+ 0xe8002cab, 0x47002cab, 0xb6002c04, 0x19002c04, 0x54002df5, 0xfb002df5, 0x0a002d5a, 0xa5002d5a,
+ 0x40003314, 0xef003314, 0x1e0033bb, 0xb10033bb, 0xfc00324a, 0x5300324a, 0xa20032e5, 0x0d0032e5,
+ 0x38003107, 0x97003107, 0x660031a8, 0xc90031a8, 0x84003059, 0x2b003059, 0xda0030f6, 0x750030f6,
+ 0xb0003732, 0x1f003732, 0xee00379d, 0x4100379d, 0x0c00366c, 0xa300366c, 0x520036c3, 0xfd0036c3,
+ 0xc8003521, 0x67003521, 0x9600358e, 0x3900358e, 0x7400347f, 0xdb00347f, 0x2a0034d0, 0x850034d0,
+ 0xa0003bf7, 0x0f003bf7, 0xfe003b58, 0x51003b58, 0x1c003aa9, 0xb3003aa9, 0x42003a06, 0xed003a06,
+ 0xd80039e4, 0x770039e4, 0x8600394b, 0x2900394b, 0x640038ba, 0xcb0038ba, 0x3a003815, 0x95003815,
+ 0x50003fd1, 0xff003fd1, 0x0e003f7e, 0xa1003f7e, 0xec003e8f, 0x43003e8f, 0xb2003e20, 0x1d003e20,
+ 0x28003dc2, 0x87003dc2, 0x76003d6d, 0xd9003d6d, 0x94003c9c, 0x3b003c9c, 0xca003c33, 0x65003c33,
+ 0x00000000, 0x00004455, 0x000088aa, 0x0000ccff, 0x00011154, 0x00015501, 0x000199fe, 0x0001ddab,
+ 0x000222a8, 0x000266fd, 0x0002aa02, 0x0002ee57, 0x000333fc, 0x000377a9, 0x0003bb56, 0x0003ff03,
+ 0x00044550, 0x00040105, 0x0004cdfa, 0x000489af, 0x00055404, 0x00051051, 0x0005dcae, 0x000598fb,
+ 0x000667f8, 0x000623ad, 0x0006ef52, 0x0006ab07, 0x000776ac, 0x000732f9, 0x0007fe06, 0x0007ba53,
+ 0x00088aa0, 0x0008cef5, 0x0008020a, 0x0008465f, 0x00099bf4, 0x0009dfa1, 0x0009135e, 0x0009570b,
+ 0x000aa808, 0x000aec5d, 0x000a20a2, 0x000a64f7, 0x000bb95c, 0x000bfd09, 0x000b31f6, 0x000b75a3,
+ 0x000ccff0, 0x000c8ba5, 0x000c475a, 0x000c030f, 0x000ddea4, 0x000d9af1, 0x000d560e, 0x000d125b,
+ 0x000eed58, 0x000ea90d, 0x000e65f2, 0x000e21a7, 0x000ffc0c, 0x000fb859, 0x000f74a6, 0x000f30f3,
+ 0x00111540, 0x00115115, 0x00119dea, 0x0011d9bf, 0x00100414, 0x00104041, 0x00108cbe, 0x0010c8eb,
+ 0x001337e8, 0x001373bd, 0x0013bf42, 0x0013fb17, 0x001226bc, 0x001262e9, 0x0012ae16, 0x0012ea43,
+ 0x00155010, 0x00151445, 0x0015d8ba, 0x00159cef, 0x00144144, 0x00140511, 0x0014c9ee, 0x00148dbb,
+ 0x001772b8, 0x001736ed, 0x0017fa12, 0x0017be47, 0x001663ec, 0x001627b9, 0x0016eb46, 0x0016af13,
+ 0x00199fe0, 0x0019dbb5, 0x0019174a, 0x0019531f, 0x00188eb4, 0x0018cae1, 0x0018061e, 0x0018424b,
+ 0x001bbd48, 0x001bf91d, 0x001b35e2, 0x001b71b7, 0x001aac1c, 0x001ae849, 0x001a24b6, 0x001a60e3,
+ 0x001ddab0, 0x001d9ee5, 0x001d521a, 0x001d164f, 0x001ccbe4, 0x001c8fb1, 0x001c434e, 0x001c071b,
+ 0x001ff818, 0x001fbc4d, 0x001f70b2, 0x001f34e7, 0x001ee94c, 0x001ead19, 0x001e61e6, 0x001e25b3,
+ 0x00222a80, 0x00226ed5, 0x0022a22a, 0x0022e67f, 0x00233bd4, 0x00237f81, 0x0023b37e, 0x0023f72b,
+ 0x00200828, 0x00204c7d, 0x00208082, 0x0020c4d7, 0x0021197c, 0x00215d29, 0x002191d6, 0x0021d583,
+ 0x00266fd0, 0x00262b85, 0x0026e77a, 0x0026a32f, 0x00277e84, 0x00273ad1, 0x0027f62e, 0x0027b27b,
+ 0x00244d78, 0x0024092d, 0x0024c5d2, 0x00248187, 0x00255c2c, 0x00251879, 0x0025d486, 0x002590d3,
+ 0x002aa020, 0x002ae475, 0x002a288a, 0x002a6cdf, 0x002bb174, 0x002bf521, 0x002b39de, 0x002b7d8b,
+ 0x00288288, 0x0028c6dd, 0x00280a22, 0x00284e77, 0x002993dc, 0x0029d789, 0x00291b76, 0x00295f23,
+ 0x002ee570, 0x002ea125, 0x002e6dda, 0x002e298f, 0x002ff424, 0x002fb071, 0x002f7c8e, 0x002f38db,
+ 0x002cc7d8, 0x002c838d, 0x002c4f72, 0x002c0b27, 0x002dd68c, 0x002d92d9, 0x002d5e26, 0x002d1a73,
+ 0x00333fc0, 0x00337b95, 0x0033b76a, 0x0033f33f, 0x00322e94, 0x00326ac1, 0x0032a63e, 0x0032e26b,
+ 0x00311d68, 0x0031593d, 0x003195c2, 0x0031d197, 0x00300c3c, 0x00304869, 0x00308496, 0x0030c0c3,
+ 0x00377a90, 0x00373ec5, 0x0037f23a, 0x0037b66f, 0x00366bc4, 0x00362f91, 0x0036e36e, 0x0036a73b,
+ 0x00355838, 0x00351c6d, 0x0035d092, 0x003594c7, 0x0034496c, 0x00340d39, 0x0034c1c6, 0x00348593,
+ 0x003bb560, 0x003bf135, 0x003b3dca, 0x003b799f, 0x003aa434, 0x003ae061, 0x003a2c9e, 0x003a68cb,
+ 0x003997c8, 0x0039d39d, 0x00391f62, 0x00395b37, 0x0038869c, 0x0038c2c9, 0x00380e36, 0x00384a63,
+ 0x003ff030, 0x003fb465, 0x003f789a, 0x003f3ccf, 0x003ee164, 0x003ea531, 0x003e69ce, 0x003e2d9b,
+ 0x003dd298, 0x003d96cd, 0x003d5a32, 0x003d1e67, 0x003cc3cc, 0x003c8799, 0x003c4b66, 0x003c0f33,
+ 0x00000000, 0x00445500, 0x0088aa00, 0x00ccff00, 0x01115400, 0x01550100, 0x0199fe00, 0x01ddab00,
+ 0x0222a800, 0x0266fd00, 0x02aa0200, 0x02ee5700, 0x0333fc00, 0x0377a900, 0x03bb5600, 0x03ff0300,
+ 0x04455000, 0x04010500, 0x04cdfa00, 0x0489af00, 0x05540400, 0x05105100, 0x05dcae00, 0x0598fb00,
+ 0x0667f800, 0x0623ad00, 0x06ef5200, 0x06ab0700, 0x0776ac00, 0x0732f900, 0x07fe0600, 0x07ba5300,
+ 0x088aa000, 0x08cef500, 0x08020a00, 0x08465f00, 0x099bf400, 0x09dfa100, 0x09135e00, 0x09570b00,
+ 0x0aa80800, 0x0aec5d00, 0x0a20a200, 0x0a64f700, 0x0bb95c00, 0x0bfd0900, 0x0b31f600, 0x0b75a300,
+ 0x0ccff000, 0x0c8ba500, 0x0c475a00, 0x0c030f00, 0x0ddea400, 0x0d9af100, 0x0d560e00, 0x0d125b00,
+ 0x0eed5800, 0x0ea90d00, 0x0e65f200, 0x0e21a700, 0x0ffc0c00, 0x0fb85900, 0x0f74a600, 0x0f30f300,
+ 0x11154000, 0x11511500, 0x119dea00, 0x11d9bf00, 0x10041400, 0x10404100, 0x108cbe00, 0x10c8eb00,
+ 0x1337e800, 0x1373bd00, 0x13bf4200, 0x13fb1700, 0x1226bc00, 0x1262e900, 0x12ae1600, 0x12ea4300,
+ 0x15501000, 0x15144500, 0x15d8ba00, 0x159cef00, 0x14414400, 0x14051100, 0x14c9ee00, 0x148dbb00,
+ 0x1772b800, 0x1736ed00, 0x17fa1200, 0x17be4700, 0x1663ec00, 0x1627b900, 0x16eb4600, 0x16af1300,
+ 0x199fe000, 0x19dbb500, 0x19174a00, 0x19531f00, 0x188eb400, 0x18cae100, 0x18061e00, 0x18424b00,
+ 0x1bbd4800, 0x1bf91d00, 0x1b35e200, 0x1b71b700, 0x1aac1c00, 0x1ae84900, 0x1a24b600, 0x1a60e300,
+ 0x1ddab000, 0x1d9ee500, 0x1d521a00, 0x1d164f00, 0x1ccbe400, 0x1c8fb100, 0x1c434e00, 0x1c071b00,
+ 0x1ff81800, 0x1fbc4d00, 0x1f70b200, 0x1f34e700, 0x1ee94c00, 0x1ead1900, 0x1e61e600, 0x1e25b300,
+ 0x222a8000, 0x226ed500, 0x22a22a00, 0x22e67f00, 0x233bd400, 0x237f8100, 0x23b37e00, 0x23f72b00,
+ 0x20082800, 0x204c7d00, 0x20808200, 0x20c4d700, 0x21197c00, 0x215d2900, 0x2191d600, 0x21d58300,
+ 0x266fd000, 0x262b8500, 0x26e77a00, 0x26a32f00, 0x277e8400, 0x273ad100, 0x27f62e00, 0x27b27b00,
+ 0x244d7800, 0x24092d00, 0x24c5d200, 0x24818700, 0x255c2c00, 0x25187900, 0x25d48600, 0x2590d300,
+ 0x2aa02000, 0x2ae47500, 0x2a288a00, 0x2a6cdf00, 0x2bb17400, 0x2bf52100, 0x2b39de00, 0x2b7d8b00,
+ 0x28828800, 0x28c6dd00, 0x280a2200, 0x284e7700, 0x2993dc00, 0x29d78900, 0x291b7600, 0x295f2300,
+ 0x2ee57000, 0x2ea12500, 0x2e6dda00, 0x2e298f00, 0x2ff42400, 0x2fb07100, 0x2f7c8e00, 0x2f38db00,
+ 0x2cc7d800, 0x2c838d00, 0x2c4f7200, 0x2c0b2700, 0x2dd68c00, 0x2d92d900, 0x2d5e2600, 0x2d1a7300,
+ 0x333fc000, 0x337b9500, 0x33b76a00, 0x33f33f00, 0x322e9400, 0x326ac100, 0x32a63e00, 0x32e26b00,
+ 0x311d6800, 0x31593d00, 0x3195c200, 0x31d19700, 0x300c3c00, 0x30486900, 0x30849600, 0x30c0c300,
+ 0x377a9000, 0x373ec500, 0x37f23a00, 0x37b66f00, 0x366bc400, 0x362f9100, 0x36e36e00, 0x36a73b00,
+ 0x35583800, 0x351c6d00, 0x35d09200, 0x3594c700, 0x34496c00, 0x340d3900, 0x34c1c600, 0x34859300,
+ 0x3bb56000, 0x3bf13500, 0x3b3dca00, 0x3b799f00, 0x3aa43400, 0x3ae06100, 0x3a2c9e00, 0x3a68cb00,
+ 0x3997c800, 0x39d39d00, 0x391f6200, 0x395b3700, 0x38869c00, 0x38c2c900, 0x380e3600, 0x384a6300,
+ 0x3ff03000, 0x3fb46500, 0x3f789a00, 0x3f3ccf00, 0x3ee16400, 0x3ea53100, 0x3e69ce00, 0x3e2d9b00,
+ 0x3dd29800, 0x3d96cd00, 0x3d5a3200, 0x3d1e6700, 0x3cc3cc00, 0x3c879900, 0x3c4b6600, 0x3c0f3300,
+ 0x00000000, 0x44550000, 0x88aa0000, 0xccff0000, 0x115400af, 0x550100af, 0x99fe00af, 0xddab00af,
+ 0x22a8015e, 0x66fd015e, 0xaa02015e, 0xee57015e, 0x33fc01f1, 0x77a901f1, 0xbb5601f1, 0xff0301f1,
+ 0x455002bc, 0x010502bc, 0xcdfa02bc, 0x89af02bc, 0x54040213, 0x10510213, 0xdcae0213, 0x98fb0213,
+ 0x67f803e2, 0x23ad03e2, 0xef5203e2, 0xab0703e2, 0x76ac034d, 0x32f9034d, 0xfe06034d, 0xba53034d,
+ 0x8aa00578, 0xcef50578, 0x020a0578, 0x465f0578, 0x9bf405d7, 0xdfa105d7, 0x135e05d7, 0x570b05d7,
+ 0xa8080426, 0xec5d0426, 0x20a20426, 0x64f70426, 0xb95c0489, 0xfd090489, 0x31f60489, 0x75a30489,
+ 0xcff007c4, 0x8ba507c4, 0x475a07c4, 0x030f07c4, 0xdea4076b, 0x9af1076b, 0x560e076b, 0x125b076b,
+ 0xed58069a, 0xa90d069a, 0x65f2069a, 0x21a7069a, 0xfc0c0635, 0xb8590635, 0x74a60635, 0x30f30635,
+ 0x15400a5f, 0x51150a5f, 0x9dea0a5f, 0xd9bf0a5f, 0x04140af0, 0x40410af0, 0x8cbe0af0, 0xc8eb0af0,
+ 0x37e80b01, 0x73bd0b01, 0xbf420b01, 0xfb170b01, 0x26bc0bae, 0x62e90bae, 0xae160bae, 0xea430bae,
+ 0x501008e3, 0x144508e3, 0xd8ba08e3, 0x9cef08e3, 0x4144084c, 0x0511084c, 0xc9ee084c, 0x8dbb084c,
+ 0x72b809bd, 0x36ed09bd, 0xfa1209bd, 0xbe4709bd, 0x63ec0912, 0x27b90912, 0xeb460912, 0xaf130912,
+ 0x9fe00f27, 0xdbb50f27, 0x174a0f27, 0x531f0f27, 0x8eb40f88, 0xcae10f88, 0x061e0f88, 0x424b0f88,
+ 0xbd480e79, 0xf91d0e79, 0x35e20e79, 0x71b70e79, 0xac1c0ed6, 0xe8490ed6, 0x24b60ed6, 0x60e30ed6,
+ 0xdab00d9b, 0x9ee50d9b, 0x521a0d9b, 0x164f0d9b, 0xcbe40d34, 0x8fb10d34, 0x434e0d34, 0x071b0d34,
+ 0xf8180cc5, 0xbc4d0cc5, 0x70b20cc5, 0x34e70cc5, 0xe94c0c6a, 0xad190c6a, 0x61e60c6a, 0x25b30c6a,
+ 0x2a8014be, 0x6ed514be, 0xa22a14be, 0xe67f14be, 0x3bd41411, 0x7f811411, 0xb37e1411, 0xf72b1411,
+ 0x082815e0, 0x4c7d15e0, 0x808215e0, 0xc4d715e0, 0x197c154f, 0x5d29154f, 0x91d6154f, 0xd583154f,
+ 0x6fd01602, 0x2b851602, 0xe77a1602, 0xa32f1602, 0x7e8416ad, 0x3ad116ad, 0xf62e16ad, 0xb27b16ad,
+ 0x4d78175c, 0x092d175c, 0xc5d2175c, 0x8187175c, 0x5c2c17f3, 0x187917f3, 0xd48617f3, 0x90d317f3,
+ 0xa02011c6, 0xe47511c6, 0x288a11c6, 0x6cdf11c6, 0xb1741169, 0xf5211169, 0x39de1169, 0x7d8b1169,
+ 0x82881098, 0xc6dd1098, 0x0a221098, 0x4e771098, 0x93dc1037, 0xd7891037, 0x1b761037, 0x5f231037,
+ 0xe570137a, 0xa125137a, 0x6dda137a, 0x298f137a, 0xf42413d5, 0xb07113d5, 0x7c8e13d5, 0x38db13d5,
+ 0xc7d81224, 0x838d1224, 0x4f721224, 0x0b271224, 0xd68c128b, 0x92d9128b, 0x5e26128b, 0x1a73128b,
+ 0x3fc01ee1, 0x7b951ee1, 0xb76a1ee1, 0xf33f1ee1, 0x2e941e4e, 0x6ac11e4e, 0xa63e1e4e, 0xe26b1e4e,
+ 0x1d681fbf, 0x593d1fbf, 0x95c21fbf, 0xd1971fbf, 0x0c3c1f10, 0x48691f10, 0x84961f10, 0xc0c31f10,
+ 0x7a901c5d, 0x3ec51c5d, 0xf23a1c5d, 0xb66f1c5d, 0x6bc41cf2, 0x2f911cf2, 0xe36e1cf2, 0xa73b1cf2,
+ 0x58381d03, 0x1c6d1d03, 0xd0921d03, 0x94c71d03, 0x496c1dac, 0x0d391dac, 0xc1c61dac, 0x85931dac,
+ 0xb5601b99, 0xf1351b99, 0x3dca1b99, 0x799f1b99, 0xa4341b36, 0xe0611b36, 0x2c9e1b36, 0x68cb1b36,
+ 0x97c81ac7, 0xd39d1ac7, 0x1f621ac7, 0x5b371ac7, 0x869c1a68, 0xc2c91a68, 0x0e361a68, 0x4a631a68,
+ 0xf0301925, 0xb4651925, 0x789a1925, 0x3ccf1925, 0xe164198a, 0xa531198a, 0x69ce198a, 0x2d9b198a,
+ 0xd298187b, 0x96cd187b, 0x5a32187b, 0x1e67187b, 0xc3cc18d4, 0x879918d4, 0x4b6618d4, 0x0f3318d4,
+ 0x00000000, 0x5500297c, 0xaa0052f8, 0xff007b84, 0x5400a55f, 0x01008c23, 0xfe00f7a7, 0xab00dedb,
+ 0xa8014abe, 0xfd0163c2, 0x02011846, 0x5701313a, 0xfc01efe1, 0xa901c69d, 0x5601bd19, 0x03019465,
+ 0x500295d3, 0x0502bcaf, 0xfa02c72b, 0xaf02ee57, 0x0402308c, 0x510219f0, 0xae026274, 0xfb024b08,
+ 0xf803df6d, 0xad03f611, 0x52038d95, 0x0703a4e9, 0xac037a32, 0xf903534e, 0x060328ca, 0x530301b6,
+ 0xa0052ba6, 0xf50502da, 0x0a05795e, 0x5f055022, 0xf4058ef9, 0xa105a785, 0x5e05dc01, 0x0b05f57d,
+ 0x08046118, 0x5d044864, 0xa20433e0, 0xf7041a9c, 0x5c04c447, 0x0904ed3b, 0xf60496bf, 0xa304bfc3,
+ 0xf007be75, 0xa5079709, 0x5a07ec8d, 0x0f07c5f1, 0xa4071b2a, 0xf1073256, 0x0e0749d2, 0x5b0760ae,
+ 0x5806f4cb, 0x0d06ddb7, 0xf206a633, 0xa7068f4f, 0x0c065194, 0x590678e8, 0xa606036c, 0xf3062a10,
+ 0x400a57e3, 0x150a7e9f, 0xea0a051b, 0xbf0a2c67, 0x140af2bc, 0x410adbc0, 0xbe0aa044, 0xeb0a8938,
+ 0xe80b1d5d, 0xbd0b3421, 0x420b4fa5, 0x170b66d9, 0xbc0bb802, 0xe90b917e, 0x160beafa, 0x430bc386,
+ 0x1008c230, 0x4508eb4c, 0xba0890c8, 0xef08b9b4, 0x4408676f, 0x11084e13, 0xee083597, 0xbb081ceb,
+ 0xb809888e, 0xed09a1f2, 0x1209da76, 0x4709f30a, 0xec092dd1, 0xb90904ad, 0x46097f29, 0x13095655,
+ 0xe00f7c45, 0xb50f5539, 0x4a0f2ebd, 0x1f0f07c1, 0xb40fd91a, 0xe10ff066, 0x1e0f8be2, 0x4b0fa29e,
+ 0x480e36fb, 0x1d0e1f87, 0xe20e6403, 0xb70e4d7f, 0x1c0e93a4, 0x490ebad8, 0xb60ec15c, 0xe30ee820,
+ 0xb00de996, 0xe50dc0ea, 0x1a0dbb6e, 0x4f0d9212, 0xe40d4cc9, 0xb10d65b5, 0x4e0d1e31, 0x1b0d374d,
+ 0x180ca328, 0x4d0c8a54, 0xb20cf1d0, 0xe70cd8ac, 0x4c0c0677, 0x190c2f0b, 0xe60c548f, 0xb30c7df3,
+ 0x8014afc6, 0xd51486ba, 0x2a14fd3e, 0x7f14d442, 0xd4140a99, 0x811423e5, 0x7e145861, 0x2b14711d,
+ 0x2815e578, 0x7d15cc04, 0x8215b780, 0xd7159efc, 0x7c154027, 0x2915695b, 0xd61512df, 0x83153ba3,
+ 0xd0163a15, 0x85161369, 0x7a1668ed, 0x2f164191, 0x84169f4a, 0xd116b636, 0x2e16cdb2, 0x7b16e4ce,
+ 0x781770ab, 0x2d1759d7, 0xd2172253, 0x87170b2f, 0x2c17d5f4, 0x7917fc88, 0x8617870c, 0xd317ae70,
+ 0x20118460, 0x7511ad1c, 0x8a11d698, 0xdf11ffe4, 0x7411213f, 0x21110843, 0xde1173c7, 0x8b115abb,
+ 0x8810cede, 0xdd10e7a2, 0x22109c26, 0x7710b55a, 0xdc106b81, 0x891042fd, 0x76103979, 0x23101005,
+ 0x701311b3, 0x251338cf, 0xda13434b, 0x8f136a37, 0x2413b4ec, 0x71139d90, 0x8e13e614, 0xdb13cf68,
+ 0xd8125b0d, 0x8d127271, 0x721209f5, 0x27122089, 0x8c12fe52, 0xd912d72e, 0x2612acaa, 0x731285d6,
+ 0xc01ef825, 0x951ed159, 0x6a1eaadd, 0x3f1e83a1, 0x941e5d7a, 0xc11e7406, 0x3e1e0f82, 0x6b1e26fe,
+ 0x681fb29b, 0x3d1f9be7, 0xc21fe063, 0x971fc91f, 0x3c1f17c4, 0x691f3eb8, 0x961f453c, 0xc31f6c40,
+ 0x901c6df6, 0xc51c448a, 0x3a1c3f0e, 0x6f1c1672, 0xc41cc8a9, 0x911ce1d5, 0x6e1c9a51, 0x3b1cb32d,
+ 0x381d2748, 0x6d1d0e34, 0x921d75b0, 0xc71d5ccc, 0x6c1d8217, 0x391dab6b, 0xc61dd0ef, 0x931df993,
+ 0x601bd383, 0x351bfaff, 0xca1b817b, 0x9f1ba807, 0x341b76dc, 0x611b5fa0, 0x9e1b2424, 0xcb1b0d58,
+ 0xc81a993d, 0x9d1ab041, 0x621acbc5, 0x371ae2b9, 0x9c1a3c62, 0xc91a151e, 0x361a6e9a, 0x631a47e6,
+ 0x30194650, 0x65196f2c, 0x9a1914a8, 0xcf193dd4, 0x6419e30f, 0x3119ca73, 0xce19b1f7, 0x9b19988b,
+ 0x98180cee, 0xcd182592, 0x32185e16, 0x6718776a, 0xcc18a9b1, 0x991880cd, 0x6618fb49, 0x3318d235,
+};
+
+const uint32_t crc32_04c11db7_crc_table[CRC_SLICES * 256] = {
+ 0x00000000, 0x04c11db7, 0x09823b6e, 0x0d4326d9, 0x130476dc, 0x17c56b6b, 0x1a864db2, 0x1e475005,
+ 0x2608edb8, 0x22c9f00f, 0x2f8ad6d6, 0x2b4bcb61, 0x350c9b64, 0x31cd86d3, 0x3c8ea00a, 0x384fbdbd,
+ 0x4c11db70, 0x48d0c6c7, 0x4593e01e, 0x4152fda9, 0x5f15adac, 0x5bd4b01b, 0x569796c2, 0x52568b75,
+ 0x6a1936c8, 0x6ed82b7f, 0x639b0da6, 0x675a1011, 0x791d4014, 0x7ddc5da3, 0x709f7b7a, 0x745e66cd,
+ 0x9823b6e0, 0x9ce2ab57, 0x91a18d8e, 0x95609039, 0x8b27c03c, 0x8fe6dd8b, 0x82a5fb52, 0x8664e6e5,
+ 0xbe2b5b58, 0xbaea46ef, 0xb7a96036, 0xb3687d81, 0xad2f2d84, 0xa9ee3033, 0xa4ad16ea, 0xa06c0b5d,
+ 0xd4326d90, 0xd0f37027, 0xddb056fe, 0xd9714b49, 0xc7361b4c, 0xc3f706fb, 0xceb42022, 0xca753d95,
+ 0xf23a8028, 0xf6fb9d9f, 0xfbb8bb46, 0xff79a6f1, 0xe13ef6f4, 0xe5ffeb43, 0xe8bccd9a, 0xec7dd02d,
+ 0x34867077, 0x30476dc0, 0x3d044b19, 0x39c556ae, 0x278206ab, 0x23431b1c, 0x2e003dc5, 0x2ac12072,
+ 0x128e9dcf, 0x164f8078, 0x1b0ca6a1, 0x1fcdbb16, 0x018aeb13, 0x054bf6a4, 0x0808d07d, 0x0cc9cdca,
+ 0x7897ab07, 0x7c56b6b0, 0x71159069, 0x75d48dde, 0x6b93dddb, 0x6f52c06c, 0x6211e6b5, 0x66d0fb02,
+ 0x5e9f46bf, 0x5a5e5b08, 0x571d7dd1, 0x53dc6066, 0x4d9b3063, 0x495a2dd4, 0x44190b0d, 0x40d816ba,
+ 0xaca5c697, 0xa864db20, 0xa527fdf9, 0xa1e6e04e, 0xbfa1b04b, 0xbb60adfc, 0xb6238b25, 0xb2e29692,
+ 0x8aad2b2f, 0x8e6c3698, 0x832f1041, 0x87ee0df6, 0x99a95df3, 0x9d684044, 0x902b669d, 0x94ea7b2a,
+ 0xe0b41de7, 0xe4750050, 0xe9362689, 0xedf73b3e, 0xf3b06b3b, 0xf771768c, 0xfa325055, 0xfef34de2,
+ 0xc6bcf05f, 0xc27dede8, 0xcf3ecb31, 0xcbffd686, 0xd5b88683, 0xd1799b34, 0xdc3abded, 0xd8fba05a,
+ 0x690ce0ee, 0x6dcdfd59, 0x608edb80, 0x644fc637, 0x7a089632, 0x7ec98b85, 0x738aad5c, 0x774bb0eb,
+ 0x4f040d56, 0x4bc510e1, 0x46863638, 0x42472b8f, 0x5c007b8a, 0x58c1663d, 0x558240e4, 0x51435d53,
+ 0x251d3b9e, 0x21dc2629, 0x2c9f00f0, 0x285e1d47, 0x36194d42, 0x32d850f5, 0x3f9b762c, 0x3b5a6b9b,
+ 0x0315d626, 0x07d4cb91, 0x0a97ed48, 0x0e56f0ff, 0x1011a0fa, 0x14d0bd4d, 0x19939b94, 0x1d528623,
+ 0xf12f560e, 0xf5ee4bb9, 0xf8ad6d60, 0xfc6c70d7, 0xe22b20d2, 0xe6ea3d65, 0xeba91bbc, 0xef68060b,
+ 0xd727bbb6, 0xd3e6a601, 0xdea580d8, 0xda649d6f, 0xc423cd6a, 0xc0e2d0dd, 0xcda1f604, 0xc960ebb3,
+ 0xbd3e8d7e, 0xb9ff90c9, 0xb4bcb610, 0xb07daba7, 0xae3afba2, 0xaafbe615, 0xa7b8c0cc, 0xa379dd7b,
+ 0x9b3660c6, 0x9ff77d71, 0x92b45ba8, 0x9675461f, 0x8832161a, 0x8cf30bad, 0x81b02d74, 0x857130c3,
+ 0x5d8a9099, 0x594b8d2e, 0x5408abf7, 0x50c9b640, 0x4e8ee645, 0x4a4ffbf2, 0x470cdd2b, 0x43cdc09c,
+ 0x7b827d21, 0x7f436096, 0x7200464f, 0x76c15bf8, 0x68860bfd, 0x6c47164a, 0x61043093, 0x65c52d24,
+ 0x119b4be9, 0x155a565e, 0x18197087, 0x1cd86d30, 0x029f3d35, 0x065e2082, 0x0b1d065b, 0x0fdc1bec,
+ 0x3793a651, 0x3352bbe6, 0x3e119d3f, 0x3ad08088, 0x2497d08d, 0x2056cd3a, 0x2d15ebe3, 0x29d4f654,
+ 0xc5a92679, 0xc1683bce, 0xcc2b1d17, 0xc8ea00a0, 0xd6ad50a5, 0xd26c4d12, 0xdf2f6bcb, 0xdbee767c,
+ 0xe3a1cbc1, 0xe760d676, 0xea23f0af, 0xeee2ed18, 0xf0a5bd1d, 0xf464a0aa, 0xf9278673, 0xfde69bc4,
+ 0x89b8fd09, 0x8d79e0be, 0x803ac667, 0x84fbdbd0, 0x9abc8bd5, 0x9e7d9662, 0x933eb0bb, 0x97ffad0c,
+ 0xafb010b1, 0xab710d06, 0xa6322bdf, 0xa2f33668, 0xbcb4666d, 0xb8757bda, 0xb5365d03, 0xb1f740b4,
+ 0x00000000, 0xd219c1dc, 0xa0f29e0f, 0x72eb5fd3, 0x452421a9, 0x973de075, 0xe5d6bfa6, 0x37cf7e7a,
+ 0x8a484352, 0x5851828e, 0x2abadd5d, 0xf8a31c81, 0xcf6c62fb, 0x1d75a327, 0x6f9efcf4, 0xbd873d28,
+ 0x10519b13, 0xc2485acf, 0xb0a3051c, 0x62bac4c0, 0x5575baba, 0x876c7b66, 0xf58724b5, 0x279ee569,
+ 0x9a19d841, 0x4800199d, 0x3aeb464e, 0xe8f28792, 0xdf3df9e8, 0x0d243834, 0x7fcf67e7, 0xadd6a63b,
+ 0x20a33626, 0xf2baf7fa, 0x8051a829, 0x524869f5, 0x6587178f, 0xb79ed653, 0xc5758980, 0x176c485c,
+ 0xaaeb7574, 0x78f2b4a8, 0x0a19eb7b, 0xd8002aa7, 0xefcf54dd, 0x3dd69501, 0x4f3dcad2, 0x9d240b0e,
+ 0x30f2ad35, 0xe2eb6ce9, 0x9000333a, 0x4219f2e6, 0x75d68c9c, 0xa7cf4d40, 0xd5241293, 0x073dd34f,
+ 0xbabaee67, 0x68a32fbb, 0x1a487068, 0xc851b1b4, 0xff9ecfce, 0x2d870e12, 0x5f6c51c1, 0x8d75901d,
+ 0x41466c4c, 0x935fad90, 0xe1b4f243, 0x33ad339f, 0x04624de5, 0xd67b8c39, 0xa490d3ea, 0x76891236,
+ 0xcb0e2f1e, 0x1917eec2, 0x6bfcb111, 0xb9e570cd, 0x8e2a0eb7, 0x5c33cf6b, 0x2ed890b8, 0xfcc15164,
+ 0x5117f75f, 0x830e3683, 0xf1e56950, 0x23fca88c, 0x1433d6f6, 0xc62a172a, 0xb4c148f9, 0x66d88925,
+ 0xdb5fb40d, 0x094675d1, 0x7bad2a02, 0xa9b4ebde, 0x9e7b95a4, 0x4c625478, 0x3e890bab, 0xec90ca77,
+ 0x61e55a6a, 0xb3fc9bb6, 0xc117c465, 0x130e05b9, 0x24c17bc3, 0xf6d8ba1f, 0x8433e5cc, 0x562a2410,
+ 0xebad1938, 0x39b4d8e4, 0x4b5f8737, 0x994646eb, 0xae893891, 0x7c90f94d, 0x0e7ba69e, 0xdc626742,
+ 0x71b4c179, 0xa3ad00a5, 0xd1465f76, 0x035f9eaa, 0x3490e0d0, 0xe689210c, 0x94627edf, 0x467bbf03,
+ 0xfbfc822b, 0x29e543f7, 0x5b0e1c24, 0x8917ddf8, 0xbed8a382, 0x6cc1625e, 0x1e2a3d8d, 0xcc33fc51,
+ 0x828cd898, 0x50951944, 0x227e4697, 0xf067874b, 0xc7a8f931, 0x15b138ed, 0x675a673e, 0xb543a6e2,
+ 0x08c49bca, 0xdadd5a16, 0xa83605c5, 0x7a2fc419, 0x4de0ba63, 0x9ff97bbf, 0xed12246c, 0x3f0be5b0,
+ 0x92dd438b, 0x40c48257, 0x322fdd84, 0xe0361c58, 0xd7f96222, 0x05e0a3fe, 0x770bfc2d, 0xa5123df1,
+ 0x189500d9, 0xca8cc105, 0xb8679ed6, 0x6a7e5f0a, 0x5db12170, 0x8fa8e0ac, 0xfd43bf7f, 0x2f5a7ea3,
+ 0xa22feebe, 0x70362f62, 0x02dd70b1, 0xd0c4b16d, 0xe70bcf17, 0x35120ecb, 0x47f95118, 0x95e090c4,
+ 0x2867adec, 0xfa7e6c30, 0x889533e3, 0x5a8cf23f, 0x6d438c45, 0xbf5a4d99, 0xcdb1124a, 0x1fa8d396,
+ 0xb27e75ad, 0x6067b471, 0x128ceba2, 0xc0952a7e, 0xf75a5404, 0x254395d8, 0x57a8ca0b, 0x85b10bd7,
+ 0x383636ff, 0xea2ff723, 0x98c4a8f0, 0x4add692c, 0x7d121756, 0xaf0bd68a, 0xdde08959, 0x0ff94885,
+ 0xc3cab4d4, 0x11d37508, 0x63382adb, 0xb121eb07, 0x86ee957d, 0x54f754a1, 0x261c0b72, 0xf405caae,
+ 0x4982f786, 0x9b9b365a, 0xe9706989, 0x3b69a855, 0x0ca6d62f, 0xdebf17f3, 0xac544820, 0x7e4d89fc,
+ 0xd39b2fc7, 0x0182ee1b, 0x7369b1c8, 0xa1707014, 0x96bf0e6e, 0x44a6cfb2, 0x364d9061, 0xe45451bd,
+ 0x59d36c95, 0x8bcaad49, 0xf921f29a, 0x2b383346, 0x1cf74d3c, 0xceee8ce0, 0xbc05d333, 0x6e1c12ef,
+ 0xe36982f2, 0x3170432e, 0x439b1cfd, 0x9182dd21, 0xa64da35b, 0x74546287, 0x06bf3d54, 0xd4a6fc88,
+ 0x6921c1a0, 0xbb38007c, 0xc9d35faf, 0x1bca9e73, 0x2c05e009, 0xfe1c21d5, 0x8cf77e06, 0x5eeebfda,
+ 0xf33819e1, 0x2121d83d, 0x53ca87ee, 0x81d34632, 0xb61c3848, 0x6405f994, 0x16eea647, 0xc4f7679b,
+ 0x79705ab3, 0xab699b6f, 0xd982c4bc, 0x0b9b0560, 0x3c547b1a, 0xee4dbac6, 0x9ca6e515, 0x4ebf24c9,
+ 0x00000000, 0x01d8ac87, 0x03b1590e, 0x0269f589, 0x0762b21c, 0x06ba1e9b, 0x04d3eb12, 0x050b4795,
+ 0x0ec56438, 0x0f1dc8bf, 0x0d743d36, 0x0cac91b1, 0x09a7d624, 0x087f7aa3, 0x0a168f2a, 0x0bce23ad,
+ 0x1d8ac870, 0x1c5264f7, 0x1e3b917e, 0x1fe33df9, 0x1ae87a6c, 0x1b30d6eb, 0x19592362, 0x18818fe5,
+ 0x134fac48, 0x129700cf, 0x10fef546, 0x112659c1, 0x142d1e54, 0x15f5b2d3, 0x179c475a, 0x1644ebdd,
+ 0x3b1590e0, 0x3acd3c67, 0x38a4c9ee, 0x397c6569, 0x3c7722fc, 0x3daf8e7b, 0x3fc67bf2, 0x3e1ed775,
+ 0x35d0f4d8, 0x3408585f, 0x3661add6, 0x37b90151, 0x32b246c4, 0x336aea43, 0x31031fca, 0x30dbb34d,
+ 0x269f5890, 0x2747f417, 0x252e019e, 0x24f6ad19, 0x21fdea8c, 0x2025460b, 0x224cb382, 0x23941f05,
+ 0x285a3ca8, 0x2982902f, 0x2beb65a6, 0x2a33c921, 0x2f388eb4, 0x2ee02233, 0x2c89d7ba, 0x2d517b3d,
+ 0x762b21c0, 0x77f38d47, 0x759a78ce, 0x7442d449, 0x714993dc, 0x70913f5b, 0x72f8cad2, 0x73206655,
+ 0x78ee45f8, 0x7936e97f, 0x7b5f1cf6, 0x7a87b071, 0x7f8cf7e4, 0x7e545b63, 0x7c3daeea, 0x7de5026d,
+ 0x6ba1e9b0, 0x6a794537, 0x6810b0be, 0x69c81c39, 0x6cc35bac, 0x6d1bf72b, 0x6f7202a2, 0x6eaaae25,
+ 0x65648d88, 0x64bc210f, 0x66d5d486, 0x670d7801, 0x62063f94, 0x63de9313, 0x61b7669a, 0x606fca1d,
+ 0x4d3eb120, 0x4ce61da7, 0x4e8fe82e, 0x4f5744a9, 0x4a5c033c, 0x4b84afbb, 0x49ed5a32, 0x4835f6b5,
+ 0x43fbd518, 0x4223799f, 0x404a8c16, 0x41922091, 0x44996704, 0x4541cb83, 0x47283e0a, 0x46f0928d,
+ 0x50b47950, 0x516cd5d7, 0x5305205e, 0x52dd8cd9, 0x57d6cb4c, 0x560e67cb, 0x54679242, 0x55bf3ec5,
+ 0x5e711d68, 0x5fa9b1ef, 0x5dc04466, 0x5c18e8e1, 0x5913af74, 0x58cb03f3, 0x5aa2f67a, 0x5b7a5afd,
+ 0xec564380, 0xed8eef07, 0xefe71a8e, 0xee3fb609, 0xeb34f19c, 0xeaec5d1b, 0xe885a892, 0xe95d0415,
+ 0xe29327b8, 0xe34b8b3f, 0xe1227eb6, 0xe0fad231, 0xe5f195a4, 0xe4293923, 0xe640ccaa, 0xe798602d,
+ 0xf1dc8bf0, 0xf0042777, 0xf26dd2fe, 0xf3b57e79, 0xf6be39ec, 0xf766956b, 0xf50f60e2, 0xf4d7cc65,
+ 0xff19efc8, 0xfec1434f, 0xfca8b6c6, 0xfd701a41, 0xf87b5dd4, 0xf9a3f153, 0xfbca04da, 0xfa12a85d,
+ 0xd743d360, 0xd69b7fe7, 0xd4f28a6e, 0xd52a26e9, 0xd021617c, 0xd1f9cdfb, 0xd3903872, 0xd24894f5,
+ 0xd986b758, 0xd85e1bdf, 0xda37ee56, 0xdbef42d1, 0xdee40544, 0xdf3ca9c3, 0xdd555c4a, 0xdc8df0cd,
+ 0xcac91b10, 0xcb11b797, 0xc978421e, 0xc8a0ee99, 0xcdaba90c, 0xcc73058b, 0xce1af002, 0xcfc25c85,
+ 0xc40c7f28, 0xc5d4d3af, 0xc7bd2626, 0xc6658aa1, 0xc36ecd34, 0xc2b661b3, 0xc0df943a, 0xc10738bd,
+ 0x9a7d6240, 0x9ba5cec7, 0x99cc3b4e, 0x981497c9, 0x9d1fd05c, 0x9cc77cdb, 0x9eae8952, 0x9f7625d5,
+ 0x94b80678, 0x9560aaff, 0x97095f76, 0x96d1f3f1, 0x93dab464, 0x920218e3, 0x906bed6a, 0x91b341ed,
+ 0x87f7aa30, 0x862f06b7, 0x8446f33e, 0x859e5fb9, 0x8095182c, 0x814db4ab, 0x83244122, 0x82fceda5,
+ 0x8932ce08, 0x88ea628f, 0x8a839706, 0x8b5b3b81, 0x8e507c14, 0x8f88d093, 0x8de1251a, 0x8c39899d,
+ 0xa168f2a0, 0xa0b05e27, 0xa2d9abae, 0xa3010729, 0xa60a40bc, 0xa7d2ec3b, 0xa5bb19b2, 0xa463b535,
+ 0xafad9698, 0xae753a1f, 0xac1ccf96, 0xadc46311, 0xa8cf2484, 0xa9178803, 0xab7e7d8a, 0xaaa6d10d,
+ 0xbce23ad0, 0xbd3a9657, 0xbf5363de, 0xbe8bcf59, 0xbb8088cc, 0xba58244b, 0xb831d1c2, 0xb9e97d45,
+ 0xb2275ee8, 0xb3fff26f, 0xb19607e6, 0xb04eab61, 0xb545ecf4, 0xb49d4073, 0xb6f4b5fa, 0xb72c197d,
+ 0x00000000, 0xdc6d9ab7, 0xbc1a28d9, 0x6077b26e, 0x7cf54c05, 0xa098d6b2, 0xc0ef64dc, 0x1c82fe6b,
+ 0xf9ea980a, 0x258702bd, 0x45f0b0d3, 0x999d2a64, 0x851fd40f, 0x59724eb8, 0x3905fcd6, 0xe5686661,
+ 0xf7142da3, 0x2b79b714, 0x4b0e057a, 0x97639fcd, 0x8be161a6, 0x578cfb11, 0x37fb497f, 0xeb96d3c8,
+ 0x0efeb5a9, 0xd2932f1e, 0xb2e49d70, 0x6e8907c7, 0x720bf9ac, 0xae66631b, 0xce11d175, 0x127c4bc2,
+ 0xeae946f1, 0x3684dc46, 0x56f36e28, 0x8a9ef49f, 0x961c0af4, 0x4a719043, 0x2a06222d, 0xf66bb89a,
+ 0x1303defb, 0xcf6e444c, 0xaf19f622, 0x73746c95, 0x6ff692fe, 0xb39b0849, 0xd3ecba27, 0x0f812090,
+ 0x1dfd6b52, 0xc190f1e5, 0xa1e7438b, 0x7d8ad93c, 0x61082757, 0xbd65bde0, 0xdd120f8e, 0x017f9539,
+ 0xe417f358, 0x387a69ef, 0x580ddb81, 0x84604136, 0x98e2bf5d, 0x448f25ea, 0x24f89784, 0xf8950d33,
+ 0xd1139055, 0x0d7e0ae2, 0x6d09b88c, 0xb164223b, 0xade6dc50, 0x718b46e7, 0x11fcf489, 0xcd916e3e,
+ 0x28f9085f, 0xf49492e8, 0x94e32086, 0x488eba31, 0x540c445a, 0x8861deed, 0xe8166c83, 0x347bf634,
+ 0x2607bdf6, 0xfa6a2741, 0x9a1d952f, 0x46700f98, 0x5af2f1f3, 0x869f6b44, 0xe6e8d92a, 0x3a85439d,
+ 0xdfed25fc, 0x0380bf4b, 0x63f70d25, 0xbf9a9792, 0xa31869f9, 0x7f75f34e, 0x1f024120, 0xc36fdb97,
+ 0x3bfad6a4, 0xe7974c13, 0x87e0fe7d, 0x5b8d64ca, 0x470f9aa1, 0x9b620016, 0xfb15b278, 0x277828cf,
+ 0xc2104eae, 0x1e7dd419, 0x7e0a6677, 0xa267fcc0, 0xbee502ab, 0x6288981c, 0x02ff2a72, 0xde92b0c5,
+ 0xcceefb07, 0x108361b0, 0x70f4d3de, 0xac994969, 0xb01bb702, 0x6c762db5, 0x0c019fdb, 0xd06c056c,
+ 0x3504630d, 0xe969f9ba, 0x891e4bd4, 0x5573d163, 0x49f12f08, 0x959cb5bf, 0xf5eb07d1, 0x29869d66,
+ 0xa6e63d1d, 0x7a8ba7aa, 0x1afc15c4, 0xc6918f73, 0xda137118, 0x067eebaf, 0x660959c1, 0xba64c376,
+ 0x5f0ca517, 0x83613fa0, 0xe3168dce, 0x3f7b1779, 0x23f9e912, 0xff9473a5, 0x9fe3c1cb, 0x438e5b7c,
+ 0x51f210be, 0x8d9f8a09, 0xede83867, 0x3185a2d0, 0x2d075cbb, 0xf16ac60c, 0x911d7462, 0x4d70eed5,
+ 0xa81888b4, 0x74751203, 0x1402a06d, 0xc86f3ada, 0xd4edc4b1, 0x08805e06, 0x68f7ec68, 0xb49a76df,
+ 0x4c0f7bec, 0x9062e15b, 0xf0155335, 0x2c78c982, 0x30fa37e9, 0xec97ad5e, 0x8ce01f30, 0x508d8587,
+ 0xb5e5e3e6, 0x69887951, 0x09ffcb3f, 0xd5925188, 0xc910afe3, 0x157d3554, 0x750a873a, 0xa9671d8d,
+ 0xbb1b564f, 0x6776ccf8, 0x07017e96, 0xdb6ce421, 0xc7ee1a4a, 0x1b8380fd, 0x7bf43293, 0xa799a824,
+ 0x42f1ce45, 0x9e9c54f2, 0xfeebe69c, 0x22867c2b, 0x3e048240, 0xe26918f7, 0x821eaa99, 0x5e73302e,
+ 0x77f5ad48, 0xab9837ff, 0xcbef8591, 0x17821f26, 0x0b00e14d, 0xd76d7bfa, 0xb71ac994, 0x6b775323,
+ 0x8e1f3542, 0x5272aff5, 0x32051d9b, 0xee68872c, 0xf2ea7947, 0x2e87e3f0, 0x4ef0519e, 0x929dcb29,
+ 0x80e180eb, 0x5c8c1a5c, 0x3cfba832, 0xe0963285, 0xfc14ccee, 0x20795659, 0x400ee437, 0x9c637e80,
+ 0x790b18e1, 0xa5668256, 0xc5113038, 0x197caa8f, 0x05fe54e4, 0xd993ce53, 0xb9e47c3d, 0x6589e68a,
+ 0x9d1cebb9, 0x4171710e, 0x2106c360, 0xfd6b59d7, 0xe1e9a7bc, 0x3d843d0b, 0x5df38f65, 0x819e15d2,
+ 0x64f673b3, 0xb89be904, 0xd8ec5b6a, 0x0481c1dd, 0x18033fb6, 0xc46ea501, 0xa419176f, 0x78748dd8,
+ 0x6a08c61a, 0xb6655cad, 0xd612eec3, 0x0a7f7474, 0x16fd8a1f, 0xca9010a8, 0xaae7a2c6, 0x768a3871,
+ 0x93e25e10, 0x4f8fc4a7, 0x2ff876c9, 0xf395ec7e, 0xef171215, 0x337a88a2, 0x530d3acc, 0x8f60a07b,
+ 0x00000000, 0x490d678d, 0x921acf1a, 0xdb17a897, 0x20f48383, 0x69f9e40e, 0xb2ee4c99, 0xfbe32b14,
+ 0x41e90706, 0x08e4608b, 0xd3f3c81c, 0x9afeaf91, 0x611d8485, 0x2810e308, 0xf3074b9f, 0xba0a2c12,
+ 0x83d20e0c, 0xcadf6981, 0x11c8c116, 0x58c5a69b, 0xa3268d8f, 0xea2bea02, 0x313c4295, 0x78312518,
+ 0xc23b090a, 0x8b366e87, 0x5021c610, 0x192ca19d, 0xe2cf8a89, 0xabc2ed04, 0x70d54593, 0x39d8221e,
+ 0x036501af, 0x4a686622, 0x917fceb5, 0xd872a938, 0x2391822c, 0x6a9ce5a1, 0xb18b4d36, 0xf8862abb,
+ 0x428c06a9, 0x0b816124, 0xd096c9b3, 0x999bae3e, 0x6278852a, 0x2b75e2a7, 0xf0624a30, 0xb96f2dbd,
+ 0x80b70fa3, 0xc9ba682e, 0x12adc0b9, 0x5ba0a734, 0xa0438c20, 0xe94eebad, 0x3259433a, 0x7b5424b7,
+ 0xc15e08a5, 0x88536f28, 0x5344c7bf, 0x1a49a032, 0xe1aa8b26, 0xa8a7ecab, 0x73b0443c, 0x3abd23b1,
+ 0x06ca035e, 0x4fc764d3, 0x94d0cc44, 0xddddabc9, 0x263e80dd, 0x6f33e750, 0xb4244fc7, 0xfd29284a,
+ 0x47230458, 0x0e2e63d5, 0xd539cb42, 0x9c34accf, 0x67d787db, 0x2edae056, 0xf5cd48c1, 0xbcc02f4c,
+ 0x85180d52, 0xcc156adf, 0x1702c248, 0x5e0fa5c5, 0xa5ec8ed1, 0xece1e95c, 0x37f641cb, 0x7efb2646,
+ 0xc4f10a54, 0x8dfc6dd9, 0x56ebc54e, 0x1fe6a2c3, 0xe40589d7, 0xad08ee5a, 0x761f46cd, 0x3f122140,
+ 0x05af02f1, 0x4ca2657c, 0x97b5cdeb, 0xdeb8aa66, 0x255b8172, 0x6c56e6ff, 0xb7414e68, 0xfe4c29e5,
+ 0x444605f7, 0x0d4b627a, 0xd65ccaed, 0x9f51ad60, 0x64b28674, 0x2dbfe1f9, 0xf6a8496e, 0xbfa52ee3,
+ 0x867d0cfd, 0xcf706b70, 0x1467c3e7, 0x5d6aa46a, 0xa6898f7e, 0xef84e8f3, 0x34934064, 0x7d9e27e9,
+ 0xc7940bfb, 0x8e996c76, 0x558ec4e1, 0x1c83a36c, 0xe7608878, 0xae6deff5, 0x757a4762, 0x3c7720ef,
+ 0x0d9406bc, 0x44996131, 0x9f8ec9a6, 0xd683ae2b, 0x2d60853f, 0x646de2b2, 0xbf7a4a25, 0xf6772da8,
+ 0x4c7d01ba, 0x05706637, 0xde67cea0, 0x976aa92d, 0x6c898239, 0x2584e5b4, 0xfe934d23, 0xb79e2aae,
+ 0x8e4608b0, 0xc74b6f3d, 0x1c5cc7aa, 0x5551a027, 0xaeb28b33, 0xe7bfecbe, 0x3ca84429, 0x75a523a4,
+ 0xcfaf0fb6, 0x86a2683b, 0x5db5c0ac, 0x14b8a721, 0xef5b8c35, 0xa656ebb8, 0x7d41432f, 0x344c24a2,
+ 0x0ef10713, 0x47fc609e, 0x9cebc809, 0xd5e6af84, 0x2e058490, 0x6708e31d, 0xbc1f4b8a, 0xf5122c07,
+ 0x4f180015, 0x06156798, 0xdd02cf0f, 0x940fa882, 0x6fec8396, 0x26e1e41b, 0xfdf64c8c, 0xb4fb2b01,
+ 0x8d23091f, 0xc42e6e92, 0x1f39c605, 0x5634a188, 0xadd78a9c, 0xe4daed11, 0x3fcd4586, 0x76c0220b,
+ 0xccca0e19, 0x85c76994, 0x5ed0c103, 0x17dda68e, 0xec3e8d9a, 0xa533ea17, 0x7e244280, 0x3729250d,
+ 0x0b5e05e2, 0x4253626f, 0x9944caf8, 0xd049ad75, 0x2baa8661, 0x62a7e1ec, 0xb9b0497b, 0xf0bd2ef6,
+ 0x4ab702e4, 0x03ba6569, 0xd8adcdfe, 0x91a0aa73, 0x6a438167, 0x234ee6ea, 0xf8594e7d, 0xb15429f0,
+ 0x888c0bee, 0xc1816c63, 0x1a96c4f4, 0x539ba379, 0xa878886d, 0xe175efe0, 0x3a624777, 0x736f20fa,
+ 0xc9650ce8, 0x80686b65, 0x5b7fc3f2, 0x1272a47f, 0xe9918f6b, 0xa09ce8e6, 0x7b8b4071, 0x328627fc,
+ 0x083b044d, 0x413663c0, 0x9a21cb57, 0xd32cacda, 0x28cf87ce, 0x61c2e043, 0xbad548d4, 0xf3d82f59,
+ 0x49d2034b, 0x00df64c6, 0xdbc8cc51, 0x92c5abdc, 0x692680c8, 0x202be745, 0xfb3c4fd2, 0xb231285f,
+ 0x8be90a41, 0xc2e46dcc, 0x19f3c55b, 0x50fea2d6, 0xab1d89c2, 0xe210ee4f, 0x390746d8, 0x700a2155,
+ 0xca000d47, 0x830d6aca, 0x581ac25d, 0x1117a5d0, 0xeaf48ec4, 0xa3f9e949, 0x78ee41de, 0x31e32653,
+ 0x00000000, 0x1b280d78, 0x36501af0, 0x2d781788, 0x6ca035e0, 0x77883898, 0x5af02f10, 0x41d82268,
+ 0xd9406bc0, 0xc26866b8, 0xef107130, 0xf4387c48, 0xb5e05e20, 0xaec85358, 0x83b044d0, 0x989849a8,
+ 0xb641ca37, 0xad69c74f, 0x8011d0c7, 0x9b39ddbf, 0xdae1ffd7, 0xc1c9f2af, 0xecb1e527, 0xf799e85f,
+ 0x6f01a1f7, 0x7429ac8f, 0x5951bb07, 0x4279b67f, 0x03a19417, 0x1889996f, 0x35f18ee7, 0x2ed9839f,
+ 0x684289d9, 0x736a84a1, 0x5e129329, 0x453a9e51, 0x04e2bc39, 0x1fcab141, 0x32b2a6c9, 0x299aabb1,
+ 0xb102e219, 0xaa2aef61, 0x8752f8e9, 0x9c7af591, 0xdda2d7f9, 0xc68ada81, 0xebf2cd09, 0xf0dac071,
+ 0xde0343ee, 0xc52b4e96, 0xe853591e, 0xf37b5466, 0xb2a3760e, 0xa98b7b76, 0x84f36cfe, 0x9fdb6186,
+ 0x0743282e, 0x1c6b2556, 0x311332de, 0x2a3b3fa6, 0x6be31dce, 0x70cb10b6, 0x5db3073e, 0x469b0a46,
+ 0xd08513b2, 0xcbad1eca, 0xe6d50942, 0xfdfd043a, 0xbc252652, 0xa70d2b2a, 0x8a753ca2, 0x915d31da,
+ 0x09c57872, 0x12ed750a, 0x3f956282, 0x24bd6ffa, 0x65654d92, 0x7e4d40ea, 0x53355762, 0x481d5a1a,
+ 0x66c4d985, 0x7decd4fd, 0x5094c375, 0x4bbcce0d, 0x0a64ec65, 0x114ce11d, 0x3c34f695, 0x271cfbed,
+ 0xbf84b245, 0xa4acbf3d, 0x89d4a8b5, 0x92fca5cd, 0xd32487a5, 0xc80c8add, 0xe5749d55, 0xfe5c902d,
+ 0xb8c79a6b, 0xa3ef9713, 0x8e97809b, 0x95bf8de3, 0xd467af8b, 0xcf4fa2f3, 0xe237b57b, 0xf91fb803,
+ 0x6187f1ab, 0x7aaffcd3, 0x57d7eb5b, 0x4cffe623, 0x0d27c44b, 0x160fc933, 0x3b77debb, 0x205fd3c3,
+ 0x0e86505c, 0x15ae5d24, 0x38d64aac, 0x23fe47d4, 0x622665bc, 0x790e68c4, 0x54767f4c, 0x4f5e7234,
+ 0xd7c63b9c, 0xccee36e4, 0xe196216c, 0xfabe2c14, 0xbb660e7c, 0xa04e0304, 0x8d36148c, 0x961e19f4,
+ 0xa5cb3ad3, 0xbee337ab, 0x939b2023, 0x88b32d5b, 0xc96b0f33, 0xd243024b, 0xff3b15c3, 0xe41318bb,
+ 0x7c8b5113, 0x67a35c6b, 0x4adb4be3, 0x51f3469b, 0x102b64f3, 0x0b03698b, 0x267b7e03, 0x3d53737b,
+ 0x138af0e4, 0x08a2fd9c, 0x25daea14, 0x3ef2e76c, 0x7f2ac504, 0x6402c87c, 0x497adff4, 0x5252d28c,
+ 0xcaca9b24, 0xd1e2965c, 0xfc9a81d4, 0xe7b28cac, 0xa66aaec4, 0xbd42a3bc, 0x903ab434, 0x8b12b94c,
+ 0xcd89b30a, 0xd6a1be72, 0xfbd9a9fa, 0xe0f1a482, 0xa12986ea, 0xba018b92, 0x97799c1a, 0x8c519162,
+ 0x14c9d8ca, 0x0fe1d5b2, 0x2299c23a, 0x39b1cf42, 0x7869ed2a, 0x6341e052, 0x4e39f7da, 0x5511faa2,
+ 0x7bc8793d, 0x60e07445, 0x4d9863cd, 0x56b06eb5, 0x17684cdd, 0x0c4041a5, 0x2138562d, 0x3a105b55,
+ 0xa28812fd, 0xb9a01f85, 0x94d8080d, 0x8ff00575, 0xce28271d, 0xd5002a65, 0xf8783ded, 0xe3503095,
+ 0x754e2961, 0x6e662419, 0x431e3391, 0x58363ee9, 0x19ee1c81, 0x02c611f9, 0x2fbe0671, 0x34960b09,
+ 0xac0e42a1, 0xb7264fd9, 0x9a5e5851, 0x81765529, 0xc0ae7741, 0xdb867a39, 0xf6fe6db1, 0xedd660c9,
+ 0xc30fe356, 0xd827ee2e, 0xf55ff9a6, 0xee77f4de, 0xafafd6b6, 0xb487dbce, 0x99ffcc46, 0x82d7c13e,
+ 0x1a4f8896, 0x016785ee, 0x2c1f9266, 0x37379f1e, 0x76efbd76, 0x6dc7b00e, 0x40bfa786, 0x5b97aafe,
+ 0x1d0ca0b8, 0x0624adc0, 0x2b5cba48, 0x3074b730, 0x71ac9558, 0x6a849820, 0x47fc8fa8, 0x5cd482d0,
+ 0xc44ccb78, 0xdf64c600, 0xf21cd188, 0xe934dcf0, 0xa8ecfe98, 0xb3c4f3e0, 0x9ebce468, 0x8594e910,
+ 0xab4d6a8f, 0xb06567f7, 0x9d1d707f, 0x86357d07, 0xc7ed5f6f, 0xdcc55217, 0xf1bd459f, 0xea9548e7,
+ 0x720d014f, 0x69250c37, 0x445d1bbf, 0x5f7516c7, 0x1ead34af, 0x058539d7, 0x28fd2e5f, 0x33d52327,
+ 0x00000000, 0x4f576811, 0x9eaed022, 0xd1f9b833, 0x399cbdf3, 0x76cbd5e2, 0xa7326dd1, 0xe86505c0,
+ 0x73397be6, 0x3c6e13f7, 0xed97abc4, 0xa2c0c3d5, 0x4aa5c615, 0x05f2ae04, 0xd40b1637, 0x9b5c7e26,
+ 0xe672f7cc, 0xa9259fdd, 0x78dc27ee, 0x378b4fff, 0xdfee4a3f, 0x90b9222e, 0x41409a1d, 0x0e17f20c,
+ 0x954b8c2a, 0xda1ce43b, 0x0be55c08, 0x44b23419, 0xacd731d9, 0xe38059c8, 0x3279e1fb, 0x7d2e89ea,
+ 0xc824f22f, 0x87739a3e, 0x568a220d, 0x19dd4a1c, 0xf1b84fdc, 0xbeef27cd, 0x6f169ffe, 0x2041f7ef,
+ 0xbb1d89c9, 0xf44ae1d8, 0x25b359eb, 0x6ae431fa, 0x8281343a, 0xcdd65c2b, 0x1c2fe418, 0x53788c09,
+ 0x2e5605e3, 0x61016df2, 0xb0f8d5c1, 0xffafbdd0, 0x17cab810, 0x589dd001, 0x89646832, 0xc6330023,
+ 0x5d6f7e05, 0x12381614, 0xc3c1ae27, 0x8c96c636, 0x64f3c3f6, 0x2ba4abe7, 0xfa5d13d4, 0xb50a7bc5,
+ 0x9488f9e9, 0xdbdf91f8, 0x0a2629cb, 0x457141da, 0xad14441a, 0xe2432c0b, 0x33ba9438, 0x7cedfc29,
+ 0xe7b1820f, 0xa8e6ea1e, 0x791f522d, 0x36483a3c, 0xde2d3ffc, 0x917a57ed, 0x4083efde, 0x0fd487cf,
+ 0x72fa0e25, 0x3dad6634, 0xec54de07, 0xa303b616, 0x4b66b3d6, 0x0431dbc7, 0xd5c863f4, 0x9a9f0be5,
+ 0x01c375c3, 0x4e941dd2, 0x9f6da5e1, 0xd03acdf0, 0x385fc830, 0x7708a021, 0xa6f11812, 0xe9a67003,
+ 0x5cac0bc6, 0x13fb63d7, 0xc202dbe4, 0x8d55b3f5, 0x6530b635, 0x2a67de24, 0xfb9e6617, 0xb4c90e06,
+ 0x2f957020, 0x60c21831, 0xb13ba002, 0xfe6cc813, 0x1609cdd3, 0x595ea5c2, 0x88a71df1, 0xc7f075e0,
+ 0xbadefc0a, 0xf589941b, 0x24702c28, 0x6b274439, 0x834241f9, 0xcc1529e8, 0x1dec91db, 0x52bbf9ca,
+ 0xc9e787ec, 0x86b0effd, 0x574957ce, 0x181e3fdf, 0xf07b3a1f, 0xbf2c520e, 0x6ed5ea3d, 0x2182822c,
+ 0x2dd0ee65, 0x62878674, 0xb37e3e47, 0xfc295656, 0x144c5396, 0x5b1b3b87, 0x8ae283b4, 0xc5b5eba5,
+ 0x5ee99583, 0x11befd92, 0xc04745a1, 0x8f102db0, 0x67752870, 0x28224061, 0xf9dbf852, 0xb68c9043,
+ 0xcba219a9, 0x84f571b8, 0x550cc98b, 0x1a5ba19a, 0xf23ea45a, 0xbd69cc4b, 0x6c907478, 0x23c71c69,
+ 0xb89b624f, 0xf7cc0a5e, 0x2635b26d, 0x6962da7c, 0x8107dfbc, 0xce50b7ad, 0x1fa90f9e, 0x50fe678f,
+ 0xe5f41c4a, 0xaaa3745b, 0x7b5acc68, 0x340da479, 0xdc68a1b9, 0x933fc9a8, 0x42c6719b, 0x0d91198a,
+ 0x96cd67ac, 0xd99a0fbd, 0x0863b78e, 0x4734df9f, 0xaf51da5f, 0xe006b24e, 0x31ff0a7d, 0x7ea8626c,
+ 0x0386eb86, 0x4cd18397, 0x9d283ba4, 0xd27f53b5, 0x3a1a5675, 0x754d3e64, 0xa4b48657, 0xebe3ee46,
+ 0x70bf9060, 0x3fe8f871, 0xee114042, 0xa1462853, 0x49232d93, 0x06744582, 0xd78dfdb1, 0x98da95a0,
+ 0xb958178c, 0xf60f7f9d, 0x27f6c7ae, 0x68a1afbf, 0x80c4aa7f, 0xcf93c26e, 0x1e6a7a5d, 0x513d124c,
+ 0xca616c6a, 0x8536047b, 0x54cfbc48, 0x1b98d459, 0xf3fdd199, 0xbcaab988, 0x6d5301bb, 0x220469aa,
+ 0x5f2ae040, 0x107d8851, 0xc1843062, 0x8ed35873, 0x66b65db3, 0x29e135a2, 0xf8188d91, 0xb74fe580,
+ 0x2c139ba6, 0x6344f3b7, 0xb2bd4b84, 0xfdea2395, 0x158f2655, 0x5ad84e44, 0x8b21f677, 0xc4769e66,
+ 0x717ce5a3, 0x3e2b8db2, 0xefd23581, 0xa0855d90, 0x48e05850, 0x07b73041, 0xd64e8872, 0x9919e063,
+ 0x02459e45, 0x4d12f654, 0x9ceb4e67, 0xd3bc2676, 0x3bd923b6, 0x748e4ba7, 0xa577f394, 0xea209b85,
+ 0x970e126f, 0xd8597a7e, 0x09a0c24d, 0x46f7aa5c, 0xae92af9c, 0xe1c5c78d, 0x303c7fbe, 0x7f6b17af,
+ 0xe4376989, 0xab600198, 0x7a99b9ab, 0x35ced1ba, 0xddabd47a, 0x92fcbc6b, 0x43050458, 0x0c526c49,
+ 0x00000000, 0x5ba1dcca, 0xb743b994, 0xece2655e, 0x6a466e9f, 0x31e7b255, 0xdd05d70b, 0x86a40bc1,
+ 0xd48cdd3e, 0x8f2d01f4, 0x63cf64aa, 0x386eb860, 0xbecab3a1, 0xe56b6f6b, 0x09890a35, 0x5228d6ff,
+ 0xadd8a7cb, 0xf6797b01, 0x1a9b1e5f, 0x413ac295, 0xc79ec954, 0x9c3f159e, 0x70dd70c0, 0x2b7cac0a,
+ 0x79547af5, 0x22f5a63f, 0xce17c361, 0x95b61fab, 0x1312146a, 0x48b3c8a0, 0xa451adfe, 0xfff07134,
+ 0x5f705221, 0x04d18eeb, 0xe833ebb5, 0xb392377f, 0x35363cbe, 0x6e97e074, 0x8275852a, 0xd9d459e0,
+ 0x8bfc8f1f, 0xd05d53d5, 0x3cbf368b, 0x671eea41, 0xe1bae180, 0xba1b3d4a, 0x56f95814, 0x0d5884de,
+ 0xf2a8f5ea, 0xa9092920, 0x45eb4c7e, 0x1e4a90b4, 0x98ee9b75, 0xc34f47bf, 0x2fad22e1, 0x740cfe2b,
+ 0x262428d4, 0x7d85f41e, 0x91679140, 0xcac64d8a, 0x4c62464b, 0x17c39a81, 0xfb21ffdf, 0xa0802315,
+ 0xbee0a442, 0xe5417888, 0x09a31dd6, 0x5202c11c, 0xd4a6cadd, 0x8f071617, 0x63e57349, 0x3844af83,
+ 0x6a6c797c, 0x31cda5b6, 0xdd2fc0e8, 0x868e1c22, 0x002a17e3, 0x5b8bcb29, 0xb769ae77, 0xecc872bd,
+ 0x13380389, 0x4899df43, 0xa47bba1d, 0xffda66d7, 0x797e6d16, 0x22dfb1dc, 0xce3dd482, 0x959c0848,
+ 0xc7b4deb7, 0x9c15027d, 0x70f76723, 0x2b56bbe9, 0xadf2b028, 0xf6536ce2, 0x1ab109bc, 0x4110d576,
+ 0xe190f663, 0xba312aa9, 0x56d34ff7, 0x0d72933d, 0x8bd698fc, 0xd0774436, 0x3c952168, 0x6734fda2,
+ 0x351c2b5d, 0x6ebdf797, 0x825f92c9, 0xd9fe4e03, 0x5f5a45c2, 0x04fb9908, 0xe819fc56, 0xb3b8209c,
+ 0x4c4851a8, 0x17e98d62, 0xfb0be83c, 0xa0aa34f6, 0x260e3f37, 0x7dafe3fd, 0x914d86a3, 0xcaec5a69,
+ 0x98c48c96, 0xc365505c, 0x2f873502, 0x7426e9c8, 0xf282e209, 0xa9233ec3, 0x45c15b9d, 0x1e608757,
+ 0x79005533, 0x22a189f9, 0xce43eca7, 0x95e2306d, 0x13463bac, 0x48e7e766, 0xa4058238, 0xffa45ef2,
+ 0xad8c880d, 0xf62d54c7, 0x1acf3199, 0x416eed53, 0xc7cae692, 0x9c6b3a58, 0x70895f06, 0x2b2883cc,
+ 0xd4d8f2f8, 0x8f792e32, 0x639b4b6c, 0x383a97a6, 0xbe9e9c67, 0xe53f40ad, 0x09dd25f3, 0x527cf939,
+ 0x00542fc6, 0x5bf5f30c, 0xb7179652, 0xecb64a98, 0x6a124159, 0x31b39d93, 0xdd51f8cd, 0x86f02407,
+ 0x26700712, 0x7dd1dbd8, 0x9133be86, 0xca92624c, 0x4c36698d, 0x1797b547, 0xfb75d019, 0xa0d40cd3,
+ 0xf2fcda2c, 0xa95d06e6, 0x45bf63b8, 0x1e1ebf72, 0x98bab4b3, 0xc31b6879, 0x2ff90d27, 0x7458d1ed,
+ 0x8ba8a0d9, 0xd0097c13, 0x3ceb194d, 0x674ac587, 0xe1eece46, 0xba4f128c, 0x56ad77d2, 0x0d0cab18,
+ 0x5f247de7, 0x0485a12d, 0xe867c473, 0xb3c618b9, 0x35621378, 0x6ec3cfb2, 0x8221aaec, 0xd9807626,
+ 0xc7e0f171, 0x9c412dbb, 0x70a348e5, 0x2b02942f, 0xada69fee, 0xf6074324, 0x1ae5267a, 0x4144fab0,
+ 0x136c2c4f, 0x48cdf085, 0xa42f95db, 0xff8e4911, 0x792a42d0, 0x228b9e1a, 0xce69fb44, 0x95c8278e,
+ 0x6a3856ba, 0x31998a70, 0xdd7bef2e, 0x86da33e4, 0x007e3825, 0x5bdfe4ef, 0xb73d81b1, 0xec9c5d7b,
+ 0xbeb48b84, 0xe515574e, 0x09f73210, 0x5256eeda, 0xd4f2e51b, 0x8f5339d1, 0x63b15c8f, 0x38108045,
+ 0x9890a350, 0xc3317f9a, 0x2fd31ac4, 0x7472c60e, 0xf2d6cdcf, 0xa9771105, 0x4595745b, 0x1e34a891,
+ 0x4c1c7e6e, 0x17bda2a4, 0xfb5fc7fa, 0xa0fe1b30, 0x265a10f1, 0x7dfbcc3b, 0x9119a965, 0xcab875af,
+ 0x3548049b, 0x6ee9d851, 0x820bbd0f, 0xd9aa61c5, 0x5f0e6a04, 0x04afb6ce, 0xe84dd390, 0xb3ec0f5a,
+ 0xe1c4d9a5, 0xba65056f, 0x56876031, 0x0d26bcfb, 0x8b82b73a, 0xd0236bf0, 0x3cc10eae, 0x6760d264,
+};
+
+const uint32_t crc32_04c11db7_reflected_crc_table[CRC_SLICES * 256] = {
+ 0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+ 0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+ 0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+ 0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+ 0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+ 0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+ 0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+ 0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+ 0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+ 0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
+ 0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+ 0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+ 0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+ 0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+ 0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+ 0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+ 0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
+ 0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+ 0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+ 0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+ 0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+ 0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+ 0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+ 0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+ 0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
+ 0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
+ 0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+ 0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+ 0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+ 0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+ 0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+ 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
+ 0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445, 0x565aa786, 0x4f4196c7,
+ 0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb, 0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf,
+ 0x4ac21251, 0x53d92310, 0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496,
+ 0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c, 0xd4413fdf, 0xcd5a0e9e,
+ 0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761, 0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265,
+ 0x5d5daeaa, 0x44469feb, 0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d,
+ 0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6, 0x891c9175, 0x9007a034,
+ 0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38, 0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c,
+ 0xf0794f05, 0xe9627e44, 0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+ 0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148, 0x6efa628b, 0x77e153ca,
+ 0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97, 0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93,
+ 0x7262d75c, 0x6b79e61d, 0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b,
+ 0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2, 0x33a7cc21, 0x2abcfd60,
+ 0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c, 0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768,
+ 0x2f3f79f6, 0x362448b7, 0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+ 0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb, 0xb1bc5478, 0xa8a76539,
+ 0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88, 0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c,
+ 0xf35a1243, 0xea412302, 0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+ 0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f, 0x271b2d9c, 0x3e001cdd,
+ 0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1, 0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5,
+ 0xae07bce9, 0xb71c8da8, 0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+ 0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4, 0x30849167, 0x299fa026,
+ 0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b, 0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f,
+ 0x2c1c24b0, 0x350715f1, 0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+ 0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b, 0x9da070c8, 0x84bb4189,
+ 0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85, 0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81,
+ 0x8138c51f, 0x9823f45e, 0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+ 0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52, 0x1fbbe891, 0x06a0d9d0,
+ 0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f, 0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b,
+ 0x96a779e4, 0x8fbc48a5, 0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+ 0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8, 0x42e6463b, 0x5bfd777a,
+ 0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876, 0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72,
+ 0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb, 0x048d7cb2, 0x054f1685,
+ 0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1, 0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d,
+ 0x1c26a370, 0x1de4c947, 0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+ 0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023, 0x16b88e7a, 0x177ae44d,
+ 0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9, 0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065,
+ 0x365e1758, 0x379c7d6f, 0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+ 0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b, 0x20e69922, 0x2124f315,
+ 0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71, 0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad,
+ 0x709a8dc0, 0x7158e7f7, 0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+ 0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93, 0x7a04a0ca, 0x7bc6cafd,
+ 0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9, 0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835,
+ 0x62af7f08, 0x636d153f, 0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+ 0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb, 0x4c5ab792, 0x4d98dda5,
+ 0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1, 0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d,
+ 0x54f16850, 0x55330267, 0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+ 0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03, 0x5e6f455a, 0x5fad2f6d,
+ 0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9, 0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05,
+ 0xef264a38, 0xeee4200f, 0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+ 0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b, 0xf99ec442, 0xf85cae75,
+ 0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711, 0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd,
+ 0xd9785d60, 0xd8ba3757, 0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+ 0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33, 0xd3e6706a, 0xd2241a5d,
+ 0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049, 0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895,
+ 0xcb4dafa8, 0xca8fc59f, 0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+ 0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab, 0x9522eaf2, 0x94e080c5,
+ 0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1, 0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d,
+ 0x8d893530, 0x8c4b5f07, 0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+ 0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663, 0x8717183a, 0x86d5720d,
+ 0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9, 0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625,
+ 0xa7f18118, 0xa633eb2f, 0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+ 0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b, 0xb1490f62, 0xb08b6555,
+ 0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31, 0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed,
+ 0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032, 0x256b5fdc, 0x9dd738b9,
+ 0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701, 0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056,
+ 0x5019579f, 0xe8a530fa, 0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+ 0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42, 0xb0c620ac, 0x087a47c9,
+ 0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0, 0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787,
+ 0x658687d1, 0xdd3ae0b4, 0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+ 0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893, 0xd540a77d, 0x6dfcc018,
+ 0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0, 0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7,
+ 0x9b14583d, 0x23a83f58, 0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084,
+ 0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0, 0x7bcb2f0e, 0xc377486b,
+ 0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c, 0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b,
+ 0x0eb9274d, 0xb6054028, 0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+ 0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731, 0x1e4da8df, 0xa6f1cfba,
+ 0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002, 0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755,
+ 0x6b3fa09c, 0xd383c7f9, 0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+ 0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841, 0x8be0d7af, 0x335cb0ca,
+ 0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5, 0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82,
+ 0x28ed9ed4, 0x9051f9b1, 0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d,
+ 0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196, 0x982bbe78, 0x2097d91d,
+ 0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5, 0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2,
+ 0x4d6b1905, 0xf5d77e60, 0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+ 0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8, 0xadb46e36, 0x15080953,
+ 0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174, 0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623,
+ 0xd8c66675, 0x607a0110, 0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+ 0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34, 0x5326b1da, 0xeb9ad6bf,
+ 0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907, 0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50,
+ 0x2654b999, 0x9ee8defc, 0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120,
+ 0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144, 0xc68bceaa, 0x7e37a9cf,
+ 0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6, 0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981,
+ 0x13cb69d7, 0xab770eb2, 0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+ 0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695, 0xa30d497b, 0x1bb12e1e,
+ 0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6, 0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1,
+ 0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70, 0x8f40f5a0, 0xb220dc10,
+ 0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111, 0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1,
+ 0x60e09782, 0x5d80be32, 0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+ 0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333, 0xdfd029e3, 0xe2b00053,
+ 0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4, 0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314,
+ 0xf1b164c5, 0xccd14d75, 0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+ 0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6, 0x2e614d26, 0x13016496,
+ 0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997, 0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57,
+ 0x58f35849, 0x659371f9, 0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+ 0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8, 0xe7c3e628, 0xdaa3cf98,
+ 0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b, 0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db,
+ 0x0863840a, 0x3503adba, 0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+ 0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d, 0x167282ed, 0x2b12ab5d,
+ 0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c, 0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c,
+ 0xf9d2e0cf, 0xc4b2c97f, 0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+ 0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e, 0x46e25eae, 0x7b82771e,
+ 0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42, 0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82,
+ 0x8196fb53, 0xbcf6d2e3, 0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743,
+ 0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860, 0x5e46d2b0, 0x6326fb00,
+ 0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601, 0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1,
+ 0x70279f96, 0x4d47b626, 0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+ 0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27, 0xcf1721f7, 0xf2770847,
+ 0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4, 0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404,
+ 0x20b743d5, 0x1dd76a65, 0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+ 0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab, 0x66551d7b, 0x5b3534cb,
+ 0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca, 0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a,
+ 0x89f57f59, 0xb49556e9, 0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349,
+ 0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8, 0x36c5c138, 0x0ba5e888,
+ 0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f, 0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf,
+ 0x18a48c1e, 0x25c4a5ae, 0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+ 0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d, 0xc774a5fd, 0xfa148c4d,
+ 0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c, 0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c,
+ 0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3, 0xd659e31d, 0x1d0530b8,
+ 0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3, 0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5,
+ 0x03d6029b, 0xc88ad13e, 0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+ 0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145, 0x39dc63eb, 0xf280b04e,
+ 0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798, 0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e,
+ 0xebff875b, 0x20a354fe, 0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+ 0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e, 0xd223e4b0, 0x197f3715,
+ 0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e, 0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578,
+ 0x0f580a6c, 0xc404d9c9, 0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+ 0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2, 0x35526b1c, 0xfe0eb8b9,
+ 0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59, 0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f,
+ 0xe0dd8a9a, 0x2b81593f, 0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+ 0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9, 0xdeadec47, 0x15f13fe2,
+ 0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99, 0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f,
+ 0x0b220dc1, 0xc07ede64, 0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+ 0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f, 0x31286cb1, 0xfa74bf14,
+ 0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676, 0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460,
+ 0xf2e396b5, 0x39bf4510, 0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+ 0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0, 0xcb3ff55e, 0x006326fb,
+ 0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680, 0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496,
+ 0x191c11ee, 0xd240c24b, 0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156,
+ 0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230, 0x2316709e, 0xe84aa33b,
+ 0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db, 0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd,
+ 0xf6999118, 0x3dc542bd, 0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+ 0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07, 0xc7b1fda9, 0x0ced2e0c,
+ 0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77, 0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61,
+ 0x123e1c2f, 0xd962cf8a, 0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97,
+ 0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1, 0x28347d5f, 0xe368aefa,
+ 0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c, 0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a,
+ 0xfa1799ef, 0x314b4a4a, 0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+ 0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa, 0xc3cbfa04, 0x089729a1,
+ 0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da, 0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc,
+ 0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7, 0x63d0353a, 0xc5a73e8e,
+ 0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa, 0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9,
+ 0x67de9cce, 0xc1a9977a, 0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240,
+ 0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e, 0x37e1e793, 0x9196ec27,
+ 0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301, 0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712,
+ 0xfc5277fb, 0x5a257c4f, 0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+ 0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5, 0xcbb39068, 0x6dc49bdc,
+ 0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8, 0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb,
+ 0x440b7579, 0xe27c7ecd, 0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+ 0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9, 0x14340e24, 0xb2430590,
+ 0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a, 0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739,
+ 0x103aa7d0, 0xb64dac64, 0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+ 0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342, 0xe86679df, 0x4e11726b,
+ 0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f, 0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c,
+ 0xec68d02b, 0x4a1fdb9f, 0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+ 0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb, 0xbc57ab76, 0x1a20a0c2,
+ 0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f, 0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c,
+ 0xbbf9a495, 0x1d8eaf21, 0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+ 0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b, 0x8c184306, 0x2a6f48b2,
+ 0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6, 0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5,
+ 0x47abd36e, 0xe1dcd8da, 0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+ 0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae, 0x1794a833, 0xb1e3a387,
+ 0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d, 0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e,
+ 0x139a01c7, 0xb5ed0a73, 0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+ 0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c, 0xafcdaab1, 0x09baa105,
+ 0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71, 0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62,
+ 0xabc30345, 0x0db408f1, 0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+ 0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285, 0xfbfc7818, 0x5d8b73ac,
+ 0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a, 0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899,
+ 0x304fe870, 0x9638e3c4, 0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+ 0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e, 0x07ae0fe3, 0xa1d90457,
+ 0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23, 0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30,
+ 0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64, 0xc66f0987, 0x0ac50919,
+ 0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56, 0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac,
+ 0x7cbb312b, 0xb01131b5, 0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+ 0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa, 0x69312319, 0xa59b2387,
+ 0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5, 0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f,
+ 0x2a9379e3, 0xe639797d, 0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+ 0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19, 0x43a25afa, 0x8f085a64,
+ 0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b, 0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1,
+ 0x299dc2ed, 0xe537c273, 0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+ 0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c, 0x3c17d0df, 0xf0bdd041,
+ 0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425, 0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf,
+ 0x86c3e873, 0x4a69e8ed, 0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+ 0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf, 0x1684a93c, 0xda2ea9a2,
+ 0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced, 0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217,
+ 0xac509190, 0x60fa910e, 0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+ 0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441, 0xb9da83a2, 0x7570833c,
+ 0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239, 0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3,
+ 0x80de9e6f, 0x4c749ef1, 0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+ 0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95, 0xe9efbd76, 0x2545bde8,
+ 0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7, 0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d,
+ 0xaa4de78c, 0x66e7e712, 0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+ 0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d, 0xbfc7f5be, 0x736df520,
+ 0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144, 0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe,
+ 0x0513cd12, 0xc9b9cd8c, 0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b,
+ 0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953, 0xbcc94eb0, 0x70634e2e,
+ 0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61, 0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b,
+ 0x061d761c, 0xcab77682, 0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05,
+ 0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd, 0x1397642e, 0xdf3d64b0,
+ 0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282, 0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78,
+ 0x50353ed4, 0x9c9f3e4a, 0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+ 0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e, 0x39041dcd, 0xf5ae1d53,
+ 0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c, 0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6,
+};
+
+const uint32_t crc32_1edc6f41_reflected_crc_table[CRC_SLICES * 256] = {
+ 0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c, 0x26a1e7e8, 0xd4ca64eb,
+ 0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24,
+ 0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+ 0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc, 0xbc267848, 0x4e4dfb4b,
+ 0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+ 0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+ 0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59, 0xe4292d5a,
+ 0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a, 0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595,
+ 0x417b1dbc, 0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+ 0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+ 0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38,
+ 0xdbfc821c, 0x2997011f, 0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+ 0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789,
+ 0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46,
+ 0x7198540d, 0x83f3d70e, 0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+ 0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de, 0xdde0eb2a, 0x2f8b6829,
+ 0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93,
+ 0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+ 0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b, 0xb4091bff, 0x466298fc,
+ 0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+ 0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+ 0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81, 0xfc588982,
+ 0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d, 0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622,
+ 0x38cc2a06, 0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+ 0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+ 0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0,
+ 0xd3d3e1ab, 0x21b862a8, 0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+ 0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f,
+ 0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1,
+ 0x69e9f0d5, 0x9b8273d6, 0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+ 0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69, 0xd5cf889d, 0x27a40b9e,
+ 0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+ 0x00000000, 0x13a29877, 0x274530ee, 0x34e7a899, 0x4e8a61dc, 0x5d28f9ab, 0x69cf5132, 0x7a6dc945,
+ 0x9d14c3b8, 0x8eb65bcf, 0xba51f356, 0xa9f36b21, 0xd39ea264, 0xc03c3a13, 0xf4db928a, 0xe7790afd,
+ 0x3fc5f181, 0x2c6769f6, 0x1880c16f, 0x0b225918, 0x714f905d, 0x62ed082a, 0x560aa0b3, 0x45a838c4,
+ 0xa2d13239, 0xb173aa4e, 0x859402d7, 0x96369aa0, 0xec5b53e5, 0xfff9cb92, 0xcb1e630b, 0xd8bcfb7c,
+ 0x7f8be302, 0x6c297b75, 0x58ced3ec, 0x4b6c4b9b, 0x310182de, 0x22a31aa9, 0x1644b230, 0x05e62a47,
+ 0xe29f20ba, 0xf13db8cd, 0xc5da1054, 0xd6788823, 0xac154166, 0xbfb7d911, 0x8b507188, 0x98f2e9ff,
+ 0x404e1283, 0x53ec8af4, 0x670b226d, 0x74a9ba1a, 0x0ec4735f, 0x1d66eb28, 0x298143b1, 0x3a23dbc6,
+ 0xdd5ad13b, 0xcef8494c, 0xfa1fe1d5, 0xe9bd79a2, 0x93d0b0e7, 0x80722890, 0xb4958009, 0xa737187e,
+ 0xff17c604, 0xecb55e73, 0xd852f6ea, 0xcbf06e9d, 0xb19da7d8, 0xa23f3faf, 0x96d89736, 0x857a0f41,
+ 0x620305bc, 0x71a19dcb, 0x45463552, 0x56e4ad25, 0x2c896460, 0x3f2bfc17, 0x0bcc548e, 0x186eccf9,
+ 0xc0d23785, 0xd370aff2, 0xe797076b, 0xf4359f1c, 0x8e585659, 0x9dface2e, 0xa91d66b7, 0xbabffec0,
+ 0x5dc6f43d, 0x4e646c4a, 0x7a83c4d3, 0x69215ca4, 0x134c95e1, 0x00ee0d96, 0x3409a50f, 0x27ab3d78,
+ 0x809c2506, 0x933ebd71, 0xa7d915e8, 0xb47b8d9f, 0xce1644da, 0xddb4dcad, 0xe9537434, 0xfaf1ec43,
+ 0x1d88e6be, 0x0e2a7ec9, 0x3acdd650, 0x296f4e27, 0x53028762, 0x40a01f15, 0x7447b78c, 0x67e52ffb,
+ 0xbf59d487, 0xacfb4cf0, 0x981ce469, 0x8bbe7c1e, 0xf1d3b55b, 0xe2712d2c, 0xd69685b5, 0xc5341dc2,
+ 0x224d173f, 0x31ef8f48, 0x050827d1, 0x16aabfa6, 0x6cc776e3, 0x7f65ee94, 0x4b82460d, 0x5820de7a,
+ 0xfbc3faf9, 0xe861628e, 0xdc86ca17, 0xcf245260, 0xb5499b25, 0xa6eb0352, 0x920cabcb, 0x81ae33bc,
+ 0x66d73941, 0x7575a136, 0x419209af, 0x523091d8, 0x285d589d, 0x3bffc0ea, 0x0f186873, 0x1cbaf004,
+ 0xc4060b78, 0xd7a4930f, 0xe3433b96, 0xf0e1a3e1, 0x8a8c6aa4, 0x992ef2d3, 0xadc95a4a, 0xbe6bc23d,
+ 0x5912c8c0, 0x4ab050b7, 0x7e57f82e, 0x6df56059, 0x1798a91c, 0x043a316b, 0x30dd99f2, 0x237f0185,
+ 0x844819fb, 0x97ea818c, 0xa30d2915, 0xb0afb162, 0xcac27827, 0xd960e050, 0xed8748c9, 0xfe25d0be,
+ 0x195cda43, 0x0afe4234, 0x3e19eaad, 0x2dbb72da, 0x57d6bb9f, 0x447423e8, 0x70938b71, 0x63311306,
+ 0xbb8de87a, 0xa82f700d, 0x9cc8d894, 0x8f6a40e3, 0xf50789a6, 0xe6a511d1, 0xd242b948, 0xc1e0213f,
+ 0x26992bc2, 0x353bb3b5, 0x01dc1b2c, 0x127e835b, 0x68134a1e, 0x7bb1d269, 0x4f567af0, 0x5cf4e287,
+ 0x04d43cfd, 0x1776a48a, 0x23910c13, 0x30339464, 0x4a5e5d21, 0x59fcc556, 0x6d1b6dcf, 0x7eb9f5b8,
+ 0x99c0ff45, 0x8a626732, 0xbe85cfab, 0xad2757dc, 0xd74a9e99, 0xc4e806ee, 0xf00fae77, 0xe3ad3600,
+ 0x3b11cd7c, 0x28b3550b, 0x1c54fd92, 0x0ff665e5, 0x759baca0, 0x663934d7, 0x52de9c4e, 0x417c0439,
+ 0xa6050ec4, 0xb5a796b3, 0x81403e2a, 0x92e2a65d, 0xe88f6f18, 0xfb2df76f, 0xcfca5ff6, 0xdc68c781,
+ 0x7b5fdfff, 0x68fd4788, 0x5c1aef11, 0x4fb87766, 0x35d5be23, 0x26772654, 0x12908ecd, 0x013216ba,
+ 0xe64b1c47, 0xf5e98430, 0xc10e2ca9, 0xd2acb4de, 0xa8c17d9b, 0xbb63e5ec, 0x8f844d75, 0x9c26d502,
+ 0x449a2e7e, 0x5738b609, 0x63df1e90, 0x707d86e7, 0x0a104fa2, 0x19b2d7d5, 0x2d557f4c, 0x3ef7e73b,
+ 0xd98eedc6, 0xca2c75b1, 0xfecbdd28, 0xed69455f, 0x97048c1a, 0x84a6146d, 0xb041bcf4, 0xa3e32483,
+ 0x00000000, 0xa541927e, 0x4f6f520d, 0xea2ec073, 0x9edea41a, 0x3b9f3664, 0xd1b1f617, 0x74f06469,
+ 0x38513ec5, 0x9d10acbb, 0x773e6cc8, 0xd27ffeb6, 0xa68f9adf, 0x03ce08a1, 0xe9e0c8d2, 0x4ca15aac,
+ 0x70a27d8a, 0xd5e3eff4, 0x3fcd2f87, 0x9a8cbdf9, 0xee7cd990, 0x4b3d4bee, 0xa1138b9d, 0x045219e3,
+ 0x48f3434f, 0xedb2d131, 0x079c1142, 0xa2dd833c, 0xd62de755, 0x736c752b, 0x9942b558, 0x3c032726,
+ 0xe144fb14, 0x4405696a, 0xae2ba919, 0x0b6a3b67, 0x7f9a5f0e, 0xdadbcd70, 0x30f50d03, 0x95b49f7d,
+ 0xd915c5d1, 0x7c5457af, 0x967a97dc, 0x333b05a2, 0x47cb61cb, 0xe28af3b5, 0x08a433c6, 0xade5a1b8,
+ 0x91e6869e, 0x34a714e0, 0xde89d493, 0x7bc846ed, 0x0f382284, 0xaa79b0fa, 0x40577089, 0xe516e2f7,
+ 0xa9b7b85b, 0x0cf62a25, 0xe6d8ea56, 0x43997828, 0x37691c41, 0x92288e3f, 0x78064e4c, 0xdd47dc32,
+ 0xc76580d9, 0x622412a7, 0x880ad2d4, 0x2d4b40aa, 0x59bb24c3, 0xfcfab6bd, 0x16d476ce, 0xb395e4b0,
+ 0xff34be1c, 0x5a752c62, 0xb05bec11, 0x151a7e6f, 0x61ea1a06, 0xc4ab8878, 0x2e85480b, 0x8bc4da75,
+ 0xb7c7fd53, 0x12866f2d, 0xf8a8af5e, 0x5de93d20, 0x29195949, 0x8c58cb37, 0x66760b44, 0xc337993a,
+ 0x8f96c396, 0x2ad751e8, 0xc0f9919b, 0x65b803e5, 0x1148678c, 0xb409f5f2, 0x5e273581, 0xfb66a7ff,
+ 0x26217bcd, 0x8360e9b3, 0x694e29c0, 0xcc0fbbbe, 0xb8ffdfd7, 0x1dbe4da9, 0xf7908dda, 0x52d11fa4,
+ 0x1e704508, 0xbb31d776, 0x511f1705, 0xf45e857b, 0x80aee112, 0x25ef736c, 0xcfc1b31f, 0x6a802161,
+ 0x56830647, 0xf3c29439, 0x19ec544a, 0xbcadc634, 0xc85da25d, 0x6d1c3023, 0x8732f050, 0x2273622e,
+ 0x6ed23882, 0xcb93aafc, 0x21bd6a8f, 0x84fcf8f1, 0xf00c9c98, 0x554d0ee6, 0xbf63ce95, 0x1a225ceb,
+ 0x8b277743, 0x2e66e53d, 0xc448254e, 0x6109b730, 0x15f9d359, 0xb0b84127, 0x5a968154, 0xffd7132a,
+ 0xb3764986, 0x1637dbf8, 0xfc191b8b, 0x595889f5, 0x2da8ed9c, 0x88e97fe2, 0x62c7bf91, 0xc7862def,
+ 0xfb850ac9, 0x5ec498b7, 0xb4ea58c4, 0x11abcaba, 0x655baed3, 0xc01a3cad, 0x2a34fcde, 0x8f756ea0,
+ 0xc3d4340c, 0x6695a672, 0x8cbb6601, 0x29faf47f, 0x5d0a9016, 0xf84b0268, 0x1265c21b, 0xb7245065,
+ 0x6a638c57, 0xcf221e29, 0x250cde5a, 0x804d4c24, 0xf4bd284d, 0x51fcba33, 0xbbd27a40, 0x1e93e83e,
+ 0x5232b292, 0xf77320ec, 0x1d5de09f, 0xb81c72e1, 0xccec1688, 0x69ad84f6, 0x83834485, 0x26c2d6fb,
+ 0x1ac1f1dd, 0xbf8063a3, 0x55aea3d0, 0xf0ef31ae, 0x841f55c7, 0x215ec7b9, 0xcb7007ca, 0x6e3195b4,
+ 0x2290cf18, 0x87d15d66, 0x6dff9d15, 0xc8be0f6b, 0xbc4e6b02, 0x190ff97c, 0xf321390f, 0x5660ab71,
+ 0x4c42f79a, 0xe90365e4, 0x032da597, 0xa66c37e9, 0xd29c5380, 0x77ddc1fe, 0x9df3018d, 0x38b293f3,
+ 0x7413c95f, 0xd1525b21, 0x3b7c9b52, 0x9e3d092c, 0xeacd6d45, 0x4f8cff3b, 0xa5a23f48, 0x00e3ad36,
+ 0x3ce08a10, 0x99a1186e, 0x738fd81d, 0xd6ce4a63, 0xa23e2e0a, 0x077fbc74, 0xed517c07, 0x4810ee79,
+ 0x04b1b4d5, 0xa1f026ab, 0x4bdee6d8, 0xee9f74a6, 0x9a6f10cf, 0x3f2e82b1, 0xd50042c2, 0x7041d0bc,
+ 0xad060c8e, 0x08479ef0, 0xe2695e83, 0x4728ccfd, 0x33d8a894, 0x96993aea, 0x7cb7fa99, 0xd9f668e7,
+ 0x9557324b, 0x3016a035, 0xda386046, 0x7f79f238, 0x0b899651, 0xaec8042f, 0x44e6c45c, 0xe1a75622,
+ 0xdda47104, 0x78e5e37a, 0x92cb2309, 0x378ab177, 0x437ad51e, 0xe63b4760, 0x0c158713, 0xa954156d,
+ 0xe5f54fc1, 0x40b4ddbf, 0xaa9a1dcc, 0x0fdb8fb2, 0x7b2bebdb, 0xde6a79a5, 0x3444b9d6, 0x91052ba8,
+ 0x00000000, 0xdd45aab8, 0xbf672381, 0x62228939, 0x7b2231f3, 0xa6679b4b, 0xc4451272, 0x1900b8ca,
+ 0xf64463e6, 0x2b01c95e, 0x49234067, 0x9466eadf, 0x8d665215, 0x5023f8ad, 0x32017194, 0xef44db2c,
+ 0xe964b13d, 0x34211b85, 0x560392bc, 0x8b463804, 0x924680ce, 0x4f032a76, 0x2d21a34f, 0xf06409f7,
+ 0x1f20d2db, 0xc2657863, 0xa047f15a, 0x7d025be2, 0x6402e328, 0xb9474990, 0xdb65c0a9, 0x06206a11,
+ 0xd725148b, 0x0a60be33, 0x6842370a, 0xb5079db2, 0xac072578, 0x71428fc0, 0x136006f9, 0xce25ac41,
+ 0x2161776d, 0xfc24ddd5, 0x9e0654ec, 0x4343fe54, 0x5a43469e, 0x8706ec26, 0xe524651f, 0x3861cfa7,
+ 0x3e41a5b6, 0xe3040f0e, 0x81268637, 0x5c632c8f, 0x45639445, 0x98263efd, 0xfa04b7c4, 0x27411d7c,
+ 0xc805c650, 0x15406ce8, 0x7762e5d1, 0xaa274f69, 0xb327f7a3, 0x6e625d1b, 0x0c40d422, 0xd1057e9a,
+ 0xaba65fe7, 0x76e3f55f, 0x14c17c66, 0xc984d6de, 0xd0846e14, 0x0dc1c4ac, 0x6fe34d95, 0xb2a6e72d,
+ 0x5de23c01, 0x80a796b9, 0xe2851f80, 0x3fc0b538, 0x26c00df2, 0xfb85a74a, 0x99a72e73, 0x44e284cb,
+ 0x42c2eeda, 0x9f874462, 0xfda5cd5b, 0x20e067e3, 0x39e0df29, 0xe4a57591, 0x8687fca8, 0x5bc25610,
+ 0xb4868d3c, 0x69c32784, 0x0be1aebd, 0xd6a40405, 0xcfa4bccf, 0x12e11677, 0x70c39f4e, 0xad8635f6,
+ 0x7c834b6c, 0xa1c6e1d4, 0xc3e468ed, 0x1ea1c255, 0x07a17a9f, 0xdae4d027, 0xb8c6591e, 0x6583f3a6,
+ 0x8ac7288a, 0x57828232, 0x35a00b0b, 0xe8e5a1b3, 0xf1e51979, 0x2ca0b3c1, 0x4e823af8, 0x93c79040,
+ 0x95e7fa51, 0x48a250e9, 0x2a80d9d0, 0xf7c57368, 0xeec5cba2, 0x3380611a, 0x51a2e823, 0x8ce7429b,
+ 0x63a399b7, 0xbee6330f, 0xdcc4ba36, 0x0181108e, 0x1881a844, 0xc5c402fc, 0xa7e68bc5, 0x7aa3217d,
+ 0x52a0c93f, 0x8fe56387, 0xedc7eabe, 0x30824006, 0x2982f8cc, 0xf4c75274, 0x96e5db4d, 0x4ba071f5,
+ 0xa4e4aad9, 0x79a10061, 0x1b838958, 0xc6c623e0, 0xdfc69b2a, 0x02833192, 0x60a1b8ab, 0xbde41213,
+ 0xbbc47802, 0x6681d2ba, 0x04a35b83, 0xd9e6f13b, 0xc0e649f1, 0x1da3e349, 0x7f816a70, 0xa2c4c0c8,
+ 0x4d801be4, 0x90c5b15c, 0xf2e73865, 0x2fa292dd, 0x36a22a17, 0xebe780af, 0x89c50996, 0x5480a32e,
+ 0x8585ddb4, 0x58c0770c, 0x3ae2fe35, 0xe7a7548d, 0xfea7ec47, 0x23e246ff, 0x41c0cfc6, 0x9c85657e,
+ 0x73c1be52, 0xae8414ea, 0xcca69dd3, 0x11e3376b, 0x08e38fa1, 0xd5a62519, 0xb784ac20, 0x6ac10698,
+ 0x6ce16c89, 0xb1a4c631, 0xd3864f08, 0x0ec3e5b0, 0x17c35d7a, 0xca86f7c2, 0xa8a47efb, 0x75e1d443,
+ 0x9aa50f6f, 0x47e0a5d7, 0x25c22cee, 0xf8878656, 0xe1873e9c, 0x3cc29424, 0x5ee01d1d, 0x83a5b7a5,
+ 0xf90696d8, 0x24433c60, 0x4661b559, 0x9b241fe1, 0x8224a72b, 0x5f610d93, 0x3d4384aa, 0xe0062e12,
+ 0x0f42f53e, 0xd2075f86, 0xb025d6bf, 0x6d607c07, 0x7460c4cd, 0xa9256e75, 0xcb07e74c, 0x16424df4,
+ 0x106227e5, 0xcd278d5d, 0xaf050464, 0x7240aedc, 0x6b401616, 0xb605bcae, 0xd4273597, 0x09629f2f,
+ 0xe6264403, 0x3b63eebb, 0x59416782, 0x8404cd3a, 0x9d0475f0, 0x4041df48, 0x22635671, 0xff26fcc9,
+ 0x2e238253, 0xf36628eb, 0x9144a1d2, 0x4c010b6a, 0x5501b3a0, 0x88441918, 0xea669021, 0x37233a99,
+ 0xd867e1b5, 0x05224b0d, 0x6700c234, 0xba45688c, 0xa345d046, 0x7e007afe, 0x1c22f3c7, 0xc167597f,
+ 0xc747336e, 0x1a0299d6, 0x782010ef, 0xa565ba57, 0xbc65029d, 0x6120a825, 0x0302211c, 0xde478ba4,
+ 0x31035088, 0xec46fa30, 0x8e647309, 0x5321d9b1, 0x4a21617b, 0x9764cbc3, 0xf54642fa, 0x2803e842,
+ 0x00000000, 0x38116fac, 0x7022df58, 0x4833b0f4, 0xe045beb0, 0xd854d11c, 0x906761e8, 0xa8760e44,
+ 0xc5670b91, 0xfd76643d, 0xb545d4c9, 0x8d54bb65, 0x2522b521, 0x1d33da8d, 0x55006a79, 0x6d1105d5,
+ 0x8f2261d3, 0xb7330e7f, 0xff00be8b, 0xc711d127, 0x6f67df63, 0x5776b0cf, 0x1f45003b, 0x27546f97,
+ 0x4a456a42, 0x725405ee, 0x3a67b51a, 0x0276dab6, 0xaa00d4f2, 0x9211bb5e, 0xda220baa, 0xe2336406,
+ 0x1ba8b557, 0x23b9dafb, 0x6b8a6a0f, 0x539b05a3, 0xfbed0be7, 0xc3fc644b, 0x8bcfd4bf, 0xb3debb13,
+ 0xdecfbec6, 0xe6ded16a, 0xaeed619e, 0x96fc0e32, 0x3e8a0076, 0x069b6fda, 0x4ea8df2e, 0x76b9b082,
+ 0x948ad484, 0xac9bbb28, 0xe4a80bdc, 0xdcb96470, 0x74cf6a34, 0x4cde0598, 0x04edb56c, 0x3cfcdac0,
+ 0x51eddf15, 0x69fcb0b9, 0x21cf004d, 0x19de6fe1, 0xb1a861a5, 0x89b90e09, 0xc18abefd, 0xf99bd151,
+ 0x37516aae, 0x0f400502, 0x4773b5f6, 0x7f62da5a, 0xd714d41e, 0xef05bbb2, 0xa7360b46, 0x9f2764ea,
+ 0xf236613f, 0xca270e93, 0x8214be67, 0xba05d1cb, 0x1273df8f, 0x2a62b023, 0x625100d7, 0x5a406f7b,
+ 0xb8730b7d, 0x806264d1, 0xc851d425, 0xf040bb89, 0x5836b5cd, 0x6027da61, 0x28146a95, 0x10050539,
+ 0x7d1400ec, 0x45056f40, 0x0d36dfb4, 0x3527b018, 0x9d51be5c, 0xa540d1f0, 0xed736104, 0xd5620ea8,
+ 0x2cf9dff9, 0x14e8b055, 0x5cdb00a1, 0x64ca6f0d, 0xccbc6149, 0xf4ad0ee5, 0xbc9ebe11, 0x848fd1bd,
+ 0xe99ed468, 0xd18fbbc4, 0x99bc0b30, 0xa1ad649c, 0x09db6ad8, 0x31ca0574, 0x79f9b580, 0x41e8da2c,
+ 0xa3dbbe2a, 0x9bcad186, 0xd3f96172, 0xebe80ede, 0x439e009a, 0x7b8f6f36, 0x33bcdfc2, 0x0badb06e,
+ 0x66bcb5bb, 0x5eadda17, 0x169e6ae3, 0x2e8f054f, 0x86f90b0b, 0xbee864a7, 0xf6dbd453, 0xcecabbff,
+ 0x6ea2d55c, 0x56b3baf0, 0x1e800a04, 0x269165a8, 0x8ee76bec, 0xb6f60440, 0xfec5b4b4, 0xc6d4db18,
+ 0xabc5decd, 0x93d4b161, 0xdbe70195, 0xe3f66e39, 0x4b80607d, 0x73910fd1, 0x3ba2bf25, 0x03b3d089,
+ 0xe180b48f, 0xd991db23, 0x91a26bd7, 0xa9b3047b, 0x01c50a3f, 0x39d46593, 0x71e7d567, 0x49f6bacb,
+ 0x24e7bf1e, 0x1cf6d0b2, 0x54c56046, 0x6cd40fea, 0xc4a201ae, 0xfcb36e02, 0xb480def6, 0x8c91b15a,
+ 0x750a600b, 0x4d1b0fa7, 0x0528bf53, 0x3d39d0ff, 0x954fdebb, 0xad5eb117, 0xe56d01e3, 0xdd7c6e4f,
+ 0xb06d6b9a, 0x887c0436, 0xc04fb4c2, 0xf85edb6e, 0x5028d52a, 0x6839ba86, 0x200a0a72, 0x181b65de,
+ 0xfa2801d8, 0xc2396e74, 0x8a0ade80, 0xb21bb12c, 0x1a6dbf68, 0x227cd0c4, 0x6a4f6030, 0x525e0f9c,
+ 0x3f4f0a49, 0x075e65e5, 0x4f6dd511, 0x777cbabd, 0xdf0ab4f9, 0xe71bdb55, 0xaf286ba1, 0x9739040d,
+ 0x59f3bff2, 0x61e2d05e, 0x29d160aa, 0x11c00f06, 0xb9b60142, 0x81a76eee, 0xc994de1a, 0xf185b1b6,
+ 0x9c94b463, 0xa485dbcf, 0xecb66b3b, 0xd4a70497, 0x7cd10ad3, 0x44c0657f, 0x0cf3d58b, 0x34e2ba27,
+ 0xd6d1de21, 0xeec0b18d, 0xa6f30179, 0x9ee26ed5, 0x36946091, 0x0e850f3d, 0x46b6bfc9, 0x7ea7d065,
+ 0x13b6d5b0, 0x2ba7ba1c, 0x63940ae8, 0x5b856544, 0xf3f36b00, 0xcbe204ac, 0x83d1b458, 0xbbc0dbf4,
+ 0x425b0aa5, 0x7a4a6509, 0x3279d5fd, 0x0a68ba51, 0xa21eb415, 0x9a0fdbb9, 0xd23c6b4d, 0xea2d04e1,
+ 0x873c0134, 0xbf2d6e98, 0xf71ede6c, 0xcf0fb1c0, 0x6779bf84, 0x5f68d028, 0x175b60dc, 0x2f4a0f70,
+ 0xcd796b76, 0xf56804da, 0xbd5bb42e, 0x854adb82, 0x2d3cd5c6, 0x152dba6a, 0x5d1e0a9e, 0x650f6532,
+ 0x081e60e7, 0x300f0f4b, 0x783cbfbf, 0x402dd013, 0xe85bde57, 0xd04ab1fb, 0x9879010f, 0xa0686ea3,
+ 0x00000000, 0xef306b19, 0xdb8ca0c3, 0x34bccbda, 0xb2f53777, 0x5dc55c6e, 0x697997b4, 0x8649fcad,
+ 0x6006181f, 0x8f367306, 0xbb8ab8dc, 0x54bad3c5, 0xd2f32f68, 0x3dc34471, 0x097f8fab, 0xe64fe4b2,
+ 0xc00c303e, 0x2f3c5b27, 0x1b8090fd, 0xf4b0fbe4, 0x72f90749, 0x9dc96c50, 0xa975a78a, 0x4645cc93,
+ 0xa00a2821, 0x4f3a4338, 0x7b8688e2, 0x94b6e3fb, 0x12ff1f56, 0xfdcf744f, 0xc973bf95, 0x2643d48c,
+ 0x85f4168d, 0x6ac47d94, 0x5e78b64e, 0xb148dd57, 0x370121fa, 0xd8314ae3, 0xec8d8139, 0x03bdea20,
+ 0xe5f20e92, 0x0ac2658b, 0x3e7eae51, 0xd14ec548, 0x570739e5, 0xb83752fc, 0x8c8b9926, 0x63bbf23f,
+ 0x45f826b3, 0xaac84daa, 0x9e748670, 0x7144ed69, 0xf70d11c4, 0x183d7add, 0x2c81b107, 0xc3b1da1e,
+ 0x25fe3eac, 0xcace55b5, 0xfe729e6f, 0x1142f576, 0x970b09db, 0x783b62c2, 0x4c87a918, 0xa3b7c201,
+ 0x0e045beb, 0xe13430f2, 0xd588fb28, 0x3ab89031, 0xbcf16c9c, 0x53c10785, 0x677dcc5f, 0x884da746,
+ 0x6e0243f4, 0x813228ed, 0xb58ee337, 0x5abe882e, 0xdcf77483, 0x33c71f9a, 0x077bd440, 0xe84bbf59,
+ 0xce086bd5, 0x213800cc, 0x1584cb16, 0xfab4a00f, 0x7cfd5ca2, 0x93cd37bb, 0xa771fc61, 0x48419778,
+ 0xae0e73ca, 0x413e18d3, 0x7582d309, 0x9ab2b810, 0x1cfb44bd, 0xf3cb2fa4, 0xc777e47e, 0x28478f67,
+ 0x8bf04d66, 0x64c0267f, 0x507ceda5, 0xbf4c86bc, 0x39057a11, 0xd6351108, 0xe289dad2, 0x0db9b1cb,
+ 0xebf65579, 0x04c63e60, 0x307af5ba, 0xdf4a9ea3, 0x5903620e, 0xb6330917, 0x828fc2cd, 0x6dbfa9d4,
+ 0x4bfc7d58, 0xa4cc1641, 0x9070dd9b, 0x7f40b682, 0xf9094a2f, 0x16392136, 0x2285eaec, 0xcdb581f5,
+ 0x2bfa6547, 0xc4ca0e5e, 0xf076c584, 0x1f46ae9d, 0x990f5230, 0x763f3929, 0x4283f2f3, 0xadb399ea,
+ 0x1c08b7d6, 0xf338dccf, 0xc7841715, 0x28b47c0c, 0xaefd80a1, 0x41cdebb8, 0x75712062, 0x9a414b7b,
+ 0x7c0eafc9, 0x933ec4d0, 0xa7820f0a, 0x48b26413, 0xcefb98be, 0x21cbf3a7, 0x1577387d, 0xfa475364,
+ 0xdc0487e8, 0x3334ecf1, 0x0788272b, 0xe8b84c32, 0x6ef1b09f, 0x81c1db86, 0xb57d105c, 0x5a4d7b45,
+ 0xbc029ff7, 0x5332f4ee, 0x678e3f34, 0x88be542d, 0x0ef7a880, 0xe1c7c399, 0xd57b0843, 0x3a4b635a,
+ 0x99fca15b, 0x76ccca42, 0x42700198, 0xad406a81, 0x2b09962c, 0xc439fd35, 0xf08536ef, 0x1fb55df6,
+ 0xf9fab944, 0x16cad25d, 0x22761987, 0xcd46729e, 0x4b0f8e33, 0xa43fe52a, 0x90832ef0, 0x7fb345e9,
+ 0x59f09165, 0xb6c0fa7c, 0x827c31a6, 0x6d4c5abf, 0xeb05a612, 0x0435cd0b, 0x308906d1, 0xdfb96dc8,
+ 0x39f6897a, 0xd6c6e263, 0xe27a29b9, 0x0d4a42a0, 0x8b03be0d, 0x6433d514, 0x508f1ece, 0xbfbf75d7,
+ 0x120cec3d, 0xfd3c8724, 0xc9804cfe, 0x26b027e7, 0xa0f9db4a, 0x4fc9b053, 0x7b757b89, 0x94451090,
+ 0x720af422, 0x9d3a9f3b, 0xa98654e1, 0x46b63ff8, 0xc0ffc355, 0x2fcfa84c, 0x1b736396, 0xf443088f,
+ 0xd200dc03, 0x3d30b71a, 0x098c7cc0, 0xe6bc17d9, 0x60f5eb74, 0x8fc5806d, 0xbb794bb7, 0x544920ae,
+ 0xb206c41c, 0x5d36af05, 0x698a64df, 0x86ba0fc6, 0x00f3f36b, 0xefc39872, 0xdb7f53a8, 0x344f38b1,
+ 0x97f8fab0, 0x78c891a9, 0x4c745a73, 0xa344316a, 0x250dcdc7, 0xca3da6de, 0xfe816d04, 0x11b1061d,
+ 0xf7fee2af, 0x18ce89b6, 0x2c72426c, 0xc3422975, 0x450bd5d8, 0xaa3bbec1, 0x9e87751b, 0x71b71e02,
+ 0x57f4ca8e, 0xb8c4a197, 0x8c786a4d, 0x63480154, 0xe501fdf9, 0x0a3196e0, 0x3e8d5d3a, 0xd1bd3623,
+ 0x37f2d291, 0xd8c2b988, 0xec7e7252, 0x034e194b, 0x8507e5e6, 0x6a378eff, 0x5e8b4525, 0xb1bb2e3c,
+ 0x00000000, 0x68032cc8, 0xd0065990, 0xb8057558, 0xa5e0c5d1, 0xcde3e919, 0x75e69c41, 0x1de5b089,
+ 0x4e2dfd53, 0x262ed19b, 0x9e2ba4c3, 0xf628880b, 0xebcd3882, 0x83ce144a, 0x3bcb6112, 0x53c84dda,
+ 0x9c5bfaa6, 0xf458d66e, 0x4c5da336, 0x245e8ffe, 0x39bb3f77, 0x51b813bf, 0xe9bd66e7, 0x81be4a2f,
+ 0xd27607f5, 0xba752b3d, 0x02705e65, 0x6a7372ad, 0x7796c224, 0x1f95eeec, 0xa7909bb4, 0xcf93b77c,
+ 0x3d5b83bd, 0x5558af75, 0xed5dda2d, 0x855ef6e5, 0x98bb466c, 0xf0b86aa4, 0x48bd1ffc, 0x20be3334,
+ 0x73767eee, 0x1b755226, 0xa370277e, 0xcb730bb6, 0xd696bb3f, 0xbe9597f7, 0x0690e2af, 0x6e93ce67,
+ 0xa100791b, 0xc90355d3, 0x7106208b, 0x19050c43, 0x04e0bcca, 0x6ce39002, 0xd4e6e55a, 0xbce5c992,
+ 0xef2d8448, 0x872ea880, 0x3f2bddd8, 0x5728f110, 0x4acd4199, 0x22ce6d51, 0x9acb1809, 0xf2c834c1,
+ 0x7ab7077a, 0x12b42bb2, 0xaab15eea, 0xc2b27222, 0xdf57c2ab, 0xb754ee63, 0x0f519b3b, 0x6752b7f3,
+ 0x349afa29, 0x5c99d6e1, 0xe49ca3b9, 0x8c9f8f71, 0x917a3ff8, 0xf9791330, 0x417c6668, 0x297f4aa0,
+ 0xe6ecfddc, 0x8eefd114, 0x36eaa44c, 0x5ee98884, 0x430c380d, 0x2b0f14c5, 0x930a619d, 0xfb094d55,
+ 0xa8c1008f, 0xc0c22c47, 0x78c7591f, 0x10c475d7, 0x0d21c55e, 0x6522e996, 0xdd279cce, 0xb524b006,
+ 0x47ec84c7, 0x2fefa80f, 0x97eadd57, 0xffe9f19f, 0xe20c4116, 0x8a0f6dde, 0x320a1886, 0x5a09344e,
+ 0x09c17994, 0x61c2555c, 0xd9c72004, 0xb1c40ccc, 0xac21bc45, 0xc422908d, 0x7c27e5d5, 0x1424c91d,
+ 0xdbb77e61, 0xb3b452a9, 0x0bb127f1, 0x63b20b39, 0x7e57bbb0, 0x16549778, 0xae51e220, 0xc652cee8,
+ 0x959a8332, 0xfd99affa, 0x459cdaa2, 0x2d9ff66a, 0x307a46e3, 0x58796a2b, 0xe07c1f73, 0x887f33bb,
+ 0xf56e0ef4, 0x9d6d223c, 0x25685764, 0x4d6b7bac, 0x508ecb25, 0x388de7ed, 0x808892b5, 0xe88bbe7d,
+ 0xbb43f3a7, 0xd340df6f, 0x6b45aa37, 0x034686ff, 0x1ea33676, 0x76a01abe, 0xcea56fe6, 0xa6a6432e,
+ 0x6935f452, 0x0136d89a, 0xb933adc2, 0xd130810a, 0xccd53183, 0xa4d61d4b, 0x1cd36813, 0x74d044db,
+ 0x27180901, 0x4f1b25c9, 0xf71e5091, 0x9f1d7c59, 0x82f8ccd0, 0xeafbe018, 0x52fe9540, 0x3afdb988,
+ 0xc8358d49, 0xa036a181, 0x1833d4d9, 0x7030f811, 0x6dd54898, 0x05d66450, 0xbdd31108, 0xd5d03dc0,
+ 0x8618701a, 0xee1b5cd2, 0x561e298a, 0x3e1d0542, 0x23f8b5cb, 0x4bfb9903, 0xf3feec5b, 0x9bfdc093,
+ 0x546e77ef, 0x3c6d5b27, 0x84682e7f, 0xec6b02b7, 0xf18eb23e, 0x998d9ef6, 0x2188ebae, 0x498bc766,
+ 0x1a438abc, 0x7240a674, 0xca45d32c, 0xa246ffe4, 0xbfa34f6d, 0xd7a063a5, 0x6fa516fd, 0x07a63a35,
+ 0x8fd9098e, 0xe7da2546, 0x5fdf501e, 0x37dc7cd6, 0x2a39cc5f, 0x423ae097, 0xfa3f95cf, 0x923cb907,
+ 0xc1f4f4dd, 0xa9f7d815, 0x11f2ad4d, 0x79f18185, 0x6414310c, 0x0c171dc4, 0xb412689c, 0xdc114454,
+ 0x1382f328, 0x7b81dfe0, 0xc384aab8, 0xab878670, 0xb66236f9, 0xde611a31, 0x66646f69, 0x0e6743a1,
+ 0x5daf0e7b, 0x35ac22b3, 0x8da957eb, 0xe5aa7b23, 0xf84fcbaa, 0x904ce762, 0x2849923a, 0x404abef2,
+ 0xb2828a33, 0xda81a6fb, 0x6284d3a3, 0x0a87ff6b, 0x17624fe2, 0x7f61632a, 0xc7641672, 0xaf673aba,
+ 0xfcaf7760, 0x94ac5ba8, 0x2ca92ef0, 0x44aa0238, 0x594fb2b1, 0x314c9e79, 0x8949eb21, 0xe14ac7e9,
+ 0x2ed97095, 0x46da5c5d, 0xfedf2905, 0x96dc05cd, 0x8b39b544, 0xe33a998c, 0x5b3fecd4, 0x333cc01c,
+ 0x60f48dc6, 0x08f7a10e, 0xb0f2d456, 0xd8f1f89e, 0xc5144817, 0xad1764df, 0x15121187, 0x7d113d4f,
+ 0x00000000, 0x493c7d27, 0x9278fa4e, 0xdb448769, 0x211d826d, 0x6821ff4a, 0xb3657823, 0xfa590504,
+ 0x423b04da, 0x0b0779fd, 0xd043fe94, 0x997f83b3, 0x632686b7, 0x2a1afb90, 0xf15e7cf9, 0xb86201de,
+ 0x847609b4, 0xcd4a7493, 0x160ef3fa, 0x5f328edd, 0xa56b8bd9, 0xec57f6fe, 0x37137197, 0x7e2f0cb0,
+ 0xc64d0d6e, 0x8f717049, 0x5435f720, 0x1d098a07, 0xe7508f03, 0xae6cf224, 0x7528754d, 0x3c14086a,
+ 0x0d006599, 0x443c18be, 0x9f789fd7, 0xd644e2f0, 0x2c1de7f4, 0x65219ad3, 0xbe651dba, 0xf759609d,
+ 0x4f3b6143, 0x06071c64, 0xdd439b0d, 0x947fe62a, 0x6e26e32e, 0x271a9e09, 0xfc5e1960, 0xb5626447,
+ 0x89766c2d, 0xc04a110a, 0x1b0e9663, 0x5232eb44, 0xa86bee40, 0xe1579367, 0x3a13140e, 0x732f6929,
+ 0xcb4d68f7, 0x827115d0, 0x593592b9, 0x1009ef9e, 0xea50ea9a, 0xa36c97bd, 0x782810d4, 0x31146df3,
+ 0x1a00cb32, 0x533cb615, 0x8878317c, 0xc1444c5b, 0x3b1d495f, 0x72213478, 0xa965b311, 0xe059ce36,
+ 0x583bcfe8, 0x1107b2cf, 0xca4335a6, 0x837f4881, 0x79264d85, 0x301a30a2, 0xeb5eb7cb, 0xa262caec,
+ 0x9e76c286, 0xd74abfa1, 0x0c0e38c8, 0x453245ef, 0xbf6b40eb, 0xf6573dcc, 0x2d13baa5, 0x642fc782,
+ 0xdc4dc65c, 0x9571bb7b, 0x4e353c12, 0x07094135, 0xfd504431, 0xb46c3916, 0x6f28be7f, 0x2614c358,
+ 0x1700aeab, 0x5e3cd38c, 0x857854e5, 0xcc4429c2, 0x361d2cc6, 0x7f2151e1, 0xa465d688, 0xed59abaf,
+ 0x553baa71, 0x1c07d756, 0xc743503f, 0x8e7f2d18, 0x7426281c, 0x3d1a553b, 0xe65ed252, 0xaf62af75,
+ 0x9376a71f, 0xda4ada38, 0x010e5d51, 0x48322076, 0xb26b2572, 0xfb575855, 0x2013df3c, 0x692fa21b,
+ 0xd14da3c5, 0x9871dee2, 0x4335598b, 0x0a0924ac, 0xf05021a8, 0xb96c5c8f, 0x6228dbe6, 0x2b14a6c1,
+ 0x34019664, 0x7d3deb43, 0xa6796c2a, 0xef45110d, 0x151c1409, 0x5c20692e, 0x8764ee47, 0xce589360,
+ 0x763a92be, 0x3f06ef99, 0xe44268f0, 0xad7e15d7, 0x572710d3, 0x1e1b6df4, 0xc55fea9d, 0x8c6397ba,
+ 0xb0779fd0, 0xf94be2f7, 0x220f659e, 0x6b3318b9, 0x916a1dbd, 0xd856609a, 0x0312e7f3, 0x4a2e9ad4,
+ 0xf24c9b0a, 0xbb70e62d, 0x60346144, 0x29081c63, 0xd3511967, 0x9a6d6440, 0x4129e329, 0x08159e0e,
+ 0x3901f3fd, 0x703d8eda, 0xab7909b3, 0xe2457494, 0x181c7190, 0x51200cb7, 0x8a648bde, 0xc358f6f9,
+ 0x7b3af727, 0x32068a00, 0xe9420d69, 0xa07e704e, 0x5a27754a, 0x131b086d, 0xc85f8f04, 0x8163f223,
+ 0xbd77fa49, 0xf44b876e, 0x2f0f0007, 0x66337d20, 0x9c6a7824, 0xd5560503, 0x0e12826a, 0x472eff4d,
+ 0xff4cfe93, 0xb67083b4, 0x6d3404dd, 0x240879fa, 0xde517cfe, 0x976d01d9, 0x4c2986b0, 0x0515fb97,
+ 0x2e015d56, 0x673d2071, 0xbc79a718, 0xf545da3f, 0x0f1cdf3b, 0x4620a21c, 0x9d642575, 0xd4585852,
+ 0x6c3a598c, 0x250624ab, 0xfe42a3c2, 0xb77edee5, 0x4d27dbe1, 0x041ba6c6, 0xdf5f21af, 0x96635c88,
+ 0xaa7754e2, 0xe34b29c5, 0x380faeac, 0x7133d38b, 0x8b6ad68f, 0xc256aba8, 0x19122cc1, 0x502e51e6,
+ 0xe84c5038, 0xa1702d1f, 0x7a34aa76, 0x3308d751, 0xc951d255, 0x806daf72, 0x5b29281b, 0x1215553c,
+ 0x230138cf, 0x6a3d45e8, 0xb179c281, 0xf845bfa6, 0x021cbaa2, 0x4b20c785, 0x906440ec, 0xd9583dcb,
+ 0x613a3c15, 0x28064132, 0xf342c65b, 0xba7ebb7c, 0x4027be78, 0x091bc35f, 0xd25f4436, 0x9b633911,
+ 0xa777317b, 0xee4b4c5c, 0x350fcb35, 0x7c33b612, 0x866ab316, 0xcf56ce31, 0x14124958, 0x5d2e347f,
+ 0xe54c35a1, 0xac704886, 0x7734cfef, 0x3e08b2c8, 0xc451b7cc, 0x8d6dcaeb, 0x56294d82, 0x1f1530a5,
+};
+
+const uint32_t crc32_864cfb00_crc_table[CRC_SLICES * 256] = {
+ 0x00000000, 0x864cfb00, 0x8ad50d00, 0x0c99f600, 0x93e6e100, 0x15aa1a00, 0x1933ec00, 0x9f7f1700,
+ 0xa1813900, 0x27cdc200, 0x2b543400, 0xad18cf00, 0x3267d800, 0xb42b2300, 0xb8b2d500, 0x3efe2e00,
+ 0xc54e8900, 0x43027200, 0x4f9b8400, 0xc9d77f00, 0x56a86800, 0xd0e49300, 0xdc7d6500, 0x5a319e00,
+ 0x64cfb000, 0xe2834b00, 0xee1abd00, 0x68564600, 0xf7295100, 0x7165aa00, 0x7dfc5c00, 0xfbb0a700,
+ 0x0cd1e900, 0x8a9d1200, 0x8604e400, 0x00481f00, 0x9f370800, 0x197bf300, 0x15e20500, 0x93aefe00,
+ 0xad50d000, 0x2b1c2b00, 0x2785dd00, 0xa1c92600, 0x3eb63100, 0xb8faca00, 0xb4633c00, 0x322fc700,
+ 0xc99f6000, 0x4fd39b00, 0x434a6d00, 0xc5069600, 0x5a798100, 0xdc357a00, 0xd0ac8c00, 0x56e07700,
+ 0x681e5900, 0xee52a200, 0xe2cb5400, 0x6487af00, 0xfbf8b800, 0x7db44300, 0x712db500, 0xf7614e00,
+ 0x19a3d200, 0x9fef2900, 0x9376df00, 0x153a2400, 0x8a453300, 0x0c09c800, 0x00903e00, 0x86dcc500,
+ 0xb822eb00, 0x3e6e1000, 0x32f7e600, 0xb4bb1d00, 0x2bc40a00, 0xad88f100, 0xa1110700, 0x275dfc00,
+ 0xdced5b00, 0x5aa1a000, 0x56385600, 0xd074ad00, 0x4f0bba00, 0xc9474100, 0xc5deb700, 0x43924c00,
+ 0x7d6c6200, 0xfb209900, 0xf7b96f00, 0x71f59400, 0xee8a8300, 0x68c67800, 0x645f8e00, 0xe2137500,
+ 0x15723b00, 0x933ec000, 0x9fa73600, 0x19ebcd00, 0x8694da00, 0x00d82100, 0x0c41d700, 0x8a0d2c00,
+ 0xb4f30200, 0x32bff900, 0x3e260f00, 0xb86af400, 0x2715e300, 0xa1591800, 0xadc0ee00, 0x2b8c1500,
+ 0xd03cb200, 0x56704900, 0x5ae9bf00, 0xdca54400, 0x43da5300, 0xc596a800, 0xc90f5e00, 0x4f43a500,
+ 0x71bd8b00, 0xf7f17000, 0xfb688600, 0x7d247d00, 0xe25b6a00, 0x64179100, 0x688e6700, 0xeec29c00,
+ 0x3347a400, 0xb50b5f00, 0xb992a900, 0x3fde5200, 0xa0a14500, 0x26edbe00, 0x2a744800, 0xac38b300,
+ 0x92c69d00, 0x148a6600, 0x18139000, 0x9e5f6b00, 0x01207c00, 0x876c8700, 0x8bf57100, 0x0db98a00,
+ 0xf6092d00, 0x7045d600, 0x7cdc2000, 0xfa90db00, 0x65efcc00, 0xe3a33700, 0xef3ac100, 0x69763a00,
+ 0x57881400, 0xd1c4ef00, 0xdd5d1900, 0x5b11e200, 0xc46ef500, 0x42220e00, 0x4ebbf800, 0xc8f70300,
+ 0x3f964d00, 0xb9dab600, 0xb5434000, 0x330fbb00, 0xac70ac00, 0x2a3c5700, 0x26a5a100, 0xa0e95a00,
+ 0x9e177400, 0x185b8f00, 0x14c27900, 0x928e8200, 0x0df19500, 0x8bbd6e00, 0x87249800, 0x01686300,
+ 0xfad8c400, 0x7c943f00, 0x700dc900, 0xf6413200, 0x693e2500, 0xef72de00, 0xe3eb2800, 0x65a7d300,
+ 0x5b59fd00, 0xdd150600, 0xd18cf000, 0x57c00b00, 0xc8bf1c00, 0x4ef3e700, 0x426a1100, 0xc426ea00,
+ 0x2ae47600, 0xaca88d00, 0xa0317b00, 0x267d8000, 0xb9029700, 0x3f4e6c00, 0x33d79a00, 0xb59b6100,
+ 0x8b654f00, 0x0d29b400, 0x01b04200, 0x87fcb900, 0x1883ae00, 0x9ecf5500, 0x9256a300, 0x141a5800,
+ 0xefaaff00, 0x69e60400, 0x657ff200, 0xe3330900, 0x7c4c1e00, 0xfa00e500, 0xf6991300, 0x70d5e800,
+ 0x4e2bc600, 0xc8673d00, 0xc4fecb00, 0x42b23000, 0xddcd2700, 0x5b81dc00, 0x57182a00, 0xd154d100,
+ 0x26359f00, 0xa0796400, 0xace09200, 0x2aac6900, 0xb5d37e00, 0x339f8500, 0x3f067300, 0xb94a8800,
+ 0x87b4a600, 0x01f85d00, 0x0d61ab00, 0x8b2d5000, 0x14524700, 0x921ebc00, 0x9e874a00, 0x18cbb100,
+ 0xe37b1600, 0x6537ed00, 0x69ae1b00, 0xefe2e000, 0x709df700, 0xf6d10c00, 0xfa48fa00, 0x7c040100,
+ 0x42fa2f00, 0xc4b6d400, 0xc82f2200, 0x4e63d900, 0xd11cce00, 0x57503500, 0x5bc9c300, 0xdd853800,
+ 0x00000000, 0x668f4800, 0xcd1e9000, 0xab91d800, 0x1c71db00, 0x7afe9300, 0xd16f4b00, 0xb7e00300,
+ 0x38e3b600, 0x5e6cfe00, 0xf5fd2600, 0x93726e00, 0x24926d00, 0x421d2500, 0xe98cfd00, 0x8f03b500,
+ 0x71c76c00, 0x17482400, 0xbcd9fc00, 0xda56b400, 0x6db6b700, 0x0b39ff00, 0xa0a82700, 0xc6276f00,
+ 0x4924da00, 0x2fab9200, 0x843a4a00, 0xe2b50200, 0x55550100, 0x33da4900, 0x984b9100, 0xfec4d900,
+ 0xe38ed800, 0x85019000, 0x2e904800, 0x481f0000, 0xffff0300, 0x99704b00, 0x32e19300, 0x546edb00,
+ 0xdb6d6e00, 0xbde22600, 0x1673fe00, 0x70fcb600, 0xc71cb500, 0xa193fd00, 0x0a022500, 0x6c8d6d00,
+ 0x9249b400, 0xf4c6fc00, 0x5f572400, 0x39d86c00, 0x8e386f00, 0xe8b72700, 0x4326ff00, 0x25a9b700,
+ 0xaaaa0200, 0xcc254a00, 0x67b49200, 0x013bda00, 0xb6dbd900, 0xd0549100, 0x7bc54900, 0x1d4a0100,
+ 0x41514b00, 0x27de0300, 0x8c4fdb00, 0xeac09300, 0x5d209000, 0x3bafd800, 0x903e0000, 0xf6b14800,
+ 0x79b2fd00, 0x1f3db500, 0xb4ac6d00, 0xd2232500, 0x65c32600, 0x034c6e00, 0xa8ddb600, 0xce52fe00,
+ 0x30962700, 0x56196f00, 0xfd88b700, 0x9b07ff00, 0x2ce7fc00, 0x4a68b400, 0xe1f96c00, 0x87762400,
+ 0x08759100, 0x6efad900, 0xc56b0100, 0xa3e44900, 0x14044a00, 0x728b0200, 0xd91ada00, 0xbf959200,
+ 0xa2df9300, 0xc450db00, 0x6fc10300, 0x094e4b00, 0xbeae4800, 0xd8210000, 0x73b0d800, 0x153f9000,
+ 0x9a3c2500, 0xfcb36d00, 0x5722b500, 0x31adfd00, 0x864dfe00, 0xe0c2b600, 0x4b536e00, 0x2ddc2600,
+ 0xd318ff00, 0xb597b700, 0x1e066f00, 0x78892700, 0xcf692400, 0xa9e66c00, 0x0277b400, 0x64f8fc00,
+ 0xebfb4900, 0x8d740100, 0x26e5d900, 0x406a9100, 0xf78a9200, 0x9105da00, 0x3a940200, 0x5c1b4a00,
+ 0x82a29600, 0xe42dde00, 0x4fbc0600, 0x29334e00, 0x9ed34d00, 0xf85c0500, 0x53cddd00, 0x35429500,
+ 0xba412000, 0xdcce6800, 0x775fb000, 0x11d0f800, 0xa630fb00, 0xc0bfb300, 0x6b2e6b00, 0x0da12300,
+ 0xf365fa00, 0x95eab200, 0x3e7b6a00, 0x58f42200, 0xef142100, 0x899b6900, 0x220ab100, 0x4485f900,
+ 0xcb864c00, 0xad090400, 0x0698dc00, 0x60179400, 0xd7f79700, 0xb178df00, 0x1ae90700, 0x7c664f00,
+ 0x612c4e00, 0x07a30600, 0xac32de00, 0xcabd9600, 0x7d5d9500, 0x1bd2dd00, 0xb0430500, 0xd6cc4d00,
+ 0x59cff800, 0x3f40b000, 0x94d16800, 0xf25e2000, 0x45be2300, 0x23316b00, 0x88a0b300, 0xee2ffb00,
+ 0x10eb2200, 0x76646a00, 0xddf5b200, 0xbb7afa00, 0x0c9af900, 0x6a15b100, 0xc1846900, 0xa70b2100,
+ 0x28089400, 0x4e87dc00, 0xe5160400, 0x83994c00, 0x34794f00, 0x52f60700, 0xf967df00, 0x9fe89700,
+ 0xc3f3dd00, 0xa57c9500, 0x0eed4d00, 0x68620500, 0xdf820600, 0xb90d4e00, 0x129c9600, 0x7413de00,
+ 0xfb106b00, 0x9d9f2300, 0x360efb00, 0x5081b300, 0xe761b000, 0x81eef800, 0x2a7f2000, 0x4cf06800,
+ 0xb234b100, 0xd4bbf900, 0x7f2a2100, 0x19a56900, 0xae456a00, 0xc8ca2200, 0x635bfa00, 0x05d4b200,
+ 0x8ad70700, 0xec584f00, 0x47c99700, 0x2146df00, 0x96a6dc00, 0xf0299400, 0x5bb84c00, 0x3d370400,
+ 0x207d0500, 0x46f24d00, 0xed639500, 0x8becdd00, 0x3c0cde00, 0x5a839600, 0xf1124e00, 0x979d0600,
+ 0x189eb300, 0x7e11fb00, 0xd5802300, 0xb30f6b00, 0x04ef6800, 0x62602000, 0xc9f1f800, 0xaf7eb000,
+ 0x51ba6900, 0x37352100, 0x9ca4f900, 0xfa2bb100, 0x4dcbb200, 0x2b44fa00, 0x80d52200, 0xe65a6a00,
+ 0x6959df00, 0x0fd69700, 0xa4474f00, 0xc2c80700, 0x75280400, 0x13a74c00, 0xb8369400, 0xdeb9dc00,
+ 0x00000000, 0x8309d700, 0x805f5500, 0x03568200, 0x86f25100, 0x05fb8600, 0x06ad0400, 0x85a4d300,
+ 0x8ba85900, 0x08a18e00, 0x0bf70c00, 0x88fedb00, 0x0d5a0800, 0x8e53df00, 0x8d055d00, 0x0e0c8a00,
+ 0x911c4900, 0x12159e00, 0x11431c00, 0x924acb00, 0x17ee1800, 0x94e7cf00, 0x97b14d00, 0x14b89a00,
+ 0x1ab41000, 0x99bdc700, 0x9aeb4500, 0x19e29200, 0x9c464100, 0x1f4f9600, 0x1c191400, 0x9f10c300,
+ 0xa4746900, 0x277dbe00, 0x242b3c00, 0xa722eb00, 0x22863800, 0xa18fef00, 0xa2d96d00, 0x21d0ba00,
+ 0x2fdc3000, 0xacd5e700, 0xaf836500, 0x2c8ab200, 0xa92e6100, 0x2a27b600, 0x29713400, 0xaa78e300,
+ 0x35682000, 0xb661f700, 0xb5377500, 0x363ea200, 0xb39a7100, 0x3093a600, 0x33c52400, 0xb0ccf300,
+ 0xbec07900, 0x3dc9ae00, 0x3e9f2c00, 0xbd96fb00, 0x38322800, 0xbb3bff00, 0xb86d7d00, 0x3b64aa00,
+ 0xcea42900, 0x4dadfe00, 0x4efb7c00, 0xcdf2ab00, 0x48567800, 0xcb5faf00, 0xc8092d00, 0x4b00fa00,
+ 0x450c7000, 0xc605a700, 0xc5532500, 0x465af200, 0xc3fe2100, 0x40f7f600, 0x43a17400, 0xc0a8a300,
+ 0x5fb86000, 0xdcb1b700, 0xdfe73500, 0x5ceee200, 0xd94a3100, 0x5a43e600, 0x59156400, 0xda1cb300,
+ 0xd4103900, 0x5719ee00, 0x544f6c00, 0xd746bb00, 0x52e26800, 0xd1ebbf00, 0xd2bd3d00, 0x51b4ea00,
+ 0x6ad04000, 0xe9d99700, 0xea8f1500, 0x6986c200, 0xec221100, 0x6f2bc600, 0x6c7d4400, 0xef749300,
+ 0xe1781900, 0x6271ce00, 0x61274c00, 0xe22e9b00, 0x678a4800, 0xe4839f00, 0xe7d51d00, 0x64dcca00,
+ 0xfbcc0900, 0x78c5de00, 0x7b935c00, 0xf89a8b00, 0x7d3e5800, 0xfe378f00, 0xfd610d00, 0x7e68da00,
+ 0x70645000, 0xf36d8700, 0xf03b0500, 0x7332d200, 0xf6960100, 0x759fd600, 0x76c95400, 0xf5c08300,
+ 0x1b04a900, 0x980d7e00, 0x9b5bfc00, 0x18522b00, 0x9df6f800, 0x1eff2f00, 0x1da9ad00, 0x9ea07a00,
+ 0x90acf000, 0x13a52700, 0x10f3a500, 0x93fa7200, 0x165ea100, 0x95577600, 0x9601f400, 0x15082300,
+ 0x8a18e000, 0x09113700, 0x0a47b500, 0x894e6200, 0x0ceab100, 0x8fe36600, 0x8cb5e400, 0x0fbc3300,
+ 0x01b0b900, 0x82b96e00, 0x81efec00, 0x02e63b00, 0x8742e800, 0x044b3f00, 0x071dbd00, 0x84146a00,
+ 0xbf70c000, 0x3c791700, 0x3f2f9500, 0xbc264200, 0x39829100, 0xba8b4600, 0xb9ddc400, 0x3ad41300,
+ 0x34d89900, 0xb7d14e00, 0xb487cc00, 0x378e1b00, 0xb22ac800, 0x31231f00, 0x32759d00, 0xb17c4a00,
+ 0x2e6c8900, 0xad655e00, 0xae33dc00, 0x2d3a0b00, 0xa89ed800, 0x2b970f00, 0x28c18d00, 0xabc85a00,
+ 0xa5c4d000, 0x26cd0700, 0x259b8500, 0xa6925200, 0x23368100, 0xa03f5600, 0xa369d400, 0x20600300,
+ 0xd5a08000, 0x56a95700, 0x55ffd500, 0xd6f60200, 0x5352d100, 0xd05b0600, 0xd30d8400, 0x50045300,
+ 0x5e08d900, 0xdd010e00, 0xde578c00, 0x5d5e5b00, 0xd8fa8800, 0x5bf35f00, 0x58a5dd00, 0xdbac0a00,
+ 0x44bcc900, 0xc7b51e00, 0xc4e39c00, 0x47ea4b00, 0xc24e9800, 0x41474f00, 0x4211cd00, 0xc1181a00,
+ 0xcf149000, 0x4c1d4700, 0x4f4bc500, 0xcc421200, 0x49e6c100, 0xcaef1600, 0xc9b99400, 0x4ab04300,
+ 0x71d4e900, 0xf2dd3e00, 0xf18bbc00, 0x72826b00, 0xf726b800, 0x742f6f00, 0x7779ed00, 0xf4703a00,
+ 0xfa7cb000, 0x79756700, 0x7a23e500, 0xf92a3200, 0x7c8ee100, 0xff873600, 0xfcd1b400, 0x7fd86300,
+ 0xe0c8a000, 0x63c17700, 0x6097f500, 0xe39e2200, 0x663af100, 0xe5332600, 0xe665a400, 0x656c7300,
+ 0x6b60f900, 0xe8692e00, 0xeb3fac00, 0x68367b00, 0xed92a800, 0x6e9b7f00, 0x6dcdfd00, 0xeec42a00,
+ 0x00000000, 0x36095200, 0x6c12a400, 0x5a1bf600, 0xd8254800, 0xee2c1a00, 0xb437ec00, 0x823ebe00,
+ 0x36066b00, 0x000f3900, 0x5a14cf00, 0x6c1d9d00, 0xee232300, 0xd82a7100, 0x82318700, 0xb438d500,
+ 0x6c0cd600, 0x5a058400, 0x001e7200, 0x36172000, 0xb4299e00, 0x8220cc00, 0xd83b3a00, 0xee326800,
+ 0x5a0abd00, 0x6c03ef00, 0x36181900, 0x00114b00, 0x822ff500, 0xb426a700, 0xee3d5100, 0xd8340300,
+ 0xd819ac00, 0xee10fe00, 0xb40b0800, 0x82025a00, 0x003ce400, 0x3635b600, 0x6c2e4000, 0x5a271200,
+ 0xee1fc700, 0xd8169500, 0x820d6300, 0xb4043100, 0x363a8f00, 0x0033dd00, 0x5a282b00, 0x6c217900,
+ 0xb4157a00, 0x821c2800, 0xd807de00, 0xee0e8c00, 0x6c303200, 0x5a396000, 0x00229600, 0x362bc400,
+ 0x82131100, 0xb41a4300, 0xee01b500, 0xd808e700, 0x5a365900, 0x6c3f0b00, 0x3624fd00, 0x002daf00,
+ 0x367fa300, 0x0076f100, 0x5a6d0700, 0x6c645500, 0xee5aeb00, 0xd853b900, 0x82484f00, 0xb4411d00,
+ 0x0079c800, 0x36709a00, 0x6c6b6c00, 0x5a623e00, 0xd85c8000, 0xee55d200, 0xb44e2400, 0x82477600,
+ 0x5a737500, 0x6c7a2700, 0x3661d100, 0x00688300, 0x82563d00, 0xb45f6f00, 0xee449900, 0xd84dcb00,
+ 0x6c751e00, 0x5a7c4c00, 0x0067ba00, 0x366ee800, 0xb4505600, 0x82590400, 0xd842f200, 0xee4ba000,
+ 0xee660f00, 0xd86f5d00, 0x8274ab00, 0xb47df900, 0x36434700, 0x004a1500, 0x5a51e300, 0x6c58b100,
+ 0xd8606400, 0xee693600, 0xb472c000, 0x827b9200, 0x00452c00, 0x364c7e00, 0x6c578800, 0x5a5eda00,
+ 0x826ad900, 0xb4638b00, 0xee787d00, 0xd8712f00, 0x5a4f9100, 0x6c46c300, 0x365d3500, 0x00546700,
+ 0xb46cb200, 0x8265e000, 0xd87e1600, 0xee774400, 0x6c49fa00, 0x5a40a800, 0x005b5e00, 0x36520c00,
+ 0x6cff4600, 0x5af61400, 0x00ede200, 0x36e4b000, 0xb4da0e00, 0x82d35c00, 0xd8c8aa00, 0xeec1f800,
+ 0x5af92d00, 0x6cf07f00, 0x36eb8900, 0x00e2db00, 0x82dc6500, 0xb4d53700, 0xeecec100, 0xd8c79300,
+ 0x00f39000, 0x36fac200, 0x6ce13400, 0x5ae86600, 0xd8d6d800, 0xeedf8a00, 0xb4c47c00, 0x82cd2e00,
+ 0x36f5fb00, 0x00fca900, 0x5ae75f00, 0x6cee0d00, 0xeed0b300, 0xd8d9e100, 0x82c21700, 0xb4cb4500,
+ 0xb4e6ea00, 0x82efb800, 0xd8f44e00, 0xeefd1c00, 0x6cc3a200, 0x5acaf000, 0x00d10600, 0x36d85400,
+ 0x82e08100, 0xb4e9d300, 0xeef22500, 0xd8fb7700, 0x5ac5c900, 0x6ccc9b00, 0x36d76d00, 0x00de3f00,
+ 0xd8ea3c00, 0xeee36e00, 0xb4f89800, 0x82f1ca00, 0x00cf7400, 0x36c62600, 0x6cddd000, 0x5ad48200,
+ 0xeeec5700, 0xd8e50500, 0x82fef300, 0xb4f7a100, 0x36c91f00, 0x00c04d00, 0x5adbbb00, 0x6cd2e900,
+ 0x5a80e500, 0x6c89b700, 0x36924100, 0x009b1300, 0x82a5ad00, 0xb4acff00, 0xeeb70900, 0xd8be5b00,
+ 0x6c868e00, 0x5a8fdc00, 0x00942a00, 0x369d7800, 0xb4a3c600, 0x82aa9400, 0xd8b16200, 0xeeb83000,
+ 0x368c3300, 0x00856100, 0x5a9e9700, 0x6c97c500, 0xeea97b00, 0xd8a02900, 0x82bbdf00, 0xb4b28d00,
+ 0x008a5800, 0x36830a00, 0x6c98fc00, 0x5a91ae00, 0xd8af1000, 0xeea64200, 0xb4bdb400, 0x82b4e600,
+ 0x82994900, 0xb4901b00, 0xee8bed00, 0xd882bf00, 0x5abc0100, 0x6cb55300, 0x36aea500, 0x00a7f700,
+ 0xb49f2200, 0x82967000, 0xd88d8600, 0xee84d400, 0x6cba6a00, 0x5ab33800, 0x00a8ce00, 0x36a19c00,
+ 0xee959f00, 0xd89ccd00, 0x82873b00, 0xb48e6900, 0x36b0d700, 0x00b98500, 0x5aa27300, 0x6cab2100,
+ 0xd893f400, 0xee9aa600, 0xb4815000, 0x82880200, 0x00b6bc00, 0x36bfee00, 0x6ca41800, 0x5aad4a00,
+ 0x00000000, 0xd9fe8c00, 0x35b1e300, 0xec4f6f00, 0x6b63c600, 0xb29d4a00, 0x5ed22500, 0x872ca900,
+ 0xd6c78c00, 0x0f390000, 0xe3766f00, 0x3a88e300, 0xbda44a00, 0x645ac600, 0x8815a900, 0x51eb2500,
+ 0x2bc3e300, 0xf23d6f00, 0x1e720000, 0xc78c8c00, 0x40a02500, 0x995ea900, 0x7511c600, 0xacef4a00,
+ 0xfd046f00, 0x24fae300, 0xc8b58c00, 0x114b0000, 0x9667a900, 0x4f992500, 0xa3d64a00, 0x7a28c600,
+ 0x5787c600, 0x8e794a00, 0x62362500, 0xbbc8a900, 0x3ce40000, 0xe51a8c00, 0x0955e300, 0xd0ab6f00,
+ 0x81404a00, 0x58bec600, 0xb4f1a900, 0x6d0f2500, 0xea238c00, 0x33dd0000, 0xdf926f00, 0x066ce300,
+ 0x7c442500, 0xa5baa900, 0x49f5c600, 0x900b4a00, 0x1727e300, 0xced96f00, 0x22960000, 0xfb688c00,
+ 0xaa83a900, 0x737d2500, 0x9f324a00, 0x46ccc600, 0xc1e06f00, 0x181ee300, 0xf4518c00, 0x2daf0000,
+ 0xaf0f8c00, 0x76f10000, 0x9abe6f00, 0x4340e300, 0xc46c4a00, 0x1d92c600, 0xf1dda900, 0x28232500,
+ 0x79c80000, 0xa0368c00, 0x4c79e300, 0x95876f00, 0x12abc600, 0xcb554a00, 0x271a2500, 0xfee4a900,
+ 0x84cc6f00, 0x5d32e300, 0xb17d8c00, 0x68830000, 0xefafa900, 0x36512500, 0xda1e4a00, 0x03e0c600,
+ 0x520be300, 0x8bf56f00, 0x67ba0000, 0xbe448c00, 0x39682500, 0xe096a900, 0x0cd9c600, 0xd5274a00,
+ 0xf8884a00, 0x2176c600, 0xcd39a900, 0x14c72500, 0x93eb8c00, 0x4a150000, 0xa65a6f00, 0x7fa4e300,
+ 0x2e4fc600, 0xf7b14a00, 0x1bfe2500, 0xc200a900, 0x452c0000, 0x9cd28c00, 0x709de300, 0xa9636f00,
+ 0xd34ba900, 0x0ab52500, 0xe6fa4a00, 0x3f04c600, 0xb8286f00, 0x61d6e300, 0x8d998c00, 0x54670000,
+ 0x058c2500, 0xdc72a900, 0x303dc600, 0xe9c34a00, 0x6eefe300, 0xb7116f00, 0x5b5e0000, 0x82a08c00,
+ 0xd853e300, 0x01ad6f00, 0xede20000, 0x341c8c00, 0xb3302500, 0x6acea900, 0x8681c600, 0x5f7f4a00,
+ 0x0e946f00, 0xd76ae300, 0x3b258c00, 0xe2db0000, 0x65f7a900, 0xbc092500, 0x50464a00, 0x89b8c600,
+ 0xf3900000, 0x2a6e8c00, 0xc621e300, 0x1fdf6f00, 0x98f3c600, 0x410d4a00, 0xad422500, 0x74bca900,
+ 0x25578c00, 0xfca90000, 0x10e66f00, 0xc918e300, 0x4e344a00, 0x97cac600, 0x7b85a900, 0xa27b2500,
+ 0x8fd42500, 0x562aa900, 0xba65c600, 0x639b4a00, 0xe4b7e300, 0x3d496f00, 0xd1060000, 0x08f88c00,
+ 0x5913a900, 0x80ed2500, 0x6ca24a00, 0xb55cc600, 0x32706f00, 0xeb8ee300, 0x07c18c00, 0xde3f0000,
+ 0xa417c600, 0x7de94a00, 0x91a62500, 0x4858a900, 0xcf740000, 0x168a8c00, 0xfac5e300, 0x233b6f00,
+ 0x72d04a00, 0xab2ec600, 0x4761a900, 0x9e9f2500, 0x19b38c00, 0xc04d0000, 0x2c026f00, 0xf5fce300,
+ 0x775c6f00, 0xaea2e300, 0x42ed8c00, 0x9b130000, 0x1c3fa900, 0xc5c12500, 0x298e4a00, 0xf070c600,
+ 0xa19be300, 0x78656f00, 0x942a0000, 0x4dd48c00, 0xcaf82500, 0x1306a900, 0xff49c600, 0x26b74a00,
+ 0x5c9f8c00, 0x85610000, 0x692e6f00, 0xb0d0e300, 0x37fc4a00, 0xee02c600, 0x024da900, 0xdbb32500,
+ 0x8a580000, 0x53a68c00, 0xbfe9e300, 0x66176f00, 0xe13bc600, 0x38c54a00, 0xd48a2500, 0x0d74a900,
+ 0x20dba900, 0xf9252500, 0x156a4a00, 0xcc94c600, 0x4bb86f00, 0x9246e300, 0x7e098c00, 0xa7f70000,
+ 0xf61c2500, 0x2fe2a900, 0xc3adc600, 0x1a534a00, 0x9d7fe300, 0x44816f00, 0xa8ce0000, 0x71308c00,
+ 0x0b184a00, 0xd2e6c600, 0x3ea9a900, 0xe7572500, 0x607b8c00, 0xb9850000, 0x55ca6f00, 0x8c34e300,
+ 0xdddfc600, 0x04214a00, 0xe86e2500, 0x3190a900, 0xb6bc0000, 0x6f428c00, 0x830de300, 0x5af36f00,
+ 0x00000000, 0x36eb3d00, 0x6dd67a00, 0x5b3d4700, 0xdbacf400, 0xed47c900, 0xb67a8e00, 0x8091b300,
+ 0x31151300, 0x07fe2e00, 0x5cc36900, 0x6a285400, 0xeab9e700, 0xdc52da00, 0x876f9d00, 0xb184a000,
+ 0x622a2600, 0x54c11b00, 0x0ffc5c00, 0x39176100, 0xb986d200, 0x8f6def00, 0xd450a800, 0xe2bb9500,
+ 0x533f3500, 0x65d40800, 0x3ee94f00, 0x08027200, 0x8893c100, 0xbe78fc00, 0xe545bb00, 0xd3ae8600,
+ 0xc4544c00, 0xf2bf7100, 0xa9823600, 0x9f690b00, 0x1ff8b800, 0x29138500, 0x722ec200, 0x44c5ff00,
+ 0xf5415f00, 0xc3aa6200, 0x98972500, 0xae7c1800, 0x2eedab00, 0x18069600, 0x433bd100, 0x75d0ec00,
+ 0xa67e6a00, 0x90955700, 0xcba81000, 0xfd432d00, 0x7dd29e00, 0x4b39a300, 0x1004e400, 0x26efd900,
+ 0x976b7900, 0xa1804400, 0xfabd0300, 0xcc563e00, 0x4cc78d00, 0x7a2cb000, 0x2111f700, 0x17faca00,
+ 0x0ee46300, 0x380f5e00, 0x63321900, 0x55d92400, 0xd5489700, 0xe3a3aa00, 0xb89eed00, 0x8e75d000,
+ 0x3ff17000, 0x091a4d00, 0x52270a00, 0x64cc3700, 0xe45d8400, 0xd2b6b900, 0x898bfe00, 0xbf60c300,
+ 0x6cce4500, 0x5a257800, 0x01183f00, 0x37f30200, 0xb762b100, 0x81898c00, 0xdab4cb00, 0xec5ff600,
+ 0x5ddb5600, 0x6b306b00, 0x300d2c00, 0x06e61100, 0x8677a200, 0xb09c9f00, 0xeba1d800, 0xdd4ae500,
+ 0xcab02f00, 0xfc5b1200, 0xa7665500, 0x918d6800, 0x111cdb00, 0x27f7e600, 0x7ccaa100, 0x4a219c00,
+ 0xfba53c00, 0xcd4e0100, 0x96734600, 0xa0987b00, 0x2009c800, 0x16e2f500, 0x4ddfb200, 0x7b348f00,
+ 0xa89a0900, 0x9e713400, 0xc54c7300, 0xf3a74e00, 0x7336fd00, 0x45ddc000, 0x1ee08700, 0x280bba00,
+ 0x998f1a00, 0xaf642700, 0xf4596000, 0xc2b25d00, 0x4223ee00, 0x74c8d300, 0x2ff59400, 0x191ea900,
+ 0x1dc8c600, 0x2b23fb00, 0x701ebc00, 0x46f58100, 0xc6643200, 0xf08f0f00, 0xabb24800, 0x9d597500,
+ 0x2cddd500, 0x1a36e800, 0x410baf00, 0x77e09200, 0xf7712100, 0xc19a1c00, 0x9aa75b00, 0xac4c6600,
+ 0x7fe2e000, 0x4909dd00, 0x12349a00, 0x24dfa700, 0xa44e1400, 0x92a52900, 0xc9986e00, 0xff735300,
+ 0x4ef7f300, 0x781cce00, 0x23218900, 0x15cab400, 0x955b0700, 0xa3b03a00, 0xf88d7d00, 0xce664000,
+ 0xd99c8a00, 0xef77b700, 0xb44af000, 0x82a1cd00, 0x02307e00, 0x34db4300, 0x6fe60400, 0x590d3900,
+ 0xe8899900, 0xde62a400, 0x855fe300, 0xb3b4de00, 0x33256d00, 0x05ce5000, 0x5ef31700, 0x68182a00,
+ 0xbbb6ac00, 0x8d5d9100, 0xd660d600, 0xe08beb00, 0x601a5800, 0x56f16500, 0x0dcc2200, 0x3b271f00,
+ 0x8aa3bf00, 0xbc488200, 0xe775c500, 0xd19ef800, 0x510f4b00, 0x67e47600, 0x3cd93100, 0x0a320c00,
+ 0x132ca500, 0x25c79800, 0x7efadf00, 0x4811e200, 0xc8805100, 0xfe6b6c00, 0xa5562b00, 0x93bd1600,
+ 0x2239b600, 0x14d28b00, 0x4fefcc00, 0x7904f100, 0xf9954200, 0xcf7e7f00, 0x94433800, 0xa2a80500,
+ 0x71068300, 0x47edbe00, 0x1cd0f900, 0x2a3bc400, 0xaaaa7700, 0x9c414a00, 0xc77c0d00, 0xf1973000,
+ 0x40139000, 0x76f8ad00, 0x2dc5ea00, 0x1b2ed700, 0x9bbf6400, 0xad545900, 0xf6691e00, 0xc0822300,
+ 0xd778e900, 0xe193d400, 0xbaae9300, 0x8c45ae00, 0x0cd41d00, 0x3a3f2000, 0x61026700, 0x57e95a00,
+ 0xe66dfa00, 0xd086c700, 0x8bbb8000, 0xbd50bd00, 0x3dc10e00, 0x0b2a3300, 0x50177400, 0x66fc4900,
+ 0xb552cf00, 0x83b9f200, 0xd884b500, 0xee6f8800, 0x6efe3b00, 0x58150600, 0x03284100, 0x35c37c00,
+ 0x8447dc00, 0xb2ace100, 0xe991a600, 0xdf7a9b00, 0x5feb2800, 0x69001500, 0x323d5200, 0x04d66f00,
+ 0x00000000, 0x3b918c00, 0x77231800, 0x4cb29400, 0xee463000, 0xd5d7bc00, 0x99652800, 0xa2f4a400,
+ 0x5ac09b00, 0x61511700, 0x2de38300, 0x16720f00, 0xb486ab00, 0x8f172700, 0xc3a5b300, 0xf8343f00,
+ 0xb5813600, 0x8e10ba00, 0xc2a22e00, 0xf933a200, 0x5bc70600, 0x60568a00, 0x2ce41e00, 0x17759200,
+ 0xef41ad00, 0xd4d02100, 0x9862b500, 0xa3f33900, 0x01079d00, 0x3a961100, 0x76248500, 0x4db50900,
+ 0xed4e9700, 0xd6df1b00, 0x9a6d8f00, 0xa1fc0300, 0x0308a700, 0x38992b00, 0x742bbf00, 0x4fba3300,
+ 0xb78e0c00, 0x8c1f8000, 0xc0ad1400, 0xfb3c9800, 0x59c83c00, 0x6259b000, 0x2eeb2400, 0x157aa800,
+ 0x58cfa100, 0x635e2d00, 0x2fecb900, 0x147d3500, 0xb6899100, 0x8d181d00, 0xc1aa8900, 0xfa3b0500,
+ 0x020f3a00, 0x399eb600, 0x752c2200, 0x4ebdae00, 0xec490a00, 0xd7d88600, 0x9b6a1200, 0xa0fb9e00,
+ 0x5cd1d500, 0x67405900, 0x2bf2cd00, 0x10634100, 0xb297e500, 0x89066900, 0xc5b4fd00, 0xfe257100,
+ 0x06114e00, 0x3d80c200, 0x71325600, 0x4aa3da00, 0xe8577e00, 0xd3c6f200, 0x9f746600, 0xa4e5ea00,
+ 0xe950e300, 0xd2c16f00, 0x9e73fb00, 0xa5e27700, 0x0716d300, 0x3c875f00, 0x7035cb00, 0x4ba44700,
+ 0xb3907800, 0x8801f400, 0xc4b36000, 0xff22ec00, 0x5dd64800, 0x6647c400, 0x2af55000, 0x1164dc00,
+ 0xb19f4200, 0x8a0ece00, 0xc6bc5a00, 0xfd2dd600, 0x5fd97200, 0x6448fe00, 0x28fa6a00, 0x136be600,
+ 0xeb5fd900, 0xd0ce5500, 0x9c7cc100, 0xa7ed4d00, 0x0519e900, 0x3e886500, 0x723af100, 0x49ab7d00,
+ 0x041e7400, 0x3f8ff800, 0x733d6c00, 0x48ace000, 0xea584400, 0xd1c9c800, 0x9d7b5c00, 0xa6ead000,
+ 0x5edeef00, 0x654f6300, 0x29fdf700, 0x126c7b00, 0xb098df00, 0x8b095300, 0xc7bbc700, 0xfc2a4b00,
+ 0xb9a3aa00, 0x82322600, 0xce80b200, 0xf5113e00, 0x57e59a00, 0x6c741600, 0x20c68200, 0x1b570e00,
+ 0xe3633100, 0xd8f2bd00, 0x94402900, 0xafd1a500, 0x0d250100, 0x36b48d00, 0x7a061900, 0x41979500,
+ 0x0c229c00, 0x37b31000, 0x7b018400, 0x40900800, 0xe264ac00, 0xd9f52000, 0x9547b400, 0xaed63800,
+ 0x56e20700, 0x6d738b00, 0x21c11f00, 0x1a509300, 0xb8a43700, 0x8335bb00, 0xcf872f00, 0xf416a300,
+ 0x54ed3d00, 0x6f7cb100, 0x23ce2500, 0x185fa900, 0xbaab0d00, 0x813a8100, 0xcd881500, 0xf6199900,
+ 0x0e2da600, 0x35bc2a00, 0x790ebe00, 0x429f3200, 0xe06b9600, 0xdbfa1a00, 0x97488e00, 0xacd90200,
+ 0xe16c0b00, 0xdafd8700, 0x964f1300, 0xadde9f00, 0x0f2a3b00, 0x34bbb700, 0x78092300, 0x4398af00,
+ 0xbbac9000, 0x803d1c00, 0xcc8f8800, 0xf71e0400, 0x55eaa000, 0x6e7b2c00, 0x22c9b800, 0x19583400,
+ 0xe5727f00, 0xdee3f300, 0x92516700, 0xa9c0eb00, 0x0b344f00, 0x30a5c300, 0x7c175700, 0x4786db00,
+ 0xbfb2e400, 0x84236800, 0xc891fc00, 0xf3007000, 0x51f4d400, 0x6a655800, 0x26d7cc00, 0x1d464000,
+ 0x50f34900, 0x6b62c500, 0x27d05100, 0x1c41dd00, 0xbeb57900, 0x8524f500, 0xc9966100, 0xf207ed00,
+ 0x0a33d200, 0x31a25e00, 0x7d10ca00, 0x46814600, 0xe475e200, 0xdfe46e00, 0x9356fa00, 0xa8c77600,
+ 0x083ce800, 0x33ad6400, 0x7f1ff000, 0x448e7c00, 0xe67ad800, 0xddeb5400, 0x9159c000, 0xaac84c00,
+ 0x52fc7300, 0x696dff00, 0x25df6b00, 0x1e4ee700, 0xbcba4300, 0x872bcf00, 0xcb995b00, 0xf008d700,
+ 0xbdbdde00, 0x862c5200, 0xca9ec600, 0xf10f4a00, 0x53fbee00, 0x686a6200, 0x24d8f600, 0x1f497a00,
+ 0xe77d4500, 0xdcecc900, 0x905e5d00, 0xabcfd100, 0x093b7500, 0x32aaf900, 0x7e186d00, 0x4589e100,
+ 0x00000000, 0xf50baf00, 0x6c5ba500, 0x99500a00, 0xd8b74a00, 0x2dbce500, 0xb4ecef00, 0x41e74000,
+ 0x37226f00, 0xc229c000, 0x5b79ca00, 0xae726500, 0xef952500, 0x1a9e8a00, 0x83ce8000, 0x76c52f00,
+ 0x6e44de00, 0x9b4f7100, 0x021f7b00, 0xf714d400, 0xb6f39400, 0x43f83b00, 0xdaa83100, 0x2fa39e00,
+ 0x5966b100, 0xac6d1e00, 0x353d1400, 0xc036bb00, 0x81d1fb00, 0x74da5400, 0xed8a5e00, 0x1881f100,
+ 0xdc89bc00, 0x29821300, 0xb0d21900, 0x45d9b600, 0x043ef600, 0xf1355900, 0x68655300, 0x9d6efc00,
+ 0xebabd300, 0x1ea07c00, 0x87f07600, 0x72fbd900, 0x331c9900, 0xc6173600, 0x5f473c00, 0xaa4c9300,
+ 0xb2cd6200, 0x47c6cd00, 0xde96c700, 0x2b9d6800, 0x6a7a2800, 0x9f718700, 0x06218d00, 0xf32a2200,
+ 0x85ef0d00, 0x70e4a200, 0xe9b4a800, 0x1cbf0700, 0x5d584700, 0xa853e800, 0x3103e200, 0xc4084d00,
+ 0x3f5f8300, 0xca542c00, 0x53042600, 0xa60f8900, 0xe7e8c900, 0x12e36600, 0x8bb36c00, 0x7eb8c300,
+ 0x087dec00, 0xfd764300, 0x64264900, 0x912de600, 0xd0caa600, 0x25c10900, 0xbc910300, 0x499aac00,
+ 0x511b5d00, 0xa410f200, 0x3d40f800, 0xc84b5700, 0x89ac1700, 0x7ca7b800, 0xe5f7b200, 0x10fc1d00,
+ 0x66393200, 0x93329d00, 0x0a629700, 0xff693800, 0xbe8e7800, 0x4b85d700, 0xd2d5dd00, 0x27de7200,
+ 0xe3d63f00, 0x16dd9000, 0x8f8d9a00, 0x7a863500, 0x3b617500, 0xce6ada00, 0x573ad000, 0xa2317f00,
+ 0xd4f45000, 0x21ffff00, 0xb8aff500, 0x4da45a00, 0x0c431a00, 0xf948b500, 0x6018bf00, 0x95131000,
+ 0x8d92e100, 0x78994e00, 0xe1c94400, 0x14c2eb00, 0x5525ab00, 0xa02e0400, 0x397e0e00, 0xcc75a100,
+ 0xbab08e00, 0x4fbb2100, 0xd6eb2b00, 0x23e08400, 0x6207c400, 0x970c6b00, 0x0e5c6100, 0xfb57ce00,
+ 0x7ebf0600, 0x8bb4a900, 0x12e4a300, 0xe7ef0c00, 0xa6084c00, 0x5303e300, 0xca53e900, 0x3f584600,
+ 0x499d6900, 0xbc96c600, 0x25c6cc00, 0xd0cd6300, 0x912a2300, 0x64218c00, 0xfd718600, 0x087a2900,
+ 0x10fbd800, 0xe5f07700, 0x7ca07d00, 0x89abd200, 0xc84c9200, 0x3d473d00, 0xa4173700, 0x511c9800,
+ 0x27d9b700, 0xd2d21800, 0x4b821200, 0xbe89bd00, 0xff6efd00, 0x0a655200, 0x93355800, 0x663ef700,
+ 0xa236ba00, 0x573d1500, 0xce6d1f00, 0x3b66b000, 0x7a81f000, 0x8f8a5f00, 0x16da5500, 0xe3d1fa00,
+ 0x9514d500, 0x601f7a00, 0xf94f7000, 0x0c44df00, 0x4da39f00, 0xb8a83000, 0x21f83a00, 0xd4f39500,
+ 0xcc726400, 0x3979cb00, 0xa029c100, 0x55226e00, 0x14c52e00, 0xe1ce8100, 0x789e8b00, 0x8d952400,
+ 0xfb500b00, 0x0e5ba400, 0x970bae00, 0x62000100, 0x23e74100, 0xd6ecee00, 0x4fbce400, 0xbab74b00,
+ 0x41e08500, 0xb4eb2a00, 0x2dbb2000, 0xd8b08f00, 0x9957cf00, 0x6c5c6000, 0xf50c6a00, 0x0007c500,
+ 0x76c2ea00, 0x83c94500, 0x1a994f00, 0xef92e000, 0xae75a000, 0x5b7e0f00, 0xc22e0500, 0x3725aa00,
+ 0x2fa45b00, 0xdaaff400, 0x43fffe00, 0xb6f45100, 0xf7131100, 0x0218be00, 0x9b48b400, 0x6e431b00,
+ 0x18863400, 0xed8d9b00, 0x74dd9100, 0x81d63e00, 0xc0317e00, 0x353ad100, 0xac6adb00, 0x59617400,
+ 0x9d693900, 0x68629600, 0xf1329c00, 0x04393300, 0x45de7300, 0xb0d5dc00, 0x2985d600, 0xdc8e7900,
+ 0xaa4b5600, 0x5f40f900, 0xc610f300, 0x331b5c00, 0x72fc1c00, 0x87f7b300, 0x1ea7b900, 0xebac1600,
+ 0xf32de700, 0x06264800, 0x9f764200, 0x6a7ded00, 0x2b9aad00, 0xde910200, 0x47c10800, 0xb2caa700,
+ 0xc40f8800, 0x31042700, 0xa8542d00, 0x5d5f8200, 0x1cb8c200, 0xe9b36d00, 0x70e36700, 0x85e8c800,
+};
+
+const uint64_t crc64_42f0e1eba9ea3693_crc_table[CRC_SLICES * 256] = {
+ 0x0000000000000000, 0x42f0e1eba9ea3693, 0x85e1c3d753d46d26, 0xc711223cfa3e5bb5,
+ 0x493366450e42ecdf, 0x0bc387aea7a8da4c, 0xccd2a5925d9681f9, 0x8e224479f47cb76a,
+ 0x9266cc8a1c85d9be, 0xd0962d61b56fef2d, 0x17870f5d4f51b498, 0x5577eeb6e6bb820b,
+ 0xdb55aacf12c73561, 0x99a54b24bb2d03f2, 0x5eb4691841135847, 0x1c4488f3e8f96ed4,
+ 0x663d78ff90e185ef, 0x24cd9914390bb37c, 0xe3dcbb28c335e8c9, 0xa12c5ac36adfde5a,
+ 0x2f0e1eba9ea36930, 0x6dfeff5137495fa3, 0xaaefdd6dcd770416, 0xe81f3c86649d3285,
+ 0xf45bb4758c645c51, 0xb6ab559e258e6ac2, 0x71ba77a2dfb03177, 0x334a9649765a07e4,
+ 0xbd68d2308226b08e, 0xff9833db2bcc861d, 0x388911e7d1f2dda8, 0x7a79f00c7818eb3b,
+ 0xcc7af1ff21c30bde, 0x8e8a101488293d4d, 0x499b3228721766f8, 0x0b6bd3c3dbfd506b,
+ 0x854997ba2f81e701, 0xc7b97651866bd192, 0x00a8546d7c558a27, 0x4258b586d5bfbcb4,
+ 0x5e1c3d753d46d260, 0x1cecdc9e94ace4f3, 0xdbfdfea26e92bf46, 0x990d1f49c77889d5,
+ 0x172f5b3033043ebf, 0x55dfbadb9aee082c, 0x92ce98e760d05399, 0xd03e790cc93a650a,
+ 0xaa478900b1228e31, 0xe8b768eb18c8b8a2, 0x2fa64ad7e2f6e317, 0x6d56ab3c4b1cd584,
+ 0xe374ef45bf6062ee, 0xa1840eae168a547d, 0x66952c92ecb40fc8, 0x2465cd79455e395b,
+ 0x3821458aada7578f, 0x7ad1a461044d611c, 0xbdc0865dfe733aa9, 0xff3067b657990c3a,
+ 0x711223cfa3e5bb50, 0x33e2c2240a0f8dc3, 0xf4f3e018f031d676, 0xb60301f359dbe0e5,
+ 0xda050215ea6c212f, 0x98f5e3fe438617bc, 0x5fe4c1c2b9b84c09, 0x1d14202910527a9a,
+ 0x93366450e42ecdf0, 0xd1c685bb4dc4fb63, 0x16d7a787b7faa0d6, 0x5427466c1e109645,
+ 0x4863ce9ff6e9f891, 0x0a932f745f03ce02, 0xcd820d48a53d95b7, 0x8f72eca30cd7a324,
+ 0x0150a8daf8ab144e, 0x43a04931514122dd, 0x84b16b0dab7f7968, 0xc6418ae602954ffb,
+ 0xbc387aea7a8da4c0, 0xfec89b01d3679253, 0x39d9b93d2959c9e6, 0x7b2958d680b3ff75,
+ 0xf50b1caf74cf481f, 0xb7fbfd44dd257e8c, 0x70eadf78271b2539, 0x321a3e938ef113aa,
+ 0x2e5eb66066087d7e, 0x6cae578bcfe24bed, 0xabbf75b735dc1058, 0xe94f945c9c3626cb,
+ 0x676dd025684a91a1, 0x259d31cec1a0a732, 0xe28c13f23b9efc87, 0xa07cf2199274ca14,
+ 0x167ff3eacbaf2af1, 0x548f120162451c62, 0x939e303d987b47d7, 0xd16ed1d631917144,
+ 0x5f4c95afc5edc62e, 0x1dbc74446c07f0bd, 0xdaad56789639ab08, 0x985db7933fd39d9b,
+ 0x84193f60d72af34f, 0xc6e9de8b7ec0c5dc, 0x01f8fcb784fe9e69, 0x43081d5c2d14a8fa,
+ 0xcd2a5925d9681f90, 0x8fdab8ce70822903, 0x48cb9af28abc72b6, 0x0a3b7b1923564425,
+ 0x70428b155b4eaf1e, 0x32b26afef2a4998d, 0xf5a348c2089ac238, 0xb753a929a170f4ab,
+ 0x3971ed50550c43c1, 0x7b810cbbfce67552, 0xbc902e8706d82ee7, 0xfe60cf6caf321874,
+ 0xe224479f47cb76a0, 0xa0d4a674ee214033, 0x67c58448141f1b86, 0x253565a3bdf52d15,
+ 0xab1721da49899a7f, 0xe9e7c031e063acec, 0x2ef6e20d1a5df759, 0x6c0603e6b3b7c1ca,
+ 0xf6fae5c07d3274cd, 0xb40a042bd4d8425e, 0x731b26172ee619eb, 0x31ebc7fc870c2f78,
+ 0xbfc9838573709812, 0xfd39626eda9aae81, 0x3a28405220a4f534, 0x78d8a1b9894ec3a7,
+ 0x649c294a61b7ad73, 0x266cc8a1c85d9be0, 0xe17dea9d3263c055, 0xa38d0b769b89f6c6,
+ 0x2daf4f0f6ff541ac, 0x6f5faee4c61f773f, 0xa84e8cd83c212c8a, 0xeabe6d3395cb1a19,
+ 0x90c79d3fedd3f122, 0xd2377cd44439c7b1, 0x15265ee8be079c04, 0x57d6bf0317edaa97,
+ 0xd9f4fb7ae3911dfd, 0x9b041a914a7b2b6e, 0x5c1538adb04570db, 0x1ee5d94619af4648,
+ 0x02a151b5f156289c, 0x4051b05e58bc1e0f, 0x87409262a28245ba, 0xc5b073890b687329,
+ 0x4b9237f0ff14c443, 0x0962d61b56fef2d0, 0xce73f427acc0a965, 0x8c8315cc052a9ff6,
+ 0x3a80143f5cf17f13, 0x7870f5d4f51b4980, 0xbf61d7e80f251235, 0xfd913603a6cf24a6,
+ 0x73b3727a52b393cc, 0x31439391fb59a55f, 0xf652b1ad0167feea, 0xb4a25046a88dc879,
+ 0xa8e6d8b54074a6ad, 0xea16395ee99e903e, 0x2d071b6213a0cb8b, 0x6ff7fa89ba4afd18,
+ 0xe1d5bef04e364a72, 0xa3255f1be7dc7ce1, 0x64347d271de22754, 0x26c49cccb40811c7,
+ 0x5cbd6cc0cc10fafc, 0x1e4d8d2b65facc6f, 0xd95caf179fc497da, 0x9bac4efc362ea149,
+ 0x158e0a85c2521623, 0x577eeb6e6bb820b0, 0x906fc95291867b05, 0xd29f28b9386c4d96,
+ 0xcedba04ad0952342, 0x8c2b41a1797f15d1, 0x4b3a639d83414e64, 0x09ca82762aab78f7,
+ 0x87e8c60fded7cf9d, 0xc51827e4773df90e, 0x020905d88d03a2bb, 0x40f9e43324e99428,
+ 0x2cffe7d5975e55e2, 0x6e0f063e3eb46371, 0xa91e2402c48a38c4, 0xebeec5e96d600e57,
+ 0x65cc8190991cb93d, 0x273c607b30f68fae, 0xe02d4247cac8d41b, 0xa2dda3ac6322e288,
+ 0xbe992b5f8bdb8c5c, 0xfc69cab42231bacf, 0x3b78e888d80fe17a, 0x7988096371e5d7e9,
+ 0xf7aa4d1a85996083, 0xb55aacf12c735610, 0x724b8ecdd64d0da5, 0x30bb6f267fa73b36,
+ 0x4ac29f2a07bfd00d, 0x08327ec1ae55e69e, 0xcf235cfd546bbd2b, 0x8dd3bd16fd818bb8,
+ 0x03f1f96f09fd3cd2, 0x41011884a0170a41, 0x86103ab85a2951f4, 0xc4e0db53f3c36767,
+ 0xd8a453a01b3a09b3, 0x9a54b24bb2d03f20, 0x5d45907748ee6495, 0x1fb5719ce1045206,
+ 0x919735e51578e56c, 0xd367d40ebc92d3ff, 0x1476f63246ac884a, 0x568617d9ef46bed9,
+ 0xe085162ab69d5e3c, 0xa275f7c11f7768af, 0x6564d5fde549331a, 0x279434164ca30589,
+ 0xa9b6706fb8dfb2e3, 0xeb46918411358470, 0x2c57b3b8eb0bdfc5, 0x6ea7525342e1e956,
+ 0x72e3daa0aa188782, 0x30133b4b03f2b111, 0xf7021977f9cceaa4, 0xb5f2f89c5026dc37,
+ 0x3bd0bce5a45a6b5d, 0x79205d0e0db05dce, 0xbe317f32f78e067b, 0xfcc19ed95e6430e8,
+ 0x86b86ed5267cdbd3, 0xc4488f3e8f96ed40, 0x0359ad0275a8b6f5, 0x41a94ce9dc428066,
+ 0xcf8b0890283e370c, 0x8d7be97b81d4019f, 0x4a6acb477bea5a2a, 0x089a2aacd2006cb9,
+ 0x14dea25f3af9026d, 0x562e43b4931334fe, 0x913f6188692d6f4b, 0xd3cf8063c0c759d8,
+ 0x5dedc41a34bbeeb2, 0x1f1d25f19d51d821, 0xd80c07cd676f8394, 0x9afce626ce85b507,
+ 0x0000000000000000, 0xaf052a6b538edf09, 0x1cfab53d0ef78881, 0xb3ff9f565d795788,
+ 0x39f56a7a1def1102, 0x96f040114e61ce0b, 0x250fdf4713189983, 0x8a0af52c4096468a,
+ 0x73ead4f43bde2204, 0xdceffe9f6850fd0d, 0x6f1061c93529aa85, 0xc0154ba266a7758c,
+ 0x4a1fbe8e26313306, 0xe51a94e575bfec0f, 0x56e50bb328c6bb87, 0xf9e021d87b48648e,
+ 0xe7d5a9e877bc4408, 0x48d0838324329b01, 0xfb2f1cd5794bcc89, 0x542a36be2ac51380,
+ 0xde20c3926a53550a, 0x7125e9f939dd8a03, 0xc2da76af64a4dd8b, 0x6ddf5cc4372a0282,
+ 0x943f7d1c4c62660c, 0x3b3a57771fecb905, 0x88c5c8214295ee8d, 0x27c0e24a111b3184,
+ 0xadca1766518d770e, 0x02cf3d0d0203a807, 0xb130a25b5f7aff8f, 0x1e3588300cf42086,
+ 0x8d5bb23b4692be83, 0x225e9850151c618a, 0x91a1070648653602, 0x3ea42d6d1bebe90b,
+ 0xb4aed8415b7daf81, 0x1babf22a08f37088, 0xa8546d7c558a2700, 0x075147170604f809,
+ 0xfeb166cf7d4c9c87, 0x51b44ca42ec2438e, 0xe24bd3f273bb1406, 0x4d4ef9992035cb0f,
+ 0xc7440cb560a38d85, 0x684126de332d528c, 0xdbbeb9886e540504, 0x74bb93e33ddada0d,
+ 0x6a8e1bd3312efa8b, 0xc58b31b862a02582, 0x7674aeee3fd9720a, 0xd97184856c57ad03,
+ 0x537b71a92cc1eb89, 0xfc7e5bc27f4f3480, 0x4f81c49422366308, 0xe084eeff71b8bc01,
+ 0x1964cf270af0d88f, 0xb661e54c597e0786, 0x059e7a1a0407500e, 0xaa9b507157898f07,
+ 0x2091a55d171fc98d, 0x8f948f3644911684, 0x3c6b106019e8410c, 0x936e3a0b4a669e05,
+ 0x5847859d24cf4b95, 0xf742aff67741949c, 0x44bd30a02a38c314, 0xebb81acb79b61c1d,
+ 0x61b2efe739205a97, 0xceb7c58c6aae859e, 0x7d485ada37d7d216, 0xd24d70b164590d1f,
+ 0x2bad51691f116991, 0x84a87b024c9fb698, 0x3757e45411e6e110, 0x9852ce3f42683e19,
+ 0x12583b1302fe7893, 0xbd5d11785170a79a, 0x0ea28e2e0c09f012, 0xa1a7a4455f872f1b,
+ 0xbf922c7553730f9d, 0x1097061e00fdd094, 0xa36899485d84871c, 0x0c6db3230e0a5815,
+ 0x8667460f4e9c1e9f, 0x29626c641d12c196, 0x9a9df332406b961e, 0x3598d95913e54917,
+ 0xcc78f88168ad2d99, 0x637dd2ea3b23f290, 0xd0824dbc665aa518, 0x7f8767d735d47a11,
+ 0xf58d92fb75423c9b, 0x5a88b89026cce392, 0xe97727c67bb5b41a, 0x46720dad283b6b13,
+ 0xd51c37a6625df516, 0x7a191dcd31d32a1f, 0xc9e6829b6caa7d97, 0x66e3a8f03f24a29e,
+ 0xece95ddc7fb2e414, 0x43ec77b72c3c3b1d, 0xf013e8e171456c95, 0x5f16c28a22cbb39c,
+ 0xa6f6e3525983d712, 0x09f3c9390a0d081b, 0xba0c566f57745f93, 0x15097c0404fa809a,
+ 0x9f038928446cc610, 0x3006a34317e21919, 0x83f93c154a9b4e91, 0x2cfc167e19159198,
+ 0x32c99e4e15e1b11e, 0x9dccb425466f6e17, 0x2e332b731b16399f, 0x813601184898e696,
+ 0x0b3cf434080ea01c, 0xa439de5f5b807f15, 0x17c6410906f9289d, 0xb8c36b625577f794,
+ 0x41234aba2e3f931a, 0xee2660d17db14c13, 0x5dd9ff8720c81b9b, 0xf2dcd5ec7346c492,
+ 0x78d620c033d08218, 0xd7d30aab605e5d11, 0x642c95fd3d270a99, 0xcb29bf966ea9d590,
+ 0xb08f0b3a499e972a, 0x1f8a21511a104823, 0xac75be0747691fab, 0x0370946c14e7c0a2,
+ 0x897a614054718628, 0x267f4b2b07ff5921, 0x9580d47d5a860ea9, 0x3a85fe160908d1a0,
+ 0xc365dfce7240b52e, 0x6c60f5a521ce6a27, 0xdf9f6af37cb73daf, 0x709a40982f39e2a6,
+ 0xfa90b5b46fafa42c, 0x55959fdf3c217b25, 0xe66a008961582cad, 0x496f2ae232d6f3a4,
+ 0x575aa2d23e22d322, 0xf85f88b96dac0c2b, 0x4ba017ef30d55ba3, 0xe4a53d84635b84aa,
+ 0x6eafc8a823cdc220, 0xc1aae2c370431d29, 0x72557d952d3a4aa1, 0xdd5057fe7eb495a8,
+ 0x24b0762605fcf126, 0x8bb55c4d56722e2f, 0x384ac31b0b0b79a7, 0x974fe9705885a6ae,
+ 0x1d451c5c1813e024, 0xb24036374b9d3f2d, 0x01bfa96116e468a5, 0xaeba830a456ab7ac,
+ 0x3dd4b9010f0c29a9, 0x92d1936a5c82f6a0, 0x212e0c3c01fba128, 0x8e2b265752757e21,
+ 0x0421d37b12e338ab, 0xab24f910416de7a2, 0x18db66461c14b02a, 0xb7de4c2d4f9a6f23,
+ 0x4e3e6df534d20bad, 0xe13b479e675cd4a4, 0x52c4d8c83a25832c, 0xfdc1f2a369ab5c25,
+ 0x77cb078f293d1aaf, 0xd8ce2de47ab3c5a6, 0x6b31b2b227ca922e, 0xc43498d974444d27,
+ 0xda0110e978b06da1, 0x75043a822b3eb2a8, 0xc6fba5d47647e520, 0x69fe8fbf25c93a29,
+ 0xe3f47a93655f7ca3, 0x4cf150f836d1a3aa, 0xff0ecfae6ba8f422, 0x500be5c538262b2b,
+ 0xa9ebc41d436e4fa5, 0x06eeee7610e090ac, 0xb51171204d99c724, 0x1a145b4b1e17182d,
+ 0x901eae675e815ea7, 0x3f1b840c0d0f81ae, 0x8ce41b5a5076d626, 0x23e1313103f8092f,
+ 0xe8c88ea76d51dcbf, 0x47cda4cc3edf03b6, 0xf4323b9a63a6543e, 0x5b3711f130288b37,
+ 0xd13de4dd70becdbd, 0x7e38ceb6233012b4, 0xcdc751e07e49453c, 0x62c27b8b2dc79a35,
+ 0x9b225a53568ffebb, 0x34277038050121b2, 0x87d8ef6e5878763a, 0x28ddc5050bf6a933,
+ 0xa2d730294b60efb9, 0x0dd21a4218ee30b0, 0xbe2d851445976738, 0x1128af7f1619b831,
+ 0x0f1d274f1aed98b7, 0xa0180d24496347be, 0x13e79272141a1036, 0xbce2b8194794cf3f,
+ 0x36e84d35070289b5, 0x99ed675e548c56bc, 0x2a12f80809f50134, 0x8517d2635a7bde3d,
+ 0x7cf7f3bb2133bab3, 0xd3f2d9d072bd65ba, 0x600d46862fc43232, 0xcf086ced7c4aed3b,
+ 0x450299c13cdcabb1, 0xea07b3aa6f5274b8, 0x59f82cfc322b2330, 0xf6fd069761a5fc39,
+ 0x65933c9c2bc3623c, 0xca9616f7784dbd35, 0x796989a12534eabd, 0xd66ca3ca76ba35b4,
+ 0x5c6656e6362c733e, 0xf3637c8d65a2ac37, 0x409ce3db38dbfbbf, 0xef99c9b06b5524b6,
+ 0x1679e868101d4038, 0xb97cc20343939f31, 0x0a835d551eeac8b9, 0xa586773e4d6417b0,
+ 0x2f8c82120df2513a, 0x8089a8795e7c8e33, 0x3376372f0305d9bb, 0x9c731d44508b06b2,
+ 0x824695745c7f2634, 0x2d43bf1f0ff1f93d, 0x9ebc20495288aeb5, 0x31b90a22010671bc,
+ 0xbbb3ff0e41903736, 0x14b6d565121ee83f, 0xa7494a334f67bfb7, 0x084c60581ce960be,
+ 0xf1ac418067a10430, 0x5ea96beb342fdb39, 0xed56f4bd69568cb1, 0x4253ded63ad853b8,
+ 0xc8592bfa7a4e1532, 0x675c019129c0ca3b, 0xd4a39ec774b99db3, 0x7ba6b4ac273742ba,
+ 0x0000000000000000, 0x23eef79f3ad718c7, 0x47ddef3e75ae318e, 0x643318a14f792949,
+ 0x8fbbde7ceb5c631c, 0xac5529e3d18b7bdb, 0xc86631429ef25292, 0xeb88c6dda4254a55,
+ 0x5d875d127f52f0ab, 0x7e69aa8d4585e86c, 0x1a5ab22c0afcc125, 0x39b445b3302bd9e2,
+ 0xd23c836e940e93b7, 0xf1d274f1aed98b70, 0x95e16c50e1a0a239, 0xb60f9bcfdb77bafe,
+ 0xbb0eba24fea5e156, 0x98e04dbbc472f991, 0xfcd3551a8b0bd0d8, 0xdf3da285b1dcc81f,
+ 0x34b5645815f9824a, 0x175b93c72f2e9a8d, 0x73688b666057b3c4, 0x50867cf95a80ab03,
+ 0xe689e73681f711fd, 0xc56710a9bb20093a, 0xa1540808f4592073, 0x82baff97ce8e38b4,
+ 0x6932394a6aab72e1, 0x4adcced5507c6a26, 0x2eefd6741f05436f, 0x0d0121eb25d25ba8,
+ 0x34ed95a254a1f43f, 0x1703623d6e76ecf8, 0x73307a9c210fc5b1, 0x50de8d031bd8dd76,
+ 0xbb564bdebffd9723, 0x98b8bc41852a8fe4, 0xfc8ba4e0ca53a6ad, 0xdf65537ff084be6a,
+ 0x696ac8b02bf30494, 0x4a843f2f11241c53, 0x2eb7278e5e5d351a, 0x0d59d011648a2ddd,
+ 0xe6d116ccc0af6788, 0xc53fe153fa787f4f, 0xa10cf9f2b5015606, 0x82e20e6d8fd64ec1,
+ 0x8fe32f86aa041569, 0xac0dd81990d30dae, 0xc83ec0b8dfaa24e7, 0xebd03727e57d3c20,
+ 0x0058f1fa41587675, 0x23b606657b8f6eb2, 0x47851ec434f647fb, 0x646be95b0e215f3c,
+ 0xd2647294d556e5c2, 0xf18a850bef81fd05, 0x95b99daaa0f8d44c, 0xb6576a359a2fcc8b,
+ 0x5ddface83e0a86de, 0x7e315b7704dd9e19, 0x1a0243d64ba4b750, 0x39ecb4497173af97,
+ 0x69db2b44a943e87e, 0x4a35dcdb9394f0b9, 0x2e06c47adcedd9f0, 0x0de833e5e63ac137,
+ 0xe660f538421f8b62, 0xc58e02a778c893a5, 0xa1bd1a0637b1baec, 0x8253ed990d66a22b,
+ 0x345c7656d61118d5, 0x17b281c9ecc60012, 0x73819968a3bf295b, 0x506f6ef79968319c,
+ 0xbbe7a82a3d4d7bc9, 0x98095fb5079a630e, 0xfc3a471448e34a47, 0xdfd4b08b72345280,
+ 0xd2d5916057e60928, 0xf13b66ff6d3111ef, 0x95087e5e224838a6, 0xb6e689c1189f2061,
+ 0x5d6e4f1cbcba6a34, 0x7e80b883866d72f3, 0x1ab3a022c9145bba, 0x395d57bdf3c3437d,
+ 0x8f52cc7228b4f983, 0xacbc3bed1263e144, 0xc88f234c5d1ac80d, 0xeb61d4d367cdd0ca,
+ 0x00e9120ec3e89a9f, 0x2307e591f93f8258, 0x4734fd30b646ab11, 0x64da0aaf8c91b3d6,
+ 0x5d36bee6fde21c41, 0x7ed84979c7350486, 0x1aeb51d8884c2dcf, 0x3905a647b29b3508,
+ 0xd28d609a16be7f5d, 0xf16397052c69679a, 0x95508fa463104ed3, 0xb6be783b59c75614,
+ 0x00b1e3f482b0ecea, 0x235f146bb867f42d, 0x476c0ccaf71edd64, 0x6482fb55cdc9c5a3,
+ 0x8f0a3d8869ec8ff6, 0xace4ca17533b9731, 0xc8d7d2b61c42be78, 0xeb3925292695a6bf,
+ 0xe63804c20347fd17, 0xc5d6f35d3990e5d0, 0xa1e5ebfc76e9cc99, 0x820b1c634c3ed45e,
+ 0x6983dabee81b9e0b, 0x4a6d2d21d2cc86cc, 0x2e5e35809db5af85, 0x0db0c21fa762b742,
+ 0xbbbf59d07c150dbc, 0x9851ae4f46c2157b, 0xfc62b6ee09bb3c32, 0xdf8c4171336c24f5,
+ 0x340487ac97496ea0, 0x17ea7033ad9e7667, 0x73d96892e2e75f2e, 0x50379f0dd83047e9,
+ 0xd3b656895287d0fc, 0xf058a1166850c83b, 0x946bb9b72729e172, 0xb7854e281dfef9b5,
+ 0x5c0d88f5b9dbb3e0, 0x7fe37f6a830cab27, 0x1bd067cbcc75826e, 0x383e9054f6a29aa9,
+ 0x8e310b9b2dd52057, 0xaddffc0417023890, 0xc9ece4a5587b11d9, 0xea02133a62ac091e,
+ 0x018ad5e7c689434b, 0x22642278fc5e5b8c, 0x46573ad9b32772c5, 0x65b9cd4689f06a02,
+ 0x68b8ecadac2231aa, 0x4b561b3296f5296d, 0x2f650393d98c0024, 0x0c8bf40ce35b18e3,
+ 0xe70332d1477e52b6, 0xc4edc54e7da94a71, 0xa0deddef32d06338, 0x83302a7008077bff,
+ 0x353fb1bfd370c101, 0x16d14620e9a7d9c6, 0x72e25e81a6def08f, 0x510ca91e9c09e848,
+ 0xba846fc3382ca21d, 0x996a985c02fbbada, 0xfd5980fd4d829393, 0xdeb7776277558b54,
+ 0xe75bc32b062624c3, 0xc4b534b43cf13c04, 0xa0862c157388154d, 0x8368db8a495f0d8a,
+ 0x68e01d57ed7a47df, 0x4b0eeac8d7ad5f18, 0x2f3df26998d47651, 0x0cd305f6a2036e96,
+ 0xbadc9e397974d468, 0x993269a643a3ccaf, 0xfd0171070cdae5e6, 0xdeef8698360dfd21,
+ 0x356740459228b774, 0x1689b7daa8ffafb3, 0x72baaf7be78686fa, 0x515458e4dd519e3d,
+ 0x5c55790ff883c595, 0x7fbb8e90c254dd52, 0x1b8896318d2df41b, 0x386661aeb7faecdc,
+ 0xd3eea77313dfa689, 0xf00050ec2908be4e, 0x9433484d66719707, 0xb7ddbfd25ca68fc0,
+ 0x01d2241d87d1353e, 0x223cd382bd062df9, 0x460fcb23f27f04b0, 0x65e13cbcc8a81c77,
+ 0x8e69fa616c8d5622, 0xad870dfe565a4ee5, 0xc9b4155f192367ac, 0xea5ae2c023f47f6b,
+ 0xba6d7dcdfbc43882, 0x99838a52c1132045, 0xfdb092f38e6a090c, 0xde5e656cb4bd11cb,
+ 0x35d6a3b110985b9e, 0x1638542e2a4f4359, 0x720b4c8f65366a10, 0x51e5bb105fe172d7,
+ 0xe7ea20df8496c829, 0xc404d740be41d0ee, 0xa037cfe1f138f9a7, 0x83d9387ecbefe160,
+ 0x6851fea36fcaab35, 0x4bbf093c551db3f2, 0x2f8c119d1a649abb, 0x0c62e60220b3827c,
+ 0x0163c7e90561d9d4, 0x228d30763fb6c113, 0x46be28d770cfe85a, 0x6550df484a18f09d,
+ 0x8ed81995ee3dbac8, 0xad36ee0ad4eaa20f, 0xc905f6ab9b938b46, 0xeaeb0134a1449381,
+ 0x5ce49afb7a33297f, 0x7f0a6d6440e431b8, 0x1b3975c50f9d18f1, 0x38d7825a354a0036,
+ 0xd35f4487916f4a63, 0xf0b1b318abb852a4, 0x9482abb9e4c17bed, 0xb76c5c26de16632a,
+ 0x8e80e86faf65ccbd, 0xad6e1ff095b2d47a, 0xc95d0751dacbfd33, 0xeab3f0cee01ce5f4,
+ 0x013b36134439afa1, 0x22d5c18c7eeeb766, 0x46e6d92d31979e2f, 0x65082eb20b4086e8,
+ 0xd307b57dd0373c16, 0xf0e942e2eae024d1, 0x94da5a43a5990d98, 0xb734addc9f4e155f,
+ 0x5cbc6b013b6b5f0a, 0x7f529c9e01bc47cd, 0x1b61843f4ec56e84, 0x388f73a074127643,
+ 0x358e524b51c02deb, 0x1660a5d46b17352c, 0x7253bd75246e1c65, 0x51bd4aea1eb904a2,
+ 0xba358c37ba9c4ef7, 0x99db7ba8804b5630, 0xfde86309cf327f79, 0xde069496f5e567be,
+ 0x68090f592e92dd40, 0x4be7f8c61445c587, 0x2fd4e0675b3cecce, 0x0c3a17f861ebf409,
+ 0xe7b2d125c5cebe5c, 0xc45c26baff19a69b, 0xa06f3e1bb0608fd2, 0x8381c9848ab79715,
+ 0x0000000000000000, 0xe59c4cf90ce5976b, 0x89c87819b0211845, 0x6c5434e0bcc48f2e,
+ 0x516011d8c9a80619, 0xb4fc5d21c54d9172, 0xd8a869c179891e5c, 0x3d342538756c8937,
+ 0xa2c023b193500c32, 0x475c6f489fb59b59, 0x2b085ba823711477, 0xce9417512f94831c,
+ 0xf3a032695af80a2b, 0x163c7e90561d9d40, 0x7a684a70ead9126e, 0x9ff40689e63c8505,
+ 0x0770a6888f4a2ef7, 0xe2ecea7183afb99c, 0x8eb8de913f6b36b2, 0x6b249268338ea1d9,
+ 0x5610b75046e228ee, 0xb38cfba94a07bf85, 0xdfd8cf49f6c330ab, 0x3a4483b0fa26a7c0,
+ 0xa5b085391c1a22c5, 0x402cc9c010ffb5ae, 0x2c78fd20ac3b3a80, 0xc9e4b1d9a0deadeb,
+ 0xf4d094e1d5b224dc, 0x114cd818d957b3b7, 0x7d18ecf865933c99, 0x9884a0016976abf2,
+ 0x0ee14d111e945dee, 0xeb7d01e81271ca85, 0x87293508aeb545ab, 0x62b579f1a250d2c0,
+ 0x5f815cc9d73c5bf7, 0xba1d1030dbd9cc9c, 0xd64924d0671d43b2, 0x33d568296bf8d4d9,
+ 0xac216ea08dc451dc, 0x49bd22598121c6b7, 0x25e916b93de54999, 0xc0755a403100def2,
+ 0xfd417f78446c57c5, 0x18dd33814889c0ae, 0x74890761f44d4f80, 0x91154b98f8a8d8eb,
+ 0x0991eb9991de7319, 0xec0da7609d3be472, 0x8059938021ff6b5c, 0x65c5df792d1afc37,
+ 0x58f1fa4158767500, 0xbd6db6b85493e26b, 0xd1398258e8576d45, 0x34a5cea1e4b2fa2e,
+ 0xab51c828028e7f2b, 0x4ecd84d10e6be840, 0x2299b031b2af676e, 0xc705fcc8be4af005,
+ 0xfa31d9f0cb267932, 0x1fad9509c7c3ee59, 0x73f9a1e97b076177, 0x9665ed1077e2f61c,
+ 0x1dc29a223d28bbdc, 0xf85ed6db31cd2cb7, 0x940ae23b8d09a399, 0x7196aec281ec34f2,
+ 0x4ca28bfaf480bdc5, 0xa93ec703f8652aae, 0xc56af3e344a1a580, 0x20f6bf1a484432eb,
+ 0xbf02b993ae78b7ee, 0x5a9ef56aa29d2085, 0x36cac18a1e59afab, 0xd3568d7312bc38c0,
+ 0xee62a84b67d0b1f7, 0x0bfee4b26b35269c, 0x67aad052d7f1a9b2, 0x82369cabdb143ed9,
+ 0x1ab23caab262952b, 0xff2e7053be870240, 0x937a44b302438d6e, 0x76e6084a0ea61a05,
+ 0x4bd22d727bca9332, 0xae4e618b772f0459, 0xc21a556bcbeb8b77, 0x27861992c70e1c1c,
+ 0xb8721f1b21329919, 0x5dee53e22dd70e72, 0x31ba67029113815c, 0xd4262bfb9df61637,
+ 0xe9120ec3e89a9f00, 0x0c8e423ae47f086b, 0x60da76da58bb8745, 0x85463a23545e102e,
+ 0x1323d73323bce632, 0xf6bf9bca2f597159, 0x9aebaf2a939dfe77, 0x7f77e3d39f78691c,
+ 0x4243c6ebea14e02b, 0xa7df8a12e6f17740, 0xcb8bbef25a35f86e, 0x2e17f20b56d06f05,
+ 0xb1e3f482b0ecea00, 0x547fb87bbc097d6b, 0x382b8c9b00cdf245, 0xddb7c0620c28652e,
+ 0xe083e55a7944ec19, 0x051fa9a375a17b72, 0x694b9d43c965f45c, 0x8cd7d1bac5806337,
+ 0x145371bbacf6c8c5, 0xf1cf3d42a0135fae, 0x9d9b09a21cd7d080, 0x7807455b103247eb,
+ 0x45336063655ecedc, 0xa0af2c9a69bb59b7, 0xccfb187ad57fd699, 0x29675483d99a41f2,
+ 0xb693520a3fa6c4f7, 0x530f1ef33343539c, 0x3f5b2a138f87dcb2, 0xdac766ea83624bd9,
+ 0xe7f343d2f60ec2ee, 0x026f0f2bfaeb5585, 0x6e3b3bcb462fdaab, 0x8ba777324aca4dc0,
+ 0x3b8534447a5177b8, 0xde1978bd76b4e0d3, 0xb24d4c5dca706ffd, 0x57d100a4c695f896,
+ 0x6ae5259cb3f971a1, 0x8f796965bf1ce6ca, 0xe32d5d8503d869e4, 0x06b1117c0f3dfe8f,
+ 0x994517f5e9017b8a, 0x7cd95b0ce5e4ece1, 0x108d6fec592063cf, 0xf511231555c5f4a4,
+ 0xc825062d20a97d93, 0x2db94ad42c4ceaf8, 0x41ed7e34908865d6, 0xa47132cd9c6df2bd,
+ 0x3cf592ccf51b594f, 0xd969de35f9fece24, 0xb53dead5453a410a, 0x50a1a62c49dfd661,
+ 0x6d9583143cb35f56, 0x8809cfed3056c83d, 0xe45dfb0d8c924713, 0x01c1b7f48077d078,
+ 0x9e35b17d664b557d, 0x7ba9fd846aaec216, 0x17fdc964d66a4d38, 0xf261859dda8fda53,
+ 0xcf55a0a5afe35364, 0x2ac9ec5ca306c40f, 0x469dd8bc1fc24b21, 0xa30194451327dc4a,
+ 0x3564795564c52a56, 0xd0f835ac6820bd3d, 0xbcac014cd4e43213, 0x59304db5d801a578,
+ 0x6404688dad6d2c4f, 0x81982474a188bb24, 0xedcc10941d4c340a, 0x08505c6d11a9a361,
+ 0x97a45ae4f7952664, 0x7238161dfb70b10f, 0x1e6c22fd47b43e21, 0xfbf06e044b51a94a,
+ 0xc6c44b3c3e3d207d, 0x235807c532d8b716, 0x4f0c33258e1c3838, 0xaa907fdc82f9af53,
+ 0x3214dfddeb8f04a1, 0xd7889324e76a93ca, 0xbbdca7c45bae1ce4, 0x5e40eb3d574b8b8f,
+ 0x6374ce05222702b8, 0x86e882fc2ec295d3, 0xeabcb61c92061afd, 0x0f20fae59ee38d96,
+ 0x90d4fc6c78df0893, 0x7548b095743a9ff8, 0x191c8475c8fe10d6, 0xfc80c88cc41b87bd,
+ 0xc1b4edb4b1770e8a, 0x2428a14dbd9299e1, 0x487c95ad015616cf, 0xade0d9540db381a4,
+ 0x2647ae664779cc64, 0xc3dbe29f4b9c5b0f, 0xaf8fd67ff758d421, 0x4a139a86fbbd434a,
+ 0x7727bfbe8ed1ca7d, 0x92bbf34782345d16, 0xfeefc7a73ef0d238, 0x1b738b5e32154553,
+ 0x84878dd7d429c056, 0x611bc12ed8cc573d, 0x0d4ff5ce6408d813, 0xe8d3b93768ed4f78,
+ 0xd5e79c0f1d81c64f, 0x307bd0f611645124, 0x5c2fe416ada0de0a, 0xb9b3a8efa1454961,
+ 0x213708eec833e293, 0xc4ab4417c4d675f8, 0xa8ff70f77812fad6, 0x4d633c0e74f76dbd,
+ 0x70571936019be48a, 0x95cb55cf0d7e73e1, 0xf99f612fb1bafccf, 0x1c032dd6bd5f6ba4,
+ 0x83f72b5f5b63eea1, 0x666b67a6578679ca, 0x0a3f5346eb42f6e4, 0xefa31fbfe7a7618f,
+ 0xd2973a8792cbe8b8, 0x370b767e9e2e7fd3, 0x5b5f429e22eaf0fd, 0xbec30e672e0f6796,
+ 0x28a6e37759ed918a, 0xcd3aaf8e550806e1, 0xa16e9b6ee9cc89cf, 0x44f2d797e5291ea4,
+ 0x79c6f2af90459793, 0x9c5abe569ca000f8, 0xf00e8ab620648fd6, 0x1592c64f2c8118bd,
+ 0x8a66c0c6cabd9db8, 0x6ffa8c3fc6580ad3, 0x03aeb8df7a9c85fd, 0xe632f42676791296,
+ 0xdb06d11e03159ba1, 0x3e9a9de70ff00cca, 0x52cea907b33483e4, 0xb752e5febfd1148f,
+ 0x2fd645ffd6a7bf7d, 0xca4a0906da422816, 0xa61e3de66686a738, 0x4382711f6a633053,
+ 0x7eb654271f0fb964, 0x9b2a18de13ea2e0f, 0xf77e2c3eaf2ea121, 0x12e260c7a3cb364a,
+ 0x8d16664e45f7b34f, 0x688a2ab749122424, 0x04de1e57f5d6ab0a, 0xe14252aef9333c61,
+ 0xdc7677968c5fb556, 0x39ea3b6f80ba223d, 0x55be0f8f3c7ead13, 0xb0224376309b3a78,
+ 0x0000000000000000, 0x770a6888f4a2ef70, 0xee14d111e945dee0, 0x991eb9991de73190,
+ 0x9ed943c87b618b53, 0xe9d32b408fc36423, 0x70cd92d9922455b3, 0x07c7fa516686bac3,
+ 0x7f42667b5f292035, 0x08480ef3ab8bcf45, 0x9156b76ab66cfed5, 0xe65cdfe242ce11a5,
+ 0xe19b25b32448ab66, 0x96914d3bd0ea4416, 0x0f8ff4a2cd0d7586, 0x78859c2a39af9af6,
+ 0xfe84ccf6be52406a, 0x898ea47e4af0af1a, 0x10901de757179e8a, 0x679a756fa3b571fa,
+ 0x605d8f3ec533cb39, 0x1757e7b631912449, 0x8e495e2f2c7615d9, 0xf94336a7d8d4faa9,
+ 0x81c6aa8de17b605f, 0xf6ccc20515d98f2f, 0x6fd27b9c083ebebf, 0x18d81314fc9c51cf,
+ 0x1f1fe9459a1aeb0c, 0x681581cd6eb8047c, 0xf10b3854735f35ec, 0x860150dc87fdda9c,
+ 0xbff97806d54eb647, 0xc8f3108e21ec5937, 0x51eda9173c0b68a7, 0x26e7c19fc8a987d7,
+ 0x21203bceae2f3d14, 0x562a53465a8dd264, 0xcf34eadf476ae3f4, 0xb83e8257b3c80c84,
+ 0xc0bb1e7d8a679672, 0xb7b176f57ec57902, 0x2eafcf6c63224892, 0x59a5a7e49780a7e2,
+ 0x5e625db5f1061d21, 0x2968353d05a4f251, 0xb0768ca41843c3c1, 0xc77ce42cece12cb1,
+ 0x417db4f06b1cf62d, 0x3677dc789fbe195d, 0xaf6965e1825928cd, 0xd8630d6976fbc7bd,
+ 0xdfa4f738107d7d7e, 0xa8ae9fb0e4df920e, 0x31b02629f938a39e, 0x46ba4ea10d9a4cee,
+ 0x3e3fd28b3435d618, 0x4935ba03c0973968, 0xd02b039add7008f8, 0xa7216b1229d2e788,
+ 0xa0e691434f545d4b, 0xd7ecf9cbbbf6b23b, 0x4ef24052a61183ab, 0x39f828da52b36cdb,
+ 0x3d0211e603775a1d, 0x4a08796ef7d5b56d, 0xd316c0f7ea3284fd, 0xa41ca87f1e906b8d,
+ 0xa3db522e7816d14e, 0xd4d13aa68cb43e3e, 0x4dcf833f91530fae, 0x3ac5ebb765f1e0de,
+ 0x4240779d5c5e7a28, 0x354a1f15a8fc9558, 0xac54a68cb51ba4c8, 0xdb5ece0441b94bb8,
+ 0xdc993455273ff17b, 0xab935cddd39d1e0b, 0x328de544ce7a2f9b, 0x45878dcc3ad8c0eb,
+ 0xc386dd10bd251a77, 0xb48cb5984987f507, 0x2d920c015460c497, 0x5a986489a0c22be7,
+ 0x5d5f9ed8c6449124, 0x2a55f65032e67e54, 0xb34b4fc92f014fc4, 0xc4412741dba3a0b4,
+ 0xbcc4bb6be20c3a42, 0xcbced3e316aed532, 0x52d06a7a0b49e4a2, 0x25da02f2ffeb0bd2,
+ 0x221df8a3996db111, 0x5517902b6dcf5e61, 0xcc0929b270286ff1, 0xbb03413a848a8081,
+ 0x82fb69e0d639ec5a, 0xf5f10168229b032a, 0x6cefb8f13f7c32ba, 0x1be5d079cbdeddca,
+ 0x1c222a28ad586709, 0x6b2842a059fa8879, 0xf236fb39441db9e9, 0x853c93b1b0bf5699,
+ 0xfdb90f9b8910cc6f, 0x8ab367137db2231f, 0x13adde8a6055128f, 0x64a7b60294f7fdff,
+ 0x63604c53f271473c, 0x146a24db06d3a84c, 0x8d749d421b3499dc, 0xfa7ef5caef9676ac,
+ 0x7c7fa516686bac30, 0x0b75cd9e9cc94340, 0x926b7407812e72d0, 0xe5611c8f758c9da0,
+ 0xe2a6e6de130a2763, 0x95ac8e56e7a8c813, 0x0cb237cffa4ff983, 0x7bb85f470eed16f3,
+ 0x033dc36d37428c05, 0x7437abe5c3e06375, 0xed29127cde0752e5, 0x9a237af42aa5bd95,
+ 0x9de480a54c230756, 0xeaeee82db881e826, 0x73f051b4a566d9b6, 0x04fa393c51c436c6,
+ 0x7a0423cc06eeb43a, 0x0d0e4b44f24c5b4a, 0x9410f2ddefab6ada, 0xe31a9a551b0985aa,
+ 0xe4dd60047d8f3f69, 0x93d7088c892dd019, 0x0ac9b11594cae189, 0x7dc3d99d60680ef9,
+ 0x054645b759c7940f, 0x724c2d3fad657b7f, 0xeb5294a6b0824aef, 0x9c58fc2e4420a59f,
+ 0x9b9f067f22a61f5c, 0xec956ef7d604f02c, 0x758bd76ecbe3c1bc, 0x0281bfe63f412ecc,
+ 0x8480ef3ab8bcf450, 0xf38a87b24c1e1b20, 0x6a943e2b51f92ab0, 0x1d9e56a3a55bc5c0,
+ 0x1a59acf2c3dd7f03, 0x6d53c47a377f9073, 0xf44d7de32a98a1e3, 0x8347156bde3a4e93,
+ 0xfbc28941e795d465, 0x8cc8e1c913373b15, 0x15d658500ed00a85, 0x62dc30d8fa72e5f5,
+ 0x651bca899cf45f36, 0x1211a2016856b046, 0x8b0f1b9875b181d6, 0xfc05731081136ea6,
+ 0xc5fd5bcad3a0027d, 0xb2f733422702ed0d, 0x2be98adb3ae5dc9d, 0x5ce3e253ce4733ed,
+ 0x5b241802a8c1892e, 0x2c2e708a5c63665e, 0xb530c913418457ce, 0xc23aa19bb526b8be,
+ 0xbabf3db18c892248, 0xcdb55539782bcd38, 0x54abeca065ccfca8, 0x23a18428916e13d8,
+ 0x24667e79f7e8a91b, 0x536c16f1034a466b, 0xca72af681ead77fb, 0xbd78c7e0ea0f988b,
+ 0x3b79973c6df24217, 0x4c73ffb49950ad67, 0xd56d462d84b79cf7, 0xa2672ea570157387,
+ 0xa5a0d4f41693c944, 0xd2aabc7ce2312634, 0x4bb405e5ffd617a4, 0x3cbe6d6d0b74f8d4,
+ 0x443bf14732db6222, 0x333199cfc6798d52, 0xaa2f2056db9ebcc2, 0xdd2548de2f3c53b2,
+ 0xdae2b28f49bae971, 0xade8da07bd180601, 0x34f6639ea0ff3791, 0x43fc0b16545dd8e1,
+ 0x4706322a0599ee27, 0x300c5aa2f13b0157, 0xa912e33becdc30c7, 0xde188bb3187edfb7,
+ 0xd9df71e27ef86574, 0xaed5196a8a5a8a04, 0x37cba0f397bdbb94, 0x40c1c87b631f54e4,
+ 0x384454515ab0ce12, 0x4f4e3cd9ae122162, 0xd6508540b3f510f2, 0xa15aedc84757ff82,
+ 0xa69d179921d14541, 0xd1977f11d573aa31, 0x4889c688c8949ba1, 0x3f83ae003c3674d1,
+ 0xb982fedcbbcbae4d, 0xce8896544f69413d, 0x57962fcd528e70ad, 0x209c4745a62c9fdd,
+ 0x275bbd14c0aa251e, 0x5051d59c3408ca6e, 0xc94f6c0529effbfe, 0xbe45048ddd4d148e,
+ 0xc6c098a7e4e28e78, 0xb1caf02f10406108, 0x28d449b60da75098, 0x5fde213ef905bfe8,
+ 0x5819db6f9f83052b, 0x2f13b3e76b21ea5b, 0xb60d0a7e76c6dbcb, 0xc10762f6826434bb,
+ 0xf8ff4a2cd0d75860, 0x8ff522a42475b710, 0x16eb9b3d39928680, 0x61e1f3b5cd3069f0,
+ 0x662609e4abb6d333, 0x112c616c5f143c43, 0x8832d8f542f30dd3, 0xff38b07db651e2a3,
+ 0x87bd2c578ffe7855, 0xf0b744df7b5c9725, 0x69a9fd4666bba6b5, 0x1ea395ce921949c5,
+ 0x19646f9ff49ff306, 0x6e6e0717003d1c76, 0xf770be8e1dda2de6, 0x807ad606e978c296,
+ 0x067b86da6e85180a, 0x7171ee529a27f77a, 0xe86f57cb87c0c6ea, 0x9f653f437362299a,
+ 0x98a2c51215e49359, 0xefa8ad9ae1467c29, 0x76b61403fca14db9, 0x01bc7c8b0803a2c9,
+ 0x7939e0a131ac383f, 0x0e338829c50ed74f, 0x972d31b0d8e9e6df, 0xe02759382c4b09af,
+ 0xe7e0a3694acdb36c, 0x90eacbe1be6f5c1c, 0x09f47278a3886d8c, 0x7efe1af0572a82fc,
+ 0x0000000000000000, 0xf40847980ddd6874, 0xaae06edbb250e67b, 0x5ee82943bf8d8e0f,
+ 0x17303c5ccd4bfa65, 0xe3387bc4c0969211, 0xbdd052877f1b1c1e, 0x49d8151f72c6746a,
+ 0x2e6078b99a97f4ca, 0xda683f21974a9cbe, 0x8480166228c712b1, 0x708851fa251a7ac5,
+ 0x395044e557dc0eaf, 0xcd58037d5a0166db, 0x93b02a3ee58ce8d4, 0x67b86da6e85180a0,
+ 0x5cc0f173352fe994, 0xa8c8b6eb38f281e0, 0xf6209fa8877f0fef, 0x0228d8308aa2679b,
+ 0x4bf0cd2ff86413f1, 0xbff88ab7f5b97b85, 0xe110a3f44a34f58a, 0x1518e46c47e99dfe,
+ 0x72a089caafb81d5e, 0x86a8ce52a265752a, 0xd840e7111de8fb25, 0x2c48a08910359351,
+ 0x6590b59662f3e73b, 0x9198f20e6f2e8f4f, 0xcf70db4dd0a30140, 0x3b789cd5dd7e6934,
+ 0xb981e2e66a5fd328, 0x4d89a57e6782bb5c, 0x13618c3dd80f3553, 0xe769cba5d5d25d27,
+ 0xaeb1debaa714294d, 0x5ab99922aac94139, 0x0451b0611544cf36, 0xf059f7f91899a742,
+ 0x97e19a5ff0c827e2, 0x63e9ddc7fd154f96, 0x3d01f4844298c199, 0xc909b31c4f45a9ed,
+ 0x80d1a6033d83dd87, 0x74d9e19b305eb5f3, 0x2a31c8d88fd33bfc, 0xde398f40820e5388,
+ 0xe54113955f703abc, 0x1149540d52ad52c8, 0x4fa17d4eed20dcc7, 0xbba93ad6e0fdb4b3,
+ 0xf2712fc9923bc0d9, 0x067968519fe6a8ad, 0x58914112206b26a2, 0xac99068a2db64ed6,
+ 0xcb216b2cc5e7ce76, 0x3f292cb4c83aa602, 0x61c105f777b7280d, 0x95c9426f7a6a4079,
+ 0xdc11577008ac3413, 0x281910e805715c67, 0x76f139abbafcd268, 0x82f97e33b721ba1c,
+ 0x31f324277d5590c3, 0xc5fb63bf7088f8b7, 0x9b134afccf0576b8, 0x6f1b0d64c2d81ecc,
+ 0x26c3187bb01e6aa6, 0xd2cb5fe3bdc302d2, 0x8c2376a0024e8cdd, 0x782b31380f93e4a9,
+ 0x1f935c9ee7c26409, 0xeb9b1b06ea1f0c7d, 0xb573324555928272, 0x417b75dd584fea06,
+ 0x08a360c22a899e6c, 0xfcab275a2754f618, 0xa2430e1998d97817, 0x564b498195041063,
+ 0x6d33d554487a7957, 0x993b92cc45a71123, 0xc7d3bb8ffa2a9f2c, 0x33dbfc17f7f7f758,
+ 0x7a03e90885318332, 0x8e0bae9088eceb46, 0xd0e387d337616549, 0x24ebc04b3abc0d3d,
+ 0x4353adedd2ed8d9d, 0xb75bea75df30e5e9, 0xe9b3c33660bd6be6, 0x1dbb84ae6d600392,
+ 0x546391b11fa677f8, 0xa06bd629127b1f8c, 0xfe83ff6aadf69183, 0x0a8bb8f2a02bf9f7,
+ 0x8872c6c1170a43eb, 0x7c7a81591ad72b9f, 0x2292a81aa55aa590, 0xd69aef82a887cde4,
+ 0x9f42fa9dda41b98e, 0x6b4abd05d79cd1fa, 0x35a2944668115ff5, 0xc1aad3de65cc3781,
+ 0xa612be788d9db721, 0x521af9e08040df55, 0x0cf2d0a33fcd515a, 0xf8fa973b3210392e,
+ 0xb122822440d64d44, 0x452ac5bc4d0b2530, 0x1bc2ecfff286ab3f, 0xefcaab67ff5bc34b,
+ 0xd4b237b22225aa7f, 0x20ba702a2ff8c20b, 0x7e52596990754c04, 0x8a5a1ef19da82470,
+ 0xc3820beeef6e501a, 0x378a4c76e2b3386e, 0x696265355d3eb661, 0x9d6a22ad50e3de15,
+ 0xfad24f0bb8b25eb5, 0x0eda0893b56f36c1, 0x503221d00ae2b8ce, 0xa43a6648073fd0ba,
+ 0xede2735775f9a4d0, 0x19ea34cf7824cca4, 0x47021d8cc7a942ab, 0xb30a5a14ca742adf,
+ 0x63e6484efaab2186, 0x97ee0fd6f77649f2, 0xc906269548fbc7fd, 0x3d0e610d4526af89,
+ 0x74d6741237e0dbe3, 0x80de338a3a3db397, 0xde361ac985b03d98, 0x2a3e5d51886d55ec,
+ 0x4d8630f7603cd54c, 0xb98e776f6de1bd38, 0xe7665e2cd26c3337, 0x136e19b4dfb15b43,
+ 0x5ab60cabad772f29, 0xaebe4b33a0aa475d, 0xf05662701f27c952, 0x045e25e812faa126,
+ 0x3f26b93dcf84c812, 0xcb2efea5c259a066, 0x95c6d7e67dd42e69, 0x61ce907e7009461d,
+ 0x2816856102cf3277, 0xdc1ec2f90f125a03, 0x82f6ebbab09fd40c, 0x76feac22bd42bc78,
+ 0x1146c18455133cd8, 0xe54e861c58ce54ac, 0xbba6af5fe743daa3, 0x4faee8c7ea9eb2d7,
+ 0x0676fdd89858c6bd, 0xf27eba409585aec9, 0xac9693032a0820c6, 0x589ed49b27d548b2,
+ 0xda67aaa890f4f2ae, 0x2e6fed309d299ada, 0x7087c47322a414d5, 0x848f83eb2f797ca1,
+ 0xcd5796f45dbf08cb, 0x395fd16c506260bf, 0x67b7f82fefefeeb0, 0x93bfbfb7e23286c4,
+ 0xf407d2110a630664, 0x000f958907be6e10, 0x5ee7bccab833e01f, 0xaaeffb52b5ee886b,
+ 0xe337ee4dc728fc01, 0x173fa9d5caf59475, 0x49d7809675781a7a, 0xbddfc70e78a5720e,
+ 0x86a75bdba5db1b3a, 0x72af1c43a806734e, 0x2c473500178bfd41, 0xd84f72981a569535,
+ 0x919767876890e15f, 0x659f201f654d892b, 0x3b77095cdac00724, 0xcf7f4ec4d71d6f50,
+ 0xa8c723623f4ceff0, 0x5ccf64fa32918784, 0x02274db98d1c098b, 0xf62f0a2180c161ff,
+ 0xbff71f3ef2071595, 0x4bff58a6ffda7de1, 0x151771e54057f3ee, 0xe11f367d4d8a9b9a,
+ 0x52156c6987feb145, 0xa61d2bf18a23d931, 0xf8f502b235ae573e, 0x0cfd452a38733f4a,
+ 0x452550354ab54b20, 0xb12d17ad47682354, 0xefc53eeef8e5ad5b, 0x1bcd7976f538c52f,
+ 0x7c7514d01d69458f, 0x887d534810b42dfb, 0xd6957a0baf39a3f4, 0x229d3d93a2e4cb80,
+ 0x6b45288cd022bfea, 0x9f4d6f14ddffd79e, 0xc1a5465762725991, 0x35ad01cf6faf31e5,
+ 0x0ed59d1ab2d158d1, 0xfaddda82bf0c30a5, 0xa435f3c10081beaa, 0x503db4590d5cd6de,
+ 0x19e5a1467f9aa2b4, 0xedede6de7247cac0, 0xb305cf9dcdca44cf, 0x470d8805c0172cbb,
+ 0x20b5e5a32846ac1b, 0xd4bda23b259bc46f, 0x8a558b789a164a60, 0x7e5dcce097cb2214,
+ 0x3785d9ffe50d567e, 0xc38d9e67e8d03e0a, 0x9d65b724575db005, 0x696df0bc5a80d871,
+ 0xeb948e8feda1626d, 0x1f9cc917e07c0a19, 0x4174e0545ff18416, 0xb57ca7cc522cec62,
+ 0xfca4b2d320ea9808, 0x08acf54b2d37f07c, 0x5644dc0892ba7e73, 0xa24c9b909f671607,
+ 0xc5f4f636773696a7, 0x31fcb1ae7aebfed3, 0x6f1498edc56670dc, 0x9b1cdf75c8bb18a8,
+ 0xd2c4ca6aba7d6cc2, 0x26cc8df2b7a004b6, 0x7824a4b1082d8ab9, 0x8c2ce32905f0e2cd,
+ 0xb7547ffcd88e8bf9, 0x435c3864d553e38d, 0x1db411276ade6d82, 0xe9bc56bf670305f6,
+ 0xa06443a015c5719c, 0x546c0438181819e8, 0x0a842d7ba79597e7, 0xfe8c6ae3aa48ff93,
+ 0x9934074542197f33, 0x6d3c40dd4fc41747, 0x33d4699ef0499948, 0xc7dc2e06fd94f13c,
+ 0x8e043b198f528556, 0x7a0c7c81828fed22, 0x24e455c23d02632d, 0xd0ec125a30df0b59,
+ 0x0000000000000000, 0xc7cc909df556430c, 0xcd69c0d04346b08b, 0x0aa5504db610f387,
+ 0xd823604b2f675785, 0x1feff0d6da311489, 0x154aa09b6c21e70e, 0xd28630069977a402,
+ 0xf2b6217df7249999, 0x357ab1e00272da95, 0x3fdfe1adb4622912, 0xf813713041346a1e,
+ 0x2a954136d843ce1c, 0xed59d1ab2d158d10, 0xe7fc81e69b057e97, 0x2030117b6e533d9b,
+ 0xa79ca31047a305a1, 0x6050338db2f546ad, 0x6af563c004e5b52a, 0xad39f35df1b3f626,
+ 0x7fbfc35b68c45224, 0xb87353c69d921128, 0xb2d6038b2b82e2af, 0x751a9316ded4a1a3,
+ 0x552a826db0879c38, 0x92e612f045d1df34, 0x984342bdf3c12cb3, 0x5f8fd22006976fbf,
+ 0x8d09e2269fe0cbbd, 0x4ac572bb6ab688b1, 0x406022f6dca67b36, 0x87acb26b29f0383a,
+ 0x0dc9a7cb26ac3dd1, 0xca053756d3fa7edd, 0xc0a0671b65ea8d5a, 0x076cf78690bcce56,
+ 0xd5eac78009cb6a54, 0x1226571dfc9d2958, 0x188307504a8ddadf, 0xdf4f97cdbfdb99d3,
+ 0xff7f86b6d188a448, 0x38b3162b24dee744, 0x3216466692ce14c3, 0xf5dad6fb679857cf,
+ 0x275ce6fdfeeff3cd, 0xe09076600bb9b0c1, 0xea35262dbda94346, 0x2df9b6b048ff004a,
+ 0xaa5504db610f3870, 0x6d99944694597b7c, 0x673cc40b224988fb, 0xa0f05496d71fcbf7,
+ 0x727664904e686ff5, 0xb5baf40dbb3e2cf9, 0xbf1fa4400d2edf7e, 0x78d334ddf8789c72,
+ 0x58e325a6962ba1e9, 0x9f2fb53b637de2e5, 0x958ae576d56d1162, 0x524675eb203b526e,
+ 0x80c045edb94cf66c, 0x470cd5704c1ab560, 0x4da9853dfa0a46e7, 0x8a6515a00f5c05eb,
+ 0x1b934f964d587ba2, 0xdc5fdf0bb80e38ae, 0xd6fa8f460e1ecb29, 0x11361fdbfb488825,
+ 0xc3b02fdd623f2c27, 0x047cbf4097696f2b, 0x0ed9ef0d21799cac, 0xc9157f90d42fdfa0,
+ 0xe9256eebba7ce23b, 0x2ee9fe764f2aa137, 0x244cae3bf93a52b0, 0xe3803ea60c6c11bc,
+ 0x31060ea0951bb5be, 0xf6ca9e3d604df6b2, 0xfc6fce70d65d0535, 0x3ba35eed230b4639,
+ 0xbc0fec860afb7e03, 0x7bc37c1bffad3d0f, 0x71662c5649bdce88, 0xb6aabccbbceb8d84,
+ 0x642c8ccd259c2986, 0xa3e01c50d0ca6a8a, 0xa9454c1d66da990d, 0x6e89dc80938cda01,
+ 0x4eb9cdfbfddfe79a, 0x89755d660889a496, 0x83d00d2bbe995711, 0x441c9db64bcf141d,
+ 0x969aadb0d2b8b01f, 0x51563d2d27eef313, 0x5bf36d6091fe0094, 0x9c3ffdfd64a84398,
+ 0x165ae85d6bf44673, 0xd19678c09ea2057f, 0xdb33288d28b2f6f8, 0x1cffb810dde4b5f4,
+ 0xce798816449311f6, 0x09b5188bb1c552fa, 0x031048c607d5a17d, 0xc4dcd85bf283e271,
+ 0xe4ecc9209cd0dfea, 0x232059bd69869ce6, 0x298509f0df966f61, 0xee49996d2ac02c6d,
+ 0x3ccfa96bb3b7886f, 0xfb0339f646e1cb63, 0xf1a669bbf0f138e4, 0x366af92605a77be8,
+ 0xb1c64b4d2c5743d2, 0x760adbd0d90100de, 0x7caf8b9d6f11f359, 0xbb631b009a47b055,
+ 0x69e52b0603301457, 0xae29bb9bf666575b, 0xa48cebd64076a4dc, 0x63407b4bb520e7d0,
+ 0x43706a30db73da4b, 0x84bcfaad2e259947, 0x8e19aae098356ac0, 0x49d53a7d6d6329cc,
+ 0x9b530a7bf4148dce, 0x5c9f9ae60142cec2, 0x563acaabb7523d45, 0x91f65a3642047e49,
+ 0x37269f2c9ab0f744, 0xf0ea0fb16fe6b448, 0xfa4f5ffcd9f647cf, 0x3d83cf612ca004c3,
+ 0xef05ff67b5d7a0c1, 0x28c96ffa4081e3cd, 0x226c3fb7f691104a, 0xe5a0af2a03c75346,
+ 0xc590be516d946edd, 0x025c2ecc98c22dd1, 0x08f97e812ed2de56, 0xcf35ee1cdb849d5a,
+ 0x1db3de1a42f33958, 0xda7f4e87b7a57a54, 0xd0da1eca01b589d3, 0x17168e57f4e3cadf,
+ 0x90ba3c3cdd13f2e5, 0x5776aca12845b1e9, 0x5dd3fcec9e55426e, 0x9a1f6c716b030162,
+ 0x48995c77f274a560, 0x8f55ccea0722e66c, 0x85f09ca7b13215eb, 0x423c0c3a446456e7,
+ 0x620c1d412a376b7c, 0xa5c08ddcdf612870, 0xaf65dd916971dbf7, 0x68a94d0c9c2798fb,
+ 0xba2f7d0a05503cf9, 0x7de3ed97f0067ff5, 0x7746bdda46168c72, 0xb08a2d47b340cf7e,
+ 0x3aef38e7bc1cca95, 0xfd23a87a494a8999, 0xf786f837ff5a7a1e, 0x304a68aa0a0c3912,
+ 0xe2cc58ac937b9d10, 0x2500c831662dde1c, 0x2fa5987cd03d2d9b, 0xe86908e1256b6e97,
+ 0xc859199a4b38530c, 0x0f958907be6e1000, 0x0530d94a087ee387, 0xc2fc49d7fd28a08b,
+ 0x107a79d1645f0489, 0xd7b6e94c91094785, 0xdd13b9012719b402, 0x1adf299cd24ff70e,
+ 0x9d739bf7fbbfcf34, 0x5abf0b6a0ee98c38, 0x501a5b27b8f97fbf, 0x97d6cbba4daf3cb3,
+ 0x4550fbbcd4d898b1, 0x829c6b21218edbbd, 0x88393b6c979e283a, 0x4ff5abf162c86b36,
+ 0x6fc5ba8a0c9b56ad, 0xa8092a17f9cd15a1, 0xa2ac7a5a4fdde626, 0x6560eac7ba8ba52a,
+ 0xb7e6dac123fc0128, 0x702a4a5cd6aa4224, 0x7a8f1a1160bab1a3, 0xbd438a8c95ecf2af,
+ 0x2cb5d0bad7e88ce6, 0xeb79402722becfea, 0xe1dc106a94ae3c6d, 0x261080f761f87f61,
+ 0xf496b0f1f88fdb63, 0x335a206c0dd9986f, 0x39ff7021bbc96be8, 0xfe33e0bc4e9f28e4,
+ 0xde03f1c720cc157f, 0x19cf615ad59a5673, 0x136a3117638aa5f4, 0xd4a6a18a96dce6f8,
+ 0x0620918c0fab42fa, 0xc1ec0111fafd01f6, 0xcb49515c4cedf271, 0x0c85c1c1b9bbb17d,
+ 0x8b2973aa904b8947, 0x4ce5e337651dca4b, 0x4640b37ad30d39cc, 0x818c23e7265b7ac0,
+ 0x530a13e1bf2cdec2, 0x94c6837c4a7a9dce, 0x9e63d331fc6a6e49, 0x59af43ac093c2d45,
+ 0x799f52d7676f10de, 0xbe53c24a923953d2, 0xb4f692072429a055, 0x733a029ad17fe359,
+ 0xa1bc329c4808475b, 0x6670a201bd5e0457, 0x6cd5f24c0b4ef7d0, 0xab1962d1fe18b4dc,
+ 0x217c7771f144b137, 0xe6b0e7ec0412f23b, 0xec15b7a1b20201bc, 0x2bd9273c475442b0,
+ 0xf95f173ade23e6b2, 0x3e9387a72b75a5be, 0x3436d7ea9d655639, 0xf3fa477768331535,
+ 0xd3ca560c066028ae, 0x1406c691f3366ba2, 0x1ea396dc45269825, 0xd96f0641b070db29,
+ 0x0be9364729077f2b, 0xcc25a6dadc513c27, 0xc680f6976a41cfa0, 0x014c660a9f178cac,
+ 0x86e0d461b6e7b496, 0x412c44fc43b1f79a, 0x4b8914b1f5a1041d, 0x8c45842c00f74711,
+ 0x5ec3b42a9980e313, 0x990f24b76cd6a01f, 0x93aa74fadac65398, 0x5466e4672f901094,
+ 0x7456f51c41c32d0f, 0xb39a6581b4956e03, 0xb93f35cc02859d84, 0x7ef3a551f7d3de88,
+ 0xac7595576ea47a8a, 0x6bb905ca9bf23986, 0x611c55872de2ca01, 0xa6d0c51ad8b4890d,
+ 0x0000000000000000, 0x6e4d3e593561ee88, 0xdc9a7cb26ac3dd10, 0xb2d742eb5fa23398,
+ 0xfbc4188f7c6d8cb3, 0x958926d6490c623b, 0x275e643d16ae51a3, 0x49135a6423cfbf2b,
+ 0xb578d0f551312ff5, 0xdb35eeac6450c17d, 0x69e2ac473bf2f2e5, 0x07af921e0e931c6d,
+ 0x4ebcc87a2d5ca346, 0x20f1f623183d4dce, 0x9226b4c8479f7e56, 0xfc6b8a9172fe90de,
+ 0x280140010b886979, 0x464c7e583ee987f1, 0xf49b3cb3614bb469, 0x9ad602ea542a5ae1,
+ 0xd3c5588e77e5e5ca, 0xbd8866d742840b42, 0x0f5f243c1d2638da, 0x61121a652847d652,
+ 0x9d7990f45ab9468c, 0xf334aead6fd8a804, 0x41e3ec46307a9b9c, 0x2faed21f051b7514,
+ 0x66bd887b26d4ca3f, 0x08f0b62213b524b7, 0xba27f4c94c17172f, 0xd46aca907976f9a7,
+ 0x500280021710d2f2, 0x3e4fbe5b22713c7a, 0x8c98fcb07dd30fe2, 0xe2d5c2e948b2e16a,
+ 0xabc6988d6b7d5e41, 0xc58ba6d45e1cb0c9, 0x775ce43f01be8351, 0x1911da6634df6dd9,
+ 0xe57a50f74621fd07, 0x8b376eae7340138f, 0x39e02c452ce22017, 0x57ad121c1983ce9f,
+ 0x1ebe48783a4c71b4, 0x70f376210f2d9f3c, 0xc22434ca508faca4, 0xac690a9365ee422c,
+ 0x7803c0031c98bb8b, 0x164efe5a29f95503, 0xa499bcb1765b669b, 0xcad482e8433a8813,
+ 0x83c7d88c60f53738, 0xed8ae6d55594d9b0, 0x5f5da43e0a36ea28, 0x31109a673f5704a0,
+ 0xcd7b10f64da9947e, 0xa3362eaf78c87af6, 0x11e16c44276a496e, 0x7fac521d120ba7e6,
+ 0x36bf087931c418cd, 0x58f2362004a5f645, 0xea2574cb5b07c5dd, 0x84684a926e662b55,
+ 0xa00500042e21a5e4, 0xce483e5d1b404b6c, 0x7c9f7cb644e278f4, 0x12d242ef7183967c,
+ 0x5bc1188b524c2957, 0x358c26d2672dc7df, 0x875b6439388ff447, 0xe9165a600dee1acf,
+ 0x157dd0f17f108a11, 0x7b30eea84a716499, 0xc9e7ac4315d35701, 0xa7aa921a20b2b989,
+ 0xeeb9c87e037d06a2, 0x80f4f627361ce82a, 0x3223b4cc69bedbb2, 0x5c6e8a955cdf353a,
+ 0x8804400525a9cc9d, 0xe6497e5c10c82215, 0x549e3cb74f6a118d, 0x3ad302ee7a0bff05,
+ 0x73c0588a59c4402e, 0x1d8d66d36ca5aea6, 0xaf5a243833079d3e, 0xc1171a61066673b6,
+ 0x3d7c90f07498e368, 0x5331aea941f90de0, 0xe1e6ec421e5b3e78, 0x8fabd21b2b3ad0f0,
+ 0xc6b8887f08f56fdb, 0xa8f5b6263d948153, 0x1a22f4cd6236b2cb, 0x746fca9457575c43,
+ 0xf007800639317716, 0x9e4abe5f0c50999e, 0x2c9dfcb453f2aa06, 0x42d0c2ed6693448e,
+ 0x0bc39889455cfba5, 0x658ea6d0703d152d, 0xd759e43b2f9f26b5, 0xb914da621afec83d,
+ 0x457f50f3680058e3, 0x2b326eaa5d61b66b, 0x99e52c4102c385f3, 0xf7a8121837a26b7b,
+ 0xbebb487c146dd450, 0xd0f67625210c3ad8, 0x622134ce7eae0940, 0x0c6c0a974bcfe7c8,
+ 0xd806c00732b91e6f, 0xb64bfe5e07d8f0e7, 0x049cbcb5587ac37f, 0x6ad182ec6d1b2df7,
+ 0x23c2d8884ed492dc, 0x4d8fe6d17bb57c54, 0xff58a43a24174fcc, 0x91159a631176a144,
+ 0x6d7e10f26388319a, 0x03332eab56e9df12, 0xb1e46c40094bec8a, 0xdfa952193c2a0202,
+ 0x96ba087d1fe5bd29, 0xf8f736242a8453a1, 0x4a2074cf75266039, 0x246d4a9640478eb1,
+ 0x02fae1e3f5a97d5b, 0x6cb7dfbac0c893d3, 0xde609d519f6aa04b, 0xb02da308aa0b4ec3,
+ 0xf93ef96c89c4f1e8, 0x9773c735bca51f60, 0x25a485dee3072cf8, 0x4be9bb87d666c270,
+ 0xb7823116a49852ae, 0xd9cf0f4f91f9bc26, 0x6b184da4ce5b8fbe, 0x055573fdfb3a6136,
+ 0x4c462999d8f5de1d, 0x220b17c0ed943095, 0x90dc552bb236030d, 0xfe916b728757ed85,
+ 0x2afba1e2fe211422, 0x44b69fbbcb40faaa, 0xf661dd5094e2c932, 0x982ce309a18327ba,
+ 0xd13fb96d824c9891, 0xbf728734b72d7619, 0x0da5c5dfe88f4581, 0x63e8fb86ddeeab09,
+ 0x9f837117af103bd7, 0xf1ce4f4e9a71d55f, 0x43190da5c5d3e6c7, 0x2d5433fcf0b2084f,
+ 0x64476998d37db764, 0x0a0a57c1e61c59ec, 0xb8dd152ab9be6a74, 0xd6902b738cdf84fc,
+ 0x52f861e1e2b9afa9, 0x3cb55fb8d7d84121, 0x8e621d53887a72b9, 0xe02f230abd1b9c31,
+ 0xa93c796e9ed4231a, 0xc7714737abb5cd92, 0x75a605dcf417fe0a, 0x1beb3b85c1761082,
+ 0xe780b114b388805c, 0x89cd8f4d86e96ed4, 0x3b1acda6d94b5d4c, 0x5557f3ffec2ab3c4,
+ 0x1c44a99bcfe50cef, 0x720997c2fa84e267, 0xc0ded529a526d1ff, 0xae93eb7090473f77,
+ 0x7af921e0e931c6d0, 0x14b41fb9dc502858, 0xa6635d5283f21bc0, 0xc82e630bb693f548,
+ 0x813d396f955c4a63, 0xef700736a03da4eb, 0x5da745ddff9f9773, 0x33ea7b84cafe79fb,
+ 0xcf81f115b800e925, 0xa1cccf4c8d6107ad, 0x131b8da7d2c33435, 0x7d56b3fee7a2dabd,
+ 0x3445e99ac46d6596, 0x5a08d7c3f10c8b1e, 0xe8df9528aeaeb886, 0x8692ab719bcf560e,
+ 0xa2ffe1e7db88d8bf, 0xccb2dfbeeee93637, 0x7e659d55b14b05af, 0x1028a30c842aeb27,
+ 0x593bf968a7e5540c, 0x3776c7319284ba84, 0x85a185dacd26891c, 0xebecbb83f8476794,
+ 0x178731128ab9f74a, 0x79ca0f4bbfd819c2, 0xcb1d4da0e07a2a5a, 0xa55073f9d51bc4d2,
+ 0xec43299df6d47bf9, 0x820e17c4c3b59571, 0x30d9552f9c17a6e9, 0x5e946b76a9764861,
+ 0x8afea1e6d000b1c6, 0xe4b39fbfe5615f4e, 0x5664dd54bac36cd6, 0x3829e30d8fa2825e,
+ 0x713ab969ac6d3d75, 0x1f778730990cd3fd, 0xada0c5dbc6aee065, 0xc3edfb82f3cf0eed,
+ 0x3f86711381319e33, 0x51cb4f4ab45070bb, 0xe31c0da1ebf24323, 0x8d5133f8de93adab,
+ 0xc442699cfd5c1280, 0xaa0f57c5c83dfc08, 0x18d8152e979fcf90, 0x76952b77a2fe2118,
+ 0xf2fd61e5cc980a4d, 0x9cb05fbcf9f9e4c5, 0x2e671d57a65bd75d, 0x402a230e933a39d5,
+ 0x0939796ab0f586fe, 0x6774473385946876, 0xd5a305d8da365bee, 0xbbee3b81ef57b566,
+ 0x4785b1109da925b8, 0x29c88f49a8c8cb30, 0x9b1fcda2f76af8a8, 0xf552f3fbc20b1620,
+ 0xbc41a99fe1c4a90b, 0xd20c97c6d4a54783, 0x60dbd52d8b07741b, 0x0e96eb74be669a93,
+ 0xdafc21e4c7106334, 0xb4b11fbdf2718dbc, 0x06665d56add3be24, 0x682b630f98b250ac,
+ 0x2138396bbb7def87, 0x4f7507328e1c010f, 0xfda245d9d1be3297, 0x93ef7b80e4dfdc1f,
+ 0x6f84f11196214cc1, 0x01c9cf48a340a249, 0xb31e8da3fce291d1, 0xdd53b3fac9837f59,
+ 0x9440e99eea4cc072, 0xfa0dd7c7df2d2efa, 0x48da952c808f1d62, 0x2697ab75b5eef3ea,
+};
+
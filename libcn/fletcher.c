@@ -0,0 +1,244 @@
+/* 
+ * Copyright (c) 2012 Apple, Inc. All Rights Reserved.
+ * 
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+
+
+#include "crc.h"
+
+/*
+ * Fletcher-16 sums bytes modulo 255 and Fletcher-32 sums little-endian
+ * 16 bit words modulo 65535, with an odd trailing byte padded with zero.
+ * Both defer the modulo to the longest run that cannot overflow 32 bits.
+ */
+
+#define FLETCHER16_NMAX 5802
+#define FLETCHER32_NMAX 360 // in words
+
+// Fletcher-32 running values carry a byte left over from an odd length
+// update above the two sums.
+#define FLETCHER32_PENDING (1ULL << 32)
+#define FLETCHER32_PENDING_BYTE(crc) ((uint8_t) ((crc) >> 40))
+
+static uint64_t
+fletcher_setup(void) { return 0; }
+
+static uint64_t
+fletcher16_update(size_t len, const void *in, uint64_t crc)
+{
+    const uint8_t *p = in;
+    uint32_t c0 = crc & 0xff, c1 = (crc >> 8) & 0xff;
+    
+    while(len) {
+        size_t n = (len < FLETCHER16_NMAX) ? len : FLETCHER16_NMAX;
+        crc_byte_sums(p, n, &c0, &c1);
+        p += n;
+        len -= n;
+        c0 %= 255;
+        c1 %= 255;
+    }
+    return (c1 << 8) | c0;
+}
+
+static uint64_t
+fletcher16_final(size_t __unused length, uint64_t crc) { return crc; }
+
+static uint64_t
+fletcher16_oneshot(size_t len, const void *in)
+{
+    return fletcher16_update(len, in, fletcher_setup());
+}
+
+static void
+word_sums_scalar(const uint8_t *p, size_t words, uint32_t *sum1, uint32_t *sum2)
+{
+    uint32_t c0 = *sum1, c1 = *sum2;
+    
+    while(words--) {
+        c0 += p[0] | ((uint32_t) p[1] << 8);
+        c1 += c0;
+        p += 2;
+    }
+    *sum1 = c0;
+    *sum2 = c1;
+}
+
+#if CRC_X86_64
+#include <immintrin.h>
+
+/*
+ * Same scheme as the byte sums in adler32.c, over 16 words per block.  The
+ * low and high bytes of each word are weighted separately since pmaddubsw
+ * only takes bytes, and the high half is scaled by 256 when folding.
+ */
+
+#define WORD_SUMS_BLOCK 16
+
+CRC_TARGET("avx2")
+static void
+word_sums_avx2(const uint8_t *p, size_t blocks, uint32_t *sum1, uint32_t *sum2)
+{
+    const __m256i taps_lo = _mm256_setr_epi8(16, 0, 15, 0, 14, 0, 13, 0, 12, 0, 11, 0, 10, 0, 9, 0,
+                                             8, 0, 7, 0, 6, 0, 5, 0, 4, 0, 3, 0, 2, 0, 1, 0);
+    const __m256i taps_hi = _mm256_setr_epi8(0, 16, 0, 15, 0, 14, 0, 13, 0, 12, 0, 11, 0, 10, 0, 9,
+                                             0, 8, 0, 7, 0, 6, 0, 5, 0, 4, 0, 3, 0, 2, 0, 1);
+    const __m256i lo_mask = _mm256_set1_epi16(0x00ff);
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i vs1 = zero, vs2_lo = zero, vs2_hi = zero, vps = zero;
+    
+    for(size_t i=0; i<blocks; i++) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i *) (p + i * WORD_SUMS_BLOCK * 2));
+        __m256i lo = _mm256_sad_epu8(_mm256_and_si256(bytes, lo_mask), zero);
+        __m256i hi = _mm256_sad_epu8(_mm256_srli_epi16(bytes, 8), zero);
+        vps = _mm256_add_epi32(vps, vs1);
+        vs1 = _mm256_add_epi32(vs1, _mm256_add_epi32(lo, _mm256_slli_epi32(hi, 8)));
+        vs2_lo = _mm256_add_epi32(vs2_lo, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, taps_lo), ones));
+        vs2_hi = _mm256_add_epi32(vs2_hi, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, taps_hi), ones));
+    }
+    __m256i vs2 = _mm256_add_epi32(_mm256_add_epi32(vs2_lo, _mm256_slli_epi32(vs2_hi, 8)), _mm256_slli_epi32(vps, 4));
+    
+    __m128i s1 = _mm_add_epi32(_mm256_castsi256_si128(vs1), _mm256_extracti128_si256(vs1, 1));
+    __m128i s2 = _mm_add_epi32(_mm256_castsi256_si128(vs2), _mm256_extracti128_si256(vs2, 1));
+    s1 = _mm_add_epi32(s1, _mm_shuffle_epi32(s1, _MM_SHUFFLE(1, 0, 3, 2)));
+    s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, _MM_SHUFFLE(1, 0, 3, 2)));
+    s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, _MM_SHUFFLE(2, 3, 0, 1)));
+    *sum2 += (uint32_t) (*sum1 * blocks * WORD_SUMS_BLOCK) + (uint32_t) _mm_cvtsi128_si32(s2);
+    *sum1 += (uint32_t) _mm_cvtsi128_si32(s1);
+}
+
+CRC_TARGET("ssse3")
+static void
+word_sums_ssse3(const uint8_t *p, size_t blocks, uint32_t *sum1, uint32_t *sum2)
+{
+    const __m128i taps_lo1 = _mm_setr_epi8(16, 0, 15, 0, 14, 0, 13, 0, 12, 0, 11, 0, 10, 0, 9, 0);
+    const __m128i taps_lo2 = _mm_setr_epi8(8, 0, 7, 0, 6, 0, 5, 0, 4, 0, 3, 0, 2, 0, 1, 0);
+    const __m128i taps_hi1 = _mm_setr_epi8(0, 16, 0, 15, 0, 14, 0, 13, 0, 12, 0, 11, 0, 10, 0, 9);
+    const __m128i taps_hi2 = _mm_setr_epi8(0, 8, 0, 7, 0, 6, 0, 5, 0, 4, 0, 3, 0, 2, 0, 1);
+    const __m128i lo_mask = _mm_set1_epi16(0x00ff);
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i vs1 = zero, vs2_lo = zero, vs2_hi = zero, vps = zero;
+    
+    for(size_t i=0; i<blocks; i++) {
+        __m128i bytes1 = _mm_loadu_si128((const __m128i *) (p + i * WORD_SUMS_BLOCK * 2));
+        __m128i bytes2 = _mm_loadu_si128((const __m128i *) (p + i * WORD_SUMS_BLOCK * 2 + 16));
+        __m128i lo = _mm_add_epi32(_mm_sad_epu8(_mm_and_si128(bytes1, lo_mask), zero),
+                                   _mm_sad_epu8(_mm_and_si128(bytes2, lo_mask), zero));
+        __m128i hi = _mm_add_epi32(_mm_sad_epu8(_mm_srli_epi16(bytes1, 8), zero),
+                                   _mm_sad_epu8(_mm_srli_epi16(bytes2, 8), zero));
+        vps = _mm_add_epi32(vps, vs1);
+        vs1 = _mm_add_epi32(vs1, _mm_add_epi32(lo, _mm_slli_epi32(hi, 8)));
+        vs2_lo = _mm_add_epi32(vs2_lo, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, taps_lo1), ones));
+        vs2_lo = _mm_add_epi32(vs2_lo, _mm_madd_epi16(_mm_maddubs_epi16(bytes2, taps_lo2), ones));
+        vs2_hi = _mm_add_epi32(vs2_hi, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, taps_hi1), ones));
+        vs2_hi = _mm_add_epi32(vs2_hi, _mm_madd_epi16(_mm_maddubs_epi16(bytes2, taps_hi2), ones));
+    }
+    __m128i vs2 = _mm_add_epi32(_mm_add_epi32(vs2_lo, _mm_slli_epi32(vs2_hi, 8)), _mm_slli_epi32(vps, 4));
+    
+    vs1 = _mm_add_epi32(vs1, _mm_shuffle_epi32(vs1, _MM_SHUFFLE(1, 0, 3, 2)));
+    vs2 = _mm_add_epi32(vs2, _mm_shuffle_epi32(vs2, _MM_SHUFFLE(1, 0, 3, 2)));
+    vs2 = _mm_add_epi32(vs2, _mm_shuffle_epi32(vs2, _MM_SHUFFLE(2, 3, 0, 1)));
+    *sum2 += (uint32_t) (*sum1 * blocks * WORD_SUMS_BLOCK) + (uint32_t) _mm_cvtsi128_si32(vs2);
+    *sum1 += (uint32_t) _mm_cvtsi128_si32(vs1);
+}
+
+#endif /* CRC_X86_64 */
+
+static void
+word_sums(const uint8_t *p, size_t words, uint32_t *sum1, uint32_t *sum2)
+{
+#if CRC_X86_64
+    uint32_t features = crc_cpu_features();
+    
+    if(features & (CRC_CPU_AVX2 | CRC_CPU_SSSE3)) {
+        size_t blocks = words / WORD_SUMS_BLOCK;
+        if(features & CRC_CPU_AVX2) word_sums_avx2(p, blocks, sum1, sum2);
+        else word_sums_ssse3(p, blocks, sum1, sum2);
+        p += blocks * WORD_SUMS_BLOCK * 2;
+        words -= blocks * WORD_SUMS_BLOCK;
+    }
+#endif
+    word_sums_scalar(p, words, sum1, sum2);
+}
+
+static uint64_t
+fletcher32_update(size_t len, const void *in, uint64_t crc)
+{
+    const uint8_t *p = in;
+    uint32_t c0 = crc & 0xffff, c1 = (crc >> 16) & 0xffff;
+    
+    if(len == 0) return crc;
+    if(crc & FLETCHER32_PENDING) {
+        c0 += FLETCHER32_PENDING_BYTE(crc) | ((uint32_t) *p++ << 8);
+        c1 += c0;
+        c0 %= 65535;
+        c1 %= 65535;
+        len--;
+    }
+    while(len >= 2) {
+        size_t n = (len / 2 < FLETCHER32_NMAX) ? len / 2 : FLETCHER32_NMAX;
+        word_sums(p, n, &c0, &c1);
+        p += n * 2;
+        len -= n * 2;
+        c0 %= 65535;
+        c1 %= 65535;
+    }
+    crc = ((uint64_t) c1 << 16) | c0;
+    if(len) crc |= FLETCHER32_PENDING | ((uint64_t) *p << 40);
+    return crc;
+}
+
+static uint64_t
+fletcher32_final(size_t __unused length, uint64_t crc)
+{
+    uint32_t c0 = crc & 0xffff, c1 = (crc >> 16) & 0xffff;
+    
+    if(crc & FLETCHER32_PENDING) {
+        c0 = (c0 + FLETCHER32_PENDING_BYTE(crc)) % 65535;
+        c1 = (c1 + c0) % 65535;
+    }
+    return ((uint64_t) c1 << 16) | c0;
+}
+
+static uint64_t
+fletcher32_oneshot(size_t len, const void *in)
+{
+    return fletcher32_final(len, fletcher32_update(len, in, fletcher_setup()));
+}
+
+const crcDescriptor fletcher16 = {
+    .name = "fletcher-16",
+    .defType = functions,
+    .def.funcs.setup = fletcher_setup,
+    .def.funcs.update = fletcher16_update,
+    .def.funcs.final = fletcher16_final,
+    .def.funcs.oneshot = fletcher16_oneshot
+};
+
+const crcDescriptor fletcher32 = {
+    .name = "fletcher-32",
+    .defType = functions,
+    .def.funcs.setup = fletcher_setup,
+    .def.funcs.update = fletcher32_update,
+    .def.funcs.final = fletcher32_final,
+    .def.funcs.oneshot = fletcher32_oneshot
+};
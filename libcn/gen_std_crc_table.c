@@ -46,23 +46,90 @@ cm_tab(crcDescriptorPtr crcdesc, uint8_t index)
     return retval & mask;
 }
 
-void
-gen_std_crc_table(void *c)
+static inline uint64_t
+crc_table_get(const void *table, size_t width, size_t i)
 {
-    crcInfoPtr crc = c;
+    switch (width) {
+        case 1: return ((const uint8_t *) table)[i];
+        case 2: return ((const uint16_t *) table)[i];
+        case 4: return ((const uint32_t *) table)[i];
+        case 8: return ((const uint64_t *) table)[i];
+    }
+    return 0;
+}
+
+static inline void
+crc_table_set(void *table, size_t width, size_t i, uint64_t value)
+{
+    switch (width) {
+        case 1: ((uint8_t *) table)[i] = (uint8_t) value; break;
+        case 2: ((uint16_t *) table)[i] = (uint16_t) value; break;
+        case 4: ((uint32_t *) table)[i] = (uint32_t) value; break;
+        case 8: ((uint64_t *) table)[i] = (uint64_t) value; break;
+    }
+}
+
+/*
+ * Slice k of the table is slice k-1 advanced by one more zero byte.  This lets
+ * the update kernels fold eight input bytes per iteration with independent
+ * lookups instead of a serial byte-by-byte chain.
+ */
+
+static void
+gen_slice_tables(crcDescriptorPtr crcdesc, void *table)
+{
+    size_t width = crcdesc->def.parms.width;
+    uint64_t mask = descmaskfunc(crcdesc);
+    int reflected = crcdesc->def.parms.reflect_reverse;
     
-    size_t width = crc->descriptor->def.parms.width;
-    if((crc->table.bytes = malloc(width * 256)) == NULL) return;
+    for(size_t k=1; k<CRC_SLICES; k++) {
+        for(size_t i=0; i<256; i++) {
+            uint64_t prev = crc_table_get(table, width, CRC_SLICE(k-1) + i);
+            uint64_t next;
+            if(reflected) next = (prev >> 8) ^ crc_table_get(table, width, prev & 0xff);
+            else next = ((prev << 8) & mask) ^ crc_table_get(table, width, (prev >> (width*8-8)) & 0xff);
+            crc_table_set(table, width, CRC_SLICE(k) + i, next);
+        }
+    }
+}
+
+void *
+gen_crc_table(crcDescriptorPtr crcdesc)
+{
+    size_t width = crcdesc->def.parms.width;
+    void *table;
+    
+    if((table = malloc(width * 256 * CRC_SLICES)) == NULL) return NULL;
     for(int i=0; i<256; i++){
         uint8_t c8 = i&0xFF;
-        switch (width) {
-            case 1: crc->table.bytes[i] = (uint8_t) cm_tab(crc->descriptor, c8); break;
-            case 2: crc->table.b16[i] = (uint16_t) cm_tab(crc->descriptor, c8); break;
-            case 4: crc->table.b32[i] = (uint32_t) cm_tab(crc->descriptor, c8); break;
-            case 8: crc->table.b64[i] = (uint64_t) cm_tab(crc->descriptor, c8); break;
-        }
+        crc_table_set(table, width, i, cm_tab(crcdesc, c8));
     }
+    gen_slice_tables(crcdesc, table);
+    return table;
+}
+
+/*
+ * The built-in models point at the read-only tables in crc_tables.c; only
+ * models without one pay for generating their tables on first use.  The
+ * update kernel is resolved here too so the per call path has no width or
+ * reflection branches left.
+ */
+
+void
+gen_std_crc_table(void *c)
+{
+    crcInfoPtr crc = c;
     
+    if((crc->table.bytes = crc->descriptor->def.parms.table) == NULL &&
+       (crc->table.bytes = gen_crc_table(crc->descriptor)) == NULL) return;
+    crc_clmul_init(crc);
+    if(crc->descriptor->def.parms.reflect_reverse) {
+        crc->update = crc_reverse_select(crc->descriptor->def.parms.width, crc->fold.enabled);
+        crc->batch = crc_reverse_select_batch(crc->descriptor->def.parms.width);
+    } else {
+        crc->update = crc_normal_select(crc->descriptor->def.parms.width, crc->fold.enabled);
+        crc->batch = crc_normal_select_batch(crc->descriptor->def.parms.width);
+    }
 }
 
 static char * cc_strndup (char const *s, size_t n)
@@ -88,13 +155,13 @@ dump_crc_table(crcInfoPtr crc)
     for(size_t i=0; i<strlen(name); i++) if(name[i] == '-') name[i] = '_';
     
     switch (width) {
-        case 1: printf("const uint8_t %s_crc_table[] = {\n", name); per_line = 16; break;
-        case 2: printf("const uint16_t %s_crc_table[] = {\n", name); per_line = 8; break;
-        case 4: printf("const uint32_t %s_crc_table[] = {\n", name); per_line = 8; break;
-        case 8: printf("const uint64_t %s_crc_table[] = {\n", name); per_line = 4; break;
+        case 1: printf("const uint8_t %s_crc_table[CRC_SLICES * 256] = {\n", name); per_line = 16; break;
+        case 2: printf("const uint16_t %s_crc_table[CRC_SLICES * 256] = {\n", name); per_line = 8; break;
+        case 4: printf("const uint32_t %s_crc_table[CRC_SLICES * 256] = {\n", name); per_line = 8; break;
+        case 8: printf("const uint64_t %s_crc_table[CRC_SLICES * 256] = {\n", name); per_line = 4; break;
     }
     
-    for(int i=0; i<256; i++) {
+    for(int i=0; i<CRC_SLICES * 256; i++) {
         switch (width) {
             case 1: printf(" 0x%02x,", crc->table.bytes[i]); break;
             case 2: printf(" 0x%04x,", crc->table.b16[i]); break;
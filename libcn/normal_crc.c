@@ -33,49 +33,129 @@ crc_normal_init(crcInfoPtr crc)
 }
 
 static inline uint8_t
-crc_table_value8(uint8_t *table, uint8_t p, uint8_t crc) {
+crc_table_value8(const uint8_t *table, uint8_t p, uint8_t crc) {
     uint8_t t = (uint8_t) (crc << 8);
     return table[((crc) ^ p) & 0xff] ^ t;
 }
 
 static inline uint16_t
-crc_table_value16(uint16_t *table, uint8_t p, uint16_t crc) {
+crc_table_value16(const uint16_t *table, uint8_t p, uint16_t crc) {
     uint16_t t = (uint16_t) (crc << 8);
     return table[((crc>>8) ^ p) & 0xff] ^ t;
 }
 
 static inline uint32_t
-crc_table_value32(uint32_t *table, uint8_t p, uint32_t crc) {
+crc_table_value32(const uint32_t *table, uint8_t p, uint32_t crc) {
     return table[((crc>>24) ^ p) & 0xff] ^ (crc << 8);
 }
 
 static inline uint64_t
-crc_table_value64(uint64_t *table, uint8_t p, uint64_t crc) {
+crc_table_value64(const uint64_t *table, uint8_t p, uint64_t crc) {
     return table[((crc>>56) ^ p) & 0xffULL] ^ (crc << 8);
 }
 
 
-uint64_t
-crc_normal_update(crcInfoPtr crc, uint8_t *p, size_t len, uint64_t current)
+/*
+ * Slicing-by-8: the register is XORed into the leading bytes of a big-endian
+ * 64 bit word and each byte of the word is resolved through its own slice.
+ * Each width also gets the two entry points crcInfo.update is resolved to at
+ * table init: a plain table walk and one that hands long buffers to the fold,
+ * and a batch kernel that walks CRC_BATCH_LANES buffers in lock step.
+ */
+
+#define CRC_NORMAL_UPDATE(BITS, TYPE, TABLE) \
+static inline TYPE \
+crc_normal_slice##BITS(const TYPE *table, uint64_t x) \
+{ \
+    return (TYPE) (table[CRC_SLICE(7) + (x >> 56)] ^ \
+                   table[CRC_SLICE(6) + ((x >> 48) & 0xff)] ^ \
+                   table[CRC_SLICE(5) + ((x >> 40) & 0xff)] ^ \
+                   table[CRC_SLICE(4) + ((x >> 32) & 0xff)] ^ \
+                   table[CRC_SLICE(3) + ((x >> 24) & 0xff)] ^ \
+                   table[CRC_SLICE(2) + ((x >> 16) & 0xff)] ^ \
+                   table[CRC_SLICE(1) + ((x >> 8) & 0xff)] ^ \
+                   table[CRC_SLICE(0) + (x & 0xff)]); \
+} \
+\
+static uint64_t \
+crc_normal_update##BITS(const TYPE *table, const uint8_t *p, size_t len, TYPE crc) \
+{ \
+    while (len >= 8) { \
+        crc = crc_normal_slice##BITS(table, crc_load64_be(p) ^ ((uint64_t) crc << (64 - BITS))); \
+        p += 8; len -= 8; \
+    } \
+    while (len--) crc = crc_table_value##BITS(table, *p++, crc); \
+    return crc; \
+} \
+\
+static void \
+crc_normal_batch##BITS(crcInfoPtr crc, const uint8_t *const *p, size_t len, uint64_t *current) \
+{ \
+    const TYPE *table = crc->table.TABLE; \
+    TYPE c[CRC_BATCH_LANES]; \
+    size_t off = 0; \
+    \
+    for(int j=0; j<CRC_BATCH_LANES; j++) c[j] = (TYPE) current[j]; \
+    for(; off + 8 <= len; off += 8) \
+        for(int j=0; j<CRC_BATCH_LANES; j++) c[j] = crc_normal_slice##BITS(table, crc_load64_be(p[j] + off) ^ ((uint64_t) c[j] << (64 - BITS))); \
+    for(; off < len; off++) \
+        for(int j=0; j<CRC_BATCH_LANES; j++) c[j] = crc_table_value##BITS(table, p[j][off], c[j]); \
+    for(int j=0; j<CRC_BATCH_LANES; j++) current[j] = c[j]; \
+} \
+\
+static uint64_t \
+crc_normal_table##BITS(crcInfoPtr crc, const uint8_t *p, size_t len, uint64_t current) \
+{ \
+    return crc_normal_update##BITS(crc->table.TABLE, p, len, (TYPE) current); \
+} \
+\
+static uint64_t \
+crc_normal_fold##BITS(crcInfoPtr crc, const uint8_t *p, size_t len, uint64_t current) \
+{ \
+    if(len >= CRC_CLMUL_MIN) return crc_clmul_update(crc, p, len, current); \
+    return crc_normal_update##BITS(crc->table.TABLE, p, len, (TYPE) current); \
+}
+
+CRC_NORMAL_UPDATE(8, uint8_t, bytes)
+CRC_NORMAL_UPDATE(16, uint16_t, b16)
+CRC_NORMAL_UPDATE(32, uint32_t, b32)
+CRC_NORMAL_UPDATE(64, uint64_t, b64)
+
+crc_update_p
+crc_normal_select(size_t width, int fold)
 {
-    while (len--) {
-        switch (crc->descriptor->def.parms.width) {
-            case 1: current = crc_table_value8(crc->table.bytes, *p, (uint8_t) current); break;
-            case 2: current = crc_table_value16(crc->table.b16, *p, (uint16_t) current); break;
-            case 4: current = crc_table_value32(crc->table.b32, *p, (uint32_t) current); break;
-            case 8: current = crc_table_value64(crc->table.b64, *p, current); break;
-        }
-        p++;
+    switch (width) {
+        case 1: return fold ? crc_normal_fold8 : crc_normal_table8;
+        case 2: return fold ? crc_normal_fold16 : crc_normal_table16;
+        case 4: return fold ? crc_normal_fold32 : crc_normal_table32;
+        case 8: return fold ? crc_normal_fold64 : crc_normal_table64;
     }
-    return current & descmaskfunc(crc->descriptor);
+    return NULL;
 }
 
+crc_batch_p
+crc_normal_select_batch(size_t width)
+{
+    switch (width) {
+        case 1: return crc_normal_batch8;
+        case 2: return crc_normal_batch16;
+        case 4: return crc_normal_batch32;
+        case 8: return crc_normal_batch64;
+    }
+    return NULL;
+}
+
+uint64_t
+crc_normal_update(crcInfoPtr crc, uint8_t *p, size_t len, uint64_t current)
+{
+    return crc->update(crc, p, len, current);
+}
 
 uint64_t
 crc_normal_final(crcInfoPtr crc, uint64_t current)
 {
     current = (current ^ crc->descriptor->def.parms.final_xor) & descmaskfunc(crc->descriptor);
-    return current;
+    return current >> crc->descriptor->def.parms.pad;
 }
 
  uint64_t
@@ -34,38 +34,119 @@ crc_reverse_init(crcInfoPtr crc)
 }
 
 static inline uint8_t
-crc_table_value8(uint8_t *table, uint8_t p, uint8_t crc) {
+crc_table_value8(const uint8_t *table, uint8_t p, uint8_t crc) {
     return table[(crc ^ p)  & 0xff] ^ (crc >> 8);
 }
 
 static inline uint16_t
-crc_table_value16(uint16_t *table, uint8_t p, uint16_t crc) {
+crc_table_value16(const uint16_t *table, uint8_t p, uint16_t crc) {
     return table[(crc ^ p)  & 0xff] ^ (crc >> 8);
 }
 
 static inline uint32_t
-crc_table_value32(uint32_t *table, uint8_t p, uint32_t crc) {
+crc_table_value32(const uint32_t *table, uint8_t p, uint32_t crc) {
     return table[(crc ^ p)  & 0xff] ^ (crc >> 8);
 }
 
 static inline uint64_t
-crc_table_value64(uint64_t *table, uint8_t p, uint64_t crc) {
+crc_table_value64(const uint64_t *table, uint8_t p, uint64_t crc) {
     return table[(crc ^ p)  & 0xffLL] ^ (crc >> 8);
 }
 
+/*
+ * Slicing-by-8: the register is XORed into the low bytes of a little-endian
+ * 64 bit word and each byte of the word is resolved through its own slice.
+ * Each width also gets the two entry points crcInfo.update is resolved to at
+ * table init: a plain table walk and one that hands long buffers to the fold,
+ * and a batch kernel that walks CRC_BATCH_LANES buffers in lock step.
+ */
+
+#define CRC_REVERSE_UPDATE(BITS, TYPE, TABLE) \
+static inline TYPE \
+crc_reverse_slice##BITS(const TYPE *table, uint64_t x) \
+{ \
+    return (TYPE) (table[CRC_SLICE(7) + (x & 0xff)] ^ \
+                   table[CRC_SLICE(6) + ((x >> 8) & 0xff)] ^ \
+                   table[CRC_SLICE(5) + ((x >> 16) & 0xff)] ^ \
+                   table[CRC_SLICE(4) + ((x >> 24) & 0xff)] ^ \
+                   table[CRC_SLICE(3) + ((x >> 32) & 0xff)] ^ \
+                   table[CRC_SLICE(2) + ((x >> 40) & 0xff)] ^ \
+                   table[CRC_SLICE(1) + ((x >> 48) & 0xff)] ^ \
+                   table[CRC_SLICE(0) + (x >> 56)]); \
+} \
+\
+static uint64_t \
+crc_reverse_update##BITS(const TYPE *table, const uint8_t *p, size_t len, TYPE crc) \
+{ \
+    while (len >= 8) { \
+        crc = crc_reverse_slice##BITS(table, crc_load64_le(p) ^ crc); \
+        p += 8; len -= 8; \
+    } \
+    while (len--) crc = crc_table_value##BITS(table, *p++, crc); \
+    return crc; \
+} \
+\
+static void \
+crc_reverse_batch##BITS(crcInfoPtr crc, const uint8_t *const *p, size_t len, uint64_t *current) \
+{ \
+    const TYPE *table = crc->table.TABLE; \
+    TYPE c[CRC_BATCH_LANES]; \
+    size_t off = 0; \
+    \
+    for(int j=0; j<CRC_BATCH_LANES; j++) c[j] = (TYPE) current[j]; \
+    for(; off + 8 <= len; off += 8) \
+        for(int j=0; j<CRC_BATCH_LANES; j++) c[j] = crc_reverse_slice##BITS(table, crc_load64_le(p[j] + off) ^ c[j]); \
+    for(; off < len; off++) \
+        for(int j=0; j<CRC_BATCH_LANES; j++) c[j] = crc_table_value##BITS(table, p[j][off], c[j]); \
+    for(int j=0; j<CRC_BATCH_LANES; j++) current[j] = c[j]; \
+} \
+\
+static uint64_t \
+crc_reverse_table##BITS(crcInfoPtr crc, const uint8_t *p, size_t len, uint64_t current) \
+{ \
+    return crc_reverse_update##BITS(crc->table.TABLE, p, len, (TYPE) current); \
+} \
+\
+static uint64_t \
+crc_reverse_fold##BITS(crcInfoPtr crc, const uint8_t *p, size_t len, uint64_t current) \
+{ \
+    if(len >= CRC_CLMUL_MIN) return crc_clmul_update(crc, p, len, current); \
+    return crc_reverse_update##BITS(crc->table.TABLE, p, len, (TYPE) current); \
+}
+
+CRC_REVERSE_UPDATE(8, uint8_t, bytes)
+CRC_REVERSE_UPDATE(16, uint16_t, b16)
+CRC_REVERSE_UPDATE(32, uint32_t, b32)
+CRC_REVERSE_UPDATE(64, uint64_t, b64)
+
+crc_update_p
+crc_reverse_select(size_t width, int fold)
+{
+    switch (width) {
+        case 1: return fold ? crc_reverse_fold8 : crc_reverse_table8;
+        case 2: return fold ? crc_reverse_fold16 : crc_reverse_table16;
+        case 4: return fold ? crc_reverse_fold32 : crc_reverse_table32;
+        case 8: return fold ? crc_reverse_fold64 : crc_reverse_table64;
+    }
+    return NULL;
+}
+
+crc_batch_p
+crc_reverse_select_batch(size_t width)
+{
+    switch (width) {
+        case 1: return crc_reverse_batch8;
+        case 2: return crc_reverse_batch16;
+        case 4: return crc_reverse_batch32;
+        case 8: return crc_reverse_batch64;
+    }
+    return NULL;
+}
+
 uint64_t
 crc_reverse_update(crcInfoPtr crc, uint8_t *p, size_t len, uint64_t current)
 {
-    while (len--) {
-        switch (crc->descriptor->def.parms.width) {
-            case 1: current = crc_table_value8(crc->table.bytes, *p, (uint8_t) current); break;
-            case 2: current = crc_table_value16(crc->table.b16, *p, (uint16_t) current); break;
-            case 4: current = crc_table_value32(crc->table.b32, *p, (uint32_t) current); break;
-            case 8: current = crc_table_value64(crc->table.b64, *p, current); break;
-        }
-        p++;
-    }
-    return current;
+    return crc->update(crc, p, len, current);
 }
 
 uint64_t
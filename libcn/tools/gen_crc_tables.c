@@ -0,0 +1,77 @@
+/* 
+ * Copyright (c) 2012 Apple, Inc. All Rights Reserved.
+ * 
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+
+
+/*
+ * Emits crc_tables.c, the read-only slicing tables shared by the built-in
+ * CRC models.  Models with the same width, polynomial and reflection use
+ * identical tables, so only one is generated for each combination.
+ *
+ *   cd libcn && cc -I. -o /tmp/gen_crc_tables tools/gen_crc_tables.c \
+ *       gen_std_crc_table.c normal_crc.c reverse_crc.c crc_clmul.c \
+ *       crc_combine.c crc_cpu.c reflect.c
+ *   /tmp/gen_crc_tables > crc_tables.c
+ */
+
+#include "crc.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TABLE_MODEL(NAME, WIDTH, POLY, REFLECT) \
+    { .name = NAME, .defType = model, .def.parms.width = WIDTH, \
+      .def.parms.poly = POLY, .def.parms.reflect_reverse = REFLECT }
+
+static const crcDescriptor tableModels[] = {
+    TABLE_MODEL("crc8-07", 1, 0x07, NO_REFLECT_REVERSE),
+    TABLE_MODEL("crc8-07-reflected", 1, 0x07, REFLECT_REVERSE),
+    TABLE_MODEL("crc8-1d", 1, 0x1D, NO_REFLECT_REVERSE),
+    TABLE_MODEL("crc8-9b-reflected", 1, 0x9B, REFLECT_REVERSE),
+    TABLE_MODEL("crc16-0589", 2, 0x0589, NO_REFLECT_REVERSE),
+    TABLE_MODEL("crc16-1021", 2, 0x1021, NO_REFLECT_REVERSE),
+    TABLE_MODEL("crc16-1021-reflected", 2, 0x1021, REFLECT_REVERSE),
+    TABLE_MODEL("crc16-8005", 2, 0x8005, NO_REFLECT_REVERSE),
+    TABLE_MODEL("crc16-8005-reflected", 2, 0x8005, REFLECT_REVERSE),
+    TABLE_MODEL("crc16-8408-reflected", 2, 0x8408, REFLECT_REVERSE),
+    TABLE_MODEL("crc32-000000af", 4, 0x000000AF, NO_REFLECT_REVERSE),
+    TABLE_MODEL("crc32-04c11db7", 4, 0x04C11DB7, NO_REFLECT_REVERSE),
+    TABLE_MODEL("crc32-04c11db7-reflected", 4, 0x04C11DB7, REFLECT_REVERSE),
+    TABLE_MODEL("crc32-1edc6f41-reflected", 4, 0x1EDC6F41, REFLECT_REVERSE),
+    TABLE_MODEL("crc32-864cfb00", 4, 0x864CFB00, NO_REFLECT_REVERSE),
+    TABLE_MODEL("crc64-42f0e1eba9ea3693", 8, 0x42F0E1EBA9EA3693, NO_REFLECT_REVERSE),
+};
+
+#define TABLE_MODEL_COUNT (sizeof(tableModels) / sizeof(tableModels[0]))
+
+int
+main(void)
+{
+    printf("/*\n * Generated by tools/gen_crc_tables.c -- do not edit.\n */\n\n");
+    printf("#include \"crc.h\"\n\n");
+    for(size_t i=0; i<TABLE_MODEL_COUNT; i++) {
+        crcInfo crc = { .descriptor = &tableModels[i] };
+        if((crc.table.bytes = gen_crc_table(crc.descriptor)) == NULL) return 1;
+        dump_crc_table(&crc);
+        free((void *) crc.table.bytes);
+    }
+    return 0;
+}